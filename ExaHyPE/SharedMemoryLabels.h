@@ -17,6 +17,12 @@
 #include "peano/datatraversal/autotuning/MethodTrace.h"
 
 
+/**
+ * Labels of the loops which the generic kernels may split among the threads.
+ * The kernels pass them to kernels::parallelFor which only queries the
+ * oracle if the kernels::KernelScheduler decided for intra-cell
+ * parallelism.
+ */
 namespace sharedmemorylabels {
   const auto GenericKernelsTrivialGuessLoop                = peano::datatraversal::autotuning::MethodTrace::UserDefined20;
   const auto GenericKernelsComputeOldSolutionsImpactOnRhs  = peano::datatraversal::autotuning::MethodTrace::UserDefined21;
@@ -598,6 +598,133 @@ bool   exahype::Parser::getSpawnDoubleCompressionAsBackgroundTask() const {
 }
 
 
+bool exahype::Parser::getNonBlockingTimeStepDataReduction() const {
+  std::string token =
+      getTokenAfter("optimisation", "non-blocking-time-step-reduction");
+
+  if (token.compare(_noTokenFound) == 0) {
+    return false;  // default value
+  }
+  else {
+    logDebug("getNonBlockingTimeStepDataReduction()",
+           "found non-blocking-time-step-reduction " << token);
+    if (token.compare("on") != 0 && token.compare("off") != 0) {
+      logError("getNonBlockingTimeStepDataReduction()",
+             "non-blocking-time-step-reduction is required in the "
+             "optimisation segment and has to be either on or off: "
+                 << token);
+      _interpretationErrorOccured = true;
+    }
+
+    return token.compare("on") == 0;
+  }
+}
+
+bool exahype::Parser::getSpeculativeTimeStepBatching() const {
+  std::string token =
+      getTokenAfter("optimisation", "speculative-time-step-batching");
+
+  if (token.compare(_noTokenFound) == 0) {
+    return false;  // default value
+  }
+  else {
+    logDebug("getSpeculativeTimeStepBatching()",
+           "found speculative-time-step-batching " << token);
+    if (token.compare("on") != 0 && token.compare("off") != 0) {
+      logError("getSpeculativeTimeStepBatching()",
+             "speculative-time-step-batching is required in the "
+             "optimisation segment and has to be either on or off: "
+                 << token);
+      _interpretationErrorOccured = true;
+    }
+
+    return token.compare("on") == 0;
+  }
+}
+
+std::string exahype::Parser::getOutOfCoreDirectory() const {
+  std::string token = getTokenAfter("optimisation", "out-of-core-directory");
+
+  if (token.compare(_noTokenFound) == 0) {
+    return "";  // default value
+  }
+  else {
+    logDebug("getOutOfCoreDirectory()", "found out-of-core-directory " << token);
+    return token;
+  }
+}
+
+int exahype::Parser::getOutOfCoreWindow() const {
+  std::string token = getTokenAfter("optimisation", "out-of-core-window");
+
+  if (token.compare(_noTokenFound) == 0) {
+    return 1024;  // default value
+  }
+  else {
+    logDebug("getOutOfCoreWindow()", "found out-of-core-window " << token);
+    int result = atoi(token.c_str());
+    if (result <= 0) {
+      logError("getOutOfCoreWindow()",
+               "out-of-core-window has to be a positive number of MB: " << token);
+      _interpretationErrorOccured = true;
+    }
+    return result;
+  }
+}
+
+std::string exahype::Parser::getPerformanceReportFile() const {
+  std::string token = getTokenAfter("optimisation", "performance-report-file");
+
+  if (token.compare(_noTokenFound) == 0) {
+    return "";  // default value
+  }
+  else {
+    logDebug("getPerformanceReportFile()", "found performance-report-file " << token);
+    return token;
+  }
+}
+
+int exahype::Parser::getPerformanceReportInterval() const {
+  std::string token = getTokenAfter("optimisation", "performance-report-interval");
+
+  if (token.compare(_noTokenFound) == 0) {
+    return 0;  // default value
+  }
+  else {
+    logDebug("getPerformanceReportInterval()", "found performance-report-interval " << token);
+    int result = atoi(token.c_str());
+    if (result < 0) {
+      logError("getPerformanceReportInterval()",
+               "performance-report-interval has to be a non-negative number of time steps: " << token);
+      _interpretationErrorOccured = true;
+    }
+    return result;
+  }
+}
+
+
+exahype::solvers::StoragePrecision exahype::Parser::getStoragePrecision(const std::string& arrayName) const {
+  const std::string key = arrayName + "-precision";
+  std::string token = getTokenAfter("optimisation", key);
+
+  if (token.compare(_noTokenFound) == 0) {
+    return exahype::solvers::StoragePrecision::Double;  // default value
+  }
+  else {
+    logDebug("getStoragePrecision()", "found " << key << " " << token);
+    bool valid = true;
+    exahype::solvers::StoragePrecision result =
+        exahype::solvers::convertToStoragePrecision(token,valid);
+    if (!valid) {
+      logError("getStoragePrecision()",
+             key << " has to be either double, single, or bfloat16: " << token);
+      _interpretationErrorOccured = true;
+    }
+    return result;
+  }
+}
+
+
 exahype::solvers::Solver::Type exahype::Parser::getType(
     int solverNumber) const {
   std::string token;
@@ -28,6 +28,7 @@ class Parser;
 #include "tarch/logging/Log.h"
 
 #include "exahype/solvers/Solver.h"
+#include "exahype/solvers/MixedPrecision.h"
 
 /**
  * ExaHyPE command line parser
@@ -242,6 +243,55 @@ class exahype::Parser {
   double getDoubleCompressionFactor() const;
   bool   getSpawnDoubleCompressionAsBackgroundTask() const;
 
+  /**
+   * \return Indicates if the global time step data shall be reduced
+   * with a non-blocking all-reduce instead of the master-worker
+   * reduction and broadcast. Optional entry; defaults to off.
+   */
+  bool getNonBlockingTimeStepDataReduction() const;
+
+  /**
+   * \return Indicates if runs with global (non-fixed) time stepping
+   * may batch several fused time steps speculatively.
+   * Optional entry; defaults to off.
+   */
+  bool getSpeculativeTimeStepBatching() const;
+
+  /**
+   * \return The node-local directory the compressed unknowns are moved
+   * to in between two traversals. Reads the optional entry
+   * out-of-core-directory; returns an empty string if it is not set.
+   */
+  std::string getOutOfCoreDirectory() const;
+
+  /**
+   * \return The memory in MB the out-of-core storage may keep resident.
+   * Optional entry out-of-core-window; defaults to 1024.
+   */
+  int getOutOfCoreWindow() const;
+
+  /**
+   * \return The file the performance report is appended to.
+   * Reads the optional entry performance-report-file; returns an
+   * empty string if it is not set, i.e. if no report shall be written.
+   */
+  std::string getPerformanceReportFile() const;
+
+  /**
+   * \return The number of time steps in between two performance reports.
+   * Optional entry performance-report-interval; defaults to 0, i.e. the
+   * report is written at the end of the simulation only.
+   */
+  int getPerformanceReportInterval() const;
+
+  /**
+   * \return The precision the array \p arrayName (e.g. "previous-solution")
+   * is stored and communicated in. Reads the optional entry
+   * <arrayName>-precision from the optimisation section. Valid values are
+   * double, single, and bfloat16. Defaults to double.
+   */
+  exahype::solvers::StoragePrecision getStoragePrecision(const std::string& arrayName) const;
+
   /**
    * If we batch time steps, we can in principle switch off the boundary data
    * exchange, as ExaHyPE's data flow is realised through heaps. However, if we
@@ -366,10 +366,12 @@ void exahype::adapters::LimiterStatusSpreading2MultiscaleLinkedCell_0::enterCell
 ) {
   dfor2(k)
     if (fineGridVertices[fineGridVerticesEnumerator(k)].isHangingNode()) {
-      multiscalelinkedcell::HangingVertexBookkeeper::getInstance().getAdjacencyEntriesOfVertex( 
+      multiscalelinkedcell::HangingVertexBookkeeper::getInstance().setAdjacencyEntryOfVertex(
         fineGridVerticesEnumerator.getVertexPosition(k),
-        fineGridVerticesEnumerator.getLevel()
-      )(TWO_POWER_D-kScalar-1) = fineGridCell.getCellDescriptionsIndex();
+        fineGridVerticesEnumerator.getLevel(),
+        TWO_POWER_D-kScalar-1,
+        fineGridCell.getCellDescriptionsIndex()
+      );
     }
     else {
       VertexOperations::writeCellDescriptionsIndex(
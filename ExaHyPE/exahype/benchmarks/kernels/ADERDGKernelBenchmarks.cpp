@@ -0,0 +1,368 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/benchmarks/kernels/KernelBenchmarks.h"
+
+#ifdef KernelBenchmarks
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "tarch/la/Vector.h"
+#include "tarch/la/ScalarOperations.h"
+
+#include "kernels/aderdg/generic/Kernels.h"
+#include "kernels/KernelUtils.h"
+
+#include "exahype/benchmarks/kernels/SyntheticSolvers.h"
+
+namespace {
+  /**
+   * Highest order that is benchmarked. The generic kernels and the
+   * quadrature tables support orders up to 9.
+   */
+  constexpr int MaxOrder = 9;
+
+  /**
+   * Sizes of the heap and temporary arrays of an ADER-DG cell. Mirrors the
+   * sizes exahype::solvers::ADERDGSolver hands out to the generic kernels
+   * (without material parameters). The temporary arrays are sized for the
+   * padded variable dimension.
+   */
+  struct ADERDGSizes {
+    int basisSize;
+    int dataPerFace;
+    int dataPerCell;
+    int tempUnknownsPerCell;
+    int tempFluxUnknownsPerCell;
+    int tempSpaceTimeUnknownsPerCell;
+    int tempSpaceTimeFluxUnknownsPerCell;
+
+    ADERDGSizes(const int order,const int numberOfVariables) {
+      basisSize                        = order+1;
+      dataPerFace                      = numberOfVariables*tarch::la::aPowI(DIMENSIONS-1,basisSize);
+      dataPerCell                      = numberOfVariables*tarch::la::aPowI(DIMENSIONS,basisSize);
+      tempUnknownsPerCell              = ::kernels::getPaddedSize(numberOfVariables)*tarch::la::aPowI(DIMENSIONS,basisSize);
+      tempFluxUnknownsPerCell          = tempUnknownsPerCell * (DIMENSIONS+1);
+      tempSpaceTimeUnknownsPerCell     = tempUnknownsPerCell * basisSize;
+      tempSpaceTimeFluxUnknownsPerCell = tempSpaceTimeUnknownsPerCell * (DIMENSIONS+1);
+    }
+  };
+
+  template <int order,int numberOfVariables>
+  void benchmarkADERDGKernels(
+      std::vector<exahype::benchmarks::kernels::Measurement>& results,
+      const std::string& filter) {
+    using namespace exahype::benchmarks::kernels;
+    typedef SyntheticADERDGSolver<order,numberOfVariables> Solver;
+    constexpr int basisSize = order+1;
+
+    Solver solver;
+    const ADERDGSizes sizes(order,numberOfVariables);
+    const double N = basisSize;
+    const double V = numberOfVariables;
+    const double D = DIMENSIONS;
+    const double dataPerCell = sizes.dataPerCell;
+    const double dataPerFace = sizes.dataPerFace;
+
+    const tarch::la::Vector<DIMENSIONS,double> dx(0.1);
+    const double dt = 1e-6;
+
+    // heap data
+    std::vector<double> luh   (sizes.dataPerCell);
+    std::vector<double> lduh  (sizes.dataPerCell);
+    std::vector<double> lQhbnd(sizes.dataPerFace*DIMENSIONS_TIMES_TWO);
+    std::vector<double> lFhbnd(sizes.dataPerFace*DIMENSIONS_TIMES_TWO);
+    fillSynthetic(luh.data(),   sizes.dataPerCell);
+    fillSynthetic(lduh.data(),  sizes.dataPerCell);
+    fillSynthetic(lQhbnd.data(),sizes.dataPerFace*DIMENSIONS_TIMES_TWO);
+    fillSynthetic(lFhbnd.data(),sizes.dataPerFace*DIMENSIONS_TIMES_TWO);
+
+    // temporary data; cf. exahype::solvers::TemporaryVariables
+    std::vector<double> tempSpaceTimeUnknownsStorage(4*(sizes.tempSpaceTimeUnknownsPerCell+sizes.tempUnknownsPerCell),0.0);
+    double* tempSpaceTimeUnknowns[4];
+    for (int i=0; i<4; i++) {
+      tempSpaceTimeUnknowns[i] = tempSpaceTimeUnknownsStorage.data() + i*(sizes.tempSpaceTimeUnknownsPerCell+sizes.tempUnknownsPerCell);
+    }
+    std::vector<double> tempSpaceTimeFluxUnknownsStorage(2*sizes.tempSpaceTimeFluxUnknownsPerCell,0.0);
+    double* tempSpaceTimeFluxUnknowns[2];
+    for (int i=0; i<2; i++) {
+      tempSpaceTimeFluxUnknowns[i] = tempSpaceTimeFluxUnknownsStorage.data() + i*sizes.tempSpaceTimeFluxUnknownsPerCell;
+    }
+    std::vector<double> tempUnknowns(sizes.tempUnknownsPerCell,0.0);
+    std::vector<double> tempFluxUnknowns(sizes.tempFluxUnknownsPerCell,0.0);
+    std::vector<double> tempStateSizedVector(numberOfVariables,0.0);
+    std::vector<double> tempPointForceSources(sizes.tempSpaceTimeUnknownsPerCell+sizes.tempUnknownsPerCell,0.0);
+    std::vector<double> tempEigenvalues(numberOfVariables,0.0);
+
+    std::vector<double> tempFaceUnknowns(3*sizes.dataPerFace,0.0);
+    std::vector<double> tempStateSizedVectorsStorage(6*numberOfVariables,0.0);
+    double* tempStateSizedVectors[6];
+    for (int i=0; i<6; i++) {
+      tempStateSizedVectors[i] = tempStateSizedVectorsStorage.data() + i*numberOfVariables;
+    }
+    std::vector<double> tempStateSizedSquareMatricesStorage(3*numberOfVariables*numberOfVariables,0.0);
+    double* tempStateSizedSquareMatrices[3];
+    for (int i=0; i<3; i++) {
+      tempStateSizedSquareMatrices[i] = tempStateSizedSquareMatricesStorage.data() + i*numberOfVariables*numberOfVariables;
+    }
+
+    double* QL = lQhbnd.data();
+    double* QR = lQhbnd.data() + sizes.dataPerFace;
+    double* FL = lFhbnd.data();
+    double* FR = lFhbnd.data() + sizes.dataPerFace;
+
+    // coarse/fine data for the AMR routines
+    std::vector<double> luhFine   (sizes.dataPerCell,0.0);
+    std::vector<double> lQhbndFine(sizes.dataPerFace,0.0);
+    std::vector<double> lFhbndFine(sizes.dataPerFace,0.0);
+    const tarch::la::Vector<DIMENSIONS,int>   subcellIndex(1);
+    const tarch::la::Vector<DIMENSIONS-1,int> subfaceIndex(1);
+
+    Measurement m;
+    m.order             = order;
+    m.numberOfVariables = numberOfVariables;
+
+    // Predictor: we assume basisSize Picard iterations for the nonlinear
+    // predictor. Each iteration applies the time integral and DIMENSIONS
+    // derivative operators along one axis of the space-time polynomial.
+    m.kernel       = "spaceTimePredictorNonlinear";
+    m.unit         = "cell";
+    m.flopsPerCall = N * (2.0*(D+1)*V*std::pow(N,D+2) + D*V*std::pow(N,D+1)) + 8.0*D*dataPerCell;
+    m.bytesPerCall = 8.0 * (dataPerCell + 4.0*D*dataPerFace + (D+2)*dataPerCell);
+    if (isSelected(m.kernel,filter)) {
+      measure(m,[&]() {
+        ::kernels::aderdg::generic::c::spaceTimePredictorNonlinear<false,true,false,Solver,true>(
+            solver,lQhbnd.data(),lFhbnd.data(),
+            tempSpaceTimeUnknowns,tempSpaceTimeFluxUnknowns,
+            tempUnknowns.data(),tempFluxUnknowns.data(),tempStateSizedVector.data(),
+            luh.data(),dx,dt);
+      });
+      consume(lQhbnd.data(),sizes.dataPerFace);
+      results.push_back(m);
+    }
+
+    m.kernel       = "spaceTimePredictorLinear";
+    m.flopsPerCall = N * (2.0*D*V*std::pow(N,D+1) + 2.0*D*dataPerCell) + 2.0*(D+1)*V*std::pow(N,D+1) + 8.0*D*dataPerCell;
+    if (isSelected(m.kernel,filter)) {
+      measure(m,[&]() {
+        ::kernels::aderdg::generic::c::spaceTimePredictorLinear<false,false,false,true,Solver>(
+            solver,lQhbnd.data(),lFhbnd.data(),
+            tempSpaceTimeUnknowns,tempSpaceTimeFluxUnknowns,
+            tempUnknowns.data(),tempFluxUnknowns.data(),tempStateSizedVector.data(),
+            luh.data(),dx,dt,tempPointForceSources.data());
+      });
+      consume(lQhbnd.data(),sizes.dataPerFace);
+      results.push_back(m);
+    }
+
+    m.kernel       = "spaceTimePredictorLinearConstantCoefficients";
+    m.flopsPerCall = N * D * (2.0*N*V*std::pow(N,D) + 2.0*V*std::pow(N,D)) + 8.0*D*dataPerCell; // V nonzeros per coefficient matrix
+    if (isSelected(m.kernel,filter)) {
+      measure(m,[&]() {
+        ::kernels::aderdg::generic::c::spaceTimePredictorLinearConstantCoefficients<Solver>(
+            solver,lQhbnd.data(),lFhbnd.data(),
+            tempSpaceTimeUnknowns,tempSpaceTimeFluxUnknowns,
+            tempUnknowns.data(),tempFluxUnknowns.data(),tempStateSizedVector.data(),
+            luh.data(),dx,dt);
+      });
+      consume(lQhbnd.data(),sizes.dataPerFace);
+      results.push_back(m);
+    }
+
+    // Volume and surface integral
+    fillSynthetic(tempFluxUnknowns.data(),sizes.tempFluxUnknownsPerCell);
+    m.kernel       = "volumeIntegralNonlinear";
+    m.flopsPerCall = 2.0*D*N*dataPerCell;
+    m.bytesPerCall = 8.0 * ((D+1)*dataPerCell);
+    if (isSelected(m.kernel,filter)) {
+      measure(m,[&]() {
+        ::kernels::aderdg::generic::c::volumeIntegralNonlinear<false,true,numberOfVariables,basisSize,true>(
+            lduh.data(),tempFluxUnknowns.data(),dx);
+      });
+      consume(lduh.data(),sizes.dataPerCell);
+      results.push_back(m);
+    }
+
+    m.kernel = "volumeIntegralLinear";
+    if (isSelected(m.kernel,filter)) {
+      measure(m,[&]() {
+        ::kernels::aderdg::generic::c::volumeIntegralLinear<false,true,numberOfVariables,basisSize>(
+            lduh.data(),tempFluxUnknowns.data(),dx);
+      });
+      consume(lduh.data(),sizes.dataPerCell);
+      results.push_back(m);
+    }
+
+    m.kernel       = "surfaceIntegralNonlinear";
+    m.flopsPerCall = 2.0*2.0*D*dataPerCell;
+    m.bytesPerCall = 8.0 * (2.0*D*dataPerFace + 2.0*dataPerCell);
+    if (isSelected(m.kernel,filter)) {
+      measure(m,[&]() {
+        ::kernels::aderdg::generic::c::surfaceIntegralNonlinear<numberOfVariables,basisSize>(
+            lduh.data(),lFhbnd.data(),dx);
+      });
+      consume(lduh.data(),sizes.dataPerCell);
+      results.push_back(m);
+    }
+
+    m.kernel = "surfaceIntegralLinear";
+    if (isSelected(m.kernel,filter)) {
+      measure(m,[&]() {
+        ::kernels::aderdg::generic::c::surfaceIntegralLinear<numberOfVariables,basisSize>(
+            lduh.data(),lFhbnd.data(),dx);
+      });
+      consume(lduh.data(),sizes.dataPerCell);
+      results.push_back(m);
+    }
+
+    // Riemann solvers (per face)
+    m.kernel       = "riemannSolverNonlinear";
+    m.unit         = "face";
+    m.flopsPerCall = 8.0*dataPerFace;
+    m.bytesPerCall = 8.0 * 6.0*dataPerFace;
+    if (isSelected(m.kernel,filter)) {
+      measure(m,[&]() {
+        ::kernels::aderdg::generic::c::riemannSolverNonlinear<false,Solver>(
+            solver,FL,FR,QL,QR,
+            tempFaceUnknowns.data(),tempStateSizedVectors,tempStateSizedSquareMatrices,
+            dt,0);
+      });
+      consume(FL,sizes.dataPerFace);
+      results.push_back(m);
+    }
+
+    m.kernel       = "riemannSolverLinear";
+    m.flopsPerCall = 4.0*V*dataPerFace + 4.0*dataPerFace;
+    if (isSelected(m.kernel,filter)) {
+      measure(m,[&]() {
+        ::kernels::aderdg::generic::c::riemannSolverLinear<false,Solver>(
+            solver,FL,FR,QL,QR,
+            tempFaceUnknowns.data(),tempStateSizedVectors,tempStateSizedSquareMatrices,
+            dt,0);
+      });
+      consume(FL,sizes.dataPerFace);
+      results.push_back(m);
+    }
+
+    // Solution update and time step size
+    m.kernel       = "solutionUpdate";
+    m.unit         = "cell";
+    m.flopsPerCall = 3.0*dataPerCell;
+    m.bytesPerCall = 8.0 * 3.0*dataPerCell;
+    if (isSelected(m.kernel,filter)) {
+      measure(m,[&]() {
+        ::kernels::aderdg::generic::c::solutionUpdate<Solver>(
+            solver,luh.data(),lduh.data(),dt);
+      });
+      consume(luh.data(),sizes.dataPerCell);
+      results.push_back(m);
+    }
+
+    m.kernel       = "stableTimeStepSize";
+    m.flopsPerCall = 2.0*D*dataPerCell;
+    m.bytesPerCall = 8.0 * dataPerCell;
+    if (isSelected(m.kernel,filter)) {
+      double admissibleTimeStepSize = 0.0;
+      measure(m,[&]() {
+        admissibleTimeStepSize += ::kernels::aderdg::generic::c::stableTimeStepSize<Solver>(
+            solver,luh.data(),tempEigenvalues.data(),dx);
+      });
+      consume(&admissibleTimeStepSize,1);
+      results.push_back(m);
+    }
+
+    // AMR routines (one level difference). These kernels are implemented
+    // as plain (non tensor-product) loops; the model counts what they do.
+    m.kernel       = "faceUnknownsProlongation";
+    m.unit         = "face";
+    m.flopsPerCall = 2.0*D*V*std::pow(N,2*(D-1));
+    m.bytesPerCall = 8.0 * 6.0*dataPerFace;
+    if (isSelected(m.kernel,filter)) {
+      measure(m,[&]() {
+        std::fill(lQhbndFine.begin(),lQhbndFine.end(),0.0);
+        std::fill(lFhbndFine.begin(),lFhbndFine.end(),0.0);
+        ::kernels::aderdg::generic::c::faceUnknownsProlongation<numberOfVariables,0,basisSize>(
+            lQhbndFine.data(),lFhbndFine.data(),QL,FL,1,2,subfaceIndex);
+      });
+      consume(lQhbndFine.data(),sizes.dataPerFace);
+      results.push_back(m);
+    }
+
+    m.kernel = "faceUnknownsRestriction";
+    if (isSelected(m.kernel,filter)) {
+      measure(m,[&]() {
+        ::kernels::aderdg::generic::c::faceUnknownsRestriction<numberOfVariables,0,basisSize>(
+            QR,FR,lQhbndFine.data(),lFhbndFine.data(),1,2,subfaceIndex);
+      });
+      consume(QR,sizes.dataPerFace);
+      results.push_back(m);
+    }
+
+    m.kernel       = "volumeUnknownsProlongation";
+    m.unit         = "cell";
+    m.flopsPerCall = (D+1)*V*std::pow(N,2*D);
+    m.bytesPerCall = 8.0 * 3.0*dataPerCell;
+    if (isSelected(m.kernel,filter)) {
+      measure(m,[&]() {
+        std::fill(luhFine.begin(),luhFine.end(),0.0);
+        ::kernels::aderdg::generic::c::volumeUnknownsProlongation<numberOfVariables,0,basisSize>(
+            luhFine.data(),luh.data(),1,2,subcellIndex);
+      });
+      consume(luhFine.data(),sizes.dataPerCell);
+      results.push_back(m);
+    }
+
+    m.kernel = "volumeUnknownsRestriction";
+    if (isSelected(m.kernel,filter)) {
+      measure(m,[&]() {
+        ::kernels::aderdg::generic::c::volumeUnknownsRestriction<numberOfVariables,0,basisSize>(
+            lduh.data(),luhFine.data(),1,2,subcellIndex);
+      });
+      consume(lduh.data(),sizes.dataPerCell);
+      results.push_back(m);
+    }
+  }
+
+  /**
+   * Sweeps over the orders 1,...,order for a range of PDE sizes
+   * (a scalar PDE, Euler, MHD/GRMHD-like and elastic-wave-like systems).
+   */
+  template <int order>
+  struct ADERDGOrderSweep {
+    static void run(
+        std::vector<exahype::benchmarks::kernels::Measurement>& results,
+        const std::string& filter) {
+      ADERDGOrderSweep<order-1>::run(results,filter);
+      benchmarkADERDGKernels<order,1>(results,filter);
+      benchmarkADERDGKernels<order,5>(results,filter);
+      benchmarkADERDGKernels<order,9>(results,filter);
+      benchmarkADERDGKernels<order,21>(results,filter);
+    }
+  };
+
+  template <>
+  struct ADERDGOrderSweep<0> {
+    static void run(
+        std::vector<exahype::benchmarks::kernels::Measurement>& results,
+        const std::string& filter) {}
+  };
+}
+
+void exahype::benchmarks::kernels::runADERDGKernelBenchmarks(
+    std::vector<Measurement>& results,const std::string& filter) {
+  ADERDGOrderSweep<MaxOrder>::run(results,filter);
+}
+
+#endif
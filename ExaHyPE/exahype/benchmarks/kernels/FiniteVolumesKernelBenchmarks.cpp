@@ -0,0 +1,153 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/benchmarks/kernels/KernelBenchmarks.h"
+
+#ifdef KernelBenchmarks
+
+#include <cmath>
+#include <vector>
+
+#include "tarch/la/Vector.h"
+#include "tarch/la/ScalarOperations.h"
+
+#include "kernels/finitevolumes/godunov/c/godunov.h"
+#include "kernels/finitevolumes/musclhancock/c/musclhancock.h"
+
+#include "exahype/benchmarks/kernels/SyntheticSolvers.h"
+
+namespace {
+  /**
+   * The MUSCL-Hancock kernel keeps ten patch sized arrays (slopes, extrapolated
+   * values) on the stack. We skip patch and PDE sizes for which these would
+   * exceed this bound in order not to overflow the default stack.
+   */
+  constexpr long MaxMusclHancockStackBytes = 4L*1024L*1024L;
+
+  /**
+   * Benchmark one finite volumes scheme for one patch size and PDE size.
+   *
+   * The model counts, per interior face, one Rusanov flux (two eigenvalue
+   * and two flux evaluations plus the dissipation term) and the update of
+   * the two adjacent volumes. The MUSCL-Hancock scheme additionally computes
+   * slopes, the half time step predictor and 2*DIMENSIONS boundary fluxes per
+   * volume. The patch is assumed to be read and written once.
+   */
+  template <int patchSize,int numberOfVariables>
+  void benchmarkFiniteVolumesKernels(
+      std::vector<exahype::benchmarks::kernels::Measurement>& results,
+      const std::string& filter) {
+    using namespace exahype::benchmarks::kernels;
+    const double P = patchSize;
+    const double V = numberOfVariables;
+    const double D = DIMENSIONS;
+    const double faces   = D * (P+1) * std::pow(P,D-1);
+    const double volumes = std::pow(P,D);
+
+    const tarch::la::Vector<DIMENSIONS,double> dx(0.1);
+    const double dt = 1e-6;
+
+    std::vector<double> tempStateSizedVectorsStorage((1+2*DIMENSIONS)*numberOfVariables,0.0);
+    double* tempStateSizedVectors[1+2*DIMENSIONS];
+    for (int i=0; i<1+2*DIMENSIONS; i++) {
+      tempStateSizedVectors[i] = tempStateSizedVectorsStorage.data() + i*numberOfVariables;
+    }
+
+    Measurement m;
+    m.numberOfVariables = numberOfVariables;
+    m.patchSize         = patchSize;
+    m.unit              = "cell";
+
+    {
+      typedef SyntheticFiniteVolumesSolver<patchSize,1,numberOfVariables> Solver;
+      Solver solver;
+      const int dataPerPatch = numberOfVariables*tarch::la::aPowI(DIMENSIONS,patchSize+2*Solver::GhostLayerWidth);
+      std::vector<double> luh(dataPerPatch);
+      std::vector<double> luhNew(dataPerPatch);
+      fillSynthetic(luh.data(),dataPerPatch);
+      fillSynthetic(luhNew.data(),dataPerPatch);
+
+      m.kernel       = "godunov::solutionUpdate";
+      m.flopsPerCall = faces * (8.0*V + D*V*2.0) + volumes * V;
+      m.bytesPerCall = 8.0 * (dataPerPatch + 2.0*volumes*V);
+      if (isSelected(m.kernel,filter)) {
+        double admissibleTimeStepSize = 0.0;
+        measure(m,[&]() {
+          admissibleTimeStepSize += ::kernels::finitevolumes::godunov::c::solutionUpdate<false,false,true,Solver>(
+              solver,luhNew.data(),luh.data(),tempStateSizedVectors,nullptr,dx,dt);
+        });
+        consume(luhNew.data(),dataPerPatch);
+        consume(&admissibleTimeStepSize,1);
+        results.push_back(m);
+      }
+    }
+
+    {
+      typedef SyntheticFiniteVolumesSolver<patchSize,2,numberOfVariables> Solver;
+      Solver solver;
+      const int dataPerPatch = numberOfVariables*tarch::la::aPowI(DIMENSIONS,patchSize+2*Solver::GhostLayerWidth);
+      std::vector<double> luh(dataPerPatch);
+      std::vector<double> luhNew(dataPerPatch);
+      fillSynthetic(luh.data(),dataPerPatch);
+      fillSynthetic(luhNew.data(),dataPerPatch);
+
+      constexpr long stride     = patchSize+2*Solver::GhostLayerWidth;
+      constexpr long stackBytes = 10L * sizeof(double) * numberOfVariables * stride * stride * (DIMENSIONS==3 ? stride : 1);
+
+      m.kernel       = "musclhancock::solutionUpdate";
+      m.flopsPerCall = faces * (8.0*V + D*V*2.0) + volumes * V * (D*(6.0 + 2.0*D*D) + 2.0);
+      m.bytesPerCall = 8.0 * (dataPerPatch + 2.0*volumes*V);
+      if (isSelected(m.kernel,filter) && stackBytes<=MaxMusclHancockStackBytes) {
+        double admissibleTimeStepSize = 0.0;
+        measure(m,[&]() {
+          admissibleTimeStepSize += ::kernels::finitevolumes::musclhancock::c::solutionUpdate<false,false,true,Solver>(
+              solver,luhNew.data(),luh.data(),tempStateSizedVectors,nullptr,dx,dt);
+        });
+        consume(luhNew.data(),dataPerPatch);
+        consume(&admissibleTimeStepSize,1);
+        results.push_back(m);
+      }
+    }
+  }
+
+  /**
+   * The patch sizes 3, 5, ..., 19 correspond to the limiter patches of
+   * ADER-DG orders 1, 2, ..., 9 (2*order+1 subcells per coordinate axis).
+   */
+  template <int order>
+  struct FiniteVolumesPatchSweep {
+    static void run(
+        std::vector<exahype::benchmarks::kernels::Measurement>& results,
+        const std::string& filter) {
+      FiniteVolumesPatchSweep<order-1>::run(results,filter);
+      benchmarkFiniteVolumesKernels<2*order+1,1>(results,filter);
+      benchmarkFiniteVolumesKernels<2*order+1,5>(results,filter);
+      benchmarkFiniteVolumesKernels<2*order+1,9>(results,filter);
+      benchmarkFiniteVolumesKernels<2*order+1,21>(results,filter);
+    }
+  };
+
+  template <>
+  struct FiniteVolumesPatchSweep<0> {
+    static void run(
+        std::vector<exahype::benchmarks::kernels::Measurement>& results,
+        const std::string& filter) {}
+  };
+}
+
+void exahype::benchmarks::kernels::runFiniteVolumesKernelBenchmarks(
+    std::vector<Measurement>& results,const std::string& filter) {
+  FiniteVolumesPatchSweep<9>::run(results,filter);
+}
+
+#endif
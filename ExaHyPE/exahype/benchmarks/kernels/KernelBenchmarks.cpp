@@ -0,0 +1,155 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/benchmarks/kernels/KernelBenchmarks.h"
+
+#ifdef KernelBenchmarks
+
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <set>
+#include <sstream>
+
+#include "tarch/logging/Log.h"
+
+#include "kernels/DGBasisFunctions.h"
+#include "kernels/DGMatrices.h"
+#include "kernels/GaussLegendreQuadrature.h"
+#include "kernels/GaussLobattoQuadrature.h"
+#include "kernels/LimiterProjectionMatrices.h"
+
+namespace {
+  tarch::logging::Log _log("exahype::benchmarks::kernels");
+
+  volatile double checksum = 0.0;
+}
+
+double exahype::benchmarks::kernels::Measurement::gflops() const {
+  return (secondsPerCall>0.0) ? flopsPerCall / secondsPerCall * 1.0e-9 : 0.0;
+}
+
+double exahype::benchmarks::kernels::Measurement::gbytes() const {
+  return (secondsPerCall>0.0) ? bytesPerCall / secondsPerCall * 1.0e-9 : 0.0;
+}
+
+bool exahype::benchmarks::kernels::isSelected(
+    const std::string& kernel,const std::string& filter) {
+  return filter.empty() || kernel.find(filter)!=std::string::npos;
+}
+
+void exahype::benchmarks::kernels::fillSynthetic(double* array,const int size) {
+  for (int i=0; i<size; i++) {
+    array[i] = 1.0 + 0.1 * std::sin(0.1 * i);
+  }
+}
+
+void exahype::benchmarks::kernels::consume(const double* array,const int size) {
+  double sum = 0.0;
+  for (int i=0; i<size; i++) {
+    sum += array[i];
+  }
+  checksum = checksum + sum;
+}
+
+void exahype::benchmarks::kernels::printTable(const std::vector<Measurement>& results) {
+  logInfo("printTable(...)",
+      "kernel | dim | order | nVar | patch | unit | calls | us/call | GFLOP/s | GB/s");
+  for (const Measurement& m : results) {
+    std::ostringstream line;
+    line << std::setw(32) << std::left << m.kernel << std::right
+         << " | " << m.dimensions
+         << " | " << std::setw(2) << m.order
+         << " | " << std::setw(2) << m.numberOfVariables
+         << " | " << std::setw(2) << m.patchSize
+         << " | " << m.unit
+         << " | " << std::setw(9) << m.repetitions
+         << " | " << std::setw(10) << std::setprecision(4) << m.secondsPerCall*1.0e6
+         << " | " << std::setw(8)  << std::setprecision(4) << m.gflops()
+         << " | " << std::setw(8)  << std::setprecision(4) << m.gbytes();
+    logInfo("printTable(...)", line.str());
+  }
+}
+
+bool exahype::benchmarks::kernels::writeJSON(
+    const std::vector<Measurement>& results,const std::string& fileName) {
+  std::ofstream out(fileName);
+  if (!out.good()) {
+    return false;
+  }
+
+  out << std::setprecision(9);
+  out << "[\n";
+  for (std::size_t i=0; i<results.size(); i++) {
+    const Measurement& m = results[i];
+    out << "  {"
+        << "\"kernel\":\""          << m.kernel            << "\","
+        << "\"dimensions\":"        << m.dimensions        << ","
+        << "\"order\":"             << m.order             << ","
+        << "\"numberOfVariables\":" << m.numberOfVariables << ","
+        << "\"patchSize\":"         << m.patchSize         << ","
+        << "\"unit\":\""            << m.unit              << "\","
+        << "\"repetitions\":"       << m.repetitions       << ","
+        << "\"secondsPerCall\":"    << m.secondsPerCall    << ","
+        << "\"flopsPerCall\":"      << m.flopsPerCall      << ","
+        << "\"bytesPerCall\":"      << m.bytesPerCall      << ","
+        << "\"gflops\":"            << m.gflops()          << ","
+        << "\"gbytes\":"            << m.gbytes()
+        << "}" << (i+1<results.size() ? "," : "") << "\n";
+  }
+  out << "]\n";
+  return out.good();
+}
+
+int exahype::benchmarks::kernels::run(const std::vector<std::string>& cmdlineargs) {
+  const std::string fileName = (cmdlineargs.size()>1) ? cmdlineargs[1] : "kernel-benchmarks.json";
+  const std::string filter   = (cmdlineargs.size()>2) ? cmdlineargs[2] : "";
+
+  // The generic kernels support the orders 0 to 9; the matrices are
+  // set up for all of them anyway (cf. kernels::initSolvers).
+  std::set<int> orders;
+  for (int order=0; order<10; order++) {
+    orders.insert(order);
+  }
+  ::kernels::initGaussLegendreNodesAndWeights(orders);
+  ::kernels::initGaussLobattoNodesAndWeights(orders);
+  ::kernels::initLimiterProjectionMatrices(orders);
+  ::kernels::initDGMatrices(orders);
+  ::kernels::initBasisFunctions(orders);
+
+  logInfo("run(...)", "run kernel benchmarks for DIMENSIONS=" << DIMENSIONS <<
+      (filter.empty() ? "" : " (filter=\""+filter+"\")"));
+
+  std::vector<Measurement> results;
+  runADERDGKernelBenchmarks(results,filter);
+  runFiniteVolumesKernelBenchmarks(results,filter);
+  runLimiterKernelBenchmarks(results,filter);
+
+  ::kernels::freeGaussLegendreNodesAndWeights(orders);
+  ::kernels::freeGaussLobattoNodesAndWeights(orders);
+  ::kernels::freeLimiterProjectionMatrices(orders);
+  ::kernels::freeDGMatrices(orders);
+  ::kernels::freeBasisFunctions(orders);
+
+  printTable(results);
+  logInfo("run(...)", "checksum=" << checksum);
+
+  if (!writeJSON(results,fileName)) {
+    logError("run(...)", "could not write benchmark results to file " << fileName);
+    return -1;
+  }
+  logInfo("run(...)", "wrote " << results.size() << " measurements to " << fileName);
+  return 0;
+}
+
+#endif
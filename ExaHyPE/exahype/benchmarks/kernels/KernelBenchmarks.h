@@ -0,0 +1,159 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef EXAHYPE_BENCHMARKS_KERNELS_KERNELBENCHMARKS_H_
+#define EXAHYPE_BENCHMARKS_KERNELS_KERNELBENCHMARKS_H_
+
+#ifdef KernelBenchmarks
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "peano/utils/Globals.h"
+
+namespace exahype {
+  namespace benchmarks {
+    /**
+     * Standalone micro-benchmarks for the generic ADER-DG, finite volumes
+     * and limiter kernels.
+     *
+     * The kernels are instantiated with synthetic solvers (see
+     * SyntheticSolvers.h) for a sweep over orders and numbers of variables.
+     * No specification file, grid or solver registry is needed.
+     * Translate the code with -DKernelBenchmarks (KERNELBENCHMARKS=On)
+     * and run
+     *
+     *   ./ExaHyPE-<app> --benchmark-kernels [results.json] [filter]
+     *
+     * DIMENSIONS is a compile time constant. Benchmarking 2d and 3d thus
+     * requires two builds.
+     *
+     * The FLOP and byte counts reported are model estimates: leading order
+     * operation counts of the tensor-product contractions and the compulsory
+     * memory traffic of the kernel arguments (temporary arrays are assumed
+     * to stay in cache). They are meant to compare kernels and orders, not
+     * to replace hardware counters.
+     */
+    namespace kernels {
+      /**
+       * Result of benchmarking one kernel instantiation.
+       */
+      struct Measurement {
+        std::string kernel;
+        int         dimensions        = DIMENSIONS;
+        int         order             = -1; // -1 if not applicable
+        int         numberOfVariables = 0;
+        int         patchSize         = -1; // -1 if not applicable
+        std::string unit              = "cell"; // "cell" or "face"
+        long        repetitions       = 0;
+        double      secondsPerCall    = 0.0;
+        double      flopsPerCall      = 0.0;
+        double      bytesPerCall      = 0.0;
+
+        double gflops() const;
+        double gbytes() const;
+      };
+
+      /**
+       * Minimum wall clock time one measurement is repeated for.
+       */
+      constexpr double MinimumSecondsPerMeasurement = 0.1;
+
+      /**
+       * Number of untimed calls before a measurement starts.
+       */
+      constexpr int WarmUpCalls = 3;
+
+      /**
+       * Repeatedly call \p kernel until at least MinimumSecondsPerMeasurement
+       * seconds have passed and return the averaged time per call in
+       * \p measurement.
+       */
+      template <typename Kernel>
+      void measure(Measurement& measurement,Kernel kernel) {
+        for (int i=0; i<WarmUpCalls; i++) {
+          kernel();
+        }
+
+        long   repetitions = 0;
+        long   batch       = 1;
+        double seconds     = 0.0;
+        const auto start = std::chrono::high_resolution_clock::now();
+        while (seconds < MinimumSecondsPerMeasurement) {
+          for (long i=0; i<batch; i++) {
+            kernel();
+          }
+          repetitions += batch;
+          batch       *= 2;
+          seconds = std::chrono::duration<double>(
+              std::chrono::high_resolution_clock::now()-start).count();
+        }
+
+        measurement.repetitions    = repetitions;
+        measurement.secondsPerCall = seconds / repetitions;
+      }
+
+      /**
+       * \return true if \p filter is empty or a substring of \p kernel.
+       */
+      bool isSelected(const std::string& kernel,const std::string& filter);
+
+      /**
+       * Fill \p array with smooth, positive, non-constant values such that
+       * eigenvalues, limiter projections etc. do not degenerate.
+       */
+      void fillSynthetic(double* array,const int size);
+
+      /**
+       * Sum up \p array. The result is passed to consume() so that the
+       * compiler cannot drop the kernel calls.
+       */
+      void consume(const double* array,const int size);
+
+      void runADERDGKernelBenchmarks(
+          std::vector<Measurement>& results,const std::string& filter);
+
+      void runFiniteVolumesKernelBenchmarks(
+          std::vector<Measurement>& results,const std::string& filter);
+
+      void runLimiterKernelBenchmarks(
+          std::vector<Measurement>& results,const std::string& filter);
+
+      /**
+       * Print one line per measurement via the logging.
+       */
+      void printTable(const std::vector<Measurement>& results);
+
+      /**
+       * Write the results as JSON array to \p fileName.
+       *
+       * \return false if the file could not be written.
+       */
+      bool writeJSON(const std::vector<Measurement>& results,const std::string& fileName);
+
+      /**
+       * Entry point called by exahype::main.
+       *
+       * \param cmdlineargs the command line arguments without the program name;
+       *        cmdlineargs[0] is "--benchmark-kernels", optionally followed by
+       *        the JSON output file and a kernel name filter.
+       */
+      int run(const std::vector<std::string>& cmdlineargs);
+    }
+  }
+}
+
+#endif
+
+#endif
@@ -0,0 +1,86 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/benchmarks/kernels/KernelBenchmarks.h"
+
+#ifdef KernelBenchmarks
+
+#include <cmath>
+#include <vector>
+
+#include "tarch/la/ScalarOperations.h"
+
+#include "kernels/limiter/generic/Limiter.h"
+
+/**
+ * The limiter projections are not templated. We benchmark them for the
+ * same orders and PDE sizes as the ADER-DG kernels and a ghost layer
+ * width of one.
+ *
+ * The discrete maximum principle and admissibility checks are not
+ * covered since they require a fully configured ADERDGSolver.
+ *
+ * Both projections are implemented as plain loops over all
+ * (DG node, subcell) pairs; the model counts DIMENSIONS+1 operations
+ * per pair and variable.
+ */
+void exahype::benchmarks::kernels::runLimiterKernelBenchmarks(
+    std::vector<Measurement>& results,const std::string& filter) {
+  constexpr int ghostLayerWidth = 1;
+  const int numbersOfVariables[] = {1,5,9,21};
+
+  for (int order=1; order<=9; order++) {
+    for (const int numberOfVariables : numbersOfVariables) {
+      const int basisSize    = order+1;
+      const int basisSizeLim = ::kernels::limiter::generic::c::getBasisSizeLim(basisSize);
+      const int dataPerCell  = numberOfVariables*tarch::la::aPowI(DIMENSIONS,basisSize);
+      const int dataPerPatch = numberOfVariables*tarch::la::aPowI(DIMENSIONS,basisSizeLim+2*ghostLayerWidth);
+      const double pairs     = std::pow(static_cast<double>(basisSize*basisSizeLim),DIMENSIONS);
+
+      std::vector<double> luh(dataPerCell);
+      std::vector<double> lim(dataPerPatch);
+      fillSynthetic(luh.data(),dataPerCell);
+      fillSynthetic(lim.data(),dataPerPatch);
+
+      Measurement m;
+      m.order             = order;
+      m.numberOfVariables = numberOfVariables;
+      m.patchSize         = basisSizeLim;
+      m.unit              = "cell";
+      m.flopsPerCall      = (DIMENSIONS+1) * numberOfVariables * pairs;
+      m.bytesPerCall      = 8.0 * (dataPerCell + dataPerPatch);
+
+      m.kernel = "projectOnFVLimiterSpace";
+      if (isSelected(m.kernel,filter)) {
+        measure(m,[&]() {
+          ::kernels::limiter::generic::c::projectOnFVLimiterSpace(
+              luh.data(),numberOfVariables,basisSize,ghostLayerWidth,lim.data());
+        });
+        consume(lim.data(),dataPerPatch);
+        results.push_back(m);
+      }
+
+      m.kernel = "projectOnDGSpace";
+      if (isSelected(m.kernel,filter)) {
+        measure(m,[&]() {
+          ::kernels::limiter::generic::c::projectOnDGSpace(
+              lim.data(),numberOfVariables,basisSize,ghostLayerWidth,luh.data());
+        });
+        consume(luh.data(),dataPerCell);
+        results.push_back(m);
+      }
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,140 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef EXAHYPE_BENCHMARKS_KERNELS_SYNTHETICSOLVERS_H_
+#define EXAHYPE_BENCHMARKS_KERNELS_SYNTHETICSOLVERS_H_
+
+#ifdef KernelBenchmarks
+
+#include <algorithm>
+
+#include "peano/utils/Globals.h"
+
+#include "kernels/finitevolumes/riemannsolvers/c/riemannsolvers.h"
+
+namespace exahype {
+  namespace benchmarks {
+    namespace kernels {
+      /**
+       * Advection velocity of the synthetic PDEs in direction \p d.
+       * Differs per direction so that no kernel can exploit symmetry.
+       */
+      inline double syntheticVelocity(const int d) {
+        return 1.0 + 0.1 * d;
+      }
+
+      /**
+       * Linear advection of \p NumberOfVariables quantities. Provides the
+       * same static interface as the generated (generic kernel) ADER-DG
+       * solvers. The PDE terms are deliberately cheap such that the benchmarks
+       * measure the kernels and not the user functions.
+       *
+       * nonConservativeProduct follows the linear kernels' convention
+       * and writes a DIMENSIONS x NumberOfVariables tensor.
+       */
+      template <int order,int numberOfVariables>
+      class SyntheticADERDGSolver {
+        public:
+          static constexpr int    Order              = order;
+          static constexpr int    NumberOfVariables  = numberOfVariables;
+          static constexpr int    NumberOfParameters = 0;
+          static constexpr double CFL                = 0.9;
+
+          void flux(const double* const Q,double** F) {
+            for (int d=0; d<DIMENSIONS; d++) {
+              const double a = syntheticVelocity(d);
+              for (int v=0; v<NumberOfVariables; v++) {
+                F[d][v] = a * Q[v];
+              }
+            }
+          }
+
+          void eigenvalues(const double* const Q,const int d,double* lambda) {
+            std::fill_n(lambda,NumberOfVariables,syntheticVelocity(d));
+          }
+
+          void algebraicSource(const double* const Q,double* S) {
+            std::fill_n(S,NumberOfVariables,0.0);
+          }
+
+          void fusedSource(const double* const Q,const double* const gradQ,double* S) {
+            std::fill_n(S,NumberOfVariables,0.0);
+          }
+
+          void nonConservativeProduct(const double* const Q,const double* const gradQ,double* BgradQ) {
+            for (int d=0; d<DIMENSIONS; d++) {
+              const double a = syntheticVelocity(d);
+              for (int v=0; v<NumberOfVariables; v++) {
+                BgradQ[d*NumberOfVariables+v] = a * gradQ[d*NumberOfVariables+v];
+              }
+            }
+          }
+
+          void coefficientMatrix(const double* const Q,const int d,double* Bn) {
+            std::fill_n(Bn,NumberOfVariables*NumberOfVariables,0.0);
+            for (int v=0; v<NumberOfVariables; v++) {
+              Bn[v*NumberOfVariables+v] = syntheticVelocity(d);
+            }
+          }
+      };
+
+      /**
+       * Finite volumes counterpart of SyntheticADERDGSolver. Uses the
+       * generic Rusanov flux as Riemann solver.
+       */
+      template <int patchSize,int ghostLayerWidth,int numberOfVariables>
+      class SyntheticFiniteVolumesSolver {
+        public:
+          static constexpr int    PatchSize          = patchSize;
+          static constexpr int    GhostLayerWidth    = ghostLayerWidth;
+          static constexpr int    NumberOfVariables  = numberOfVariables;
+          static constexpr int    NumberOfParameters = 0;
+          static constexpr double CFL                = 0.9;
+
+          void flux(const double* const Q,double** F) {
+            for (int d=0; d<DIMENSIONS; d++) {
+              const double a = syntheticVelocity(d);
+              for (int v=0; v<NumberOfVariables; v++) {
+                F[d][v] = a * Q[v];
+              }
+            }
+          }
+
+          void eigenvalues(const double* const Q,const int d,double* lambda) {
+            std::fill_n(lambda,NumberOfVariables,syntheticVelocity(d));
+          }
+
+          void algebraicSource(const double* const Q,double* S) {
+            std::fill_n(S,NumberOfVariables,0.0);
+          }
+
+          void fusedSource(const double* const Q,const double* const gradQ,double* S) {
+            std::fill_n(S,NumberOfVariables,0.0);
+          }
+
+          void nonConservativeProduct(const double* const Q,const double* const gradQ,double* BgradQ) {
+            std::fill_n(BgradQ,NumberOfVariables,0.0);
+          }
+
+          double riemannSolver(double* fL,double* fR,const double* qL,const double* qR,int normalNonZero) {
+            return ::kernels::finitevolumes::riemannsolvers::c::rusanov<false,true>(
+                *this,fL,fR,qL,qR,normalNonZero);
+          }
+      };
+    }
+  }
+}
+
+#endif
+
+#endif
@@ -29,6 +29,9 @@
 #include "kernels/GaussLegendreQuadrature.h"
 #include "kernels/DGMatrices.h"
 
+#include "exahype/benchmarks/kernels/KernelBenchmarks.h"
+#include "exahype/plotters/Snapshot/SnapshotReader.h"
+
 #include <vector>
 #include <cstdlib> // getenv, exit
 #include <iostream>
@@ -217,6 +220,34 @@ int exahype::main(int argc, char** argv) {
     return EXIT_SUCCESS;
   }
 
+  //
+  //   Kernel micro-benchmarks
+  // ===========================
+  // They do not need a specification file. Like the unit tests, they cannot
+  // run in shared memory mode as the autotuning is not set up.
+  //
+  #if defined(KernelBenchmarks)
+  if (firstarg == "--benchmark-kernels") {
+    #if defined(SharedMemoryParallelisation)
+    logError("main()", "kernel benchmarks are not supported in shared memory mode. Quit.");
+    return -1;
+    #else
+    return exahype::benchmarks::kernels::run(cmdlineargs);
+    #endif
+  }
+  #endif
+
+  //
+  //   Snapshot extraction
+  // =======================
+  // Decompresses (parts of) a snapshot written by the Snapshot::Compressed
+  // plotter. Does not need a specification file either.
+  //
+  if (firstarg == "--extract-snapshot") {
+    return exahype::plotters::snapshot::extract(
+        std::vector<std::string>(cmdlineargs.begin()+1, cmdlineargs.end()));
+  }
+
   exahype::Parser parser;
   parser.readFile(firstarg);
 
@@ -355,6 +386,16 @@ void exahype::help(const std::string& programname) {
   std::cout << "\n";
   std::cout << "    --help     Show this help message\n";
   std::cout << "    --version  Show version and other hard coded information\n";
+  #if defined(KernelBenchmarks)
+  std::cout << "    --benchmark-kernels [results.json] [filter]\n";
+  std::cout << "               Run the kernel micro-benchmarks and write the results\n";
+  std::cout << "               to results.json (default: kernel-benchmarks.json).\n";
+  std::cout << "               Only kernels whose name contains filter are run.\n";
+  #endif
+  std::cout << "    --extract-snapshot <file.snapidx> [variables=a,b,...] [region=x0,y0,(z0,)x1,y1(,z1)] [output=file]\n";
+  std::cout << "               Decompress a snapshot of the Snapshot::Compressed plotter\n";
+  std::cout << "               and write the selected variables at all nodes inside the\n";
+  std::cout << "               region as ASCII columns (default: standard output).\n";
   std::cout << "\n";
 }
 
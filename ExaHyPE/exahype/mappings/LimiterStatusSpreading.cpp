@@ -20,6 +20,8 @@
 
 #include "exahype/solvers/LimitingADERDGSolver.h"
 
+#include "exahype/mappings/TimeStepSizeComputation.h"
+
 #include "tarch/la/VectorScalarOperations.h"
 
 #include "multiscalelinkedcell/HangingVertexBookkeeper.h"
@@ -98,6 +100,8 @@ void exahype::mappings::LimiterStatusSpreading::beginIteration(
 ) {
   _localState = solverState;
 
+  exahype::mappings::TimeStepSizeComputation::finishNonBlockingTimeStepDataReduction();
+
   exahype::solvers::initialiseSolverFlags(_solverFlags);
   exahype::solvers::prepareSolverFlags(_solverFlags);
 
@@ -142,7 +146,9 @@ void exahype::mappings::LimiterStatusSpreading::endIteration(exahype::State& sol
       auto* limitingADERDG = static_cast<exahype::solvers::LimitingADERDGSolver*>(solver);
 
       limitingADERDG->updateNextMeshUpdateRequest(_solverFlags._meshUpdateRequest[solverNumber]);
-      limitingADERDG->updateNextAttainedStableState(!limitingADERDG->getNextMeshUpdateRequest());
+      limitingADERDG->updateNextAttainedStableState(
+          !limitingADERDG->getNextMeshUpdateRequest() &&
+          _solverFlags._attainedStableState[solverNumber]);
       limitingADERDG->updateNextLimiterDomainChange(_solverFlags._limiterDomainChange[solverNumber]);
 
       limitingADERDG->setNextMeshUpdateRequest();
@@ -213,8 +219,10 @@ void exahype::mappings::LimiterStatusSpreading::enterCell(
     if (element!=exahype::solvers::Solver::NotFound) {
       if (solver->isComputing(_localState.getAlgorithmSection())) {
         auto* limitingADERDG = static_cast<exahype::solvers::LimitingADERDGSolver*>(solver);
-        limitingADERDG->updateLimiterStatusDuringLimiterStatusSpreading(
-            fineGridCell.getCellDescriptionsIndex(),element);
+        const bool limiterStatusHasChanged =
+            limitingADERDG->updateLimiterStatusDuringLimiterStatusSpreading(
+                fineGridCell.getCellDescriptionsIndex(),element);
+        _solverFlags._attainedStableState[solverNumber] &= !limiterStatusHasChanged;
 
         bool meshUpdateRequest =
             limitingADERDG->
@@ -405,7 +413,8 @@ exahype::mappings::LimiterStatusSpreading::~LimiterStatusSpreading() {
 void exahype::mappings::LimiterStatusSpreading::mergeWithWorkerThread(
     const LimiterStatusSpreading& workerThread) {
   for (int i = 0; i < static_cast<int>(exahype::solvers::RegisteredSolvers.size()); i++) {
-    _solverFlags._meshUpdateRequest[i]  |= workerThread._solverFlags._meshUpdateRequest[i];
+    _solverFlags._meshUpdateRequest[i]   |= workerThread._solverFlags._meshUpdateRequest[i];
+    _solverFlags._attainedStableState[i] &= workerThread._solverFlags._attainedStableState[i];
     _solverFlags._limiterDomainChange[i] =
         std::max ( _solverFlags._limiterDomainChange[i],
                    workerThread._solverFlags._limiterDomainChange[i] );
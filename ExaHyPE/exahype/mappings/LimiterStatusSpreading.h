@@ -98,6 +98,11 @@ public:
    *
    * For these solvers further check if a grid update
    * is necessary after the spreading.
+   *
+   * We further memorise if the limiter status of
+   * any cell has changed. If not, the spreading has
+   * attained a fixed point and the runner can
+   * skip the remaining iterations.
    */
   void enterCell(
       exahype::Cell& fineGridCell, exahype::Vertex* const fineGridVertices,
@@ -124,6 +129,10 @@ public:
    * For each solver, set the grid update requested flag
    * for the next iteration.
    *
+   * A solver has attained a stable state if
+   * no cell has changed its limiter status during
+   * this iteration and no mesh update is requested.
+   *
    * <h2>MPI</h2>
    * If this rank is the global master, update the
    * initial grid refinement strategy.
@@ -264,7 +273,8 @@ public:
   virtual ~LimiterStatusSpreading();
 #if defined(SharedMemoryParallelisation)
   /**
-   * Nop.
+   * Merge the solver flags of the worker thread
+   * into the flags of the master thread.
    */
   void mergeWithWorkerThread(const LimiterStatusSpreading& workerThread);
 #endif
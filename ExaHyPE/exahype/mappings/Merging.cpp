@@ -19,6 +19,10 @@
 
 #include "exahype/solvers/LimitingADERDGSolver.h"
 
+#include "exahype/mappings/TimeStepSizeComputation.h"
+
+#include "exahype/profilers/PerformanceReport.h"
+
 #include "peano/utils/UserInterface.h"
 
 peano::CommunicationSpecification
@@ -114,6 +118,10 @@ void exahype::mappings::Merging::beginIteration(
 
   _localState = solverState;
 
+  // A pending non-blocking time step data reduction must be finished
+  // before the master broadcasts its time step data.
+  exahype::mappings::TimeStepSizeComputation::finishNonBlockingTimeStepDataReduction();
+
   logDebug("beginIteration(State)",
       "MergeMode="<<exahype::records::State::toString(_localState.getMergeMode())<<
       ", SendMode="<<exahype::records::State::toString(_localState.getSendMode())<<
@@ -164,6 +172,10 @@ void exahype::mappings::Merging::mergeNeighboursDataAndMetadata(
     const int pos1Scalar,
     const tarch::la::Vector<DIMENSIONS,int>&  pos2,
     const int pos2Scalar) {
+  exahype::profilers::PerformanceReport::ScopedPhase phase(
+      exahype::profilers::PerformanceReport::Phase::NeighbourMerging);
+  exahype::profilers::PerformanceReport::getInstance().countFaces(1);
+
   auto grainSize = peano::datatraversal::autotuning::Oracle::getInstance().
   parallelise(solvers::RegisteredSolvers.size(), peano::datatraversal::autotuning::MethodTrace::UserDefined7);
   pfor(solverNumber, 0, static_cast<int>(solvers::RegisteredSolvers.size()),grainSize.getGrainSize())
@@ -199,6 +211,10 @@ void exahype::mappings::Merging::mergeWithBoundaryDataAndMetadata(
     const int pos1Scalar,
     const tarch::la::Vector<DIMENSIONS,int>&  pos2,
     const int pos2Scalar) {
+  exahype::profilers::PerformanceReport::ScopedPhase phase(
+      exahype::profilers::PerformanceReport::Phase::NeighbourMerging);
+  exahype::profilers::PerformanceReport::getInstance().countFaces(1);
+
   auto grainSize = peano::datatraversal::autotuning::Oracle::getInstance().
   parallelise(solvers::RegisteredSolvers.size(), peano::datatraversal::autotuning::MethodTrace::UserDefined8);
   pfor(solverNumber, 0, static_cast<int>(solvers::RegisteredSolvers.size()),grainSize.getGrainSize())
@@ -368,6 +384,9 @@ void exahype::mappings::Merging::mergeWithNeighbour(
       _localState.getMergeMode()==exahype::records::State::BroadcastAndMergeTimeStepDataAndDropFaceData
   ) {
     // logDebug("mergeWithNeighbour(...)","hasToMerge");
+    // Includes the time spent waiting for the neighbour's messages
+    exahype::profilers::PerformanceReport::ScopedPhase phase(
+        exahype::profilers::PerformanceReport::Phase::RemoteNeighbourMerging);
 
     dfor2(myDest)
       dfor2(mySrc)
@@ -399,6 +418,7 @@ void exahype::mappings::Merging::mergeWithNeighbour(
                   src,dest,
                   fineGridX,level,
                   receivedMetadata);
+              exahype::profilers::PerformanceReport::getInstance().countFaces(1);
             } else { // _localState.getMergeMode()==exahype::records::State::DropFaceData ||
                      // _localState.getMergeMode()==exahype::records::State::BroadcastAndMergeTimeStepDataAndDropFaceData
               dropNeighbourData(
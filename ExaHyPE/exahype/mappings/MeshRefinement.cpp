@@ -23,6 +23,7 @@
 #include "multiscalelinkedcell/HangingVertexBookkeeper.h"
 
 #include "exahype/solvers/LimitingADERDGSolver.h"
+#include "exahype/solvers/PackedCellMigration.h"
 
 #include "exahype/mappings/LimiterStatusSpreading.h"
 
@@ -294,6 +295,8 @@ void exahype::mappings::MeshRefinement::enterCell(
   for (unsigned int solverNumber=0; solverNumber<exahype::solvers::RegisteredSolvers.size(); solverNumber++) {
     auto* solver = exahype::solvers::RegisteredSolvers[solverNumber];
     if (solver->getMeshUpdateRequest()) {
+      const tarch::la::Vector<3,int> previousStatus = getStatusOfCell(fineGridCell,solverNumber);
+
       refineFineGridCell |=
           solver->markForRefinement(
               fineGridCell,
@@ -317,6 +320,11 @@ void exahype::mappings::MeshRefinement::enterCell(
               fineGridPositionOfCell,
               IsInitialMeshRefinement,
               solverNumber);
+
+      // enterCell is serial, we can thus directly update the solver's flag
+      if (!tarch::la::equals(getStatusOfCell(fineGridCell,solverNumber),previousStatus)) {
+        solver->updateNextAttainedStableState(false);
+      }
     }
 
     const int element = solver->tryGetElement(fineGridCell.getCellDescriptionsIndex(),solverNumber);
@@ -362,6 +370,26 @@ void exahype::mappings::MeshRefinement::enterCell(
   logTraceOutWith1Argument("enterCell(...)", fineGridCell);
 }
 
+tarch::la::Vector<3,int> exahype::mappings::MeshRefinement::getStatusOfCell(
+    const exahype::Cell& fineGridCell,
+    const int            solverNumber) {
+  tarch::la::Vector<3,int> status(-1);
+
+  auto* solver = exahype::solvers::RegisteredSolvers[solverNumber];
+  if (solver->getType()==exahype::solvers::Solver::Type::ADERDG ||
+      solver->getType()==exahype::solvers::Solver::Type::LimitingADERDG) {
+    const int element = solver->tryGetElement(fineGridCell.getCellDescriptionsIndex(),solverNumber);
+    if (element!=exahype::solvers::Solver::NotFound) {
+      auto& cellDescription = exahype::solvers::ADERDGSolver::getCellDescription(
+          fineGridCell.getCellDescriptionsIndex(),element);
+      status[0] = cellDescription.getAugmentationStatus();
+      status[1] = cellDescription.getHelperStatus();
+      status[2] = cellDescription.getLimiterStatus();
+    }
+  }
+  return status;
+}
+
 void exahype::mappings::MeshRefinement::leaveCell(
     exahype::Cell& fineGridCell, exahype::Vertex* const fineGridVertices,
     const peano::grid::VertexEnumerator& fineGridVerticesEnumerator,
@@ -517,36 +545,13 @@ void exahype::mappings::MeshRefinement::prepareCopyToRemoteNode(
     const tarch::la::Vector<DIMENSIONS, double>& cellCentre,
     const tarch::la::Vector<DIMENSIONS, double>& cellSize, int level) {
   if (localCell.isInside() && localCell.isInitialised()) {
-    exahype::solvers::ADERDGSolver::sendCellDescriptions(toRank,localCell.getCellDescriptionsIndex(),
-        peano::heap::MessageType::ForkOrJoinCommunication,cellCentre,level);
-    exahype::solvers::FiniteVolumesSolver::sendCellDescriptions(toRank,localCell.getCellDescriptionsIndex(),
-        peano::heap::MessageType::ForkOrJoinCommunication,cellCentre,level);
-
-    for (unsigned int solverNumber=0; solverNumber < exahype::solvers::RegisteredSolvers.size(); solverNumber++) {
-        auto* solver = exahype::solvers::RegisteredSolvers[solverNumber];
-
-      const int element = solver->tryGetElement(localCell.getCellDescriptionsIndex(),solverNumber);
-      if(element!=exahype::solvers::Solver::NotFound) {
-        solver->sendDataToWorkerOrMasterDueToForkOrJoin(
-            toRank,localCell.getCellDescriptionsIndex(),element,cellCentre,level);
-      } else {
-        solver->sendEmptyDataToWorkerOrMasterDueToForkOrJoin(toRank,cellCentre,level);
-      }
-    }
+    exahype::solvers::PackedCellMigration::sendCell(
+        toRank,localCell.getCellDescriptionsIndex(),cellCentre,level);
 
     exahype::solvers::ADERDGSolver::eraseCellDescriptions(localCell.getCellDescriptionsIndex());
     exahype::solvers::FiniteVolumesSolver::eraseCellDescriptions(localCell.getCellDescriptionsIndex());
   } else if (localCell.isInside() && !localCell.isInitialised()){
-    exahype::solvers::ADERDGSolver::sendEmptyCellDescriptions(toRank,
-        peano::heap::MessageType::ForkOrJoinCommunication,cellCentre,level);
-    exahype::solvers::FiniteVolumesSolver::sendEmptyCellDescriptions(toRank,
-        peano::heap::MessageType::ForkOrJoinCommunication,cellCentre,level);
-
-    for (unsigned int solverNumber=0; solverNumber < exahype::solvers::RegisteredSolvers.size(); solverNumber++) {
-       auto* solver = exahype::solvers::RegisteredSolvers[solverNumber];
-
-      solver->sendEmptyDataToWorkerOrMasterDueToForkOrJoin(toRank,cellCentre,level);
-    }
+    exahype::solvers::PackedCellMigration::sendEmptyCell(toRank,cellCentre,level);
   }
 }
 
@@ -563,26 +568,8 @@ void exahype::mappings::MeshRefinement::mergeWithRemoteDataDueToForkOrJoin(
           multiscalelinkedcell::HangingVertexBookkeeper::InvalidAdjacencyIndex);
     }
 
-    exahype::solvers::ADERDGSolver::mergeCellDescriptionsWithRemoteData(
-        fromRank,localCell,
-        peano::heap::MessageType::ForkOrJoinCommunication,
-        cellCentre,level);
-    exahype::solvers::FiniteVolumesSolver::mergeCellDescriptionsWithRemoteData(
-        fromRank,localCell,
-        peano::heap::MessageType::ForkOrJoinCommunication,
-        cellCentre,level);
-
-    for (unsigned int solverNumber=0; solverNumber < exahype::solvers::RegisteredSolvers.size(); solverNumber++) {
-      auto* solver = exahype::solvers::RegisteredSolvers[solverNumber];
-
-      int element = solver->tryGetElement(localCell.getCellDescriptionsIndex(),solverNumber);
-      if (element!=exahype::solvers::Solver::NotFound) {
-        solver->mergeWithWorkerOrMasterDataDueToForkOrJoin(
-            fromRank,localCell.getCellDescriptionsIndex(),element,cellCentre,level);
-      } else {
-        solver->dropWorkerOrMasterDataDueToForkOrJoin(fromRank,cellCentre,level);
-      }
-    }
+    exahype::solvers::PackedCellMigration::mergeCell(
+        fromRank,localCell,cellCentre,level);
   }
 }
 
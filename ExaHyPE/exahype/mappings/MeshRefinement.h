@@ -69,6 +69,24 @@ private:
       bool                                          isCalledByCreationalEvent
   ) const;
 
+  /**
+   * Returns the augmentation, helper, and limiter status
+   * of the ADER-DG cell description the solver with
+   * number \p solverNumber has registered for \p fineGridCell.
+   *
+   * Returns a vector with entries -1 if there is no
+   * such cell description, e.g. for a finite volumes solver.
+   *
+   * enterCell(...) compares the status before and after the
+   * solver has updated the cell. If it has changed,
+   * the solver has not attained a stable state yet as
+   * the neighbours will only observe the change in the
+   * next iteration.
+   */
+  static tarch::la::Vector<3,int> getStatusOfCell(
+      const exahype::Cell& fineGridCell,
+      const int            solverNumber);
+
   #ifdef Parallel
   /**
    * Returns false if the \p cellDescriptionsIndex is invalid,
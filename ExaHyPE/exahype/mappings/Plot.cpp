@@ -23,6 +23,8 @@
 
 #include "exahype/plotters/Plotter.h"
 
+#include "exahype/profilers/PerformanceReport.h"
+
 tarch::logging::Log exahype::mappings::Plot::_log("exahype::mappings::Plot");
 
 tarch::multicore::BooleanSemaphore exahype::mappings::Plot::_semaphoreForPlotting;
@@ -307,7 +309,17 @@ void exahype::mappings::Plot::enterCell(
     exahype::Cell& coarseGridCell,
     const tarch::la::Vector<DIMENSIONS, int>& fineGridPositionOfCell) {
   if ( fineGridCell.isInitialised() ) {
+    exahype::profilers::PerformanceReport::ScopedPhase phase(
+        exahype::profilers::PerformanceReport::Phase::Plotting);
+
     for (auto* plotter : exahype::plotters::RegisteredPlotters) {
+      // Cells outside of a slice or region are skipped before any heap access
+      if (!plotter->isActive() ||
+          !plotter->isPatchActive(
+              fineGridVerticesEnumerator.getVertexPosition(),fineGridVerticesEnumerator.getCellSize())) {
+        continue;
+      }
+
       for (unsigned int solverNumber = 0; solverNumber < exahype::solvers::RegisteredSolvers.size(); ++solverNumber) {
         auto* solver = exahype::solvers::RegisteredSolvers[solverNumber];
 
@@ -84,6 +84,14 @@ class exahype::mappings::Plot {
    * Note that we assume here that we always plot the solution values
    * of the previous iteration.
    * Never have this mapping after mapping SolutionUpdate.
+   *
+   * <h2>Slicing</h2>
+   * Before we look up any cell description, we ask each plotter whether
+   * the cell's bounding box intersects the plotter's slice or region; see
+   * Plotter::isPatchActive(...). Peano does not allow a mapping to skip the
+   * descent into a subtree. However, all cells of a subtree that misses the
+   * region are rejected by this single box test, so a 2d slice through a
+   * 3d grid only reads and locks the cells on the slice.
    */
   void enterCell(
       exahype::Cell& fineGridCell, exahype::Vertex* const fineGridVertices,
@@ -15,6 +15,8 @@
 
 #include "exahype/solvers/Solver.h"
 
+#include "exahype/mappings/TimeStepSizeComputation.h"
+
 peano::CommunicationSpecification
 exahype::mappings::PreProcessing::communicationSpecification() const {
   return peano::CommunicationSpecification(
@@ -230,7 +232,7 @@ void exahype::mappings::PreProcessing::endIteration(
 
 void exahype::mappings::PreProcessing::beginIteration(
     exahype::State& solverState) {
-  // do nothing
+  exahype::mappings::TimeStepSizeComputation::finishNonBlockingTimeStepDataReduction();
 }
 
 #if defined(SharedMemoryParallelisation)
@@ -26,6 +26,10 @@
 
 #include "exahype/amr/AdaptiveMeshRefinement.h"
 
+#include "exahype/profilers/PerformanceReport.h"
+
+#include "kernels/KernelScheduler.h"
+
 #include "peano/utils/UserInterface.h"
 
 peano::CommunicationSpecification
@@ -78,7 +82,8 @@ exahype::mappings::Prediction::descendSpecification(int level) const {
 tarch::logging::Log exahype::mappings::Prediction::_log(
     "exahype::mappings::Prediction");
 
-exahype::mappings::Prediction::Prediction() {}
+exahype::mappings::Prediction::Prediction() :
+  _numberOfReadyCells(0) {}
 
 exahype::mappings::Prediction::~Prediction() {
   exahype::solvers::deleteTemporaryVariables(_temporaryVariables);
@@ -86,12 +91,14 @@ exahype::mappings::Prediction::~Prediction() {
 
 #if defined(SharedMemoryParallelisation)
 exahype::mappings::Prediction::Prediction(const Prediction& masterThread)
-  : _localState(masterThread._localState) {
+  : _localState(masterThread._localState),
+    _numberOfReadyCells(0) {
   exahype::solvers::initialiseTemporaryVariables(_temporaryVariables);
 }
 
 void exahype::mappings::Prediction::mergeWithWorkerThread(
     const Prediction& workerThread) {
+  _numberOfReadyCells += workerThread._numberOfReadyCells;
 }
 #endif
 
@@ -99,11 +106,28 @@ void exahype::mappings::Prediction::beginIteration(
     exahype::State& solverState) {
   _localState = solverState;
 
+  _numberOfReadyCells = 0;
+
   exahype::solvers::initialiseTemporaryVariables(_temporaryVariables);
 }
 
 void exahype::mappings::Prediction::endIteration(
     exahype::State& solverState) {
+  kernels::KernelScheduler::getInstance().setNumberOfReadyCells(_numberOfReadyCells);
+
+  // The rerun predictor uses a stable time step size. Reset the flag on
+  // every rank as it otherwise blocks the next speculative batch of time steps.
+  if (
+      exahype::solvers::ADERDGSolver::SpeculativeTimeStepBatching &&
+      _localState.getAlgorithmSection()==exahype::records::State::AlgorithmSection::PredictionRerunAllSend
+  ) {
+    for (auto* solver : exahype::solvers::RegisteredSolvers) {
+      if (solver->getType()==exahype::solvers::Solver::Type::ADERDG) {
+        static_cast<exahype::solvers::ADERDGSolver*>(solver)->setStabilityConditionWasViolated(false);
+      }
+    }
+  }
+
   exahype::solvers::deleteTemporaryVariables(_temporaryVariables);
 }
 
@@ -147,6 +171,10 @@ void exahype::mappings::Prediction::enterCell(
         exahype::solvers::ADERDGSolver::Heap::getInstance().getData(
             fineGridCell.getCellDescriptionsIndex()).size());
     if (numberOfADERDGCellDescriptions>0) {
+      exahype::profilers::PerformanceReport::ScopedPhase phase(
+          exahype::profilers::PerformanceReport::Phase::Prediction);
+      _numberOfReadyCells++;
+
       auto grainSize = peano::datatraversal::autotuning::Oracle::getInstance().parallelise(
           numberOfADERDGCellDescriptions, peano::datatraversal::autotuning::MethodTrace::UserDefined9);
       pfor(i, 0, numberOfADERDGCellDescriptions, grainSize.getGrainSize())
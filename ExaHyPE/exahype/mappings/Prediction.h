@@ -66,6 +66,11 @@ namespace exahype {
  * As the mapping accesses the state data in a read-only fashion, no special
  * attention is required here.
  *
+ * The mapping counts the cells which are ready for the space-time predictor.
+ * The kernels::KernelScheduler uses this count to decide if the kernels of
+ * the next traversal run serially (enough cells to keep all threads busy)
+ * or split their loops among the threads.
+ *
  * <h2>Optimisations</h2>
  * We dedicate each thread a fixed size space-time predictor,
  * space-time volume flux, predictor, and volume flux
@@ -116,6 +121,14 @@ private:
 
   exahype::solvers::PredictionTemporaryVariables _temporaryVariables;
 
+  /**
+   * Number of cells holding ADER-DG cell descriptions which have been
+   * entered during this traversal. It is handed over to the
+   * kernels::KernelScheduler in endIteration() and determines if the
+   * kernels of the next traversal split their loops among the threads.
+   */
+  int _numberOfReadyCells;
+
  public:
   peano::MappingSpecification touchVertexLastTimeSpecification(int level) const;
   peano::MappingSpecification touchVertexFirstTimeSpecification(int level) const;
@@ -148,7 +161,7 @@ private:
    */
   Prediction(const Prediction& masterThread);
   /**
-   * Nop
+   * Accumulate the number of ready cells.
    */
   void mergeWithWorkerThread(const Prediction& workerThread);
   #endif
@@ -436,7 +449,8 @@ private:
       const tarch::la::Vector<DIMENSIONS, int>& fineGridPositionOfVertex);
 
   /**
-   * Nop
+   * Hand the number of ready cells over to the kernels::KernelScheduler
+   * and delete the temporary variables.
    */
   void endIteration(exahype::State& solverState);
 
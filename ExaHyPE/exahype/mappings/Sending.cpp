@@ -32,6 +32,8 @@
 #include "exahype/solvers/ADERDGSolver.h"
 #include "exahype/solvers/FiniteVolumesSolver.h"
 
+#include "exahype/mappings/TimeStepSizeComputation.h"
+
 #include "exahype/amr/AdaptiveMeshRefinement.h"
 
 
@@ -296,8 +298,9 @@ void exahype::mappings::Sending::prepareSendToMaster(
     const peano::grid::VertexEnumerator& coarseGridVerticesEnumerator,
     const exahype::Cell& coarseGridCell,
     const tarch::la::Vector<DIMENSIONS, int>& fineGridPositionOfCell) {
-  if (_localState.getSendMode()==exahype::records::State::SendMode::ReduceAndMergeTimeStepData ||
-      _localState.getSendMode()==exahype::records::State::SendMode::ReduceAndMergeTimeStepDataAndSendFaceData) {
+  if ((_localState.getSendMode()==exahype::records::State::SendMode::ReduceAndMergeTimeStepData ||
+      _localState.getSendMode()==exahype::records::State::SendMode::ReduceAndMergeTimeStepDataAndSendFaceData) &&
+      !exahype::mappings::TimeStepSizeComputation::reducesTimeStepDataNonBlocking()) {
     for (auto* solver : exahype::solvers::RegisteredSolvers) {
       if (solver->isSending(_localState.getAlgorithmSection())) {
         solver->sendDataToMaster(
@@ -366,8 +369,9 @@ void exahype::mappings::Sending::mergeWithMaster(
     const tarch::la::Vector<DIMENSIONS, int>& fineGridPositionOfCell,
     int worker, const exahype::State& workerState,
     exahype::State& masterState) {
-  if (_localState.getSendMode()==exahype::records::State::SendMode::ReduceAndMergeTimeStepData ||
-      _localState.getSendMode()==exahype::records::State::SendMode::ReduceAndMergeTimeStepDataAndSendFaceData) {
+  if ((_localState.getSendMode()==exahype::records::State::SendMode::ReduceAndMergeTimeStepData ||
+      _localState.getSendMode()==exahype::records::State::SendMode::ReduceAndMergeTimeStepDataAndSendFaceData) &&
+      !exahype::mappings::TimeStepSizeComputation::reducesTimeStepDataNonBlocking()) {
     for (auto* solver : exahype::solvers::RegisteredSolvers) {
       if (solver->isSending(_localState.getAlgorithmSection())) {
         solver->mergeWithWorkerData(
@@ -21,6 +21,8 @@
 #include "exahype/solvers/LimitingADERDGSolver.h"
 
 #include "exahype/VertexOperations.h"
+
+#include "exahype/profilers/PerformanceReport.h"
 #include "multiscalelinkedcell/HangingVertexBookkeeper.h"
 
 
@@ -97,11 +99,15 @@ exahype::mappings::SolutionUpdate::~SolutionUpdate() {
 #if defined(SharedMemoryParallelisation)
 exahype::mappings::SolutionUpdate::SolutionUpdate(
     const SolutionUpdate& masterThread)
-  : _localState(masterThread._localState) {
+  : _localState(masterThread._localState),
+    _activeCouplings(masterThread._activeCouplings),
+    _couplingsActiveFirstTime(masterThread._couplingsActiveFirstTime) {
   exahype::solvers::initialiseTemporaryVariables(_temporaryVariables);
 
   exahype::solvers::initialiseSolverFlags(_solverFlags);
   exahype::solvers::prepareSolverFlags(_solverFlags);
+
+  initialiseInSituAccumulators();
 }
 
 void exahype::mappings::SolutionUpdate::mergeWithWorkerThread(
@@ -111,10 +117,34 @@ void exahype::mappings::SolutionUpdate::mergeWithWorkerThread(
     _solverFlags._limiterDomainChange[i] =
         std::max ( _solverFlags._limiterDomainChange[i],
             workerThread._solverFlags._limiterDomainChange[i] );
+
+    auto* inSituReductions = exahype::solvers::RegisteredSolvers[i]->getInSituReductions();
+    if (inSituReductions!=nullptr && inSituReductions->isActive()) {
+      _inSituAccumulators[i].merge(workerThread._inSituAccumulators[i]);
+    }
   }
 }
 #endif
 
+void exahype::mappings::SolutionUpdate::initialiseInSituAccumulators() {
+  _inSituAccumulators.resize(exahype::solvers::RegisteredSolvers.size());
+  for (unsigned int solverNumber=0; solverNumber < exahype::solvers::RegisteredSolvers.size(); ++solverNumber) {
+    auto* inSituReductions = exahype::solvers::RegisteredSolvers[solverNumber]->getInSituReductions();
+    if (inSituReductions!=nullptr && inSituReductions->isActive()) {
+      inSituReductions->initialiseAccumulator(_inSituAccumulators[solverNumber]);
+    }
+  }
+}
+
+void exahype::mappings::SolutionUpdate::finishInSituReductions() {
+  for (auto* solver : exahype::solvers::RegisteredSolvers) {
+    auto* inSituReductions = solver->getInSituReductions();
+    if (inSituReductions!=nullptr) {
+      inSituReductions->finishPendingReduction();
+    }
+  }
+}
+
 void exahype::mappings::SolutionUpdate::enterCell(
     exahype::Cell& fineGridCell, exahype::Vertex* const fineGridVertices,
     const peano::grid::VertexEnumerator& fineGridVerticesEnumerator,
@@ -132,6 +162,9 @@ void exahype::mappings::SolutionUpdate::enterCell(
   }
 
   if (fineGridCell.isInitialised()) {
+    exahype::profilers::PerformanceReport::ScopedPhase phase(
+        exahype::profilers::PerformanceReport::Phase::SolutionUpdate);
+
     const int numberOfSolvers = exahype::solvers::RegisteredSolvers.size();
     auto grainSize = peano::datatraversal::autotuning::Oracle::getInstance().parallelise(numberOfSolvers, peano::datatraversal::autotuning::MethodTrace::UserDefined17);
     pfor(i, 0, numberOfSolvers, grainSize.getGrainSize())
@@ -146,6 +179,15 @@ void exahype::mappings::SolutionUpdate::enterCell(
               _temporaryVariables._tempUnknowns[i],
               fineGridVertices,
               fineGridVerticesEnumerator);
+          exahype::profilers::PerformanceReport::getInstance().countUpdatedCell(
+              solver,fineGridCell.getCellDescriptionsIndex(),element);
+
+          // Reduce while the updated solution is still in cache
+          auto* inSituReductions = solver->getInSituReductions();
+          if (inSituReductions!=nullptr && inSituReductions->isActive()) {
+            solver->reduceInSitu(
+                fineGridCell.getCellDescriptionsIndex(),element,_inSituAccumulators[i]);
+          }
 
           // The mapping might be also used in GlobalRecomputation branch
           if (solver->getType()==exahype::solvers::Solver::Type::LimitingADERDG) {
@@ -194,18 +236,68 @@ void exahype::mappings::SolutionUpdate::enterCell(
       }
     endpfor
     grainSize.parallelSectionHasTerminated();
+
+    // Couple the solvers while the updated solutions are still in cache
+    coupleSolvers(
+        fineGridCell.getCellDescriptionsIndex(),
+        fineGridVertices,fineGridVerticesEnumerator);
   }
   logTraceOutWith1Argument("enterCell(...)", fineGridCell);
 }
 
+void exahype::mappings::SolutionUpdate::coupleSolvers(
+    const int cellDescriptionsIndex,
+    exahype::Vertex* const fineGridVertices,
+    const peano::grid::VertexEnumerator& fineGridVerticesEnumerator) const {
+  for (auto* coupling : _couplingsActiveFirstTime) {
+    coupling->coupleFirstTime(
+        cellDescriptionsIndex,fineGridVertices,fineGridVerticesEnumerator);
+  }
+  for (auto* coupling : _activeCouplings) {
+    coupling->couple(
+        cellDescriptionsIndex,fineGridVertices,fineGridVerticesEnumerator);
+  }
+}
+
+void exahype::mappings::SolutionUpdate::determineActiveCouplings() {
+  _activeCouplings.clear();
+  _couplingsActiveFirstTime.clear();
+
+  // Reruns of the solution update must not couple the solvers a second time.
+  if (_localState.getAlgorithmSection()==exahype::records::State::TimeStepping) {
+    const double minTimeStamp = exahype::solvers::Solver::getMinSolverTimeStampOfAllSolvers();
+    for (auto* coupling : exahype::solvers::RegisteredSolverCouplings) {
+      if (
+          coupling->getType()==exahype::solvers::SolverCoupling::Type::CellWise &&
+          coupling->isActive(minTimeStamp)
+      ) {
+        auto* cellWiseCoupling = static_cast<exahype::solvers::CellWiseCoupling*>(coupling);
+        if (cellWiseCoupling->isActiveFirstTime()) {
+          _couplingsActiveFirstTime.push_back(cellWiseCoupling);
+        } else {
+          _activeCouplings.push_back(cellWiseCoupling);
+        }
+      }
+    }
+    logDebug("determineActiveCouplings()", _couplingsActiveFirstTime.size()+_activeCouplings.size() << " solver coupling(s) active at t=" << minTimeStamp);
+  }
+}
+
 void exahype::mappings::SolutionUpdate::beginIteration(
     exahype::State& solverState) {
   logTraceInWith1Argument("beginIteration(State)", solverState);
 
   _localState = solverState;
 
+  finishInSituReductions();
+
   if (_localState.getAlgorithmSection()==exahype::records::State::TimeStepping) {
     for (auto* solver : exahype::solvers::RegisteredSolvers) {
+      auto* inSituReductions = solver->getInSituReductions();
+      if (inSituReductions!=nullptr) {
+        inSituReductions->beginTimeStep();
+      }
+
       solver->setNextMeshUpdateRequest();
       solver->setNextAttainedStableState();
 
@@ -220,6 +312,10 @@ void exahype::mappings::SolutionUpdate::beginIteration(
   exahype::solvers::initialiseSolverFlags(_solverFlags);
   exahype::solvers::prepareSolverFlags(_solverFlags);
 
+  initialiseInSituAccumulators();
+
+  determineActiveCouplings();
+
   logTraceOutWith1Argument("beginIteration(State)", solverState);
 }
 
@@ -240,6 +336,11 @@ void exahype::mappings::SolutionUpdate::endIteration(
         limitingADERDGSolver->updateNextLimiterDomainChange(_solverFlags._limiterDomainChange[solverNumber]);
       }
     }
+
+    auto* inSituReductions = solver->getInSituReductions();
+    if (inSituReductions!=nullptr) {
+      inSituReductions->endTimeStep(_inSituAccumulators[solverNumber]);
+    }
   }
 
   deleteTemporaryVariables(_temporaryVariables);
@@ -28,11 +28,21 @@
 #include "exahype/Vertex.h"
 
 #include "exahype/solvers/TemporaryVariables.h"
+#include "exahype/solvers/CellWiseCoupling.h"
+
+#include "exahype/plotters/ascii/InSituReductions.h"
+
+#include <vector>
 
 namespace exahype {
 namespace mappings {
 class SolutionUpdate;
 }
+namespace tests {
+namespace mappings {
+class SolutionUpdateTest;
+}
+}
 }
 
 /**
@@ -47,6 +57,13 @@ class SolutionUpdate;
  *
  * All this is done in enterCell().
  *
+ * <h2>Solver coupling</h2>
+ * If cell-wise solver couplings are registered, we evaluate them in
+ * enterCell() right after all solvers have updated their solution
+ * in the cell, i.e. while the cell's data is still in cache. The coupling
+ * thus does not require a traversal of its own and runs concurrently
+ * on the fine grid just as the solution update.
+ *
  * <h2>Finite Volumes</h2>
  * This is where we do the actual time stepping with the finite volume scheme.
  *
@@ -59,6 +76,8 @@ class SolutionUpdate;
  */
 class exahype::mappings::SolutionUpdate {
 private:
+  friend class exahype::tests::mappings::SolutionUpdateTest;
+
   /**
    * Logging device for the trace macros.
    */
@@ -86,6 +105,62 @@ private:
    */
   exahype::solvers::SolverFlags _solverFlags;
 
+  /**
+   * One accumulator per registered solver for the in-situ
+   * reductions. The entries of solvers without in-situ reductions
+   * or which do not reduce in the current time step are empty.
+   *
+   * Each thread owns a copy; see mergeWithWorkerThread(...).
+   */
+  std::vector<exahype::plotters::ascii::InSituReductions::Accumulator> _inSituAccumulators;
+
+  /**
+   * Resets the accumulators of all solvers which
+   * reduce their solution in the current time step.
+   */
+  void initialiseInSituAccumulators();
+
+ public:
+  /**
+   * Waits for the in-situ reductions all solvers have posted in
+   * the previous time step and writes out their results.
+   *
+   * Called at the beginning of each iteration and by the runner after the
+   * last one. Nop for solvers without a pending reduction.
+   */
+  static void finishInSituReductions();
+
+ private:
+
+  /**
+   * The cell-wise solver couplings which are active in the current
+   * time step and have been active before. Determined once per iteration
+   * in beginIteration(...) as SolverCoupling::isActive(...) advances the
+   * coupling's snapshot time.
+   */
+  std::vector<exahype::solvers::CellWiseCoupling*> _activeCouplings;
+
+  /**
+   * The cell-wise solver couplings which are active in the current
+   * time step for the first time. They invoke CellWiseCoupling::coupleFirstTime(...)
+   * instead of CellWiseCoupling::couple(...).
+   */
+  std::vector<exahype::solvers::CellWiseCoupling*> _couplingsActiveFirstTime;
+
+  /**
+   * Collects the cell-wise couplings which become active in the current
+   * time step into _activeCouplings and _couplingsActiveFirstTime.
+   */
+  void determineActiveCouplings();
+
+  /**
+   * Evaluates the active couplings for the cell at \p cellDescriptionsIndex.
+   */
+  void coupleSolvers(
+      const int cellDescriptionsIndex,
+      exahype::Vertex* const fineGridVertices,
+      const peano::grid::VertexEnumerator& fineGridVerticesEnumerator) const;
+
  public:
   /**
    * Run through the whole tree. Run concurrently on the fine grid.
@@ -134,6 +209,11 @@ private:
    * <h2>Finite volumes<h2>
    * For finite volume solvers, we simply call the
    * solutionUpdate(...) routine.
+   *
+   * <h2>Solver coupling<h2>
+   * After all solvers have updated the cell, we invoke
+   * CellWiseCoupling::couple(...) of every active coupling
+   * for the cell.
    */
   void enterCell(
       exahype::Cell& fineGridCell, exahype::Vertex* const fineGridVertices,
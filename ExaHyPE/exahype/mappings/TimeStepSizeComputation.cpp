@@ -27,6 +27,18 @@
 
 bool exahype::mappings::TimeStepSizeComputation::VetoFusedTimeSteppingTimeStepSizeReinitialisation = false;
 
+bool exahype::mappings::TimeStepSizeComputation::NonBlockingTimeStepDataReduction = false;
+
+#ifdef Parallel
+bool exahype::mappings::TimeStepSizeComputation::_reduceTimeStepDataNonBlockingInThisIteration = false;
+bool exahype::mappings::TimeStepSizeComputation::_nonBlockingReductionIsPending = false;
+exahype::records::State::AlgorithmSection exahype::mappings::TimeStepSizeComputation::_nonBlockingReductionAlgorithmSection =
+    exahype::records::State::AlgorithmSection::TimeStepping;
+std::vector<double> exahype::mappings::TimeStepSizeComputation::_nonBlockingReductionSendBuffer;
+std::vector<double> exahype::mappings::TimeStepSizeComputation::_nonBlockingReductionReceiveBuffer;
+MPI_Request exahype::mappings::TimeStepSizeComputation::_nonBlockingReductionRequest = MPI_REQUEST_NULL;
+#endif
+
 peano::CommunicationSpecification
 exahype::mappings::TimeStepSizeComputation::communicationSpecification() const {
   return peano::CommunicationSpecification(
@@ -121,6 +133,17 @@ void exahype::mappings::TimeStepSizeComputation::beginIteration(
 
   _localState = solverState;
 
+  #ifdef Parallel
+  finishNonBlockingTimeStepDataReduction();
+
+  _reduceTimeStepDataNonBlockingInThisIteration =
+      NonBlockingTimeStepDataReduction &&
+      exahype::State::fuseADERDGPhases() &&
+      _localState.getAlgorithmSection()==exahype::records::State::AlgorithmSection::TimeStepping &&
+      (_localState.getSendMode()==exahype::records::State::SendMode::ReduceAndMergeTimeStepData ||
+      _localState.getSendMode()==exahype::records::State::SendMode::ReduceAndMergeTimeStepDataAndSendFaceData);
+  #endif
+
   prepareLocalTimeStepVariables();
   exahype::solvers::initialiseTemporaryVariables(_temporaryVariables);
 
@@ -142,8 +165,7 @@ void exahype::mappings::TimeStepSizeComputation::reconstructStandardTimeStepping
 }
 
 void exahype::mappings::TimeStepSizeComputation::reinitialiseTimeStepDataIfLastPredictorTimeStepSizeWasInstable(
-    exahype::State& state,
-    exahype::solvers::Solver* solver) const {
+    exahype::solvers::Solver* solver) {
   exahype::solvers::ADERDGSolver* aderdgSolver = nullptr;
 
   switch(solver->getType()) {
@@ -169,8 +191,9 @@ void exahype::mappings::TimeStepSizeComputation::reinitialiseTimeStepDataIfLastP
 
     bool usedTimeStepSizeWasInstable = usedTimeStepSize > stableTimeStepSize;
     aderdgSolver->setStabilityConditionWasViolated(usedTimeStepSizeWasInstable);
+    aderdgSolver->updateTimeStepSizeWeight(usedTimeStepSizeWasInstable);
 
-    const double timeStepSizeWeight = exahype::State::getTimeStepSizeWeightForPredictionRerun();
+    const double timeStepSizeWeight = aderdgSolver->getTimeStepSizeWeight();
     if (usedTimeStepSizeWasInstable) {
       aderdgSolver->updateMinNextPredictorTimeStepSize(
           timeStepSizeWeight * stableTimeStepSize);
@@ -187,6 +210,94 @@ void exahype::mappings::TimeStepSizeComputation::reinitialiseTimeStepDataIfLastP
   }
 }
 
+void exahype::mappings::TimeStepSizeComputation::startNewTimeStep(
+    exahype::solvers::Solver* solver,
+    const exahype::records::State::AlgorithmSection& algorithmSection,
+    const bool reinitialiseTimeStepData) {
+  if (reinitialiseTimeStepData) {
+    reinitialiseTimeStepDataIfLastPredictorTimeStepSizeWasInstable(solver);
+  }
+  solver->startNewTimeStep();
+
+  if (algorithmSection==exahype::records::State::TimeStepping) {
+    solver->setNextMeshUpdateRequest();
+    solver->setNextAttainedStableState();
+    if (solver->getType()==exahype::solvers::Solver::Type::LimitingADERDG) {
+      static_cast<exahype::solvers::LimitingADERDGSolver*>(solver)->setNextLimiterDomainChange();
+      assertion(
+          static_cast<exahype::solvers::LimitingADERDGSolver*>(solver)->getLimiterDomainChange()
+          !=exahype::solvers::LimiterDomainChange::IrregularRequiringMeshUpdate ||
+          solver->getMeshUpdateRequest());
+    }
+  }
+}
+
+bool exahype::mappings::TimeStepSizeComputation::reducesTimeStepDataNonBlocking() {
+  #ifdef Parallel
+  return _reduceTimeStepDataNonBlockingInThisIteration;
+  #else
+  return false;
+  #endif
+}
+
+#ifdef Parallel
+void exahype::mappings::TimeStepSizeComputation::postNonBlockingTimeStepDataReduction(
+    const exahype::records::State::AlgorithmSection& algorithmSection) {
+  assertion(!_nonBlockingReductionIsPending);
+
+  _nonBlockingReductionSendBuffer.clear();
+  for (auto* solver : exahype::solvers::RegisteredSolvers) {
+    if (solver->isComputing(algorithmSection)) {
+      DataHeap::HeapEntries message = solver->compileTimeStepDataForGlobalReduction();
+      _nonBlockingReductionSendBuffer.insert(
+          _nonBlockingReductionSendBuffer.end(),message.begin(),message.end());
+    }
+  }
+  _nonBlockingReductionReceiveBuffer.resize(_nonBlockingReductionSendBuffer.size());
+
+  MPI_Iallreduce(
+      _nonBlockingReductionSendBuffer.data(),_nonBlockingReductionReceiveBuffer.data(),
+      static_cast<int>(_nonBlockingReductionSendBuffer.size()),MPI_DOUBLE,MPI_MIN,
+      tarch::parallel::Node::getInstance().getCommunicator(),&_nonBlockingReductionRequest);
+
+  _nonBlockingReductionAlgorithmSection = algorithmSection;
+  _nonBlockingReductionIsPending        = true;
+
+  logDebug("postNonBlockingTimeStepDataReduction(...)","posted reduction of " <<
+           _nonBlockingReductionSendBuffer.size() << " entries");
+}
+#endif
+
+void exahype::mappings::TimeStepSizeComputation::finishNonBlockingTimeStepDataReduction() {
+  #ifdef Parallel
+  if (_nonBlockingReductionIsPending) {
+    MPI_Wait(&_nonBlockingReductionRequest,MPI_STATUS_IGNORE);
+    _nonBlockingReductionIsPending = false;
+
+    // All ranks hold the same reduced values and thus
+    // perform the same time step update; see endIteration(...).
+    unsigned int offset = 0;
+    for (auto* solver : exahype::solvers::RegisteredSolvers) {
+      if (solver->isComputing(_nonBlockingReductionAlgorithmSection)) {
+        const unsigned int messageSize = solver->compileTimeStepDataForGlobalReduction().size();
+        assertion2(offset+messageSize<=_nonBlockingReductionReceiveBuffer.size(),offset,messageSize);
+        DataHeap::HeapEntries message(
+            _nonBlockingReductionReceiveBuffer.begin()+offset,
+            _nonBlockingReductionReceiveBuffer.begin()+offset+messageSize);
+        offset += messageSize;
+
+        solver->mergeWithGloballyReducedTimeStepData(message);
+        startNewTimeStep(solver,_nonBlockingReductionAlgorithmSection,
+            !VetoFusedTimeSteppingTimeStepSizeReinitialisation);
+
+        logDebug("finishNonBlockingTimeStepDataReduction()","updatedTimeStepSize="<<solver->getMinTimeStepSize());
+      }
+    }
+    VetoFusedTimeSteppingTimeStepSizeReinitialisation = false;
+  }
+  #endif
+}
+
 void exahype::mappings::TimeStepSizeComputation::endIteration(
     exahype::State& state) {
   logTraceInWith1Argument("endIteration(State)", state);
@@ -203,6 +314,12 @@ void exahype::mappings::TimeStepSizeComputation::endIteration(
       solver->updateNextMaxCellSize(_maxCellSizes[solverNumber]);
       solver->updateMinNextTimeStepSize(_minTimeStepSizes[solverNumber]);
 
+      #ifdef Parallel
+      if (_reduceTimeStepDataNonBlockingInThisIteration) {
+        continue; // see finishNonBlockingTimeStepDataReduction()
+      }
+      #endif
+
       if (tarch::parallel::Node::getInstance().getRank()==tarch::parallel::Node::getInstance().getGlobalMasterRank()) {
         assertion4(solver->getNextMinCellSize()<std::numeric_limits<double>::max(),
             solver->getNextMinCellSize(),_minCellSizes[solverNumber],solver->toString(),
@@ -212,26 +329,13 @@ void exahype::mappings::TimeStepSizeComputation::endIteration(
             exahype::records::State::toString(_localState.getAlgorithmSection()));
       }
 
-      if (exahype::State::fuseADERDGPhases()
-      #ifdef Parallel
-      && tarch::parallel::Node::getInstance().getRank()==tarch::parallel::Node::getInstance().getGlobalMasterRank()
-      #endif
-      && !VetoFusedTimeSteppingTimeStepSizeReinitialisation) {
-        reinitialiseTimeStepDataIfLastPredictorTimeStepSizeWasInstable(state,solver);
-      }
-      solver->startNewTimeStep();
-
-      if (_localState.getAlgorithmSection()==exahype::records::State::TimeStepping) {
-        solver->setNextMeshUpdateRequest();
-        solver->setNextAttainedStableState();
-        if (solver->getType()==exahype::solvers::Solver::Type::LimitingADERDG) {
-          static_cast<exahype::solvers::LimitingADERDGSolver*>(solver)->setNextLimiterDomainChange();
-          assertion(
-              static_cast<exahype::solvers::LimitingADERDGSolver*>(solver)->getLimiterDomainChange()
-              !=exahype::solvers::LimiterDomainChange::IrregularRequiringMeshUpdate ||
-              solver->getMeshUpdateRequest());
-        }
-      }
+      const bool reinitialiseTimeStepData =
+          exahype::State::fuseADERDGPhases()
+          #ifdef Parallel
+          && tarch::parallel::Node::getInstance().getRank()==tarch::parallel::Node::getInstance().getGlobalMasterRank()
+          #endif
+          && !VetoFusedTimeSteppingTimeStepSizeReinitialisation;
+      startNewTimeStep(solver,_localState.getAlgorithmSection(),reinitialiseTimeStepData);
 
       if (!exahype::State::fuseADERDGPhases()) {
         reconstructStandardTimeSteppingData(solver);
@@ -241,7 +345,15 @@ void exahype::mappings::TimeStepSizeComputation::endIteration(
     }
   }
 
+  #ifdef Parallel
+  if (_reduceTimeStepDataNonBlockingInThisIteration) {
+    postNonBlockingTimeStepDataReduction(_localState.getAlgorithmSection());
+  } else {
+    VetoFusedTimeSteppingTimeStepSizeReinitialisation = false;
+  }
+  #else
   VetoFusedTimeSteppingTimeStepSizeReinitialisation = false;
+  #endif
 
   exahype::solvers::deleteTemporaryVariables(_temporaryVariables);
   logTraceOutWith1Argument("endIteration(State)", state);
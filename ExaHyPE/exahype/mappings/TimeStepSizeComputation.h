@@ -29,6 +29,12 @@
 
 #include "exahype/solvers/TemporaryVariables.h"
 
+#ifdef Parallel
+#include <mpi.h>
+#endif
+
+#include <vector>
+
 namespace exahype {
   namespace mappings {
     class TimeStepSizeComputation;
@@ -108,7 +114,52 @@ class exahype::mappings::TimeStepSizeComputation {
    * with stable time step sizes if we detect a-posteriori that the CFL condition was
    * harmed by the estimated predictor time step size used in the last iteration.
    */
-  void reinitialiseTimeStepDataIfLastPredictorTimeStepSizeWasInstable(exahype::State& state,exahype::solvers::Solver* solver) const;
+  static void reinitialiseTimeStepDataIfLastPredictorTimeStepSizeWasInstable(exahype::solvers::Solver* solver);
+
+  /**
+   * Perform the time step update on the solver after its "next" time step
+   * data has been reduced, i.e. the part of endIteration(...) which follows
+   * the update of the next time step size and cell sizes.
+   */
+  static void startNewTimeStep(
+      exahype::solvers::Solver* solver,
+      const exahype::records::State::AlgorithmSection& algorithmSection,
+      const bool reinitialiseTimeStepData);
+
+  #ifdef Parallel
+  /**
+   * Set in beginIteration(...). Indicates that this traversal
+   * reduces the time step data with a non-blocking all-reduce.
+   */
+  static bool _reduceTimeStepDataNonBlockingInThisIteration;
+
+  /**
+   * Indicates that a non-blocking reduction has been posted
+   * but not been finished yet.
+   */
+  static bool _nonBlockingReductionIsPending;
+
+  /**
+   * Algorithm section of the traversal which posted the pending reduction.
+   */
+  static exahype::records::State::AlgorithmSection _nonBlockingReductionAlgorithmSection;
+
+  /**
+   * Packed time step data of all solvers: send and receive buffer.
+   */
+  static std::vector<double> _nonBlockingReductionSendBuffer;
+  static std::vector<double> _nonBlockingReductionReceiveBuffer;
+
+  static MPI_Request _nonBlockingReductionRequest;
+
+  /**
+   * Pack the time step data of all solvers computing in
+   * \p algorithmSection and post a single MPI_Iallreduce
+   * (elementwise minimum).
+   */
+  static void postNonBlockingTimeStepDataReduction(
+      const exahype::records::State::AlgorithmSection& algorithmSection);
+  #endif
 
   /**
    * If the original time stepping algorithm is used for the ADER-DG scheme,
@@ -135,6 +186,41 @@ class exahype::mappings::TimeStepSizeComputation {
    */
   static bool VetoFusedTimeSteppingTimeStepSizeReinitialisation;
 
+  /**
+   * Replace the master-worker reduction and broadcast of the
+   * global time step data in the fused time stepping loop by a single
+   * non-blocking all-reduce over all ranks. The reduction is posted
+   * in endIteration(...) and finished lazily by
+   * finishNonBlockingTimeStepDataReduction().
+   *
+   * Requires that all ranks are working, i.e. that there are no idle ranks
+   * which do not take part in the traversals.
+   *
+   * Is configured via the optimisation section of the specification file
+   * (non-blocking-time-step-reduction). Has no effect in builds without MPI.
+   */
+  static bool NonBlockingTimeStepDataReduction;
+
+  /**
+   * \return if the current traversal reduces the global time step data
+   * with a non-blocking all-reduce instead of the master-worker
+   * reduction.
+   *
+   * \see exahype::mappings::Sending
+   */
+  static bool reducesTimeStepDataNonBlocking();
+
+  /**
+   * Wait for a pending non-blocking time step data reduction,
+   * merge the global values into the solvers and start a new time step.
+   * Nop if no reduction is pending.
+   *
+   * Must be called before time step data of a solver is read or
+   * broadcast again, i.e. in beginIteration(...) of the Merging mapping
+   * and in the runner after a traversal.
+   */
+  static void finishNonBlockingTimeStepDataReduction();
+
   /**
    * Run through whole tree. Run concurrently on fine grid.
    */
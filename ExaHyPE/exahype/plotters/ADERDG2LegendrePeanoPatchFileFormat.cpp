@@ -13,6 +13,7 @@
  
 #include "ADERDG2LegendrePeanoPatchFileFormat.h"
 #include "tarch/parallel/Node.h"
+#include "tarch/la/ScalarOperations.h"
 
 #include "peano/utils/Loop.h"
 
@@ -34,6 +35,7 @@
 
 
 #include "kernels/DGBasisFunctions.h"
+#include "kernels/DGResampling.h"
 #include "kernels/aderdg/generic/c/computeGradients.cpph" // derivatives
 
 #include "exahype/plotters/slicing/Slicer.h"
@@ -273,7 +275,9 @@ void exahype::plotters::ADERDG2LegendrePeanoPatchFileFormat::plotVertexData(
 ) {
   assertion( _vertexDataWriter!=nullptr || _writtenUnknowns==0 );
 
-  double* value       = _writtenUnknowns==0 ? nullptr : new double[_writtenUnknowns];
+  static thread_local std::vector<double> valueBuffer;
+  valueBuffer.resize(_writtenUnknowns);
+  double* value = _writtenUnknowns==0 ? nullptr : valueBuffer.data();
 
   // this should go to the header or similar
   const int basisX = _order + 1;
@@ -330,8 +334,9 @@ void exahype::plotters::ADERDG2LegendrePeanoPatchFileFormat::plotCellData(
 ) {
   assertion( _cellDataWriter!=nullptr || _writtenUnknowns==0 );
 
-  double* interpoland = new double[_solverUnknowns];
-  double* value       = _writtenUnknowns==0 ? nullptr : new double[_writtenUnknowns];
+  static thread_local std::vector<double> valueBuffer;
+  valueBuffer.resize(_writtenUnknowns);
+  double* value = _writtenUnknowns==0 ? nullptr : valueBuffer.data();
 
   /****************************
    *  Note: The vtk::Legendre::cells::... plotter has not been tested yet
@@ -341,50 +346,30 @@ void exahype::plotters::ADERDG2LegendrePeanoPatchFileFormat::plotCellData(
    * for correctness.
    ****************************/
 
-  // this should go to the header or similar
-  const int basisX = _order + 1;
-  const int basisY = _order + 1;
-  const int basisZ = (DIMENSIONS == 3 ? _order  : 0 ) + 1;
+  const int numberOfSubcells = tarch::la::aPowI(DIMENSIONS,_order);
 
+  static thread_local std::vector<double> interpolands;
+  interpolands.resize(numberOfSubcells*_solverUnknowns);
+  kernels::resample(u,_solverUnknowns,_order,_order,kernels::ResamplingPoints::GaussLegendreCellCentres,interpolands.data());
+
+  // The gradients are resampled as DIMENSIONS*_solverUnknowns unknowns per node.
   const bool interpolateDerivatives = _postProcessing->mapWithDerivatives();
-  double* inter_gradQ = interpolateDerivatives ? new double[DIMENSIONS * _solverUnknowns] : nullptr;
-  kernels::index idx_gradU(basisZ, basisY, basisX, DIMENSIONS, _solverUnknowns);
-  kernels::index idx_inter_gradU(DIMENSIONS, _solverUnknowns);
+  static thread_local std::vector<double> interpolatedGradients;
+  if (interpolateDerivatives) {
+    interpolatedGradients.resize(numberOfSubcells*DIMENSIONS*_solverUnknowns);
+    kernels::resample(gradU,DIMENSIONS*_solverUnknowns,_order,_order,kernels::ResamplingPoints::GaussLegendreCellCentres,interpolatedGradients.data());
+  }
 
   dfor(i,_order) {
-    // This is inefficient but works. We could look it up directly from the arrays
     tarch::la::Vector<DIMENSIONS, double> p;
     for (int d=0; d<DIMENSIONS; d++) {
       p(d) = offsetOfPatch(d) + (kernels::gaussLegendreNodes[_order][i(d)]+kernels::gaussLegendreNodes[_order][i(d)+1]) * sizeOfPatch(d)/2.0;
     }
-    for (int unknown=0; unknown < _solverUnknowns; unknown++) {
-      interpoland[unknown] = kernels::interpolate(
-        offsetOfPatch.data(),
-        sizeOfPatch.data(),
-        p.data(), // das ist die Position
-        _solverUnknowns,
-        unknown,
-        _order,
-        u
-      );
-    }
+    const int subcell   = peano::utils::dLinearisedWithoutLookup(i,_order);
+    double* interpoland = interpolands.data() + subcell*_solverUnknowns;
 
     if(interpolateDerivatives) {
-      // Inteprolate the given gradients between the cells. We abuse the interpolate' argument
-      // `numberOfUnknowns` with the value `nDim*nVar` in order to circumvent the gradU data ordering.
-      for (int d=0; d < DIMENSIONS; d++) {
-        for (int unknown=0; unknown < _solverUnknowns; unknown++) {
-          inter_gradQ[idx_inter_gradU(d,unknown)] = kernels::interpolate(
-            offsetOfPatch.data(),
-            sizeOfPatch.data(),
-            p.data(),
-            DIMENSIONS * _solverUnknowns,
-            d * _solverUnknowns + unknown,
-            _order,
-            gradU
-          );
-        }
-      }
+      double* inter_gradQ = interpolatedGradients.data() + subcell*DIMENSIONS*_solverUnknowns;
 
       _postProcessing->mapQuantities(
         offsetOfPatch,
@@ -414,13 +399,15 @@ void exahype::plotters::ADERDG2LegendrePeanoPatchFileFormat::plotCellData(
 
     firstCellIndex++;
   }
-
-  if (interpoland!=nullptr)  delete[] interpoland;
-  if (inter_gradQ!=nullptr)  delete[] inter_gradQ;
-  if (value!=nullptr)        delete[] value;
 }
 
 
+bool exahype::plotters::ADERDG2LegendrePeanoPatchFileFormat::isPatchActive(
+    const tarch::la::Vector<DIMENSIONS, double>& offsetOfPatch,
+    const tarch::la::Vector<DIMENSIONS, double>& sizeOfPatch) const {
+  return !slicer || slicer->isPatchActive(offsetOfPatch, sizeOfPatch);
+}
+
 void exahype::plotters::ADERDG2LegendrePeanoPatchFileFormat::plotPatch(const int cellDescriptionsIndex, const int element) {
   auto& aderdgCellDescription = exahype::solvers::ADERDGSolver::getCellDescription(cellDescriptionsIndex,element);
 
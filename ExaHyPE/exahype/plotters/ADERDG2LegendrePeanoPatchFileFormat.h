@@ -96,6 +96,10 @@ class exahype::plotters::ADERDG2LegendrePeanoPatchFileFormat: public exahype::pl
 
   virtual void init(const std::string& filename, int orderPlusOne, int solverUnknowns, int writtenUnknowns, const std::string& select);
 
+  bool isPatchActive(
+      const tarch::la::Vector<DIMENSIONS, double>& offsetOfPatch,
+      const tarch::la::Vector<DIMENSIONS, double>& sizeOfPatch) const override;
+
   void plotPatch(const int cellDescriptionsIndex, const int element) override;
 
   void plotPatch(
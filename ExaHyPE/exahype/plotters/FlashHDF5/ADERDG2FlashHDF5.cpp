@@ -4,6 +4,7 @@
 #include <stdio.h>
 #include <sstream>
 #include <memory>
+#include <vector>
 #include <limits> // signaling_NaN
 
 
@@ -77,6 +78,8 @@ void exahype::plotters::ADERDG2FlashHDF5::interpolateCartesianSlicedPatch(
 #include "kernels/DGMatrices.h"
 #include "exahype/solvers/ADERDGSolver.h"
 #include "kernels/DGBasisFunctions.h"
+#include "kernels/DGResampling.h"
+#include "tarch/la/ScalarOperations.h"
 #include "tarch/logging/Log.h"
 #include <sstream>
 
@@ -163,24 +166,14 @@ void exahype::plotters::ADERDG2FlashHDF5::interpolateCartesianPatch(const dvec&
   const int solverUnknowns = writer->solverUnknowns;
   const int order = basisSize-1;
 
-  double* interpoland = new double[solverUnknowns];
   assertion(sizeOfPatch(0)==sizeOfPatch(1)); // expressing this is all for squared cells.
-  
+
+  static thread_local std::vector<double> interpolands;
+  interpolands.resize(tarch::la::aPowI(DIMENSIONS,basisSize)*solverUnknowns);
+  kernels::resample(u,solverUnknowns,order,basisSize,kernels::ResamplingPoints::EquidistantVertices,interpolands.data());
+
   dfor(i,basisSize) {
-    for (int unknown=0; unknown < solverUnknowns; unknown++) {
-      interpoland[unknown] = 0.0;
-      dfor(ii,basisSize) { // Gauss-Legendre node indices
-        int iGauss = peano::utils::dLinearisedWithoutLookup(ii,order + 1);
-        interpoland[unknown] +=
-		kernels::equidistantGridProjector1d[order][ii(0)][i(0)] *
-		kernels::equidistantGridProjector1d[order][ii(1)][i(1)] *
-		#if DIMENSIONS==3
-		kernels::equidistantGridProjector1d[order][ii(2)][i(2)] *
-		#endif
-		u[iGauss * solverUnknowns + unknown];
-        assertion3(interpoland[unknown] == interpoland[unknown], offsetOfPatch, sizeOfPatch, iGauss);
-      }
-    }
+    double* interpoland = interpolands.data() + peano::utils::dLinearisedWithoutLookup(i,basisSize)*solverUnknowns;
 
     double *value = mappedCell + (DIMENSIONS == 3 ? writer->patchCellIdx->get(i(2),i(1),i(0),0) : writer->patchCellIdx->get(i(1),i(0),0));
     //value += writer->patchCellIdx(i(1),i(0),0); // Transposed position. Correct.
@@ -195,7 +188,6 @@ void exahype::plotters::ADERDG2FlashHDF5::interpolateCartesianPatch(const dvec&
       timeStamp
     );
   }
-  delete[] interpoland;
 
   writer->plotPatch(offsetOfPatch, sizeOfPatch, dx, mappedCell, timeStamp);
 }
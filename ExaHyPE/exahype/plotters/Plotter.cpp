@@ -17,6 +17,7 @@
 #include "exahype/plotters/ADERDG2CartesianPeanoPatchFileFormat.h"
 #include "exahype/plotters/ADERDG2LegendrePeanoPatchFileFormat.h"
 #include "exahype/plotters/VTK/ADERDG2LegendreVTK.h"
+#include "exahype/plotters/VTK/ADERDG2CartesianSliceVTK.h"
 #include "exahype/plotters/CSV/ADERDG2LegendreCSV.h"
 #include "exahype/plotters/VTK/ADERDG2LegendreDivergenceVTK.h"
 #include "exahype/plotters/ADERDG2ProbeAscii.h"
@@ -27,6 +28,8 @@
 #include "exahype/plotters/VTK/FiniteVolumes2VTK.h"
 #include "exahype/plotters/VTK/LimitingADERDG2CartesianVTK.h"
 #include "exahype/plotters/VTK/LimitingADERDGSubcells2CartesianVTK.h"
+#include "exahype/plotters/Snapshot/ADERDG2Snapshot.h"
+#include "exahype/plotters/Snapshot/FiniteVolumes2Snapshot.h"
 #include "exahype/solvers/LimitingADERDGSolver.h"
 
 /* BEGIN Case intensitive string comparison: http://stackoverflow.com/a/23944175 */
@@ -245,6 +248,19 @@ exahype::plotters::Plotter::Plotter(
         _device = new ADERDG2LegendreDivergenceVerticesVTUBinary(postProcessing);
       }
 
+      if (equalsIgnoreCase(_identifier, ADERDG2CartesianSliceVTKAscii::getIdentifier())) {
+        _device = new ADERDG2CartesianSliceVTKAscii(postProcessing,parser.getOffset(),parser.getDomainSize());
+      }
+      if (equalsIgnoreCase(_identifier, ADERDG2CartesianSliceVTKBinary::getIdentifier())) {
+        _device = new ADERDG2CartesianSliceVTKBinary(postProcessing,parser.getOffset(),parser.getDomainSize());
+      }
+      if (equalsIgnoreCase(_identifier, ADERDG2CartesianSliceVTUAscii::getIdentifier())) {
+        _device = new ADERDG2CartesianSliceVTUAscii(postProcessing,parser.getOffset(),parser.getDomainSize());
+      }
+      if (equalsIgnoreCase(_identifier, ADERDG2CartesianSliceVTUBinary::getIdentifier())) {
+        _device = new ADERDG2CartesianSliceVTUBinary(postProcessing,parser.getOffset(),parser.getDomainSize());
+      }
+
       if (equalsIgnoreCase(_identifier, ADERDG2ProbeAscii::getIdentifier())) {
         _device = new ADERDG2ProbeAscii(postProcessing);
       }
@@ -257,6 +273,9 @@ exahype::plotters::Plotter::Plotter(
       if (equalsIgnoreCase(_identifier, ADERDG2FlashHDF5::getIdentifier())) {
         _device = new ADERDG2FlashHDF5(postProcessing);
       }
+      if (equalsIgnoreCase(_identifier, ADERDG2Snapshot::getIdentifier())) {
+        _device = new ADERDG2Snapshot(postProcessing);
+      }
     break;
     case exahype::solvers::Solver::Type::FiniteVolumes:
       /**
@@ -309,6 +328,11 @@ exahype::plotters::Plotter::Plotter(
                 solvers::RegisteredSolvers[_solver])->getGhostLayerWidth()
 	);
       }
+      if (equalsIgnoreCase(_identifier, FiniteVolumes2Snapshot::getIdentifier())) {
+        _device = new FiniteVolumes2Snapshot(
+            postProcessing,static_cast<exahype::solvers::FiniteVolumesSolver*>(
+                solvers::RegisteredSolvers[_solver])->getGhostLayerWidth());
+      }
     break;
     case exahype::solvers::Solver::Type::LimitingADERDG:
       /**
@@ -388,6 +412,19 @@ exahype::plotters::Plotter::Plotter(
         _device = new ADERDG2LegendreDivergenceVerticesVTUBinary(postProcessing);
       }
 
+      if (equalsIgnoreCase(_identifier, ADERDG2CartesianSliceVTKAscii::getIdentifier())) {
+        _device = new ADERDG2CartesianSliceVTKAscii(postProcessing,parser.getOffset(),parser.getDomainSize());
+      }
+      if (equalsIgnoreCase(_identifier, ADERDG2CartesianSliceVTKBinary::getIdentifier())) {
+        _device = new ADERDG2CartesianSliceVTKBinary(postProcessing,parser.getOffset(),parser.getDomainSize());
+      }
+      if (equalsIgnoreCase(_identifier, ADERDG2CartesianSliceVTUAscii::getIdentifier())) {
+        _device = new ADERDG2CartesianSliceVTUAscii(postProcessing,parser.getOffset(),parser.getDomainSize());
+      }
+      if (equalsIgnoreCase(_identifier, ADERDG2CartesianSliceVTUBinary::getIdentifier())) {
+        _device = new ADERDG2CartesianSliceVTUBinary(postProcessing,parser.getOffset(),parser.getDomainSize());
+      }
+
       if (equalsIgnoreCase(_identifier, ADERDG2ProbeAscii::getIdentifier())) {
         _device = new ADERDG2ProbeAscii(postProcessing);
       }
@@ -400,6 +437,9 @@ exahype::plotters::Plotter::Plotter(
       if (equalsIgnoreCase(_identifier, ADERDG2FlashHDF5::getIdentifier())) {
         _device = new ADERDG2FlashHDF5(postProcessing);
       }
+      if (equalsIgnoreCase(_identifier, ADERDG2Snapshot::getIdentifier())) {
+        _device = new ADERDG2Snapshot(postProcessing);
+      }
 
       /**
        * Plotters specifically for the limiting ADER-DG scheme.
@@ -563,6 +603,13 @@ bool exahype::plotters::Plotter::plotDataFromSolver(int solver) const {
 }
 
 
+bool exahype::plotters::Plotter::isPatchActive(
+  const tarch::la::Vector<DIMENSIONS, double>& offsetOfPatch,
+  const tarch::la::Vector<DIMENSIONS, double>& sizeOfPatch) const {
+  return _device!=nullptr && _device->isPatchActive(offsetOfPatch,sizeOfPatch);
+}
+
+
 void exahype::plotters::Plotter::plotPatch(
   const int cellDescriptionsIndex,
   const int element) {
@@ -216,6 +216,21 @@ class exahype::plotters::Plotter {
         const int cellDescriptionsIndex,
         const int element) = 0;
 
+    /**
+     * Geometric selection of patches. Is invoked by the Plot mapping
+     * before it looks up the cell descriptions of a cell. Devices that
+     * slice or clip their output return false for cells which do not
+     * intersect their region; such cells and their data are not touched
+     * at all then.
+     *
+     * The default implementation selects all patches.
+     */
+    virtual bool isPatchActive(
+        const tarch::la::Vector<DIMENSIONS, double>& offsetOfPatch,
+        const tarch::la::Vector<DIMENSIONS, double>& sizeOfPatch) const {
+      return true;
+    }
+
     virtual void startPlotting( double time ) = 0;
     virtual void finishPlotting() = 0;
   };
@@ -299,6 +314,14 @@ class exahype::plotters::Plotter {
    */
   void finishedPlotting();
 
+  /**
+   * @return if the cell with the given geometry may hold data which is
+   *         plotted by this plotter's device; see Device::isPatchActive(...).
+   */
+  bool isPatchActive(
+      const tarch::la::Vector<DIMENSIONS, double>& offsetOfPatch,
+      const tarch::la::Vector<DIMENSIONS, double>& sizeOfPatch) const;
+
   void plotPatch(
       const int cellDescriptionsIndex,const int element);
 
@@ -0,0 +1,149 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/plotters/Snapshot/ADERDG2Snapshot.h"
+
+#include "exahype/plotters/Snapshot/SnapshotWriter.h"
+#include "exahype/solvers/ADERDGSolver.h"
+
+#include "kernels/GaussLegendreQuadrature.h"
+#include "kernels/KernelUtils.h"
+#include "kernels/aderdg/generic/c/computeGradients.cpph" // derivatives
+
+#include "peano/utils/Loop.h"
+#include "tarch/la/ScalarOperations.h"
+
+tarch::logging::Log exahype::plotters::ADERDG2Snapshot::_log("exahype::plotters::ADERDG2Snapshot");
+
+
+exahype::plotters::ADERDG2Snapshot::ADERDG2Snapshot(exahype::plotters::Plotter::UserOnTheFlyPostProcessing* postProcessing):
+  Device(postProcessing),
+  _order(-1),
+  _solverUnknowns(-1),
+  _writtenUnknowns(-1),
+  _writer(nullptr) {
+}
+
+exahype::plotters::ADERDG2Snapshot::~ADERDG2Snapshot() {
+  delete _writer;
+}
+
+std::string exahype::plotters::ADERDG2Snapshot::getIdentifier() {
+  return "Snapshot::Compressed";
+}
+
+void exahype::plotters::ADERDG2Snapshot::init(const std::string& filename, int orderPlusOne, int solverUnknowns, int writtenUnknowns, const std::string& select) {
+  _order           = orderPlusOne-1;
+  _solverUnknowns  = solverUnknowns;
+  _writtenUnknowns = writtenUnknowns;
+
+  double absoluteErrorBound, relativeErrorBound;
+  SnapshotWriter::parseErrorBounds(select,absoluteErrorBound,relativeErrorBound);
+
+  std::vector<double> nodes(orderPlusOne);
+  for (int i=0; i<orderPlusOne; i++) {
+    nodes[i] = kernels::gaussLegendreNodes[_order][i];
+  }
+
+  char** names = new char*[writtenUnknowns];
+  std::fill_n(names, writtenUnknowns, nullptr);
+  _postProcessing->writtenQuantitiesNames(names);
+  std::vector<std::string> namesAsStrings;
+  for (int unknown=0; unknown<writtenUnknowns; unknown++) {
+    namesAsStrings.push_back(names[unknown]!=nullptr ? names[unknown] : "Q"+std::to_string(unknown));
+  }
+  delete[] names;
+
+  _values.resize(tarch::la::aPowI(DIMENSIONS,orderPlusOne)*writtenUnknowns);
+  _writer = new SnapshotWriter(
+      filename,SnapshotWriter::PatchType::Legendre,nodes,writtenUnknowns,namesAsStrings,
+      absoluteErrorBound,relativeErrorBound);
+
+  logInfo("init(...)", "write compressed snapshots to " << filename << " with absolute error bound "
+      << absoluteErrorBound << " and relative error bound " << relativeErrorBound);
+}
+
+void exahype::plotters::ADERDG2Snapshot::startPlotting( double time ) {
+  _writer->startPlotting(time);
+}
+
+void exahype::plotters::ADERDG2Snapshot::finishPlotting() {
+  _writer->finishPlotting();
+}
+
+void exahype::plotters::ADERDG2Snapshot::plotPatch(const int cellDescriptionsIndex, const int element) {
+  auto& cellDescription = exahype::solvers::ADERDGSolver::getCellDescription(cellDescriptionsIndex,element);
+
+  if (cellDescription.getType()==exahype::solvers::ADERDGSolver::CellDescription::Type::Cell) {
+    double* solution = DataHeap::getInstance().getData(cellDescription.getSolution()).data();
+
+    plotPatch(
+        cellDescription.getOffset(),
+        cellDescription.getSize(),
+        solution,
+        cellDescription.getCorrectorTimeStamp());
+  }
+}
+
+void exahype::plotters::ADERDG2Snapshot::plotPatch(
+    const tarch::la::Vector<DIMENSIONS, double>& offsetOfPatch,
+    const tarch::la::Vector<DIMENSIONS, double>& sizeOfPatch, double* u,
+    double timeStamp) {
+  const int basisX = _order + 1;
+  const int basisY = _order + 1;
+  const int basisZ = (DIMENSIONS == 3 ? _order  : 0 ) + 1;
+
+  kernels::index idx_u(basisZ, basisY, basisX, _solverUnknowns);
+  kernels::index idx_gradU(basisZ, basisY, basisX, DIMENSIONS, _solverUnknowns);
+
+  double* gradU = nullptr;
+  if(_postProcessing->mapWithDerivatives()) {
+    gradU = new double[basisZ*basisY*basisX * DIMENSIONS * _solverUnknowns];
+    kernels::aderdg::generic::c::computeGradQ(gradU, u, sizeOfPatch, _solverUnknowns, _order);
+  }
+
+  dfor(i,_order+1) {
+    tarch::la::Vector<DIMENSIONS, double> p;
+    for (int d=0; d<DIMENSIONS; d++) {
+      p(d) = offsetOfPatch(d) + kernels::gaussLegendreNodes[_order][i(d)] * sizeOfPatch(d);
+    }
+
+    double* value = _values.data() + peano::utils::dLinearisedWithoutLookup(i,_order+1)*_writtenUnknowns;
+    if(_postProcessing->mapWithDerivatives()) {
+      _postProcessing->mapQuantities(
+        offsetOfPatch,
+        sizeOfPatch,
+        p,
+        i,
+        u + idx_u(DIMENSIONS == 3 ? i(2) : 0, i(1), i(0), 0),
+        gradU + idx_gradU(DIMENSIONS == 3 ? i(2) : 0, i(1), i(0), 0, 0),
+        value,
+        timeStamp
+      );
+    } else {
+      _postProcessing->mapQuantities(
+        offsetOfPatch,
+        sizeOfPatch,
+        p,
+        i,
+        u + idx_u(DIMENSIONS == 3 ? i(2) : 0, i(1), i(0), 0),
+        value,
+        timeStamp
+      );
+    }
+  }
+
+  delete[] gradU;
+
+  _writer->plotPatch(offsetOfPatch,sizeOfPatch,_values.data(),timeStamp);
+}
@@ -0,0 +1,77 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_PLOTTERS_ADERDG_2_SNAPSHOT_H_
+#define _EXAHYPE_PLOTTERS_ADERDG_2_SNAPSHOT_H_
+
+#include "exahype/plotters/Plotter.h"
+
+#include <vector>
+
+namespace exahype {
+  namespace plotters {
+    class ADERDG2Snapshot;
+    class SnapshotWriter;
+  }
+}
+
+/**
+ * Writes error-bounded compressed snapshots of the nodal values of the
+ * ADER-DG solution at the Gauss-Legendre nodes; see SnapshotFormat.h.
+ *
+ * The error bounds are specified in the select statement, e.g.
+ *
+ *   select = {abserror:1e-8,relerror:1e-4}
+ *
+ * If no bound is given, we use a relative error bound of 1e-6. Use
+ * abserror:0,relerror:0 for lossless output.
+ *
+ * Snapshots can be inspected without loading them completely with
+ *
+ *   ./ExaHyPE-<Application> --extract-snapshot <file>-<counter>.snapidx
+ */
+class exahype::plotters::ADERDG2Snapshot : public exahype::plotters::Plotter::Device {
+ private:
+  static tarch::logging::Log _log;
+
+  int _order;
+  int _solverUnknowns;
+  int _writtenUnknowns;
+
+  SnapshotWriter* _writer;
+
+  /**
+   * The written unknowns of all nodes of the current patch.
+   */
+  std::vector<double> _values;
+
+ public:
+  ADERDG2Snapshot(exahype::plotters::Plotter::UserOnTheFlyPostProcessing* postProcessing);
+  virtual ~ADERDG2Snapshot();
+
+  static std::string getIdentifier();
+
+  virtual void init(const std::string& filename, int orderPlusOne, int solverUnknowns, int writtenUnknowns, const std::string& select);
+
+  void plotPatch(const int cellDescriptionsIndex, const int element) override;
+
+  void plotPatch(
+      const tarch::la::Vector<DIMENSIONS, double>& offsetOfPatch,
+      const tarch::la::Vector<DIMENSIONS, double>& sizeOfPatch, double* u,
+      double timeStamp);
+
+  virtual void startPlotting( double time );
+  virtual void finishPlotting();
+};
+
+#endif
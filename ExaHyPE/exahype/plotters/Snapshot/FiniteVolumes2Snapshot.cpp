@@ -0,0 +1,117 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/plotters/Snapshot/FiniteVolumes2Snapshot.h"
+
+#include "exahype/plotters/Snapshot/SnapshotWriter.h"
+#include "exahype/solvers/FiniteVolumesSolver.h"
+
+#include "peano/utils/Loop.h"
+#include "tarch/la/ScalarOperations.h"
+
+tarch::logging::Log exahype::plotters::FiniteVolumes2Snapshot::_log("exahype::plotters::FiniteVolumes2Snapshot");
+
+
+exahype::plotters::FiniteVolumes2Snapshot::FiniteVolumes2Snapshot(
+    exahype::plotters::Plotter::UserOnTheFlyPostProcessing* postProcessing,
+    const int ghostLayerWidth):
+  Device(postProcessing),
+  _ghostLayerWidth(ghostLayerWidth),
+  _numberOfCellsPerAxis(-1),
+  _solverUnknowns(-1),
+  _writtenUnknowns(-1),
+  _writer(nullptr) {
+}
+
+exahype::plotters::FiniteVolumes2Snapshot::~FiniteVolumes2Snapshot() {
+  delete _writer;
+}
+
+std::string exahype::plotters::FiniteVolumes2Snapshot::getIdentifier() {
+  return "Snapshot::Compressed";
+}
+
+void exahype::plotters::FiniteVolumes2Snapshot::init(const std::string& filename, int numberOfCellsPerAxis, int solverUnknowns, int writtenUnknowns, const std::string& select) {
+  _numberOfCellsPerAxis = numberOfCellsPerAxis;
+  _solverUnknowns       = solverUnknowns;
+  _writtenUnknowns      = writtenUnknowns;
+
+  double absoluteErrorBound, relativeErrorBound;
+  SnapshotWriter::parseErrorBounds(select,absoluteErrorBound,relativeErrorBound);
+
+  std::vector<double> nodes(numberOfCellsPerAxis);
+  for (int i=0; i<numberOfCellsPerAxis; i++) {
+    nodes[i] = (i+0.5)/numberOfCellsPerAxis;
+  }
+
+  char** names = new char*[writtenUnknowns];
+  std::fill_n(names, writtenUnknowns, nullptr);
+  _postProcessing->writtenQuantitiesNames(names);
+  std::vector<std::string> namesAsStrings;
+  for (int unknown=0; unknown<writtenUnknowns; unknown++) {
+    namesAsStrings.push_back(names[unknown]!=nullptr ? names[unknown] : "Q"+std::to_string(unknown));
+  }
+  delete[] names;
+
+  _values.resize(tarch::la::aPowI(DIMENSIONS,numberOfCellsPerAxis)*writtenUnknowns);
+  _writer = new SnapshotWriter(
+      filename,SnapshotWriter::PatchType::Subcells,nodes,writtenUnknowns,namesAsStrings,
+      absoluteErrorBound,relativeErrorBound);
+
+  logInfo("init(...)", "write compressed snapshots to " << filename << " with absolute error bound "
+      << absoluteErrorBound << " and relative error bound " << relativeErrorBound);
+}
+
+void exahype::plotters::FiniteVolumes2Snapshot::startPlotting( double time ) {
+  _writer->startPlotting(time);
+}
+
+void exahype::plotters::FiniteVolumes2Snapshot::finishPlotting() {
+  _writer->finishPlotting();
+}
+
+void exahype::plotters::FiniteVolumes2Snapshot::plotPatch(const int cellDescriptionsIndex, const int element) {
+  auto& cellDescription = exahype::solvers::FiniteVolumesSolver::getCellDescription(cellDescriptionsIndex,element);
+
+  if (cellDescription.getType()==exahype::solvers::FiniteVolumesSolver::CellDescription::Type::Cell) {
+    double* solution = DataHeap::getInstance().getData(cellDescription.getSolution()).data();
+
+    plotPatch(
+        cellDescription.getOffset(),
+        cellDescription.getSize(),
+        solution,
+        cellDescription.getTimeStamp());
+  }
+}
+
+void exahype::plotters::FiniteVolumes2Snapshot::plotPatch(
+    const tarch::la::Vector<DIMENSIONS, double>& offsetOfPatch,
+    const tarch::la::Vector<DIMENSIONS, double>& sizeOfPatch, double* u,
+    double timeStamp) {
+  assertion(sizeOfPatch(0)==sizeOfPatch(1));
+
+  dfor(i,_numberOfCellsPerAxis) {
+    // !!! Be aware of the "2*_ghostLayerWidth" !!!
+    _postProcessing->mapQuantities(
+      offsetOfPatch,
+      sizeOfPatch,
+      offsetOfPatch + (i.convertScalar<double>()+0.5)* (sizeOfPatch(0)/(_numberOfCellsPerAxis)),
+      i,
+      u + peano::utils::dLinearisedWithoutLookup(i+_ghostLayerWidth,_numberOfCellsPerAxis+2*_ghostLayerWidth)*_solverUnknowns,
+      _values.data() + peano::utils::dLinearisedWithoutLookup(i,_numberOfCellsPerAxis)*_writtenUnknowns,
+      timeStamp
+    );
+  }
+
+  _writer->plotPatch(offsetOfPatch,sizeOfPatch,_values.data(),timeStamp);
+}
@@ -0,0 +1,80 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_PLOTTERS_FINITE_VOLUMES_2_SNAPSHOT_H_
+#define _EXAHYPE_PLOTTERS_FINITE_VOLUMES_2_SNAPSHOT_H_
+
+#include "exahype/plotters/Plotter.h"
+
+#include <vector>
+
+namespace exahype {
+  namespace plotters {
+    class FiniteVolumes2Snapshot;
+    class SnapshotWriter;
+  }
+}
+
+/**
+ * Writes error-bounded compressed snapshots of the subcell values of a
+ * Finite Volumes solution; see SnapshotFormat.h. Ghost layers are not
+ * written.
+ *
+ * The error bounds are specified in the select statement as for the
+ * ADERDG2Snapshot device, e.g.
+ *
+ *   select = {abserror:1e-8,relerror:1e-4}
+ *
+ * If no bound is given, we use a relative error bound of 1e-6. Use
+ * abserror:0,relerror:0 for lossless output.
+ *
+ * Snapshots can be inspected without loading them completely with
+ *
+ *   ./ExaHyPE-<Application> --extract-snapshot <file>-<counter>.snapidx
+ */
+class exahype::plotters::FiniteVolumes2Snapshot : public exahype::plotters::Plotter::Device {
+ private:
+  static tarch::logging::Log _log;
+
+  const int _ghostLayerWidth;
+  int       _numberOfCellsPerAxis;
+  int       _solverUnknowns;
+  int       _writtenUnknowns;
+
+  SnapshotWriter* _writer;
+
+  /**
+   * The written unknowns of all subcells of the current patch.
+   */
+  std::vector<double> _values;
+
+ public:
+  FiniteVolumes2Snapshot(exahype::plotters::Plotter::UserOnTheFlyPostProcessing* postProcessing, const int ghostLayerWidth);
+  virtual ~FiniteVolumes2Snapshot();
+
+  static std::string getIdentifier();
+
+  virtual void init(const std::string& filename, int numberOfCellsPerAxis, int solverUnknowns, int writtenUnknowns, const std::string& select);
+
+  void plotPatch(const int cellDescriptionsIndex, const int element) override;
+
+  void plotPatch(
+      const tarch::la::Vector<DIMENSIONS, double>& offsetOfPatch,
+      const tarch::la::Vector<DIMENSIONS, double>& sizeOfPatch, double* u,
+      double timeStamp);
+
+  virtual void startPlotting( double time );
+  virtual void finishPlotting();
+};
+
+#endif
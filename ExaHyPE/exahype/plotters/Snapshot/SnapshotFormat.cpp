@@ -0,0 +1,184 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/plotters/Snapshot/SnapshotFormat.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+
+namespace {
+  /**
+   * We quantise with a slightly smaller step than twice the error
+   * bound such that round-off does not violate the bound.
+   */
+  constexpr double StepSizeFactor = 1.999;
+
+  /**
+   * The largest quantised value; the zigzag encoded differences
+   * then still fit into 64 bits.
+   */
+  constexpr double MaxQuantisedValue = 4.0e18;
+
+  template <typename T>
+  void append(std::vector<unsigned char>& out, const T& value) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&value);
+    out.insert(out.end(),bytes,bytes+sizeof(T));
+  }
+
+  template <typename T>
+  T read(const unsigned char* in) {
+    T value;
+    std::memcpy(&value,in,sizeof(T));
+    return value;
+  }
+
+  uint64_t zigzag(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+  }
+
+  int64_t unzigzag(uint64_t value) {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+  }
+
+  int bitWidth(uint64_t value) {
+    int bits = 0;
+    while (value!=0) {
+      bits++;
+      value >>= 1;
+    }
+    return bits;
+  }
+}
+
+
+std::string exahype::plotters::snapshot::getIndexFileName(const std::string& filename, int counter) {
+  return filename + "-" + std::to_string(counter) + ".snapidx";
+}
+
+std::string exahype::plotters::snapshot::getDataFileName(const std::string& filename, int counter, int rank) {
+  return filename + "-" + std::to_string(counter) + "-rank-" + std::to_string(rank) + ".snap";
+}
+
+void exahype::plotters::snapshot::compressBlock(
+    const double* values, int numberOfValues, double errorBound,
+    std::vector<unsigned char>& out) {
+  bool   isFinite = true;
+  double minimum  = std::numeric_limits<double>::max();
+  double maximum  = -std::numeric_limits<double>::max();
+  for (int i=0; i<numberOfValues; i++) {
+    isFinite &= std::isfinite(values[i]);
+    minimum   = std::min(minimum,values[i]);
+    maximum   = std::max(maximum,values[i]);
+  }
+
+  const double step = StepSizeFactor * errorBound;
+  if (isFinite && errorBound>0.0 && maximum-minimum<=step) {
+    append(out,Encoding::Constant);
+    append(out,0.5*(minimum+maximum));
+  }
+  else if (isFinite && errorBound>0.0 && (maximum-minimum)/step<MaxQuantisedValue) {
+    std::vector<uint64_t> differences(numberOfValues);
+    uint64_t bits     = 0;
+    int64_t  previous = 0;
+    for (int i=0; i<numberOfValues; i++) {
+      const int64_t quantised = std::llround((values[i]-minimum)/step);
+      differences[i] = zigzag(quantised-previous);
+      bits           = std::max(bits,static_cast<uint64_t>(bitWidth(differences[i])));
+      previous       = quantised;
+    }
+
+    append(out,Encoding::Quantised);
+    append(out,minimum);
+    append(out,step);
+    append(out,static_cast<uint8_t>(bits));
+
+    const std::size_t begin = out.size();
+    out.resize(begin + (numberOfValues*bits+7)/8, 0);
+    uint64_t bitPosition = 0;
+    for (int i=0; i<numberOfValues; i++) {
+      for (uint64_t b=0; b<bits; b++, bitPosition++) {
+        if ((differences[i] >> b) & 1) {
+          out[begin + bitPosition/8] |= static_cast<unsigned char>(1 << (bitPosition%8));
+        }
+      }
+    }
+  }
+  else {
+    append(out,Encoding::Raw);
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(values);
+    out.insert(out.end(),bytes,bytes+numberOfValues*sizeof(double));
+  }
+}
+
+std::size_t exahype::plotters::snapshot::decompressBlock(
+    const unsigned char* in, std::size_t numberOfBytes,
+    int numberOfValues, double* values) {
+  if (numberOfBytes<1 || numberOfValues<0) {
+    return 0;
+  }
+  const std::size_t numberOfDoubles = static_cast<std::size_t>(numberOfValues);
+  const Encoding    encoding        = read<Encoding>(in);
+  switch (encoding) {
+    case Encoding::Constant: {
+      const std::size_t blockSize = 1+sizeof(double);
+      if (numberOfBytes<blockSize) {
+        return 0;
+      }
+      if (values!=nullptr) {
+        std::fill_n(values,numberOfValues,read<double>(in+1));
+      }
+      return blockSize;
+    }
+    case Encoding::Quantised: {
+      const std::size_t headerSize = 2+2*sizeof(double);
+      if (numberOfBytes<headerSize) {
+        return 0;
+      }
+      const double   minimum = read<double>(in+1);
+      const double   step    = read<double>(in+1+sizeof(double));
+      const uint64_t bits    = read<uint8_t>(in+1+2*sizeof(double));
+      const std::size_t blockSize = headerSize + (numberOfDoubles*bits+7)/8;
+      if (bits>64 || numberOfBytes<blockSize) {
+        return 0;
+      }
+      const unsigned char* packed = in+headerSize;
+      if (values!=nullptr) {
+        uint64_t bitPosition = 0;
+        int64_t  quantised   = 0;
+        for (int i=0; i<numberOfValues; i++) {
+          uint64_t difference = 0;
+          for (uint64_t b=0; b<bits; b++, bitPosition++) {
+            difference |= static_cast<uint64_t>((packed[bitPosition/8] >> (bitPosition%8)) & 1) << b;
+          }
+          quantised += unzigzag(difference);
+          values[i]  = minimum + quantised*step;
+        }
+      }
+      return blockSize;
+    }
+    case Encoding::Raw: {
+      const std::size_t blockSize = 1+numberOfDoubles*sizeof(double);
+      if (numberOfBytes<blockSize) {
+        return 0;
+      }
+      if (values!=nullptr) {
+        std::memcpy(values,in+1,numberOfDoubles*sizeof(double));
+      }
+      return blockSize;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,145 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_PLOTTERS_SNAPSHOT_SNAPSHOT_FORMAT_H_
+#define _EXAHYPE_PLOTTERS_SNAPSHOT_SNAPSHOT_FORMAT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * <h2>The compressed snapshot format</h2>
+ *
+ * A snapshot consists of one binary data file per rank and an ASCII index
+ * written by the global master rank:
+ *
+ *   <filename>-<counter>.snapidx
+ *   <filename>-<counter>-rank-<rank>.snap
+ *
+ * The index holds everything needed to interpret the data files: the time,
+ * the dimension, the 1d reference coordinates of the nodes within a patch
+ * (Gauss-Legendre nodes for ADER-DG, subcell centres for Finite Volumes),
+ * the error bounds, the names of the variables and the list of data files.
+ *
+ * A data file starts with a FileHeader, followed by the patches and a patch
+ * table of PatchRecords. A FileTrailer at the very end of the file points to
+ * the patch table. Readers thus can read the table and afterwards seek to
+ * exactly those patches which overlap a region of interest.
+ *
+ * The payload of a patch holds one compressed block per variable; see
+ * compressBlock(...). All data is written in the native byte order of the
+ * machine. The header holds a marker to detect mismatches.
+ *
+ * This file, SnapshotFormat.cpp and the SnapshotReader do only depend on the
+ * C++ standard library and can be used outside of ExaHyPE.
+ */
+namespace exahype {
+  namespace plotters {
+    namespace snapshot {
+      constexpr char     FileMagic[8]      = {'E','X','A','S','N','A','P','1'};
+      constexpr char     TrailerMagic[8]   = {'E','X','A','S','N','A','P','T'};
+      constexpr char     IndexMagic[]      = "exahype-snapshot-index";
+      constexpr int      Version           = 1;
+      constexpr uint32_t ByteOrderMarker   = 0x01020304;
+      /**
+       * Readers reject snapshots with more nodes per patch and axis
+       * as corrupted. The limit is far beyond any order we support.
+       */
+      constexpr int      MaxNodesPerAxis   = 256;
+
+      /**
+       * Encodings of a compressed block.
+       */
+      enum class Encoding : uint8_t {
+        /**
+         * All values are within the error bound of a single value.
+         */
+        Constant  = 0,
+        /**
+         * The values are quantised with a step size of (almost) twice the
+         * error bound. The differences of consecutive quantised values are
+         * zigzag encoded and bit-packed with the minimal common bit width.
+         */
+        Quantised = 1,
+        /**
+         * The values are stored without loss. This is used if a value is
+         * not finite or the range of the values is too large to be quantised.
+         */
+        Raw       = 2
+      };
+
+      struct FileHeader {
+        char     magic[8];
+        uint32_t byteOrderMarker;
+        uint32_t version;
+        uint32_t dimensions;
+        uint32_t nodesPerAxis;
+        uint32_t numberOfVariables;
+        uint32_t reserved;
+        double   time;
+      };
+
+      /**
+       * Entry of the patch table. Coordinates beyond the
+       * dimension of the snapshot are zero.
+       */
+      struct PatchRecord {
+        double   offset[3];
+        double   size[3];
+        double   timeStamp;
+        uint64_t fileOffset;
+        uint64_t numberOfBytes;
+      };
+
+      struct FileTrailer {
+        uint64_t tableOffset;
+        uint64_t numberOfPatches;
+        char     magic[8];
+      };
+
+      std::string getIndexFileName(const std::string& filename, int counter);
+
+      std::string getDataFileName(const std::string& filename, int counter, int rank);
+
+      /**
+       * Appends a compressed representation of \p values to \p out.
+       *
+       * Every decompressed value differs by at most \p errorBound from the
+       * original one (plus round-off in the reconstruction). An error bound
+       * of zero or less results in lossless storage.
+       */
+      void compressBlock(
+          const double* values, int numberOfValues, double errorBound,
+          std::vector<unsigned char>& out);
+
+      /**
+       * Decompresses a block written by compressBlock(...).
+       *
+       * @param numberOfBytes The number of bytes available at \p in.
+       *                      We never read beyond these.
+       * @param values Has to provide space for numberOfValues values. Might
+       *               be nullptr in which case the block is only skipped.
+       * @return the number of bytes of the block or 0 if the block is
+       *         corrupted, i.e. has an unknown encoding, a bit width larger
+       *         than 64 or is truncated.
+       */
+      std::size_t decompressBlock(
+          const unsigned char* in, std::size_t numberOfBytes,
+          int numberOfValues, double* values);
+    }
+  }
+}
+
+#endif
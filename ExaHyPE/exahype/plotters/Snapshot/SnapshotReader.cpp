@@ -0,0 +1,353 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/plotters/Snapshot/SnapshotReader.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+
+#include "exahype/plotters/Snapshot/SnapshotFormat.h"
+
+
+exahype::plotters::SnapshotReader::SnapshotReader(const std::string& indexFileName):
+  _time(0.0),
+  _dimensions(0) {
+  const std::string::size_type separator = indexFileName.find_last_of('/');
+  _directory = separator==std::string::npos ? "" : indexFileName.substr(0,separator+1);
+  parseIndex(indexFileName);
+}
+
+void exahype::plotters::SnapshotReader::parseIndex(const std::string& indexFileName) {
+  std::ifstream index(indexFileName);
+  if (!index) {
+    _error = "cannot open snapshot index '" + indexFileName + "'";
+    return;
+  }
+
+  std::string magic, key, dummy;
+  int version = -1;
+  index >> magic >> version;
+  if (magic!=snapshot::IndexMagic || version!=snapshot::Version) {
+    _error = "'" + indexFileName + "' is not a snapshot index of version " + std::to_string(snapshot::Version);
+    return;
+  }
+
+  int numberOfNodes = 0, numberOfVariables = 0, numberOfFiles = 0;
+  double absoluteErrorBound, relativeErrorBound;
+  index >> key >> _time;
+  index >> key >> _dimensions;
+  index >> key >> _patchType;
+  index >> key >> numberOfNodes;
+  if (!index || _dimensions<1 || _dimensions>3 || numberOfNodes<1 || numberOfNodes>snapshot::MaxNodesPerAxis) {
+    _error = "snapshot index '" + indexFileName + "' is corrupted";
+    return;
+  }
+  _nodes.resize(numberOfNodes);
+  for (double& node : _nodes) {
+    index >> node;
+  }
+  index >> key >> dummy >> absoluteErrorBound >> dummy >> relativeErrorBound;
+  index >> key >> numberOfVariables;
+  _variables.resize(std::max(0,numberOfVariables));
+  for (std::string& variable : _variables) {
+    index >> variable;
+  }
+  index >> key >> numberOfFiles;
+  _files.resize(std::max(0,numberOfFiles));
+  for (std::string& file : _files) {
+    index >> file;
+  }
+
+  if (!index || key!="files") {
+    _error = "snapshot index '" + indexFileName + "' is corrupted";
+  }
+}
+
+bool exahype::plotters::SnapshotReader::isValid() const {
+  return _error.empty();
+}
+
+const std::string& exahype::plotters::SnapshotReader::getError() const {
+  return _error;
+}
+
+double exahype::plotters::SnapshotReader::getTime() const {
+  return _time;
+}
+
+int exahype::plotters::SnapshotReader::getDimensions() const {
+  return _dimensions;
+}
+
+const std::string& exahype::plotters::SnapshotReader::getPatchType() const {
+  return _patchType;
+}
+
+const std::vector<double>& exahype::plotters::SnapshotReader::getNodes() const {
+  return _nodes;
+}
+
+const std::vector<std::string>& exahype::plotters::SnapshotReader::getVariables() const {
+  return _variables;
+}
+
+int exahype::plotters::SnapshotReader::getVariableIndex(const std::string& name) const {
+  for (unsigned int variable=0; variable<_variables.size(); variable++) {
+    if (_variables[variable]==name) {
+      return variable;
+    }
+  }
+  return -1;
+}
+
+int exahype::plotters::SnapshotReader::read(
+    const double* const regionMin, const double* const regionMax,
+    const std::vector<int>& variables, const Callback& callback) {
+  if (!isValid()) {
+    return -1;
+  }
+  for (int variable : variables) {
+    if (variable<0 || variable>=static_cast<int>(_variables.size())) {
+      _error = "snapshot has no variable with index " + std::to_string(variable);
+      return -1;
+    }
+  }
+
+  const int nodesPerAxis  = _nodes.size();
+  int       numberOfNodes = 1;
+  for (int d=0; d<_dimensions; d++) {
+    numberOfNodes *= nodesPerAxis;
+  }
+
+  std::vector<snapshot::PatchRecord> patches;
+  std::vector<unsigned char>         payload;
+  std::vector<double>                values(numberOfNodes*variables.size());
+  std::vector<double>                point(variables.size());
+  int numberOfReadPatches = 0;
+
+  for (const std::string& file : _files) {
+    const std::string fileName = _directory + file;
+    FILE* data = fopen(fileName.c_str(),"rb");
+    if (data==nullptr) {
+      _error = "cannot open snapshot file '" + fileName + "'";
+      return -1;
+    }
+
+    // The file has to hold the header, the patch table and the trailer.
+    // All offsets and sizes are checked against the file size before we
+    // allocate or seek such that truncated files are rejected cleanly.
+    snapshot::FileHeader  header;
+    snapshot::FileTrailer trailer;
+    long fileSize = -1;
+    bool isValidFile =
+        fseek(data,0,SEEK_END)==0 &&
+        (fileSize=ftell(data))>=static_cast<long>(sizeof(header)+sizeof(trailer)) &&
+        fseek(data,0,SEEK_SET)==0 &&
+        fread(&header,sizeof(header),1,data)==1 &&
+        std::memcmp(header.magic,snapshot::FileMagic,sizeof(header.magic))==0 &&
+        header.byteOrderMarker==snapshot::ByteOrderMarker &&
+        header.version==static_cast<uint32_t>(snapshot::Version) &&
+        static_cast<int>(header.dimensions)==_dimensions &&
+        static_cast<int>(header.nodesPerAxis)==nodesPerAxis &&
+        header.numberOfVariables==_variables.size() &&
+        fseek(data,-static_cast<long>(sizeof(trailer)),SEEK_END)==0 &&
+        fread(&trailer,sizeof(trailer),1,data)==1 &&
+        std::memcmp(trailer.magic,snapshot::TrailerMagic,sizeof(trailer.magic))==0;
+    const uint64_t tableEnd = static_cast<uint64_t>(fileSize)-sizeof(trailer);
+    isValidFile &=
+        trailer.tableOffset>=sizeof(header) &&
+        trailer.tableOffset<=tableEnd &&
+        trailer.numberOfPatches==(tableEnd-trailer.tableOffset)/sizeof(snapshot::PatchRecord) &&
+        (tableEnd-trailer.tableOffset)%sizeof(snapshot::PatchRecord)==0;
+    if (isValidFile) {
+      patches.resize(trailer.numberOfPatches);
+      isValidFile =
+          fseek(data,static_cast<long>(trailer.tableOffset),SEEK_SET)==0 &&
+          fread(patches.data(),sizeof(snapshot::PatchRecord),patches.size(),data)==patches.size();
+    }
+
+    for (unsigned int p=0; isValidFile && p<patches.size(); p++) {
+      const snapshot::PatchRecord& patch = patches[p];
+      bool overlaps = true;
+      for (int d=0; d<_dimensions; d++) {
+        overlaps &= patch.offset[d]<=regionMax[d] && patch.offset[d]+patch.size[d]>=regionMin[d];
+      }
+      if (!overlaps) {
+        continue;
+      }
+
+      isValidFile =
+          patch.fileOffset>=sizeof(header) &&
+          patch.fileOffset<=trailer.tableOffset &&
+          patch.numberOfBytes<=trailer.tableOffset-patch.fileOffset;
+      if (!isValidFile) {
+        break;
+      }
+      payload.resize(patch.numberOfBytes);
+      isValidFile =
+          fseek(data,static_cast<long>(patch.fileOffset),SEEK_SET)==0 &&
+          fread(payload.data(),1,payload.size(),data)==payload.size();
+
+      // Decompress the requested variables and skip all others
+      std::size_t position = 0;
+      for (unsigned int variable=0; isValidFile && variable<_variables.size(); variable++) {
+        double* target = nullptr;
+        for (unsigned int v=0; v<variables.size(); v++) {
+          if (variables[v]==static_cast<int>(variable)) {
+            target = values.data() + v*numberOfNodes;
+          }
+        }
+        const std::size_t blockSize = snapshot::decompressBlock(
+            payload.data()+position,payload.size()-position,numberOfNodes,target);
+        isValidFile = blockSize>0;
+        position   += blockSize;
+      }
+      if (!isValidFile) {
+        break;
+      }
+      numberOfReadPatches++;
+
+      for (int node=0; node<numberOfNodes; node++) {
+        double x[3] = {0.0, 0.0, 0.0};
+        bool   isInside = true;
+        for (int d=0, i=node; d<_dimensions; d++, i/=nodesPerAxis) {
+          x[d]      = patch.offset[d] + _nodes[i%nodesPerAxis]*patch.size[d];
+          isInside &= x[d]>=regionMin[d] && x[d]<=regionMax[d];
+        }
+        if (isInside) {
+          for (unsigned int v=0; v<variables.size(); v++) {
+            point[v] = values[v*numberOfNodes+node];
+          }
+          callback(x,point.data());
+        }
+      }
+    }
+    fclose(data);
+
+    if (!isValidFile) {
+      _error = "snapshot file '" + fileName + "' is corrupted or was written on a different architecture";
+      return -1;
+    }
+  }
+  return numberOfReadPatches;
+}
+
+
+int exahype::plotters::snapshot::extract(const std::vector<std::string>& arguments) {
+  if (arguments.empty()) {
+    std::cerr << "no snapshot index specified" << std::endl;
+    return -1;
+  }
+
+  SnapshotReader reader(arguments[0]);
+  if (!reader.isValid()) {
+    std::cerr << reader.getError() << std::endl;
+    return -1;
+  }
+  const int dimensions = reader.getDimensions();
+
+  std::vector<int> variables;
+  double regionMin[3] = {-std::numeric_limits<double>::max(), -std::numeric_limits<double>::max(), -std::numeric_limits<double>::max()};
+  double regionMax[3] = { std::numeric_limits<double>::max(),  std::numeric_limits<double>::max(),  std::numeric_limits<double>::max()};
+  std::string outputFileName;
+
+  for (unsigned int i=1; i<arguments.size(); i++) {
+    const std::string::size_type separator = arguments[i].find('=');
+    const std::string key   = arguments[i].substr(0,separator);
+    std::string       value = separator==std::string::npos ? "" : arguments[i].substr(separator+1);
+    for (char& c : value) {
+      c = c==',' ? ' ' : c;
+    }
+    std::istringstream values(value);
+
+    if (key=="variables") {
+      std::string name;
+      while (values >> name) {
+        int variable = reader.getVariableIndex(name);
+        if (variable<0 && name.find_first_not_of("0123456789")==std::string::npos) {
+          variable = std::stoi(name);
+        }
+        if (variable<0 || variable>=static_cast<int>(reader.getVariables().size())) {
+          std::cerr << "snapshot has no variable '" << name << "'" << std::endl;
+          return -1;
+        }
+        variables.push_back(variable);
+      }
+    }
+    else if (key=="region") {
+      for (int d=0; d<dimensions; d++) values >> regionMin[d];
+      for (int d=0; d<dimensions; d++) values >> regionMax[d];
+      if (!values) {
+        std::cerr << "region requires " << 2*dimensions << " coordinates" << std::endl;
+        return -1;
+      }
+    }
+    else if (key=="output") {
+      outputFileName = value;
+    }
+    else {
+      std::cerr << "unknown argument '" << arguments[i] << "'" << std::endl;
+      return -1;
+    }
+  }
+
+  if (variables.empty()) {
+    for (unsigned int variable=0; variable<reader.getVariables().size(); variable++) {
+      variables.push_back(variable);
+    }
+  }
+
+  std::ofstream outputFile;
+  if (!outputFileName.empty()) {
+    outputFile.open(outputFileName);
+    if (!outputFile) {
+      std::cerr << "cannot open output file '" << outputFileName << "'" << std::endl;
+      return -1;
+    }
+  }
+  std::ostream& out = outputFileName.empty() ? std::cout : outputFile;
+  out.precision(std::numeric_limits<double>::digits10+2);
+
+  const char* coordinates[3] = {"x", "y", "z"};
+  out << "# time " << reader.getTime() << std::endl << "#";
+  for (int d=0; d<dimensions; d++) {
+    out << " " << coordinates[d];
+  }
+  for (int variable : variables) {
+    out << " " << reader.getVariables()[variable];
+  }
+  out << std::endl;
+
+  const int numberOfReadPatches = reader.read(
+      regionMin,regionMax,variables,
+      [&] (const double* const x, const double* const values) -> void {
+        for (int d=0; d<dimensions; d++) {
+          out << x[d] << " ";
+        }
+        for (unsigned int v=0; v<variables.size(); v++) {
+          out << values[v] << (v+1<variables.size() ? " " : "");
+        }
+        out << "\n";
+      });
+  if (numberOfReadPatches<0) {
+    std::cerr << reader.getError() << std::endl;
+    return -1;
+  }
+
+  std::cerr << "extracted data of " << numberOfReadPatches << " patches" << std::endl;
+  return 0;
+}
@@ -0,0 +1,101 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_PLOTTERS_SNAPSHOT_SNAPSHOT_READER_H_
+#define _EXAHYPE_PLOTTERS_SNAPSHOT_SNAPSHOT_READER_H_
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace exahype {
+  namespace plotters {
+    class SnapshotReader;
+
+    namespace snapshot {
+      /**
+       * Command line front end of the SnapshotReader; see exahype/main.cpp.
+       *
+       * @param arguments The index file followed by optional arguments
+       *                  variables=<name|index>[,...],
+       *                  region=<x0>,<y0>[,<z0>],<x1>,<y1>[,<z1>] and
+       *                  output=<file>.
+       * @return 0 on success.
+       */
+      int extract(const std::vector<std::string>& arguments);
+    }
+  }
+}
+
+/**
+ * Reads compressed snapshots written by the SnapshotWriter.
+ *
+ * The reader only loads the patch tables of the data files. The payload of
+ * a patch is read only if the patch overlaps the region of interest and
+ * only the requested variables are decompressed. Large snapshots thus can
+ * be inspected on a workstation.
+ *
+ * This class does only depend on the C++ standard library. Errors are
+ * reported via isValid() and getError().
+ */
+class exahype::plotters::SnapshotReader {
+ public:
+  /**
+   * Is invoked for every node inside the region with the coordinates
+   * (always three) and the values of the requested variables.
+   */
+  typedef std::function<void(const double* const x, const double* const values)> Callback;
+
+ private:
+  std::string              _directory;
+  std::string              _error;
+  double                   _time;
+  int                      _dimensions;
+  std::string              _patchType;
+  std::vector<double>      _nodes;
+  std::vector<std::string> _variables;
+  std::vector<std::string> _files;
+
+  void parseIndex(const std::string& indexFileName);
+
+ public:
+  SnapshotReader(const std::string& indexFileName);
+
+  bool isValid() const;
+  const std::string& getError() const;
+
+  double getTime() const;
+  int getDimensions() const;
+  const std::string& getPatchType() const;
+  const std::vector<double>& getNodes() const;
+  const std::vector<std::string>& getVariables() const;
+
+  /**
+   * @return the index of the variable \p name or -1.
+   */
+  int getVariableIndex(const std::string& name) const;
+
+  /**
+   * Reads all nodes within the box [\p regionMin, \p regionMax]. Only the
+   * first getDimensions() coordinates of the region are considered.
+   *
+   * @param variables Indices of the variables to read.
+   * @return the number of patches which have been decompressed or -1 if
+   *         an error occurred.
+   */
+  int read(
+      const double* const regionMin, const double* const regionMax,
+      const std::vector<int>& variables, const Callback& callback);
+};
+
+#endif
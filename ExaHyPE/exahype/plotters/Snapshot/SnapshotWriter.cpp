@@ -0,0 +1,218 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/plotters/Snapshot/SnapshotWriter.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+
+#include "tarch/Assertions.h"
+#include "tarch/la/ScalarOperations.h"
+#include "tarch/parallel/Node.h"
+#include "tarch/parallel/NodePool.h"
+
+#include "exahype/Parser.h"
+
+tarch::logging::Log exahype::plotters::SnapshotWriter::_log("exahype::plotters::SnapshotWriter");
+
+
+exahype::plotters::SnapshotWriter::SnapshotWriter(
+    const std::string&              filename,
+    const PatchType                 patchType,
+    const std::vector<double>&      nodes,
+    const int                       writtenUnknowns,
+    const std::vector<std::string>& names,
+    const double                    absoluteErrorBound,
+    const double                    relativeErrorBound):
+  _filename(filename),
+  _patchType(patchType),
+  _nodes(nodes),
+  _numberOfNodes(tarch::la::aPowI(DIMENSIONS,static_cast<int>(nodes.size()))),
+  _writtenUnknowns(writtenUnknowns),
+  _names(names),
+  _absoluteErrorBound(std::max(0.0,absoluteErrorBound)),
+  _relativeErrorBound(std::max(0.0,relativeErrorBound)),
+  _fileCounter(0),
+  _time(0.0),
+  _file(nullptr),
+  _uncompressedBytes(0.0),
+  _compressedBytes(0.0) {
+  for (int unknown=static_cast<int>(_names.size()); unknown<_writtenUnknowns; unknown++) {
+    _names.push_back("Q"+std::to_string(unknown));
+  }
+  _names.resize(_writtenUnknowns);
+  _block.resize(_numberOfNodes);
+}
+
+exahype::plotters::SnapshotWriter::~SnapshotWriter() {
+  if (_file!=nullptr) {
+    fclose(_file);
+  }
+}
+
+const char* exahype::plotters::SnapshotWriter::toString(const PatchType& patchType) {
+  switch (patchType) {
+    case PatchType::Legendre: return "Legendre";
+    case PatchType::Subcells: return "Subcells";
+  }
+  return "undefined";
+}
+
+void exahype::plotters::SnapshotWriter::parseErrorBounds(
+    const std::string& select, double& absoluteErrorBound, double& relativeErrorBound) {
+  absoluteErrorBound = exahype::Parser::getValueFromPropertyString(select,"abserror");
+  relativeErrorBound = exahype::Parser::getValueFromPropertyString(select,"relerror");
+
+  if (std::isnan(absoluteErrorBound) && std::isnan(relativeErrorBound)) {
+    relativeErrorBound = 1e-6;
+  }
+  absoluteErrorBound = std::isnan(absoluteErrorBound) ? 0.0 : absoluteErrorBound;
+  relativeErrorBound = std::isnan(relativeErrorBound) ? 0.0 : relativeErrorBound;
+}
+
+void exahype::plotters::SnapshotWriter::startPlotting(const double time) {
+  assertion(_file==nullptr);
+  _time = time;
+  _patches.clear();
+  _uncompressedBytes = 0.0;
+  _compressedBytes   = 0.0;
+
+  const std::string dataFileName = snapshot::getDataFileName(
+      _filename,_fileCounter,tarch::parallel::Node::getInstance().getRank());
+  _file = fopen(dataFileName.c_str(),"wb");
+  if (_file==nullptr) {
+    logError("startPlotting(...)", "Cannot open snapshot file at '" << dataFileName << "': " << strerror(errno));
+    exit(-1);
+  }
+
+  snapshot::FileHeader header;
+  std::memcpy(header.magic,snapshot::FileMagic,sizeof(header.magic));
+  header.byteOrderMarker   = snapshot::ByteOrderMarker;
+  header.version           = snapshot::Version;
+  header.dimensions        = DIMENSIONS;
+  header.nodesPerAxis      = _nodes.size();
+  header.numberOfVariables = _writtenUnknowns;
+  header.reserved          = 0;
+  header.time              = time;
+  fwrite(&header,sizeof(header),1,_file);
+}
+
+void exahype::plotters::SnapshotWriter::plotPatch(
+    const tarch::la::Vector<DIMENSIONS, double>& offsetOfPatch,
+    const tarch::la::Vector<DIMENSIONS, double>& sizeOfPatch,
+    const double* const values,
+    const double timeStamp) {
+  assertion(_file!=nullptr);
+
+  _payload.clear();
+  for (int unknown=0; unknown<_writtenUnknowns; unknown++) {
+    double maximumModulus = 0.0;
+    for (int node=0; node<_numberOfNodes; node++) {
+      _block[node]   = values[node*_writtenUnknowns+unknown];
+      maximumModulus = std::max(maximumModulus,std::abs(_block[node]));
+    }
+    const double errorBound = std::isfinite(maximumModulus) ?
+        std::max(_absoluteErrorBound,_relativeErrorBound*maximumModulus) : 0.0;
+    snapshot::compressBlock(_block.data(),_numberOfNodes,errorBound,_payload);
+  }
+
+  snapshot::PatchRecord record;
+  std::fill_n(record.offset,3,0.0);
+  std::fill_n(record.size,3,0.0);
+  for (int d=0; d<DIMENSIONS; d++) {
+    record.offset[d] = offsetOfPatch(d);
+    record.size[d]   = sizeOfPatch(d);
+  }
+  record.timeStamp     = timeStamp;
+  record.fileOffset    = ftell(_file);
+  record.numberOfBytes = _payload.size();
+  _patches.push_back(record);
+
+  fwrite(_payload.data(),1,_payload.size(),_file);
+
+  _uncompressedBytes += static_cast<double>(_numberOfNodes)*_writtenUnknowns*sizeof(double);
+  _compressedBytes   += _payload.size();
+}
+
+void exahype::plotters::SnapshotWriter::finishPlotting() {
+  assertion(_file!=nullptr);
+
+  snapshot::FileTrailer trailer;
+  trailer.tableOffset     = ftell(_file);
+  trailer.numberOfPatches = _patches.size();
+  std::memcpy(trailer.magic,snapshot::TrailerMagic,sizeof(trailer.magic));
+
+  fwrite(_patches.data(),sizeof(snapshot::PatchRecord),_patches.size(),_file);
+  fwrite(&trailer,sizeof(trailer),1,_file);
+  const bool failed = ferror(_file)!=0;
+  fclose(_file);
+  _file = nullptr;
+
+  if (failed) {
+    logError("finishPlotting()", "Writing snapshot " << _fileCounter << " to '" << _filename << "' failed.");
+  }
+
+  logInfo("finishPlotting()", "wrote " << _patches.size() << " patches of snapshot " << _fileCounter
+      << ", compression ratio " << (_compressedBytes>0.0 ? _uncompressedBytes/_compressedBytes : 0.0));
+
+  if (tarch::parallel::Node::getInstance().isGlobalMaster()) {
+    writeIndex();
+  }
+  _fileCounter++;
+}
+
+void exahype::plotters::SnapshotWriter::writeIndex() const {
+  const std::string indexFileName = snapshot::getIndexFileName(_filename,_fileCounter);
+  FILE* index = fopen(indexFileName.c_str(),"w");
+  if (index==nullptr) {
+    logError("writeIndex()", "Cannot open snapshot index at '" << indexFileName << "': " << strerror(errno));
+    exit(-1);
+  }
+
+  fprintf(index,"%s %d\n",snapshot::IndexMagic,snapshot::Version);
+  fprintf(index,"time %.17e\n",_time);
+  fprintf(index,"dimensions %d\n",DIMENSIONS);
+  fprintf(index,"patchtype %s\n",toString(_patchType));
+  fprintf(index,"nodes %d",static_cast<int>(_nodes.size()));
+  for (double node : _nodes) {
+    fprintf(index," %.17e",node);
+  }
+  fprintf(index,"\nerrorbound absolute %.17e relative %.17e\n",_absoluteErrorBound,_relativeErrorBound);
+  fprintf(index,"variables %d",_writtenUnknowns);
+  for (const std::string& name : _names) {
+    fprintf(index," %s",name.c_str());
+  }
+  fputs("\n",index);
+
+  // The data files are referenced relative to the index file
+  const std::string::size_type separator = _filename.find_last_of('/');
+  const std::string basename = separator==std::string::npos ? _filename : _filename.substr(separator+1);
+
+  std::vector<int> ranks(1,tarch::parallel::Node::getInstance().getRank());
+  #ifdef Parallel
+  for (int rank=0; rank<tarch::parallel::Node::getInstance().getNumberOfNodes(); rank++) {
+    if (rank!=tarch::parallel::Node::getGlobalMasterRank() &&
+        !tarch::parallel::NodePool::getInstance().isIdleNode(rank)) {
+      ranks.push_back(rank);
+    }
+  }
+  #endif
+
+  fprintf(index,"files %d\n",static_cast<int>(ranks.size()));
+  for (int rank : ranks) {
+    fprintf(index,"%s\n",snapshot::getDataFileName(basename,_fileCounter,rank).c_str());
+  }
+  fclose(index);
+}
@@ -0,0 +1,146 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_PLOTTERS_SNAPSHOT_SNAPSHOT_WRITER_H_
+#define _EXAHYPE_PLOTTERS_SNAPSHOT_SNAPSHOT_WRITER_H_
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "peano/utils/Globals.h"
+#include "tarch/la/Vector.h"
+#include "tarch/logging/Log.h"
+
+#include "exahype/plotters/Snapshot/SnapshotFormat.h"
+
+namespace exahype {
+  namespace plotters {
+    class SnapshotWriter;
+  }
+}
+
+/**
+ * Writes the compressed snapshots of ADERDG2Snapshot and
+ * FiniteVolumes2Snapshot; see SnapshotFormat.h for the file format.
+ *
+ * Every rank writes its patches into its own data file. No data is
+ * exchanged between the ranks. The global master rank additionally writes
+ * the index which lists the data files of all ranks which hold a part of
+ * the grid.
+ *
+ * <h2>Error bound</h2>
+ * The error bound of a variable within a patch is the maximum of the
+ * absolute error bound and the relative error bound times the maximum
+ * modulus of the variable within the patch. Smooth patches thus are stored
+ * with very few bits per value while the structure of small-scale features
+ * is preserved.
+ */
+class exahype::plotters::SnapshotWriter {
+ public:
+  enum class PatchType {
+    /**
+     * The nodes of a patch are the tensor product Gauss-Legendre nodes.
+     */
+    Legendre,
+    /**
+     * The nodes of a patch are the centres of the Finite Volumes subcells.
+     */
+    Subcells
+  };
+
+ private:
+  static tarch::logging::Log _log;
+
+  const std::string         _filename;
+  const PatchType           _patchType;
+  const std::vector<double> _nodes;
+  const int                 _numberOfNodes;
+  const int                 _writtenUnknowns;
+  std::vector<std::string>  _names;
+  const double              _absoluteErrorBound;
+  const double              _relativeErrorBound;
+
+  int    _fileCounter;
+  double _time;
+  FILE*  _file;
+  std::vector<snapshot::PatchRecord> _patches;
+
+  /**
+   * Buffers reused for all patches.
+   */
+  std::vector<double>        _block;
+  std::vector<unsigned char> _payload;
+
+  double _uncompressedBytes;
+  double _compressedBytes;
+
+  void writeIndex() const;
+
+ public:
+  /**
+   * @param nodes              The 1d coordinates of the nodes of a patch
+   *                           relative to the unit interval.
+   * @param names              The names of the written unknowns. Might be
+   *                           shorter than writtenUnknowns.
+   * @param absoluteErrorBound Might be zero.
+   * @param relativeErrorBound Might be zero. If both bounds are zero, the
+   *                           data is stored without loss.
+   */
+  SnapshotWriter(
+      const std::string&              filename,
+      const PatchType                 patchType,
+      const std::vector<double>&      nodes,
+      const int                       writtenUnknowns,
+      const std::vector<std::string>& names,
+      const double                    absoluteErrorBound,
+      const double                    relativeErrorBound);
+
+  ~SnapshotWriter();
+
+  // Disallow copy and assignment
+  SnapshotWriter(const SnapshotWriter& other) = delete;
+  SnapshotWriter& operator=(const SnapshotWriter& other) = delete;
+
+  void startPlotting(const double time);
+
+  /**
+   * Compresses and writes a patch.
+   *
+   * @param values The written unknowns of all nodes of the patch.
+   *               The layout is [node][unknown] with the node index
+   *               running fastest in x direction.
+   */
+  void plotPatch(
+      const tarch::la::Vector<DIMENSIONS, double>& offsetOfPatch,
+      const tarch::la::Vector<DIMENSIONS, double>& sizeOfPatch,
+      const double* const values,
+      const double timeStamp);
+
+  /**
+   * Writes the patch table and closes the rank's data file.
+   * The global master rank further writes the index.
+   */
+  void finishPlotting();
+
+  static const char* toString(const PatchType& patchType);
+
+  /**
+   * Reads the keys abserror and relerror from the select statement of a
+   * plotter. Falls back to a relative error bound of 1e-6 if neither key
+   * is specified.
+   */
+  static void parseErrorBounds(const std::string& select, double& absoluteErrorBound, double& relativeErrorBound);
+};
+
+#endif
@@ -0,0 +1,402 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "ADERDG2CartesianSliceVTK.h"
+
+#include "tarch/la/ScalarOperations.h"
+
+#include "kernels/DGResampling.h"
+
+#include "tarch/plotter/griddata/unstructured/vtk/VTKTextFileWriter.h"
+#include "tarch/plotter/griddata/unstructured/vtk/VTKBinaryFileWriter.h"
+#include "tarch/plotter/griddata/unstructured/vtk/VTUTextFileWriter.h"
+#include "tarch/plotter/griddata/unstructured/vtk/VTUBinaryFileWriter.h"
+
+#include "exahype/plotters/slicing/CartesianSlicer.h"
+#include "exahype/solvers/ADERDGSolver.h"
+
+#include "kernels/aderdg/generic/c/computeGradients.cpph" // derivatives
+
+tarch::logging::Log exahype::plotters::ADERDG2CartesianSliceVTK::_log("exahype::plotters::ADERDG2CartesianSliceVTK");
+
+
+std::string exahype::plotters::ADERDG2CartesianSliceVTKAscii::getIdentifier() {
+  return "vtk::Cartesian::slice::ascii";
+}
+
+
+exahype::plotters::ADERDG2CartesianSliceVTKAscii::ADERDG2CartesianSliceVTKAscii(
+    exahype::plotters::Plotter::UserOnTheFlyPostProcessing* postProcessing,
+    const tarch::la::Vector<DIMENSIONS, double>& domainOffset,
+    const tarch::la::Vector<DIMENSIONS, double>& domainSize):
+    ADERDG2CartesianSliceVTK(postProcessing,domainOffset,domainSize,PlotterType::ASCIIVTK) {
+}
+
+
+std::string exahype::plotters::ADERDG2CartesianSliceVTKBinary::getIdentifier() {
+  return "vtk::Cartesian::slice::binary";
+}
+
+
+exahype::plotters::ADERDG2CartesianSliceVTKBinary::ADERDG2CartesianSliceVTKBinary(
+    exahype::plotters::Plotter::UserOnTheFlyPostProcessing* postProcessing,
+    const tarch::la::Vector<DIMENSIONS, double>& domainOffset,
+    const tarch::la::Vector<DIMENSIONS, double>& domainSize):
+    ADERDG2CartesianSliceVTK(postProcessing,domainOffset,domainSize,PlotterType::BinaryVTK) {
+}
+
+
+std::string exahype::plotters::ADERDG2CartesianSliceVTUAscii::getIdentifier() {
+  return "vtu::Cartesian::slice::ascii";
+}
+
+
+exahype::plotters::ADERDG2CartesianSliceVTUAscii::ADERDG2CartesianSliceVTUAscii(
+    exahype::plotters::Plotter::UserOnTheFlyPostProcessing* postProcessing,
+    const tarch::la::Vector<DIMENSIONS, double>& domainOffset,
+    const tarch::la::Vector<DIMENSIONS, double>& domainSize):
+    ADERDG2CartesianSliceVTK(postProcessing,domainOffset,domainSize,PlotterType::ASCIIVTU) {
+}
+
+
+std::string exahype::plotters::ADERDG2CartesianSliceVTUBinary::getIdentifier() {
+  return "vtu::Cartesian::slice::binary";
+}
+
+
+exahype::plotters::ADERDG2CartesianSliceVTUBinary::ADERDG2CartesianSliceVTUBinary(
+    exahype::plotters::Plotter::UserOnTheFlyPostProcessing* postProcessing,
+    const tarch::la::Vector<DIMENSIONS, double>& domainOffset,
+    const tarch::la::Vector<DIMENSIONS, double>& domainSize):
+    ADERDG2CartesianSliceVTK(postProcessing,domainOffset,domainSize,PlotterType::BinaryVTU) {
+}
+
+
+exahype::plotters::ADERDG2CartesianSliceVTK::ADERDG2CartesianSliceVTK(
+    exahype::plotters::Plotter::UserOnTheFlyPostProcessing* postProcessing,
+    const tarch::la::Vector<DIMENSIONS, double>& domainOffset,
+    const tarch::la::Vector<DIMENSIONS, double>& domainSize,
+    PlotterType plotterType):
+  Device(postProcessing),
+  _fileCounter(-1),
+  _plotterType(plotterType),
+  _domainOffset(domainOffset),
+  _domainSize(domainSize),
+  _order(-1),
+  _solverUnknowns(-1),
+  _writtenUnknowns(-1),
+  _time(0.0),
+  _slicer(nullptr),
+  _gridWriter(nullptr),
+  _vertexWriter(nullptr),
+  _cellWriter(nullptr),
+  _vertexTimeStampDataWriter(nullptr),
+  _vertexDataWriter(nullptr) {
+}
+
+
+exahype::plotters::ADERDG2CartesianSliceVTK::~ADERDG2CartesianSliceVTK() {
+  if (_slicer!=nullptr) delete _slicer;
+}
+
+
+void exahype::plotters::ADERDG2CartesianSliceVTK::init(
+  const std::string& filename,
+  int                orderPlusOne,
+  int                unknowns,
+  int                writtenUnknowns,
+  const std::string& select
+) {
+  _filename          = filename;
+  _order             = orderPlusOne-1;
+  _solverUnknowns    = unknowns;
+  _writtenUnknowns   = writtenUnknowns;
+
+  _slicer = CartesianSlicer::fromSelectionQuery(select);
+  if (_order<1) {
+    // The vertices are spaced sizeOfPatch/order apart.
+    logError("init(...)", "plotter " << filename << " requires an ADER-DG solver of order 1 or higher. Got order "
+        << _order << ". No data will be written.");
+    delete _slicer;
+    _slicer = nullptr;
+  }
+  else if (!_slicer->clips() || _slicer->targetDim<1) {
+    logError("init(...)", "plotter " << filename << " requires a plane or a line in its select statement, e.g. select={z:0.5}. Got '"
+        << select << "'. No data will be written.");
+    delete _slicer;
+    _slicer = nullptr;
+  }
+  else {
+    logInfo("init(...)", "Plotting selection "<<_slicer->toString()<<" to Files "<<filename);
+  }
+}
+
+
+bool exahype::plotters::ADERDG2CartesianSliceVTK::isPatchActive(
+    const tarch::la::Vector<DIMENSIONS, double>& offsetOfPatch,
+    const tarch::la::Vector<DIMENSIONS, double>& sizeOfPatch) const {
+  if (_slicer==nullptr) {
+    return false;
+  }
+  for (int d=0; d<DIMENSIONS; d++) {
+    if (_slicer->active(d)) {
+      const double upperBound       = offsetOfPatch(d)+sizeOfPatch(d);
+      const bool   isDomainBoundary = tarch::la::equals(upperBound,_domainOffset(d)+_domainSize(d));
+      if (
+          _slicer->req(d) < offsetOfPatch(d) ||
+          (isDomainBoundary  && tarch::la::greater(_slicer->req(d),upperBound)) ||
+          (!isDomainBoundary && _slicer->req(d) >= upperBound)
+      ) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+
+void exahype::plotters::ADERDG2CartesianSliceVTK::startPlotting( double time ) {
+  _fileCounter++;
+
+  if (_writtenUnknowns>0) {
+    switch (_plotterType) {
+      case PlotterType::BinaryVTK:
+        _gridWriter = new tarch::plotter::griddata::unstructured::vtk::VTKBinaryFileWriter();
+        break;
+      case PlotterType::ASCIIVTK:
+        _gridWriter = new tarch::plotter::griddata::unstructured::vtk::VTKTextFileWriter();
+        break;
+      case PlotterType::BinaryVTU:
+        _gridWriter = new tarch::plotter::griddata::unstructured::vtk::VTUBinaryFileWriter();
+        break;
+      case PlotterType::ASCIIVTU:
+        _gridWriter = new tarch::plotter::griddata::unstructured::vtk::VTUTextFileWriter();
+        break;
+    }
+
+    _vertexWriter              = _gridWriter->createVertexWriter();
+    _cellWriter                = _gridWriter->createCellWriter();
+    _vertexDataWriter          = _gridWriter->createVertexDataWriter("Q", _writtenUnknowns);
+    _vertexTimeStampDataWriter = _gridWriter->createVertexDataWriter("time", 1);
+
+    assertion( _gridWriter!=nullptr );
+    assertion( _vertexWriter!=nullptr );
+    assertion( _cellWriter!=nullptr );
+  }
+
+  _postProcessing->startPlotting( time );
+
+  _time = time;
+}
+
+
+void exahype::plotters::ADERDG2CartesianSliceVTK::finishPlotting() {
+  _postProcessing->finishPlotting();
+
+  if ( _writtenUnknowns>0 ) {
+    assertion( _gridWriter!=nullptr );
+
+    _vertexWriter->close();
+    _cellWriter->close();
+    _vertexDataWriter->close();
+    _vertexTimeStampDataWriter->close();
+
+    std::ostringstream snapshotFileName;
+    snapshotFileName << _filename
+                     << "-" << _fileCounter;
+
+    switch (_plotterType) {
+      case PlotterType::BinaryVTK:
+        break;
+      case PlotterType::ASCIIVTK:
+        break;
+      case PlotterType::BinaryVTU:
+        _timeSeriesWriter.addSnapshot( snapshotFileName.str(), _time);
+        _timeSeriesWriter.writeFile(_filename);
+        break;
+      case PlotterType::ASCIIVTU:
+        _timeSeriesWriter.addSnapshot( snapshotFileName.str(), _time);
+        _timeSeriesWriter.writeFile(_filename);
+        break;
+    }
+
+    const bool hasBeenSuccessful =
+      _gridWriter->writeToFile(snapshotFileName.str());
+    if (!hasBeenSuccessful) {
+      exit(-1);
+    }
+  }
+
+  if (_vertexDataWriter!=nullptr)          delete _vertexDataWriter;
+  if (_vertexTimeStampDataWriter!=nullptr) delete _vertexTimeStampDataWriter;
+  if (_vertexWriter!=nullptr)              delete _vertexWriter;
+  if (_cellWriter!=nullptr)                delete _cellWriter;
+  if (_gridWriter!=nullptr)                delete _gridWriter;
+
+  _vertexDataWriter          = nullptr;
+  _vertexTimeStampDataWriter = nullptr;
+  _vertexWriter              = nullptr;
+  _cellWriter                = nullptr;
+  _gridWriter                = nullptr;
+}
+
+
+int exahype::plotters::ADERDG2CartesianSliceVTK::plotSliceGrid(
+  const tarch::la::Vector<DIMENSIONS, double>& offsetOfPatch,
+  const tarch::la::Vector<DIMENSIONS, double>& sizeOfPatch
+) {
+  assertion(_vertexWriter!=nullptr);
+  assertion(_cellWriter!=nullptr);
+
+  const int numberOfVertices = tarch::la::aPowI(_slicer->targetDim,_order+1);
+
+  int firstVertex = -1;
+  for (int vertex=0; vertex<numberOfVertices; vertex++) {
+    tarch::la::Vector<DIMENSIONS, double> p = _slicer->project(offsetOfPatch);
+    for (int r=0, j=vertex; r<_slicer->targetDim; r++, j/=(_order+1)) {
+      const int axis = _slicer->runningAxes(r);
+      p(axis) = offsetOfPatch(axis) + (j%(_order+1)) * (sizeOfPatch(axis)/_order);
+    }
+
+    const int newVertexNumber = _vertexWriter->plotVertex(p);
+    firstVertex = firstVertex==-1 ? newVertexNumber : firstVertex;
+  }
+
+  if (_slicer->targetDim==2) {
+    for (int j=0; j<_order; j++) {
+      for (int i=0; i<_order; i++) {
+        int cellsVertexIndices[4];
+        cellsVertexIndices[0] = firstVertex + (i+0) + (j+0) * (_order+1);
+        cellsVertexIndices[1] = firstVertex + (i+1) + (j+0) * (_order+1);
+        cellsVertexIndices[2] = firstVertex + (i+0) + (j+1) * (_order+1);
+        cellsVertexIndices[3] = firstVertex + (i+1) + (j+1) * (_order+1);
+        _cellWriter->plotQuadrangle(cellsVertexIndices);
+      }
+    }
+  }
+  else {
+    for (int i=0; i<_order; i++) {
+      int cellsVertexIndices[2];
+      cellsVertexIndices[0] = firstVertex + i;
+      cellsVertexIndices[1] = firstVertex + i + 1;
+      _cellWriter->plotLine(cellsVertexIndices);
+    }
+  }
+
+  return firstVertex;
+}
+
+
+void exahype::plotters::ADERDG2CartesianSliceVTK::plotPatch(const int cellDescriptionsIndex, const int element) {
+  auto& aderdgCellDescription = exahype::solvers::ADERDGSolver::getCellDescription(cellDescriptionsIndex,element);
+
+  if (aderdgCellDescription.getType()==exahype::solvers::ADERDGSolver::CellDescription::Type::Cell) {
+    double* solverSolution = DataHeap::getInstance().getData(aderdgCellDescription.getSolution()).data();
+
+    plotPatch(
+        aderdgCellDescription.getOffset(),
+        aderdgCellDescription.getSize(), solverSolution,
+        aderdgCellDescription.getCorrectorTimeStamp());
+  }
+}
+
+
+void exahype::plotters::ADERDG2CartesianSliceVTK::plotPatch(
+    const tarch::la::Vector<DIMENSIONS, double>& offsetOfPatch,
+    const tarch::la::Vector<DIMENSIONS, double>& sizeOfPatch,
+    double* u,
+    double timeStamp) {
+  if (_writtenUnknowns==0 || !isPatchActive(offsetOfPatch, sizeOfPatch)) {
+    return;
+  }
+  assertion( _vertexWriter && _cellWriter && _gridWriter && _vertexDataWriter && _vertexTimeStampDataWriter );
+  assertion(sizeOfPatch(0)==sizeOfPatch(1));
+
+  // Evaluation matrices: equidistant vertices along the running axes and a
+  // single point on the slice along the normal axes
+  static thread_local std::vector<double> normalMatrices;
+  normalMatrices.resize(DIMENSIONS*(_order+1));
+  const double* evaluationMatrices[DIMENSIONS];
+  int           numberOfPoints[DIMENSIONS];
+  for (int d=0; d<DIMENSIONS; d++) {
+    if (_slicer->active(d)) {
+      const double xRef = (_slicer->req(d)-offsetOfPatch(d))/sizeOfPatch(d);
+      kernels::computeEvaluationMatrix1d(_order,&xRef,1,normalMatrices.data()+d*(_order+1));
+      evaluationMatrices[d] = normalMatrices.data()+d*(_order+1);
+      numberOfPoints[d]     = 1;
+    }
+    else {
+      evaluationMatrices[d] = kernels::getEvaluationMatrix1d(_order,_order+1,kernels::ResamplingPoints::EquidistantVertices);
+      numberOfPoints[d]     = _order+1;
+    }
+  }
+
+  // The normal axes have extent one, i.e. the vertices are enumerated
+  // exactly as in plotSliceGrid(...)
+  const int numberOfVertices = tarch::la::aPowI(_slicer->targetDim,_order+1);
+  static thread_local std::vector<double> interpolands;
+  interpolands.resize(numberOfVertices*_solverUnknowns);
+  kernels::resample(u,_solverUnknowns,_order,evaluationMatrices,numberOfPoints,interpolands.data());
+
+  const bool interpolateDerivatives = _postProcessing->mapWithDerivatives();
+  static thread_local std::vector<double> gradU;
+  static thread_local std::vector<double> interpolatedGradients;
+  if (interpolateDerivatives) {
+    gradU.resize(tarch::la::aPowI(DIMENSIONS,_order+1)*DIMENSIONS*_solverUnknowns);
+    kernels::aderdg::generic::c::computeGradQ(gradU.data(), u, sizeOfPatch, _solverUnknowns, _order);
+    interpolatedGradients.resize(numberOfVertices*DIMENSIONS*_solverUnknowns);
+    kernels::resample(gradU.data(),DIMENSIONS*_solverUnknowns,_order,evaluationMatrices,numberOfPoints,interpolatedGradients.data());
+  }
+
+  static thread_local std::vector<double> valueBuffer;
+  valueBuffer.resize(_writtenUnknowns);
+  double* value = valueBuffer.data();
+
+  const int firstVertex = plotSliceGrid(offsetOfPatch,sizeOfPatch);
+  for (int vertex=0; vertex<numberOfVertices; vertex++) {
+    tarch::la::Vector<DIMENSIONS, int>    i(0);
+    tarch::la::Vector<DIMENSIONS, double> p = _slicer->project(offsetOfPatch);
+    for (int r=0, j=vertex; r<_slicer->targetDim; r++, j/=(_order+1)) {
+      const int axis = _slicer->runningAxes(r);
+      i(axis) = j%(_order+1);
+      p(axis) = offsetOfPatch(axis) + i(axis) * (sizeOfPatch(axis)/_order);
+    }
+
+    double* interpoland = interpolands.data() + vertex*_solverUnknowns;
+    if (interpolateDerivatives) {
+      _postProcessing->mapQuantities(
+        offsetOfPatch,
+        sizeOfPatch,
+        p,
+        i,
+        interpoland,
+        interpolatedGradients.data() + vertex*DIMENSIONS*_solverUnknowns,
+        value,
+        timeStamp
+      );
+    } else {
+      _postProcessing->mapQuantities(
+        offsetOfPatch,
+        sizeOfPatch,
+        p,
+        i,
+        interpoland,
+        value,
+        timeStamp
+      );
+    }
+
+    _vertexDataWriter->plotVertex(firstVertex+vertex, value, _writtenUnknowns);
+    _vertexTimeStampDataWriter->plotVertex(firstVertex+vertex, timeStamp);
+  }
+}
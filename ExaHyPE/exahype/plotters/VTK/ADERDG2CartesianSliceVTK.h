@@ -0,0 +1,186 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_PLOTTERS_ADERDG_2_CARTESIAN_SLICE_VTK_H_
+#define _EXAHYPE_PLOTTERS_ADERDG_2_CARTESIAN_SLICE_VTK_H_
+
+#include "exahype/plotters/Plotter.h"
+
+#include "tarch/plotter/griddata/unstructured/UnstructuredGridWriter.h"
+#include "tarch/plotter/griddata/VTUTimeSeriesWriter.h"
+
+namespace exahype {
+  namespace plotters {
+    class ADERDG2CartesianSliceVTK;
+
+    class ADERDG2CartesianSliceVTKAscii;
+    class ADERDG2CartesianSliceVTKBinary;
+    class ADERDG2CartesianSliceVTUAscii;
+    class ADERDG2CartesianSliceVTUBinary;
+
+    class CartesianSlicer; // external forward decl, #include exahype/plotters/slicing/CartesianSlicer.h
+  }
+  namespace tests {
+    namespace plotters {
+      class ADERDG2CartesianSliceVTKTest;
+    }
+  }
+}
+
+/**
+ * Plots the ADER-DG solution on an axis-aligned plane or line only.
+ *
+ * The slice is specified as for the CartesianSlicer, e.g. select={z:0.5}
+ * for the plane z=0.5 or select={y:0,z:0} for a line parallel to the x
+ * axis. In contrast to the other VTK plotters which write all patches
+ * that touch the slice, this plotter evaluates the DG polynomial directly
+ * on the slice and writes a grid of the slice's dimension: (order+1)^2
+ * equidistant vertices and order^2 quadrangles per patch on a plane and
+ * order+1 vertices and order lines per patch on a line. Solvers of order
+ * zero have no such grid and are rejected in init(...).
+ *
+ * The evaluation is a tensor-product sweep (see kernels::resample) where
+ * the axes normal to the slice are collapsed onto a single point.
+ *
+ * A patch is responsible for the slice if the slice lies in the half-open
+ * interval [offset,offset+size) along all normal axes. Slices on faces
+ * between two patches thus are written once. If the patch's upper face
+ * lies on the upper boundary of the domain, the interval is closed so
+ * that slices on this boundary are written, too.
+ */
+class exahype::plotters::ADERDG2CartesianSliceVTK: public exahype::plotters::Plotter::Device {
+  protected:
+   enum class PlotterType {
+     BinaryVTK,
+     ASCIIVTK,
+     BinaryVTU,
+     ASCIIVTU
+   };
+ private:
+  friend class exahype::tests::plotters::ADERDG2CartesianSliceVTKTest;
+
+  static tarch::logging::Log _log;
+
+  int               _fileCounter;
+  const PlotterType _plotterType;
+
+  /**
+   * Offset and size of the computational domain. Required to detect
+   * patches whose upper face lies on the domain boundary.
+   */
+  const tarch::la::Vector<DIMENSIONS, double> _domainOffset;
+  const tarch::la::Vector<DIMENSIONS, double> _domainSize;
+
+  std::string       _filename;
+  int               _order;
+  int               _solverUnknowns;
+  int               _writtenUnknowns;
+
+  /**
+   * Is obviously only used if we use vtu instead of the vtk legacy format.
+   */
+  tarch::plotter::griddata::VTUTimeSeriesWriter _timeSeriesWriter;
+
+  /**
+   * To memorise the time argument from startPlotter(). We need it when we close the plotter for the time series.
+   */
+  double _time;
+
+  /**
+   * Is nullptr if the select statement does not specify a plane or line.
+   */
+  exahype::plotters::CartesianSlicer* _slicer;
+
+  tarch::plotter::griddata::unstructured::UnstructuredGridWriter*                _gridWriter;
+  tarch::plotter::griddata::unstructured::UnstructuredGridWriter::VertexWriter*  _vertexWriter;
+  tarch::plotter::griddata::unstructured::UnstructuredGridWriter::CellWriter*    _cellWriter;
+
+  tarch::plotter::griddata::Writer::VertexDataWriter*  _vertexTimeStampDataWriter;
+  tarch::plotter::griddata::Writer::VertexDataWriter*  _vertexDataWriter;
+
+  /**
+   * Plots the vertices and cells of the slice through a patch.
+   *
+   * @return the index of the first vertex.
+   */
+  int plotSliceGrid(
+    const tarch::la::Vector<DIMENSIONS, double>& offsetOfPatch,
+    const tarch::la::Vector<DIMENSIONS, double>& sizeOfPatch
+  );
+
+ public:
+  ADERDG2CartesianSliceVTK(
+      exahype::plotters::Plotter::UserOnTheFlyPostProcessing* postProcessing,
+      const tarch::la::Vector<DIMENSIONS, double>& domainOffset,
+      const tarch::la::Vector<DIMENSIONS, double>& domainSize,
+      PlotterType plotterType);
+  virtual ~ADERDG2CartesianSliceVTK();
+
+  virtual void init(const std::string& filename, int orderPlusOne, int solverUnknowns, int writtenUnknowns, const std::string& select);
+
+  bool isPatchActive(
+      const tarch::la::Vector<DIMENSIONS, double>& offsetOfPatch,
+      const tarch::la::Vector<DIMENSIONS, double>& sizeOfPatch) const override;
+
+  void plotPatch(const int cellDescriptionsIndex, const int element) override;
+
+  void plotPatch(
+      const tarch::la::Vector<DIMENSIONS, double>& offsetOfPatch,
+      const tarch::la::Vector<DIMENSIONS, double>& sizeOfPatch, double* u,
+      double timeStamp);
+
+  virtual void startPlotting( double time );
+  virtual void finishPlotting();
+};
+
+
+class exahype::plotters::ADERDG2CartesianSliceVTKAscii: public exahype::plotters::ADERDG2CartesianSliceVTK {
+  public:
+    static std::string getIdentifier();
+    ADERDG2CartesianSliceVTKAscii(
+        exahype::plotters::Plotter::UserOnTheFlyPostProcessing* postProcessing,
+        const tarch::la::Vector<DIMENSIONS, double>& domainOffset,
+        const tarch::la::Vector<DIMENSIONS, double>& domainSize);
+};
+
+
+class exahype::plotters::ADERDG2CartesianSliceVTKBinary: public exahype::plotters::ADERDG2CartesianSliceVTK {
+  public:
+    static std::string getIdentifier();
+    ADERDG2CartesianSliceVTKBinary(
+        exahype::plotters::Plotter::UserOnTheFlyPostProcessing* postProcessing,
+        const tarch::la::Vector<DIMENSIONS, double>& domainOffset,
+        const tarch::la::Vector<DIMENSIONS, double>& domainSize);
+};
+
+
+class exahype::plotters::ADERDG2CartesianSliceVTUAscii: public exahype::plotters::ADERDG2CartesianSliceVTK {
+  public:
+    static std::string getIdentifier();
+    ADERDG2CartesianSliceVTUAscii(
+        exahype::plotters::Plotter::UserOnTheFlyPostProcessing* postProcessing,
+        const tarch::la::Vector<DIMENSIONS, double>& domainOffset,
+        const tarch::la::Vector<DIMENSIONS, double>& domainSize);
+};
+
+
+class exahype::plotters::ADERDG2CartesianSliceVTUBinary: public exahype::plotters::ADERDG2CartesianSliceVTK {
+  public:
+    static std::string getIdentifier();
+    ADERDG2CartesianSliceVTUBinary(
+        exahype::plotters::Plotter::UserOnTheFlyPostProcessing* postProcessing,
+        const tarch::la::Vector<DIMENSIONS, double>& domainOffset,
+        const tarch::la::Vector<DIMENSIONS, double>& domainSize);
+};
+
+#endif
@@ -103,6 +103,10 @@ class exahype::plotters::ADERDG2CartesianVTK: public exahype::plotters::Plotter:
 
   virtual void init(const std::string& filename, int orderPlusOne, int solverUnknowns, int writtenUnknowns, const std::string& select);
 
+  bool isPatchActive(
+      const tarch::la::Vector<DIMENSIONS, double>& offsetOfPatch,
+      const tarch::la::Vector<DIMENSIONS, double>& sizeOfPatch) const override;
+
   void plotPatch(const int cellDescriptionsIndex, const int element) override;
 
   void plotPatch(
@@ -281,26 +281,17 @@ void exahype::plotters::ADERDG2LegendreDivergenceVTK::plotVertexData(
 ) {
   assertion( _vertexDataWriter!=nullptr || _writtenUnknowns==0 );
 
-  double* interpoland = new double[_solverUnknowns];
-  double* value       = _writtenUnknowns==0 ? nullptr : new double[_writtenUnknowns];
+  static thread_local std::vector<double> valueBuffer;
+  valueBuffer.resize(_writtenUnknowns);
+  double* value = _writtenUnknowns==0 ? nullptr : valueBuffer.data();
 
   dfor(i,_order+1) {
-    // This is inefficient but works. We could look it up directly from the arrays
     tarch::la::Vector<DIMENSIONS, double> p;
     for (int d=0; d<DIMENSIONS; d++) {
       p(d) = offsetOfPatch(d) + kernels::gaussLegendreNodes[_order][i(d)] * sizeOfPatch(d);
     }
-    for (int unknown=0; unknown < _solverUnknowns; unknown++) {
-      interpoland[unknown] = kernels::interpolate(
-        offsetOfPatch.data(),
-        sizeOfPatch.data(),
-        p.data(), // das ist die Position
-        _solverUnknowns,
-        unknown,
-        _order,
-        u
-      );
-    }
+    // The vertices coincide with the Gauss-Legendre nodes, i.e. no interpolation is required.
+    double* interpoland = u + peano::utils::dLinearisedWithoutLookup(i,_order+1)*_solverUnknowns;
 
     assertion(sizeOfPatch(0)==sizeOfPatch(1));
     _postProcessing->mapQuantities(
@@ -319,9 +310,6 @@ void exahype::plotters::ADERDG2LegendreDivergenceVTK::plotVertexData(
 
     firstVertexIndex++;
   }
-
-  if (interpoland!=nullptr)  delete[] interpoland;
-  if (value!=nullptr)        delete[] value;
 }
 
 
@@ -295,6 +295,12 @@ exahype::plotters::FiniteVolumes2VTK::~FiniteVolumes2VTK() {
 
 #include "exahype/plotters/slicing/CartesianSlicer.h"
 
+bool exahype::plotters::FiniteVolumes2VTK::isPatchActive(
+    const tarch::la::Vector<DIMENSIONS, double>& offsetOfPatch,
+    const tarch::la::Vector<DIMENSIONS, double>& sizeOfPatch) const {
+  return !slicer || slicer->isPatchActive(offsetOfPatch, sizeOfPatch);
+}
+
 void exahype::plotters::FiniteVolumes2VTK::plotPatch(const int cellDescriptionsIndex, const int element) {
   auto& cellDescription = exahype::solvers::FiniteVolumesSolver::getCellDescription(cellDescriptionsIndex,element);
 
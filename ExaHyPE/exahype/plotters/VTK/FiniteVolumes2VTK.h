@@ -89,6 +89,10 @@ class exahype::plotters::FiniteVolumes2VTK: public exahype::plotters::Plotter::D
 
   virtual void init(const std::string& filename, int numberOfCellsPerAxis, int unknowns, int writtenUnknowns, const std::string& select);
 
+  bool isPatchActive(
+      const tarch::la::Vector<DIMENSIONS, double>& offsetOfPatch,
+      const tarch::la::Vector<DIMENSIONS, double>& sizeOfPatch) const override;
+
   void plotPatch(const int cellDescriptionsIndex, const int element) override;
 
   void plotCellData(
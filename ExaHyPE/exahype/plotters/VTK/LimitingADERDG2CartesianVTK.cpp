@@ -13,6 +13,7 @@
  
 #include "LimitingADERDG2CartesianVTK.h"
 #include "tarch/parallel/Node.h"
+#include "tarch/la/ScalarOperations.h"
 
 // @todo 16/05/03:Dominic Etienne Charreir Plotter depends now on kernels.
 // Should thus be placed in kernel module or the solver
@@ -27,6 +28,7 @@
 
 
 #include "kernels/DGBasisFunctions.h"
+#include "kernels/DGResampling.h"
 
 #include "exahype/plotters/slicing/Slicer.h"
 #include "exahype/solvers/LimitingADERDGSolver.h"
@@ -259,23 +261,16 @@ void exahype::plotters::LimitingADERDG2CartesianVTK::plotVertexData(
 ) {
   assertion( _vertexDataWriter!=nullptr || _writtenUnknowns==0 );
 
-  double* interpoland = new double[_solverUnknowns];
-  double* value       = _writtenUnknowns==0 ? nullptr : new double[_writtenUnknowns];
+  static thread_local std::vector<double> valueBuffer;
+  valueBuffer.resize(_writtenUnknowns);
+  double* value = _writtenUnknowns==0 ? nullptr : valueBuffer.data();
+
+  static thread_local std::vector<double> interpolands;
+  interpolands.resize(tarch::la::aPowI(DIMENSIONS,_order+1)*_solverUnknowns);
+  kernels::resample(u,_solverUnknowns,_order,_order+1,kernels::ResamplingPoints::EquidistantVertices,interpolands.data());
 
   dfor(i,_order+1) {
-    for (int unknown=0; unknown < _solverUnknowns; unknown++) {
-      interpoland[unknown] = 0.0;
-      dfor(ii,_order+1) { // Gauss-Legendre node indices
-        int iGauss = peano::utils::dLinearisedWithoutLookup(ii,_order + 1);
-        interpoland[unknown] += kernels::equidistantGridProjector1d[_order][ii(1)][i(1)] *
-                 kernels::equidistantGridProjector1d[_order][ii(0)][i(0)] *
-                 #if DIMENSIONS==3
-                 kernels::equidistantGridProjector1d[_order][ii(2)][i(2)] *
-                 #endif
-                 u[iGauss * _solverUnknowns + unknown];
-        assertion3(interpoland[unknown] == interpoland[unknown], offsetOfPatch, sizeOfPatch, iGauss);
-      }
-    }
+    double* interpoland = interpolands.data() + peano::utils::dLinearisedWithoutLookup(i,_order+1)*_solverUnknowns;
 
     assertion(sizeOfPatch(0)==sizeOfPatch(1));
     _postProcessing->mapQuantities(
@@ -297,9 +292,6 @@ void exahype::plotters::LimitingADERDG2CartesianVTK::plotVertexData(
 
     firstVertexIndex++;
   }
-
-  if (interpoland!=nullptr)  delete[] interpoland;
-  if (value!=nullptr)        delete[] value;
 }
 
 
@@ -314,21 +306,16 @@ void exahype::plotters::LimitingADERDG2CartesianVTK::plotCellData(
 ) {
   assertion( _cellDataWriter!=nullptr || _writtenUnknowns==0 );
 
-  double* interpoland = new double[_solverUnknowns];
-  double* value       = _writtenUnknowns==0 ? nullptr : new double[_writtenUnknowns];
+  static thread_local std::vector<double> valueBuffer;
+  valueBuffer.resize(_writtenUnknowns);
+  double* value = _writtenUnknowns==0 ? nullptr : valueBuffer.data();
+
+  static thread_local std::vector<double> interpolands;
+  interpolands.resize(tarch::la::aPowI(DIMENSIONS,_order)*_solverUnknowns);
+  kernels::resample(u,_solverUnknowns,_order,_order,kernels::ResamplingPoints::EquidistantCellCentres,interpolands.data());
 
   dfor(i,_order) {
-    for (int unknown=0; unknown < _solverUnknowns; unknown++) {
-      interpoland[unknown] = kernels::interpolate(
-        offsetOfPatch.data(),
-        sizeOfPatch.data(),
-        (offsetOfPatch + (i.convertScalar<double>()+0.5)* (sizeOfPatch(0)/(_order))).data(),
-        _solverUnknowns,
-        unknown,
-        _order,
-        u
-      );
-    }
+    double* interpoland = interpolands.data() + peano::utils::dLinearisedWithoutLookup(i,_order)*_solverUnknowns;
 
     assertion(sizeOfPatch(0)==sizeOfPatch(1));
     _postProcessing->mapQuantities(
@@ -350,9 +337,12 @@ void exahype::plotters::LimitingADERDG2CartesianVTK::plotCellData(
 
     firstCellIndex++;
   }
+}
 
-  if (interpoland!=nullptr)  delete[] interpoland;
-  if (value!=nullptr)        delete[] value;
+bool exahype::plotters::LimitingADERDG2CartesianVTK::isPatchActive(
+    const tarch::la::Vector<DIMENSIONS, double>& offsetOfPatch,
+    const tarch::la::Vector<DIMENSIONS, double>& sizeOfPatch) const {
+  return !slicer || slicer->isPatchActive(offsetOfPatch, sizeOfPatch);
 }
 
 void exahype::plotters::LimitingADERDG2CartesianVTK::plotPatch(const int cellDescriptionsIndex, const int element) {
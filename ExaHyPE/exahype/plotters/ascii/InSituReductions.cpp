@@ -0,0 +1,331 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/plotters/ascii/InSituReductions.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "tarch/Assertions.h"
+#include "tarch/parallel/Node.h"
+
+tarch::logging::Log exahype::plotters::ascii::InSituReductions::_log("exahype::plotters::ascii::InSituReductions");
+
+
+void exahype::plotters::ascii::InSituReductions::Accumulator::addToSum(const int index, const double value) {
+  double& sum          = _sums[2*index];
+  double& compensation = _sums[2*index+1];
+
+  const double t = sum + value;
+  if (std::abs(sum) >= std::abs(value)) {
+    compensation += (sum - t) + value;
+  } else {
+    compensation += (value - t) + sum;
+  }
+  sum = t;
+}
+
+void exahype::plotters::ascii::InSituReductions::Accumulator::updateMaximum(const int index, const double value) {
+  _maxima[index] = std::max(_maxima[index],value);
+}
+
+void exahype::plotters::ascii::InSituReductions::Accumulator::merge(const Accumulator& other) {
+  assertionEquals(_sums.size(),other._sums.size());
+  assertionEquals(_maxima.size(),other._maxima.size());
+
+  for (unsigned int index=0; index<_sums.size()/2; index++) {
+    addToSum(index,other._sums[2*index]);
+    _sums[2*index+1] += other._sums[2*index+1];
+  }
+  for (unsigned int index=0; index<_maxima.size(); index++) {
+    updateMaximum(index,other._maxima[index]);
+  }
+}
+
+double exahype::plotters::ascii::InSituReductions::Accumulator::getSum(const int index) const {
+  return _sums[2*index] + _sums[2*index+1];
+}
+
+double exahype::plotters::ascii::InSituReductions::Accumulator::getMaximum(const int index) const {
+  return _maxima[index];
+}
+
+
+exahype::plotters::ascii::InSituReductions::InSituReductions(const int numberOfUnknowns)
+  : _numberOfUnknowns(numberOfUnknowns),
+    _numberOfSums(NumberOfInternalSums),
+    _numberOfMaxima(NumberOfInternalMaxima),
+    _filename("insitu-reductions.asc"),
+    _file(nullptr),
+    _timeStepInterval(1),
+    _numberOfTimeSteps(0),
+    _numberOfWrittenRows(0),
+    _isActive(false)
+    #ifdef Parallel
+    ,
+    _datatype(MPI_DATATYPE_NULL),
+    _request(MPI_REQUEST_NULL),
+    _reductionIsPending(false)
+    #endif
+{
+}
+
+exahype::plotters::ascii::InSituReductions::~InSituReductions() {
+  #ifdef Parallel
+  assertion(!_reductionIsPending);
+  #endif
+
+  if (_file!=nullptr) {
+    fclose(_file);
+  }
+}
+
+void exahype::plotters::ascii::InSituReductions::add(
+    const std::string& name, const int unknown, const Integrand& integrand, const Kind kind) {
+  assertion1(_numberOfTimeSteps==0,name);
+
+  Reduction reduction;
+  reduction._name      = name;
+  reduction._unknown   = unknown;
+  reduction._integrand = integrand;
+  reduction._kind      = kind;
+  switch (kind) {
+    case Kind::Integral:
+    case Kind::Average:
+    case Kind::L1Norm:
+    case Kind::L2Norm:
+      reduction._slot = _numberOfSums++;
+      break;
+    case Kind::Minimum:
+    case Kind::Maximum:
+      reduction._slot = _numberOfMaxima++;
+      break;
+  }
+  _reductions.push_back(reduction);
+}
+
+void exahype::plotters::ascii::InSituReductions::add(
+    const std::string& name, const int unknown, const Kind kind) {
+  assertion3(unknown>=0 && unknown<_numberOfUnknowns,name,unknown,_numberOfUnknowns);
+  add(name,unknown,nullptr,kind);
+}
+
+void exahype::plotters::ascii::InSituReductions::add(
+    const std::string& name, const Integrand& integrand, const Kind kind) {
+  assertion1(integrand,name);
+  add(name,-1,integrand,kind);
+}
+
+void exahype::plotters::ascii::InSituReductions::setOutput(
+    const std::string& filename, const int timeStepInterval) {
+  assertion2(timeStepInterval>0,filename,timeStepInterval);
+  _filename         = filename;
+  _timeStepInterval = timeStepInterval;
+}
+
+bool exahype::plotters::ascii::InSituReductions::isEmpty() const {
+  return _reductions.empty();
+}
+
+bool exahype::plotters::ascii::InSituReductions::beginTimeStep() {
+  _isActive = !isEmpty() && (_numberOfTimeSteps % _timeStepInterval)==0;
+  _numberOfTimeSteps++;
+  return _isActive;
+}
+
+bool exahype::plotters::ascii::InSituReductions::isActive() const {
+  return _isActive;
+}
+
+void exahype::plotters::ascii::InSituReductions::initialiseAccumulator(Accumulator& accumulator) const {
+  accumulator._sums.assign(2*_numberOfSums,0.0);
+  accumulator._maxima.assign(_numberOfMaxima,-std::numeric_limits<double>::max());
+}
+
+void exahype::plotters::ascii::InSituReductions::accumulate(
+    Accumulator& accumulator, const double* const Q, const double weight) const {
+  bool hasNaNs = false;
+  for (int unknown=0; unknown<_numberOfUnknowns; unknown++) {
+    hasNaNs |= std::isnan(Q[unknown]);
+  }
+  accumulator.addToSum(VolumeSum,weight);
+  accumulator.addToSum(NaNSum,hasNaNs ? 1.0 : 0.0);
+
+  for (const Reduction& reduction : _reductions) {
+    const double value = reduction._integrand ? reduction._integrand(Q) : Q[reduction._unknown];
+    switch (reduction._kind) {
+      case Kind::Integral:
+      case Kind::Average:
+        accumulator.addToSum(reduction._slot,weight*value);
+        break;
+      case Kind::L1Norm:
+        accumulator.addToSum(reduction._slot,weight*std::abs(value));
+        break;
+      case Kind::L2Norm:
+        accumulator.addToSum(reduction._slot,weight*value*value);
+        break;
+      case Kind::Minimum:
+        accumulator.updateMaximum(reduction._slot,-value);
+        break;
+      case Kind::Maximum:
+        accumulator.updateMaximum(reduction._slot,value);
+        break;
+    }
+  }
+}
+
+void exahype::plotters::ascii::InSituReductions::accumulateTimeStamp(
+    Accumulator& accumulator, const double timeStamp) const {
+  accumulator.updateMaximum(TimeMaximum,timeStamp);
+}
+
+void exahype::plotters::ascii::InSituReductions::openFile() {
+  logInfo("openFile()", "Opening in-situ reductions file '"<< _filename << "'");
+
+  _file = fopen(_filename.c_str(), "w");
+  if (_file==nullptr) {
+    logError("openFile()", "Cannot open output ASCII file at '" << _filename << "'.");
+    exit(-1);
+  }
+
+  fputs("plotindex time",_file);
+  for (const Reduction& reduction : _reductions) {
+    fprintf(_file," %s",reduction._name.c_str());
+  }
+  fputs(" numnan\n",_file);
+}
+
+void exahype::plotters::ascii::InSituReductions::writeRow(const Accumulator& accumulator) {
+  assertion(tarch::parallel::Node::getInstance().isGlobalMaster());
+
+  if (_file==nullptr) {
+    openFile();
+  }
+
+  const double volume = accumulator.getSum(VolumeSum);
+  fprintf(_file,"%d\t%e",_numberOfWrittenRows,accumulator.getMaximum(TimeMaximum));
+  for (const Reduction& reduction : _reductions) {
+    double value = 0.0;
+    switch (reduction._kind) {
+      case Kind::Integral:
+      case Kind::L1Norm:
+        value = accumulator.getSum(reduction._slot);
+        break;
+      case Kind::Average:
+        value = volume>0.0 ? accumulator.getSum(reduction._slot)/volume : 0.0;
+        break;
+      case Kind::L2Norm:
+        value = std::sqrt(accumulator.getSum(reduction._slot));
+        break;
+      case Kind::Minimum:
+        value = -accumulator.getMaximum(reduction._slot);
+        break;
+      case Kind::Maximum:
+        value = accumulator.getMaximum(reduction._slot);
+        break;
+    }
+    fprintf(_file,"\t%.15e",value);
+  }
+  fprintf(_file,"\t%.0f\n",accumulator.getSum(NaNSum));
+  fflush(_file); // write out this line immediately
+
+  _numberOfWrittenRows++;
+}
+
+#ifdef Parallel
+void exahype::plotters::ascii::InSituReductions::pack(
+    const Accumulator& accumulator, std::vector<double>& buffer) {
+  buffer.clear();
+  buffer.push_back(accumulator._sums.size()/2);
+  buffer.insert(buffer.end(),accumulator._sums.begin(),accumulator._sums.end());
+  buffer.insert(buffer.end(),accumulator._maxima.begin(),accumulator._maxima.end());
+}
+
+void exahype::plotters::ascii::InSituReductions::unpack(
+    const std::vector<double>& buffer, Accumulator& accumulator) {
+  const int numberOfSums = static_cast<int>(buffer[0]);
+  accumulator._sums.assign(buffer.begin()+1,buffer.begin()+1+2*numberOfSums);
+  accumulator._maxima.assign(buffer.begin()+1+2*numberOfSums,buffer.end());
+}
+
+void exahype::plotters::ascii::InSituReductions::reducePackedAccumulators(
+    void* in, void* inout, int* length, MPI_Datatype* datatype) {
+  int messageSize;
+  MPI_Type_size(*datatype,&messageSize);
+  messageSize /= sizeof(double);
+
+  std::vector<double> buffer;
+  Accumulator accumulatorIn, accumulatorInOut;
+  for (int message=0; message<*length; message++) {
+    const double* const packedIn = static_cast<const double*>(in)+message*messageSize;
+    double* const packedInOut    = static_cast<double*>(inout)+message*messageSize;
+
+    buffer.assign(packedIn,packedIn+messageSize);
+    unpack(buffer,accumulatorIn);
+    buffer.assign(packedInOut,packedInOut+messageSize);
+    unpack(buffer,accumulatorInOut);
+
+    accumulatorInOut.merge(accumulatorIn);
+    pack(accumulatorInOut,buffer);
+    std::copy(buffer.begin(),buffer.end(),packedInOut);
+  }
+}
+#endif
+
+void exahype::plotters::ascii::InSituReductions::endTimeStep(const Accumulator& accumulator) {
+  if (!_isActive) {
+    return;
+  }
+  _isActive = false;
+
+  #ifdef Parallel
+  assertion(!_reductionIsPending);
+
+  static MPI_Op reduction = MPI_OP_NULL;
+  if (reduction==MPI_OP_NULL) {
+    MPI_Op_create(&reducePackedAccumulators,true,&reduction);
+  }
+
+  pack(accumulator,_sendBuffer);
+  _receiveBuffer.resize(_sendBuffer.size());
+  if (_datatype==MPI_DATATYPE_NULL) {
+    MPI_Type_contiguous(static_cast<int>(_sendBuffer.size()),MPI_DOUBLE,&_datatype);
+    MPI_Type_commit(&_datatype);
+  }
+  MPI_Ireduce(
+      _sendBuffer.data(),_receiveBuffer.data(),1,
+      _datatype,reduction,tarch::parallel::Node::getGlobalMasterRank(),
+      tarch::parallel::Node::getInstance().getCommunicator(),&_request);
+  _reductionIsPending = true;
+
+  logDebug("endTimeStep(...)","posted reduction of " << _sendBuffer.size() << " entries");
+  #else
+  writeRow(accumulator);
+  #endif
+}
+
+void exahype::plotters::ascii::InSituReductions::finishPendingReduction() {
+  #ifdef Parallel
+  if (_reductionIsPending) {
+    MPI_Wait(&_request,MPI_STATUS_IGNORE);
+    _reductionIsPending = false;
+
+    if (tarch::parallel::Node::getInstance().isGlobalMaster()) {
+      Accumulator accumulator;
+      unpack(_receiveBuffer,accumulator);
+      writeRow(accumulator);
+    }
+  }
+  #endif
+}
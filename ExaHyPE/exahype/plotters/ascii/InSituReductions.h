@@ -0,0 +1,281 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef EXAHYPE_PLOTTERS_ASCII_INSITUREDUCTIONS_H_
+#define EXAHYPE_PLOTTERS_ASCII_INSITUREDUCTIONS_H_
+
+#include <stdio.h>
+#include <functional>
+#include <string>
+#include <vector>
+
+#ifdef Parallel
+#include <mpi.h>
+#endif
+
+#include "tarch/logging/Log.h"
+
+namespace exahype {
+  namespace plotters {
+    namespace ascii {
+      class InSituReductions;
+    }
+  }
+}
+
+/**
+ * Integrals, norms and extrema of a solver's solution which are computed
+ * during the solution update instead of in a separate plotting traversal.
+ *
+ * TimeSeriesReductions and the ReductionsWriter are driven by plotters and
+ * thus require the solution to be read once more from the heap. The in-situ
+ * reductions are instead evaluated by the SolutionUpdate mapping right after
+ * a cell's solution has been updated, i.e. while the cell's data is still in
+ * cache.
+ *
+ * <h2>Usage</h2>
+ * A user solver declares its reductions in its init(...) routine via
+ * Solver::addInSituReduction(...) and configures the output via
+ * Solver::setInSituReductionsOutput(...). Every reduction either reduces a
+ * single unknown or the value of a user-supplied integrand. A row with the
+ * values of all reductions is written to an ASCII file every
+ * timeStepInterval time steps.
+ *
+ * <h2>Accuracy</h2>
+ * Integrals are approximated with the solver's own quadrature rule: the
+ * Gauss-Legendre rule of the DG polynomial for ADER-DG solvers and the
+ * midpoint rule for Finite Volumes solvers. All sums are accumulated with
+ * Neumaier's compensated summation; the compensation terms are carried
+ * through the thread and rank reductions.
+ *
+ * <h2>Shared memory</h2>
+ * Each mapping copy owns an Accumulator. The copies are merged in
+ * mergeWithWorkerThread(...). We thus do not need any locks.
+ *
+ * <h2>MPI</h2>
+ * All accumulators of a solver on a rank are packed into one message which
+ * is reduced onto the global master rank with a single MPI_Ireduce per output
+ * interval, i.e. there is one reduction per solver with in-situ reductions. The reduction is finished lazily in the next traversal (or by
+ * the runner after the last one), i.e. it overlaps with the next time step.
+ * All ranks have to take part in every reduction. The runner thus rejects
+ * setups with idle ranks.
+ *
+ * \note Cells that are recomputed by a LimitingADERDGSolver after the
+ * time step (local recomputation) enter the reductions with their solution
+ * before the recomputation.
+ */
+class exahype::plotters::ascii::InSituReductions {
+ public:
+  /**
+   * The kinds of reductions. Integral, Average, L1Norm and L2Norm
+   * are approximated by quadrature, the extrema are taken over the
+   * quadrature points.
+   */
+  enum class Kind { Integral, Average, L1Norm, L2Norm, Minimum, Maximum };
+
+  /**
+   * Maps the unknowns and parameters of a point onto the value to reduce.
+   */
+  typedef std::function<double(const double* const Q)> Integrand;
+
+  /**
+   * Partial results of a thread or rank.
+   *
+   * The sums are stored as (value,compensation) pairs. Minima are stored
+   * as negated maxima such that all extrema can be reduced with max.
+   */
+  class Accumulator {
+   private:
+    friend class InSituReductions;
+
+    std::vector<double> _sums;
+    std::vector<double> _maxima;
+
+   public:
+    /**
+     * Adds \p value to the sum \p index (Neumaier's variant of
+     * Kahan summation).
+     */
+    void addToSum(const int index, const double value);
+
+    void updateMaximum(const int index, const double value);
+
+    /**
+     * Merges the partial results of \p other into this accumulator.
+     */
+    void merge(const Accumulator& other);
+
+    /**
+     * @return the compensated value of the sum \p index.
+     */
+    double getSum(const int index) const;
+
+    double getMaximum(const int index) const;
+  };
+
+ private:
+  static tarch::logging::Log _log;
+
+  /**
+   * Indices into the sums and maxima of an Accumulator. The
+   * first sums hold the volume and the number of points with NaNs,
+   * the first maximum holds the time stamp of the reduced solution.
+   */
+  enum Slots { VolumeSum = 0, NaNSum = 1, NumberOfInternalSums = 2, TimeMaximum = 0, NumberOfInternalMaxima = 1 };
+
+  struct Reduction {
+    std::string _name;
+    int         _unknown;
+    Integrand   _integrand;
+    Kind        _kind;
+    /**
+     * Index of the sum or maximum in the Accumulator.
+     */
+    int         _slot;
+  };
+
+  const int              _numberOfUnknowns;
+  std::vector<Reduction> _reductions;
+  int                    _numberOfSums;
+  int                    _numberOfMaxima;
+
+  std::string _filename;
+  FILE*       _file;
+  int         _timeStepInterval;
+  int         _numberOfTimeSteps;
+  int         _numberOfWrittenRows;
+
+  /**
+   * Indicates that the solution is reduced in the current time step.
+   */
+  bool        _isActive;
+
+  #ifdef Parallel
+  std::vector<double> _sendBuffer;
+  std::vector<double> _receiveBuffer;
+
+  /**
+   * A packed accumulator is reduced as a single element of
+   * this contiguous datatype. MPI might otherwise split
+   * the message when applying the reduction operation.
+   */
+  MPI_Datatype        _datatype;
+  MPI_Request         _request;
+  bool                _reductionIsPending;
+
+  /**
+   * Reduces packed accumulators of type _datatype; see pack(...).
+   */
+  static void reducePackedAccumulators(void* in, void* inout, int* length, MPI_Datatype* datatype);
+
+  /**
+   * Packs \p accumulator into \p buffer: the number of sums
+   * followed by the (value,compensation) pairs and the maxima.
+   */
+  static void pack(const Accumulator& accumulator, std::vector<double>& buffer);
+
+  static void unpack(const std::vector<double>& buffer, Accumulator& accumulator);
+  #endif
+
+  void add(const std::string& name, const int unknown, const Integrand& integrand, const Kind kind);
+
+  /**
+   * Opens the output file and writes the header line.
+   */
+  void openFile();
+
+  /**
+   * Writes the values reduced over all threads and ranks.
+   * Must only be called on the global master rank.
+   */
+  void writeRow(const Accumulator& accumulator);
+
+ public:
+  /**
+   * @param numberOfUnknowns The number of variables plus parameters per point.
+   */
+  InSituReductions(const int numberOfUnknowns);
+
+  ~InSituReductions();
+
+  // Disallow copy and assignment
+  InSituReductions(const InSituReductions& other) = delete;
+  InSituReductions& operator=(const InSituReductions& other) = delete;
+
+  /**
+   * Declares a reduction of the unknown with index \p unknown.
+   */
+  void add(const std::string& name, const int unknown, const Kind kind);
+
+  /**
+   * Declares a reduction of the value of \p integrand.
+   */
+  void add(const std::string& name, const Integrand& integrand, const Kind kind);
+
+  /**
+   * Sets the name of the output file and the number of
+   * time steps between two rows of the output file.
+   */
+  void setOutput(const std::string& filename, const int timeStepInterval);
+
+  /**
+   * @return if at least one reduction was declared.
+   */
+  bool isEmpty() const;
+
+  /**
+   * Starts a new time step. The solution is reduced
+   * if the time step is the first one of an output interval.
+   *
+   * @return if the solution is reduced in this time step.
+   */
+  bool beginTimeStep();
+
+  /**
+   * @return if the solution is reduced in the current time step.
+   */
+  bool isActive() const;
+
+  /**
+   * Resizes and resets \p accumulator.
+   */
+  void initialiseAccumulator(Accumulator& accumulator) const;
+
+  /**
+   * Accumulates the reductions of point values \p Q with quadrature
+   * weight \p weight.
+   */
+  void accumulate(Accumulator& accumulator, const double* const Q, const double weight) const;
+
+  /**
+   * Records the time stamp \p timeStamp of the reduced solution.
+   */
+  void accumulateTimeStamp(Accumulator& accumulator, const double timeStamp) const;
+
+  /**
+   * Finishes the current time step. If it is an active one, the rank's
+   * results are reduced onto the global master rank which writes them out.
+   *
+   * <h2>MPI</h2>
+   * The reduction is only posted here; see finishPendingReduction().
+   */
+  void endTimeStep(const Accumulator& accumulator);
+
+  /**
+   * Waits for a reduction posted by endTimeStep(...) and writes out the result.
+   * Nop if no reduction is pending.
+   */
+  void finishPendingReduction();
+};
+
+#endif
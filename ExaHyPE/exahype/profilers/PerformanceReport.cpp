@@ -0,0 +1,322 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/profilers/PerformanceReport.h"
+
+#include <fstream>
+#include <sstream>
+
+#include "tarch/Assertions.h"
+#include "tarch/la/ScalarOperations.h"
+#include "tarch/multicore/Lock.h"
+#include "tarch/parallel/Node.h"
+
+#include "peano/utils/Globals.h"
+
+#include "exahype/solvers/ADERDGSolver.h"
+#include "exahype/solvers/FiniteVolumesSolver.h"
+
+namespace {
+const char* const PhaseNames[exahype::profilers::PerformanceReport::NumberOfPhases] = {
+    "Prediction",
+    "NeighbourMerging",
+    "RemoteNeighbourMerging",
+    "SolutionUpdate",
+    "Plotting",
+    "Compression",
+    "Uncompression"
+};
+
+const char* const CellCategoryNames[exahype::profilers::PerformanceReport::NumberOfCellCategories] = {
+    "Cell",
+    "Descendant",
+    "Ancestor",
+    "Troubled"
+};
+
+double toSeconds(const long long nanoseconds) {
+  return static_cast<double>(nanoseconds) * 1e-9;
+}
+}  // namespace
+
+tarch::logging::Log exahype::profilers::PerformanceReport::_log("exahype::profilers::PerformanceReport");
+
+constexpr int exahype::profilers::PerformanceReport::NumberOfPhases;
+constexpr int exahype::profilers::PerformanceReport::NumberOfCellCategories;
+
+exahype::profilers::PerformanceReport::ScopedPhase::ScopedPhase(const Phase phase):
+  _phase(phase),
+  _active(PerformanceReport::getInstance().isActive()) {
+  if (_active) {
+    _start = Clock::now();
+  }
+}
+
+exahype::profilers::PerformanceReport::ScopedPhase::~ScopedPhase() {
+  if (_active) {
+    const long long nanoseconds =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now()-_start).count();
+    PerformanceReport::getInstance().recordPhase(_phase,nanoseconds);
+  }
+}
+
+exahype::profilers::PerformanceReport::ThreadCounters::ThreadCounters() {
+  for (int phase=0; phase<NumberOfPhases; phase++) {
+    phaseNanoseconds[phase].store(0);
+    phaseCalls[phase].store(0);
+  }
+  for (int category=0; category<NumberOfCellCategories; category++) {
+    cells[category].store(0);
+  }
+  degreesOfFreedom.store(0);
+  faces.store(0);
+}
+
+exahype::profilers::PerformanceReport& exahype::profilers::PerformanceReport::getInstance() {
+  static PerformanceReport singleton;
+  return singleton;
+}
+
+exahype::profilers::PerformanceReport::PerformanceReport():
+  _fileName(""),
+  _interval(0),
+  _active(false),
+  _startTime(Clock::now()),
+  _numberOfTimeSteps(0),
+  _numberOfTimeStepsSinceLastReport(0) {
+}
+
+void exahype::profilers::PerformanceReport::configure(const std::string& fileName, const int interval) {
+  assertion1(!isActive(),_fileName);
+  assertion1(interval>=0,interval);
+
+  std::ostringstream fullFileName;
+  fullFileName << fileName;
+  #ifdef Parallel
+  fullFileName << "-rank-" << tarch::parallel::Node::getInstance().getRank();
+  #endif
+  _fileName = fullFileName.str();
+  _interval = interval;
+
+  std::ofstream file(_fileName, std::ios::trunc);
+  if (!file) {
+    logError("configure(...)", "could not open performance report file " << _fileName << ". No report is written");
+    return;
+  }
+
+  _startTime = Clock::now();
+  _active    = true;
+  logInfo("configure(...)", "write performance report to " << _fileName <<
+      (_interval>0 ? " every " + std::to_string(_interval) + " time steps and" : "") << " at exit");
+}
+
+bool exahype::profilers::PerformanceReport::isActive() const {
+  return _active;
+}
+
+exahype::profilers::PerformanceReport::ThreadCounters&
+exahype::profilers::PerformanceReport::getThreadCounters() {
+  static thread_local ThreadCounters* threadCounters = nullptr;
+  if (threadCounters==nullptr) {
+    tarch::multicore::Lock lock(_semaphore);
+    _threadCounters.emplace_back(new ThreadCounters());
+    threadCounters = _threadCounters.back().get();
+  }
+  return *threadCounters;
+}
+
+void exahype::profilers::PerformanceReport::add(std::atomic<long long>& counter, const long long value) {
+  // The calling thread is the only writer
+  counter.store(counter.load(std::memory_order_relaxed)+value, std::memory_order_relaxed);
+}
+
+void exahype::profilers::PerformanceReport::recordPhase(const Phase phase, const long long nanoseconds) {
+  ThreadCounters& counters = getThreadCounters();
+  add(counters.phaseNanoseconds[static_cast<int>(phase)], nanoseconds);
+  add(counters.phaseCalls[static_cast<int>(phase)], 1);
+}
+
+void exahype::profilers::PerformanceReport::countCell(const CellCategory category, const int degreesOfFreedom) {
+  if (_active) {
+    ThreadCounters& counters = getThreadCounters();
+    add(counters.cells[static_cast<int>(category)], 1);
+    add(counters.degreesOfFreedom, degreesOfFreedom);
+  }
+}
+
+void exahype::profilers::PerformanceReport::countUpdatedCell(
+    const exahype::solvers::Solver* const solver,
+    const int cellDescriptionsIndex,
+    const int element) {
+  if (!_active) {
+    return;
+  }
+
+  const int degreesOfFreedom =
+      tarch::la::aPowI(DIMENSIONS,solver->getNodesPerCoordinateAxis())*solver->getNumberOfVariables();
+
+  switch (solver->getType()) {
+    case exahype::solvers::Solver::Type::ADERDG:
+    case exahype::solvers::Solver::Type::LimitingADERDG: {
+      typedef exahype::solvers::ADERDGSolver::CellDescription CellDescription;
+      CellDescription& cellDescription =
+          exahype::solvers::ADERDGSolver::getCellDescription(cellDescriptionsIndex,element);
+      switch (cellDescription.getType()) {
+        case CellDescription::Type::Cell:
+          countCell(CellCategory::Cell,degreesOfFreedom);
+          if (solver->getType()==exahype::solvers::Solver::Type::LimitingADERDG &&
+              cellDescription.getLimiterStatus()>=static_cast<int>(CellDescription::LimiterStatus::Troubled)) {
+            countCell(CellCategory::Troubled,0);
+          }
+          break;
+        case CellDescription::Type::Descendant:
+          countCell(CellCategory::Descendant,0);
+          break;
+        case CellDescription::Type::Ancestor:
+          countCell(CellCategory::Ancestor,0);
+          break;
+        case CellDescription::Type::Erased:
+          break;
+      }
+    } break;
+    case exahype::solvers::Solver::Type::FiniteVolumes: {
+      typedef exahype::solvers::FiniteVolumesSolver::CellDescription CellDescription;
+      CellDescription& cellDescription =
+          exahype::solvers::FiniteVolumesSolver::getCellDescription(cellDescriptionsIndex,element);
+      switch (cellDescription.getType()) {
+        case CellDescription::Type::Cell:
+          countCell(CellCategory::Cell,degreesOfFreedom);
+          break;
+        case CellDescription::Type::Descendant:
+          countCell(CellCategory::Descendant,0);
+          break;
+        case CellDescription::Type::Ancestor:
+          countCell(CellCategory::Ancestor,0);
+          break;
+        case CellDescription::Type::Erased:
+          break;
+      }
+    } break;
+  }
+}
+
+void exahype::profilers::PerformanceReport::countFaces(const int numberOfFaces) {
+  if (_active) {
+    add(getThreadCounters().faces, numberOfFaces);
+  }
+}
+
+void exahype::profilers::PerformanceReport::recordTraversals(
+    const std::string& adapterName, const int numberOfTraversals, const double seconds) {
+  if (_active) {
+    AdapterStatistics& statistics = _adapters[adapterName]; // zero-initialised on insertion
+    statistics.traversals += numberOfTraversals;
+    statistics.seconds    += seconds;
+  }
+}
+
+void exahype::profilers::PerformanceReport::finishedTimeSteps(const int numberOfTimeSteps) {
+  if (_active) {
+    _numberOfTimeSteps                += numberOfTimeSteps;
+    _numberOfTimeStepsSinceLastReport += numberOfTimeSteps;
+    if (_interval>0 && _numberOfTimeStepsSinceLastReport>=_interval) {
+      writeReport("interval");
+      _numberOfTimeStepsSinceLastReport = 0;
+    }
+  }
+}
+
+void exahype::profilers::PerformanceReport::writeReport(const std::string& event) {
+  if (!_active) {
+    return;
+  }
+
+  long long phaseNanoseconds[NumberOfPhases]   = {0};
+  long long phaseCalls[NumberOfPhases]         = {0};
+  long long cells[NumberOfCellCategories]      = {0};
+  long long degreesOfFreedom                   = 0;
+  long long faces                              = 0;
+  int       numberOfThreads                    = 0;
+  {
+    tarch::multicore::Lock lock(_semaphore);
+    for (auto& counters : _threadCounters) {
+      for (int phase=0; phase<NumberOfPhases; phase++) {
+        phaseNanoseconds[phase] += counters->phaseNanoseconds[phase].load(std::memory_order_relaxed);
+        phaseCalls[phase]       += counters->phaseCalls[phase].load(std::memory_order_relaxed);
+      }
+      for (int category=0; category<NumberOfCellCategories; category++) {
+        cells[category] += counters->cells[category].load(std::memory_order_relaxed);
+      }
+      degreesOfFreedom += counters->degreesOfFreedom.load(std::memory_order_relaxed);
+      faces            += counters->faces.load(std::memory_order_relaxed);
+    }
+    numberOfThreads = _threadCounters.size();
+  }
+
+  const double wallClockSeconds =
+      std::chrono::duration<double>(Clock::now()-_startTime).count();
+  double traversalSeconds = 0.0;
+  for (auto& adapter : _adapters) {
+    traversalSeconds += adapter.second.seconds;
+  }
+  const long long cellUpdates = cells[static_cast<int>(CellCategory::Cell)];
+
+  std::ostringstream report;
+  report << "{\"event\":\"" << event << "\"" <<
+      ",\"rank\":" << tarch::parallel::Node::getInstance().getRank() <<
+      ",\"timeSteps\":" << _numberOfTimeSteps <<
+      ",\"wallClockSeconds\":" << wallClockSeconds <<
+      ",\"traversalSeconds\":" << traversalSeconds <<
+      ",\"threads\":" << numberOfThreads;
+
+  report << ",\"adapters\":{";
+  bool first = true;
+  for (auto& adapter : _adapters) {
+    report << (first ? "" : ",") << "\"" << adapter.first << "\":{" <<
+        "\"traversals\":" << adapter.second.traversals <<
+        ",\"seconds\":"   << adapter.second.seconds << "}";
+    first = false;
+  }
+  report << "}";
+
+  report << ",\"phases\":{";
+  for (int phase=0; phase<NumberOfPhases; phase++) {
+    report << (phase>0 ? "," : "") << "\"" << PhaseNames[phase] << "\":{" <<
+        "\"calls\":"         << phaseCalls[phase] <<
+        ",\"threadSeconds\":" << toSeconds(phaseNanoseconds[phase]) << "}";
+  }
+  report << "}";
+
+  report << ",\"cells\":{";
+  for (int category=0; category<NumberOfCellCategories; category++) {
+    report << (category>0 ? "," : "") << "\"" << CellCategoryNames[category] << "\":" << cells[category];
+  }
+  report << "}";
+
+  report << ",\"faces\":" << faces <<
+      ",\"dofUpdates\":" << degreesOfFreedom <<
+      ",\"cellUpdatesPerSecond\":" << (wallClockSeconds>0.0 ? cellUpdates/wallClockSeconds : 0.0) <<
+      ",\"dofUpdatesPerSecond\":"  << (wallClockSeconds>0.0 ? degreesOfFreedom/wallClockSeconds : 0.0) <<
+      "}";
+
+  std::ofstream file(_fileName, std::ios::app);
+  if (file) {
+    file << report.str() << std::endl;
+  } else {
+    logError("writeReport(...)", "could not append to performance report file " << _fileName);
+  }
+
+  logInfo("writeReport(...)", "performance report (" << event << "): time steps=" << _numberOfTimeSteps <<
+      ", cell updates/s=" << (wallClockSeconds>0.0 ? cellUpdates/wallClockSeconds : 0.0) <<
+      ", DoF updates/s=" << (wallClockSeconds>0.0 ? degreesOfFreedom/wallClockSeconds : 0.0));
+}
@@ -0,0 +1,267 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_PROFILERS_PERFORMANCE_REPORT_H_
+#define _EXAHYPE_PROFILERS_PERFORMANCE_REPORT_H_
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tarch/logging/Log.h"
+#include "tarch/multicore/BooleanSemaphore.h"
+
+namespace exahype {
+namespace solvers {
+class Solver;
+}  // namespace solvers
+
+namespace tests {
+namespace profilers {
+class PerformanceReportTest;
+}  // namespace profilers
+}  // namespace tests
+
+namespace profilers {
+
+/**
+ * Run-wide performance report.
+ *
+ * Peano's iteration statistics tell us how often and how long each adapter
+ * ran, and printTimeStepInfo() logs time stamps and memory usage. Neither
+ * tells us where the wall time of a time step went. This report collects
+ *
+ * - per adapter: the number of traversals and the wall time spent in them
+ *   (recorded by the runner around each Repository::iterate() call);
+ * - per phase: the number of calls and the time spent in the solver
+ *   kernels of this phase (see Phase);
+ * - the number of cell descriptions processed by the solution update per
+ *   category (see CellCategory), the number of merged faces, and the number
+ *   of degrees of freedom updated.
+ *
+ * From these, it derives the cell updates and the DoF updates per second of
+ * wall time. The report is appended as a single line of JSON to a file, either
+ * every few time steps or at the end of the simulation (see the optional
+ * entries performance-report-file and performance-report-interval
+ * in the optimisation section of the specification file). Each line holds the
+ * counts accumulated since the start of the run. One can thus diff two
+ * lines to obtain the counts of an interval, or compare the final lines of two
+ * runs to spot performance regressions.
+ *
+ * <h2>Multithreading</h2>
+ *
+ * Phases and counts are recorded concurrently by the mapping and background
+ * threads. Each thread registers its own set of counters on first use and
+ * from then on writes only to these. A counter thus has exactly one writer and
+ * we do not need to lock or to issue atomic read-modify-write operations. The
+ * counters are atomics nevertheless so that writeReport(...) can read them
+ * while the threads are still running.
+ *
+ * The time of a phase is the sum over all threads, i.e. it is given in
+ * thread-seconds. It may exceed the wall time of the adapters if
+ * several threads run the same phase.
+ *
+ * <h2>MPI</h2>
+ *
+ * Every rank writes its own report. The rank is appended to the file name.
+ * The time spent waiting for and merging the neighbour data of other ranks is
+ * recorded as phase RemoteNeighbourMerging.
+ *
+ * \note If no file is configured, the report is inactive. ScopedPhase and the
+ * count operations then return immediately.
+ */
+class PerformanceReport {
+ public:
+  typedef std::chrono::steady_clock Clock;
+
+  /**
+   * The phases we time within the grid traversals. Phases may nest,
+   * e.g. a compression spawned within the solution update
+   * counts towards Compression and towards SolutionUpdate.
+   */
+  enum class Phase {
+    Prediction,
+    NeighbourMerging,
+    RemoteNeighbourMerging,
+    SolutionUpdate,
+    Plotting,
+    Compression,
+    Uncompression,
+    NumberOfPhases
+  };
+
+  /**
+   * The categories of cell descriptions we count. Troubled cells are
+   * compute cells (Cell) of a LimitingADERDGSolver which are updated with the
+   * limiter; they are counted as Cell as well.
+   */
+  enum class CellCategory {
+    Cell,
+    Descendant,
+    Ancestor,
+    Troubled,
+    NumberOfCellCategories
+  };
+
+  static constexpr int NumberOfPhases         = static_cast<int>(Phase::NumberOfPhases);
+  static constexpr int NumberOfCellCategories = static_cast<int>(CellCategory::NumberOfCellCategories);
+
+  /**
+   * Times the enclosing scope as \p phase if the report is active.
+   */
+  class ScopedPhase {
+   private:
+    const Phase       _phase;
+    const bool        _active;
+    Clock::time_point _start;
+
+   public:
+    explicit ScopedPhase(const Phase phase);
+    ~ScopedPhase();
+
+    ScopedPhase(const ScopedPhase& other) = delete;
+    ScopedPhase& operator=(const ScopedPhase& other) = delete;
+  };
+
+ private:
+  friend class exahype::tests::profilers::PerformanceReportTest;
+
+  static tarch::logging::Log _log;
+
+  /**
+   * The counters of one thread. Written by this thread only.
+   */
+  struct ThreadCounters {
+    std::atomic<long long> phaseNanoseconds[NumberOfPhases];
+    std::atomic<long long> phaseCalls[NumberOfPhases];
+    std::atomic<long long> cells[NumberOfCellCategories];
+    std::atomic<long long> degreesOfFreedom;
+    std::atomic<long long> faces;
+
+    ThreadCounters();
+  };
+
+  struct AdapterStatistics {
+    long long traversals;
+    double    seconds;
+  };
+
+  std::string _fileName;
+  int         _interval;
+
+  bool        _active;
+
+  Clock::time_point _startTime;
+
+  int _numberOfTimeSteps;
+  int _numberOfTimeStepsSinceLastReport;
+
+  /**
+   * The counters of all threads which have recorded anything so far.
+   * Guarded by _semaphore.
+   */
+  std::vector<std::unique_ptr<ThreadCounters>> _threadCounters;
+
+  /**
+   * Per adapter statistics. Written by the runner only.
+   */
+  std::map<std::string,AdapterStatistics> _adapters;
+
+  tarch::multicore::BooleanSemaphore _semaphore;
+
+  PerformanceReport();
+
+  /**
+   * \return The counters of the calling thread. Registers them on first use.
+   */
+  ThreadCounters& getThreadCounters();
+
+  /**
+   * Adds \p value to a counter of the calling thread.
+   */
+  static void add(std::atomic<long long>& counter, const long long value);
+
+ public:
+  static PerformanceReport& getInstance();
+
+  PerformanceReport(const PerformanceReport& other) = delete;
+  PerformanceReport& operator=(const PerformanceReport& other) = delete;
+
+  /**
+   * Activates the report.
+   *
+   * \param fileName The file the report is written to. We append the rank
+   *                 if we run with MPI. The file is truncated.
+   * \param interval Write a report every \p interval time steps. Pass 0
+   *                 to write a report at the end of the simulation only.
+   */
+  void configure(const std::string& fileName, const int interval);
+
+  bool isActive() const;
+
+  /**
+   * Adds \p nanoseconds spent in \p phase to the counters of the calling thread.
+   */
+  void recordPhase(const Phase phase, const long long nanoseconds);
+
+  /**
+   * Counts a cell of \p category. \p degreesOfFreedom is the number of
+   * unknowns the cell has updated.
+   */
+  void countCell(const CellCategory category, const int degreesOfFreedom);
+
+  /**
+   * Categorises the cell description \p element at \p cellDescriptionsIndex of
+   * \p solver after its solution update and counts it.
+   */
+  void countUpdatedCell(
+      const exahype::solvers::Solver* const solver,
+      const int cellDescriptionsIndex,
+      const int element);
+
+  /**
+   * Counts \p numberOfFaces merged faces.
+   */
+  void countFaces(const int numberOfFaces);
+
+  /**
+   * Records that the runner ran \p numberOfTraversals traversals
+   * of the adapter \p adapterName which took \p seconds of wall time.
+   *
+   * \note Must be called by the runner (master thread) only.
+   */
+  void recordTraversals(const std::string& adapterName, const int numberOfTraversals, const double seconds);
+
+  /**
+   * Notifies the report that the runner has finished \p numberOfTimeSteps
+   * time steps. Writes an interval report if due.
+   *
+   * \note Must be called by the runner (master thread) only.
+   */
+  void finishedTimeSteps(const int numberOfTimeSteps);
+
+  /**
+   * Appends a report to the file.
+   *
+   * \param event Identifies why the report was written, e.g. "interval" or "exit".
+   */
+  void writeReport(const std::string& event);
+};
+
+}  // namespace profilers
+}  // namespace exahype
+
+#endif  // _EXAHYPE_PROFILERS_PERFORMANCE_REPORT_H_
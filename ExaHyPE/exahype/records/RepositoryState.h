@@ -40,7 +40,7 @@ class exahype::records::RepositoryState {
       typedef exahype::records::RepositoryStatePacked Packed;
       
       enum Action {
-         WriteCheckpoint = 0, ReadCheckpoint = 1, Terminate = 2, RunOnAllNodes = 3, UseAdapterMeshRefinement = 4, UseAdapterPredictionAndFusedTimeSteppingInitialisation = 5, UseAdapterPredictionAndFusedTimeSteppingInitialisationAndPlot = 6, UseAdapterPredictionAndFusedTimeSteppingInitialisationAndPlot2d = 7, UseAdapterGridErasing = 8, UseAdapterADERDGTimeStep = 9, UseAdapterPlotAndADERDGTimeStep = 10, UseAdapterLimiterStatusSpreading = 11, UseAdapterReinitialisation = 12, UseAdapterLocalRecomputationAndTimeStepSizeComputation = 13, UseAdapterNeighbourDataMerging = 14, UseAdapterSolutionUpdate = 15, UseAdapterTimeStepSizeComputation = 16, UseAdapterPrediction = 17, UseAdapterPredictionAndPlot = 18, UseAdapterPredictionAndPlot2d = 19, UseAdapterFinaliseMeshRefinementAndTimeStepSizeComputation = 20, UseAdapterMergeTimeStepData = 21, UseAdapterMergeTimeStepDataDropFaceData = 22, UseAdapterFinaliseMeshRefinementAndReinitialisation = 23, NumberOfAdapters = 24
+         WriteCheckpoint = 0, ReadCheckpoint = 1, Terminate = 2, RunOnAllNodes = 3, UseAdapterMeshRefinement = 4, UseAdapterPredictionAndFusedTimeSteppingInitialisation = 5, UseAdapterPredictionAndFusedTimeSteppingInitialisationAndPlot = 6, UseAdapterPredictionAndFusedTimeSteppingInitialisationAndPlot2d = 7, UseAdapterGridErasing = 8, UseAdapterADERDGTimeStep = 9, UseAdapterPlotAndADERDGTimeStep = 10, UseAdapterLimiterStatusSpreading = 11, UseAdapterReinitialisation = 12, UseAdapterLocalRecomputationAndTimeStepSizeComputation = 13, UseAdapterNeighbourDataMerging = 14, UseAdapterSolutionUpdate = 15, UseAdapterTimeStepSizeComputation = 16, UseAdapterPrediction = 17, UseAdapterPredictionAndPlot = 18, UseAdapterPredictionAndPlot2d = 19, UseAdapterFinaliseMeshRefinementAndTimeStepSizeComputation = 20, UseAdapterMergeTimeStepData = 21, UseAdapterMergeTimeStepDataDropFaceData = 22, UseAdapterFinaliseMeshRefinementAndReinitialisation = 23, UseAdapterSolutionUpdateAndTimeStepSizeComputation = 24, NumberOfAdapters = 25
       };
       
       struct PersistentRecords {
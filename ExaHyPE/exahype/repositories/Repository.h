@@ -89,6 +89,7 @@ class exahype::repositories::Repository {
     virtual void switchToMergeTimeStepData() = 0;    
     virtual void switchToMergeTimeStepDataDropFaceData() = 0;    
     virtual void switchToFinaliseMeshRefinementAndReinitialisation() = 0;    
+    virtual void switchToSolutionUpdateAndTimeStepSizeComputation() = 0;    
 
     virtual bool isActiveAdapterMeshRefinement() const = 0;
     virtual bool isActiveAdapterPredictionAndFusedTimeSteppingInitialisation() const = 0;
@@ -110,6 +111,7 @@ class exahype::repositories::Repository {
     virtual bool isActiveAdapterMergeTimeStepData() const = 0;
     virtual bool isActiveAdapterMergeTimeStepDataDropFaceData() const = 0;
     virtual bool isActiveAdapterFinaliseMeshRefinementAndReinitialisation() const = 0;
+    virtual bool isActiveAdapterSolutionUpdateAndTimeStepSizeComputation() const = 0;
 
 
     /**
@@ -36,6 +36,7 @@
  #include "exahype/adapters/MergeTimeStepData.h" 
  #include "exahype/adapters/MergeTimeStepDataDropFaceData.h" 
  #include "exahype/adapters/FinaliseMeshRefinementAndReinitialisation.h" 
+ #include "exahype/adapters/SolutionUpdateAndTimeStepSizeComputation.h" 
 
 
 
@@ -81,6 +82,7 @@ class exahype::repositories::RepositoryArrayStack: public exahype::repositories:
     peano::grid::Grid<exahype::Vertex,exahype::Cell,exahype::State,VertexStack,CellStack,exahype::adapters::MergeTimeStepData> _gridWithMergeTimeStepData;
     peano::grid::Grid<exahype::Vertex,exahype::Cell,exahype::State,VertexStack,CellStack,exahype::adapters::MergeTimeStepDataDropFaceData> _gridWithMergeTimeStepDataDropFaceData;
     peano::grid::Grid<exahype::Vertex,exahype::Cell,exahype::State,VertexStack,CellStack,exahype::adapters::FinaliseMeshRefinementAndReinitialisation> _gridWithFinaliseMeshRefinementAndReinitialisation;
+    peano::grid::Grid<exahype::Vertex,exahype::Cell,exahype::State,VertexStack,CellStack,exahype::adapters::SolutionUpdateAndTimeStepSizeComputation> _gridWithSolutionUpdateAndTimeStepSizeComputation;
 
   
    exahype::records::RepositoryState               _repositoryState;
@@ -105,6 +107,7 @@ class exahype::repositories::RepositoryArrayStack: public exahype::repositories:
     tarch::timing::Measurement _measureMergeTimeStepDataCPUTime;
     tarch::timing::Measurement _measureMergeTimeStepDataDropFaceDataCPUTime;
     tarch::timing::Measurement _measureFinaliseMeshRefinementAndReinitialisationCPUTime;
+    tarch::timing::Measurement _measureSolutionUpdateAndTimeStepSizeComputationCPUTime;
 
     tarch::timing::Measurement _measureMeshRefinementCalendarTime;
     tarch::timing::Measurement _measurePredictionAndFusedTimeSteppingInitialisationCalendarTime;
@@ -126,6 +129,7 @@ class exahype::repositories::RepositoryArrayStack: public exahype::repositories:
     tarch::timing::Measurement _measureMergeTimeStepDataCalendarTime;
     tarch::timing::Measurement _measureMergeTimeStepDataDropFaceDataCalendarTime;
     tarch::timing::Measurement _measureFinaliseMeshRefinementAndReinitialisationCalendarTime;
+    tarch::timing::Measurement _measureSolutionUpdateAndTimeStepSizeComputationCalendarTime;
 
 
   public:
@@ -191,6 +195,7 @@ class exahype::repositories::RepositoryArrayStack: public exahype::repositories:
     virtual void switchToMergeTimeStepData();    
     virtual void switchToMergeTimeStepDataDropFaceData();    
     virtual void switchToFinaliseMeshRefinementAndReinitialisation();    
+    virtual void switchToSolutionUpdateAndTimeStepSizeComputation();    
 
     virtual bool isActiveAdapterMeshRefinement() const;
     virtual bool isActiveAdapterPredictionAndFusedTimeSteppingInitialisation() const;
@@ -212,6 +217,7 @@ class exahype::repositories::RepositoryArrayStack: public exahype::repositories:
     virtual bool isActiveAdapterMergeTimeStepData() const;
     virtual bool isActiveAdapterMergeTimeStepDataDropFaceData() const;
     virtual bool isActiveAdapterFinaliseMeshRefinementAndReinitialisation() const;
+    virtual bool isActiveAdapterSolutionUpdateAndTimeStepSizeComputation() const;
 
      
     #ifdef Parallel
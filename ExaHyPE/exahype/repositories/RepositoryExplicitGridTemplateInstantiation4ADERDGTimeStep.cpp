@@ -33,6 +33,7 @@
  #include "exahype/adapters/MergeTimeStepData.h" 
  #include "exahype/adapters/MergeTimeStepDataDropFaceData.h" 
  #include "exahype/adapters/FinaliseMeshRefinementAndReinitialisation.h" 
+ #include "exahype/adapters/SolutionUpdateAndTimeStepSizeComputation.h" 
 
 
 namespace peano {
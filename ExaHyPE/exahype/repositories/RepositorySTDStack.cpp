@@ -54,6 +54,7 @@ exahype::repositories::RepositorySTDStack::RepositorySTDStack(
   _gridWithMergeTimeStepData(_vertexStack,_cellStack,_geometry,_solverState,domainSize,computationalDomainOffset,_regularGridContainer,_traversalOrderOnTopLevel),
   _gridWithMergeTimeStepDataDropFaceData(_vertexStack,_cellStack,_geometry,_solverState,domainSize,computationalDomainOffset,_regularGridContainer,_traversalOrderOnTopLevel),
   _gridWithFinaliseMeshRefinementAndReinitialisation(_vertexStack,_cellStack,_geometry,_solverState,domainSize,computationalDomainOffset,_regularGridContainer,_traversalOrderOnTopLevel),
+  _gridWithSolutionUpdateAndTimeStepSizeComputation(_vertexStack,_cellStack,_geometry,_solverState,domainSize,computationalDomainOffset,_regularGridContainer,_traversalOrderOnTopLevel),
 
   _repositoryState() {
   logTraceIn( "RepositorySTDStack(...)" );
@@ -96,6 +97,7 @@ exahype::repositories::RepositorySTDStack::RepositorySTDStack(
   _gridWithMergeTimeStepData(_vertexStack,_cellStack,_geometry,_solverState,_regularGridContainer,_traversalOrderOnTopLevel),
   _gridWithMergeTimeStepDataDropFaceData(_vertexStack,_cellStack,_geometry,_solverState,_regularGridContainer,_traversalOrderOnTopLevel),
   _gridWithFinaliseMeshRefinementAndReinitialisation(_vertexStack,_cellStack,_geometry,_solverState,_regularGridContainer,_traversalOrderOnTopLevel),
+  _gridWithSolutionUpdateAndTimeStepSizeComputation(_vertexStack,_cellStack,_geometry,_solverState,_regularGridContainer,_traversalOrderOnTopLevel),
 
   _repositoryState() {
   logTraceIn( "RepositorySTDStack(Geometry&)" );
@@ -154,6 +156,7 @@ void exahype::repositories::RepositorySTDStack::restart(
   _gridWithMergeTimeStepData.restart(domainSize,domainOffset,domainLevel, positionOfCentralElementWithRespectToCoarserRemoteLevel);
   _gridWithMergeTimeStepDataDropFaceData.restart(domainSize,domainOffset,domainLevel, positionOfCentralElementWithRespectToCoarserRemoteLevel);
   _gridWithFinaliseMeshRefinementAndReinitialisation.restart(domainSize,domainOffset,domainLevel, positionOfCentralElementWithRespectToCoarserRemoteLevel);
+  _gridWithSolutionUpdateAndTimeStepSizeComputation.restart(domainSize,domainOffset,domainLevel, positionOfCentralElementWithRespectToCoarserRemoteLevel);
 
 
   _solverState.restart();
@@ -197,6 +200,7 @@ void exahype::repositories::RepositorySTDStack::terminate() {
   _gridWithMergeTimeStepData.terminate();
   _gridWithMergeTimeStepDataDropFaceData.terminate();
   _gridWithFinaliseMeshRefinementAndReinitialisation.terminate();
+  _gridWithSolutionUpdateAndTimeStepSizeComputation.terminate();
 
 
   logTraceOut( "terminate()" );
@@ -272,6 +276,7 @@ void exahype::repositories::RepositorySTDStack::iterate(int numberOfIterations,
       case exahype::records::RepositoryState::UseAdapterMergeTimeStepData: watch.startTimer(); _gridWithMergeTimeStepData.iterate(); watch.stopTimer(); _measureMergeTimeStepDataCPUTime.setValue( watch.getCPUTime() ); _measureMergeTimeStepDataCalendarTime.setValue( watch.getCalendarTime() ); break;
       case exahype::records::RepositoryState::UseAdapterMergeTimeStepDataDropFaceData: watch.startTimer(); _gridWithMergeTimeStepDataDropFaceData.iterate(); watch.stopTimer(); _measureMergeTimeStepDataDropFaceDataCPUTime.setValue( watch.getCPUTime() ); _measureMergeTimeStepDataDropFaceDataCalendarTime.setValue( watch.getCalendarTime() ); break;
       case exahype::records::RepositoryState::UseAdapterFinaliseMeshRefinementAndReinitialisation: watch.startTimer(); _gridWithFinaliseMeshRefinementAndReinitialisation.iterate(); watch.stopTimer(); _measureFinaliseMeshRefinementAndReinitialisationCPUTime.setValue( watch.getCPUTime() ); _measureFinaliseMeshRefinementAndReinitialisationCalendarTime.setValue( watch.getCalendarTime() ); break;
+      case exahype::records::RepositoryState::UseAdapterSolutionUpdateAndTimeStepSizeComputation: watch.startTimer(); _gridWithSolutionUpdateAndTimeStepSizeComputation.iterate(); watch.stopTimer(); _measureSolutionUpdateAndTimeStepSizeComputationCPUTime.setValue( watch.getCPUTime() ); _measureSolutionUpdateAndTimeStepSizeComputationCalendarTime.setValue( watch.getCalendarTime() ); break;
 
       case exahype::records::RepositoryState::Terminate:
         assertionMsg( false, "this branch/state should never be reached" ); 
@@ -323,6 +328,7 @@ void exahype::repositories::RepositorySTDStack::iterate(int numberOfIterations,
  void exahype::repositories::RepositorySTDStack::switchToMergeTimeStepData() { _repositoryState.setAction(exahype::records::RepositoryState::UseAdapterMergeTimeStepData); }
  void exahype::repositories::RepositorySTDStack::switchToMergeTimeStepDataDropFaceData() { _repositoryState.setAction(exahype::records::RepositoryState::UseAdapterMergeTimeStepDataDropFaceData); }
  void exahype::repositories::RepositorySTDStack::switchToFinaliseMeshRefinementAndReinitialisation() { _repositoryState.setAction(exahype::records::RepositoryState::UseAdapterFinaliseMeshRefinementAndReinitialisation); }
+ void exahype::repositories::RepositorySTDStack::switchToSolutionUpdateAndTimeStepSizeComputation() { _repositoryState.setAction(exahype::records::RepositoryState::UseAdapterSolutionUpdateAndTimeStepSizeComputation); }
 
 
 
@@ -346,6 +352,7 @@ void exahype::repositories::RepositorySTDStack::iterate(int numberOfIterations,
  bool exahype::repositories::RepositorySTDStack::isActiveAdapterMergeTimeStepData() const { return _repositoryState.getAction() == exahype::records::RepositoryState::UseAdapterMergeTimeStepData; }
  bool exahype::repositories::RepositorySTDStack::isActiveAdapterMergeTimeStepDataDropFaceData() const { return _repositoryState.getAction() == exahype::records::RepositoryState::UseAdapterMergeTimeStepDataDropFaceData; }
  bool exahype::repositories::RepositorySTDStack::isActiveAdapterFinaliseMeshRefinementAndReinitialisation() const { return _repositoryState.getAction() == exahype::records::RepositoryState::UseAdapterFinaliseMeshRefinementAndReinitialisation; }
+ bool exahype::repositories::RepositorySTDStack::isActiveAdapterSolutionUpdateAndTimeStepSizeComputation() const { return _repositoryState.getAction() == exahype::records::RepositoryState::UseAdapterSolutionUpdateAndTimeStepSizeComputation; }
 
 
 
@@ -442,6 +449,7 @@ void exahype::repositories::RepositorySTDStack::logIterationStatistics(bool logA
    if (logAllAdapters || _measureMergeTimeStepDataCPUTime.getNumberOfMeasurements()>0) logInfo( "logIterationStatistics()", "| MergeTimeStepData \t |  " << _measureMergeTimeStepDataCPUTime.getNumberOfMeasurements() << " \t |  " << _measureMergeTimeStepDataCPUTime.getAccumulatedValue() << " \t |  " << _measureMergeTimeStepDataCPUTime.getValue()  << " \t |  " << _measureMergeTimeStepDataCalendarTime.getAccumulatedValue() << " \t |  " << _measureMergeTimeStepDataCalendarTime.getValue() << " \t |  " << _measureMergeTimeStepDataCPUTime.toString() << " \t |  " << _measureMergeTimeStepDataCalendarTime.toString() );
    if (logAllAdapters || _measureMergeTimeStepDataDropFaceDataCPUTime.getNumberOfMeasurements()>0) logInfo( "logIterationStatistics()", "| MergeTimeStepDataDropFaceData \t |  " << _measureMergeTimeStepDataDropFaceDataCPUTime.getNumberOfMeasurements() << " \t |  " << _measureMergeTimeStepDataDropFaceDataCPUTime.getAccumulatedValue() << " \t |  " << _measureMergeTimeStepDataDropFaceDataCPUTime.getValue()  << " \t |  " << _measureMergeTimeStepDataDropFaceDataCalendarTime.getAccumulatedValue() << " \t |  " << _measureMergeTimeStepDataDropFaceDataCalendarTime.getValue() << " \t |  " << _measureMergeTimeStepDataDropFaceDataCPUTime.toString() << " \t |  " << _measureMergeTimeStepDataDropFaceDataCalendarTime.toString() );
    if (logAllAdapters || _measureFinaliseMeshRefinementAndReinitialisationCPUTime.getNumberOfMeasurements()>0) logInfo( "logIterationStatistics()", "| FinaliseMeshRefinementAndReinitialisation \t |  " << _measureFinaliseMeshRefinementAndReinitialisationCPUTime.getNumberOfMeasurements() << " \t |  " << _measureFinaliseMeshRefinementAndReinitialisationCPUTime.getAccumulatedValue() << " \t |  " << _measureFinaliseMeshRefinementAndReinitialisationCPUTime.getValue()  << " \t |  " << _measureFinaliseMeshRefinementAndReinitialisationCalendarTime.getAccumulatedValue() << " \t |  " << _measureFinaliseMeshRefinementAndReinitialisationCalendarTime.getValue() << " \t |  " << _measureFinaliseMeshRefinementAndReinitialisationCPUTime.toString() << " \t |  " << _measureFinaliseMeshRefinementAndReinitialisationCalendarTime.toString() );
+   if (logAllAdapters || _measureSolutionUpdateAndTimeStepSizeComputationCPUTime.getNumberOfMeasurements()>0) logInfo( "logIterationStatistics()", "| SolutionUpdateAndTimeStepSizeComputation \t |  " << _measureSolutionUpdateAndTimeStepSizeComputationCPUTime.getNumberOfMeasurements() << " \t |  " << _measureSolutionUpdateAndTimeStepSizeComputationCPUTime.getAccumulatedValue() << " \t |  " << _measureSolutionUpdateAndTimeStepSizeComputationCPUTime.getValue()  << " \t |  " << _measureSolutionUpdateAndTimeStepSizeComputationCalendarTime.getAccumulatedValue() << " \t |  " << _measureSolutionUpdateAndTimeStepSizeComputationCalendarTime.getValue() << " \t |  " << _measureSolutionUpdateAndTimeStepSizeComputationCPUTime.toString() << " \t |  " << _measureSolutionUpdateAndTimeStepSizeComputationCalendarTime.toString() );
 
 }
 
@@ -467,6 +475,7 @@ void exahype::repositories::RepositorySTDStack::clearIterationStatistics() {
    _measureMergeTimeStepDataCPUTime.erase();
    _measureMergeTimeStepDataDropFaceDataCPUTime.erase();
    _measureFinaliseMeshRefinementAndReinitialisationCPUTime.erase();
+   _measureSolutionUpdateAndTimeStepSizeComputationCPUTime.erase();
 
    _measureMeshRefinementCalendarTime.erase();
    _measurePredictionAndFusedTimeSteppingInitialisationCalendarTime.erase();
@@ -488,5 +497,6 @@ void exahype::repositories::RepositorySTDStack::clearIterationStatistics() {
    _measureMergeTimeStepDataCalendarTime.erase();
    _measureMergeTimeStepDataDropFaceDataCalendarTime.erase();
    _measureFinaliseMeshRefinementAndReinitialisationCalendarTime.erase();
+   _measureSolutionUpdateAndTimeStepSizeComputationCalendarTime.erase();
 
 }
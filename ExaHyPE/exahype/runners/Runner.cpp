@@ -13,7 +13,9 @@
 
 #include "exahype/runners/Runner.h"
 
+#include <chrono>
 #include <cmath>
+#include <limits>
 
 #include "../../../Peano/mpibalancing/HotspotBalancing.h"
 
@@ -22,6 +24,7 @@
 #include "exahype/mappings/TimeStepSizeComputation.h"
 #include "exahype/mappings/Sending.h"
 #include "exahype/mappings/LoadBalancing.h"
+#include "exahype/mappings/SolutionUpdate.h"
 
 
 #include "tarch/Assertions.h"
@@ -62,13 +65,24 @@
 #include "exahype/mappings/LimiterStatusSpreading.h"
 
 #include "exahype/solvers/LimitingADERDGSolver.h"
+#include "exahype/solvers/HeapEntryPool.h"
+#include "exahype/solvers/OutOfCoreStorage.h"
+
+#include "exahype/profilers/PerformanceReport.h"
+
+#include "kernels/KernelScheduler.h"
 
 #include "tarch/multicore/MulticoreDefinitions.h"
 
 
 tarch::logging::Log exahype::runners::Runner::_log("exahype::runners::Runner");
 
-exahype::runners::Runner::Runner(Parser& parser) : _parser(parser), _boundingBoxSize(0.0) {}
+constexpr int exahype::runners::Runner::MaxSpeculativeBatchSize;
+
+exahype::runners::Runner::Runner(Parser& parser) :
+  _parser(parser),
+  _boundingBoxSize(0.0),
+  _speculativeBatchSize(1) {}
 
 exahype::runners::Runner::~Runner() {}
 
@@ -202,6 +216,14 @@ void exahype::runners::Runner::initDistributedMemoryConfiguration() {
     exahype::mappings::Sending::SkipReductionInBatchedTimeSteps = false;
   }
 
+  if ( _parser.getNonBlockingTimeStepDataReduction() ) {
+    logInfo("initDistributedMemoryConfiguration()", "reduce time step data with a non-blocking all-reduce" );
+    exahype::mappings::TimeStepSizeComputation::NonBlockingTimeStepDataReduction = true;
+  }
+  else {
+    exahype::mappings::TimeStepSizeComputation::NonBlockingTimeStepDataReduction = false;
+  }
+
   tarch::parallel::NodePool::getInstance().waitForAllNodesToBecomeIdle();
   #endif
 }
@@ -218,6 +240,7 @@ void exahype::runners::Runner::initSharedMemoryConfiguration() {
   #ifdef SharedMemoryParallelisation
   const int numberOfThreads = _parser.getNumberOfThreads();
   tarch::multicore::Core::getInstance().configure(numberOfThreads);
+  kernels::KernelScheduler::getInstance().configure(numberOfThreads);
 
   switch (_parser.getMulticoreOracleType()) {
   case Parser::MulticoreOracleType::Dummy:
@@ -303,6 +326,37 @@ void exahype::runners::Runner::initDataCompression() {
       logInfo( "initDataCompression()", "store all data with accuracy of " << exahype::solvers::ADERDGSolver::CompressionAccuracy << ". Use background threads for data conversion=" << exahype::solvers::ADERDGSolver::SpawnCompressionAsBackgroundThread);
     }
   }
+
+  exahype::solvers::ADERDGSolver::ExtrapolatedPredictorPrecision = _parser.getStoragePrecision("extrapolated-predictor");
+  exahype::solvers::ADERDGSolver::FluctuationPrecision           = _parser.getStoragePrecision("fluctuation");
+  exahype::solvers::ADERDGSolver::PreviousSolutionPrecision      = _parser.getStoragePrecision("previous-solution");
+  exahype::solvers::ADERDGSolver::UpdatePrecision                = _parser.getStoragePrecision("update");
+
+  if (exahype::solvers::ADERDGSolver::usesCompressedStorage() && !_parser.getFuseAlgorithmicSteps()) {
+    logError( "initDataCompression()", "reduced storage precision is not supported if you don't use the fused time stepping");
+    exahype::solvers::ADERDGSolver::ExtrapolatedPredictorPrecision = exahype::solvers::StoragePrecision::Double;
+    exahype::solvers::ADERDGSolver::FluctuationPrecision           = exahype::solvers::StoragePrecision::Double;
+    exahype::solvers::ADERDGSolver::PreviousSolutionPrecision      = exahype::solvers::StoragePrecision::Double;
+    exahype::solvers::ADERDGSolver::UpdatePrecision                = exahype::solvers::StoragePrecision::Double;
+  }
+  else if (exahype::solvers::ADERDGSolver::usesCompressedStorage()) {
+    logInfo( "initDataCompression()", "store and communicate arrays in precision: " <<
+        "extrapolated-predictor=" << exahype::solvers::toString(exahype::solvers::ADERDGSolver::ExtrapolatedPredictorPrecision) <<
+        ",fluctuation="           << exahype::solvers::toString(exahype::solvers::ADERDGSolver::FluctuationPrecision) <<
+        ",previous-solution="     << exahype::solvers::toString(exahype::solvers::ADERDGSolver::PreviousSolutionPrecision) <<
+        ",update="                << exahype::solvers::toString(exahype::solvers::ADERDGSolver::UpdatePrecision));
+  }
+
+  const std::string outOfCoreDirectory = _parser.getOutOfCoreDirectory();
+  if (!outOfCoreDirectory.empty()) {
+    if (!exahype::solvers::ADERDGSolver::usesCompressedStorage()) {
+      logWarning( "initDataCompression()", "out-of-core storage requires data compression or a reduced storage precision. Keep all data in memory");
+    }
+    else {
+      exahype::solvers::OutOfCoreStorage::getInstance().configure(
+          outOfCoreDirectory, static_cast<long>(_parser.getOutOfCoreWindow())*1024*1024);
+    }
+  }
 }
 
 
@@ -472,6 +526,9 @@ exahype::repositories::Repository* exahype::runners::Runner::createRepository()
 
   _domainSize = scaledDomainSize;
 
+  multiscalelinkedcell::HangingVertexBookkeeper::getInstance().setBoundingBox(
+      boundingBoxOffset,_boundingBoxSize);
+
   static peano::geometry::Hexahedron geometry(
       _domainSize,
       _domainOffset);
@@ -486,6 +543,12 @@ exahype::repositories::Repository* exahype::runners::Runner::createRepository()
 
 void exahype::runners::Runner::initHPCEnvironment() {
   peano::performanceanalysis::Analysis::getInstance().enable(false);
+
+  const std::string performanceReportFile = _parser.getPerformanceReportFile();
+  if (!performanceReportFile.empty()) {
+    exahype::profilers::PerformanceReport::getInstance().configure(
+        performanceReportFile, _parser.getPerformanceReportInterval());
+  }
 }
 
 
@@ -506,6 +569,23 @@ int exahype::runners::Runner::run() {
     if (_parser.getFuseAlgorithmicSteps()) {
       exahype::State::FuseADERDGPhases         = _parser.getFuseAlgorithmicSteps();
       exahype::State::WeightForPredictionRerun = _parser.getFuseAlgorithmicStepsFactor();
+
+      if (_parser.getSpeculativeTimeStepBatching()) {
+        bool allSolversAreADERDGSolvers = true;
+        for (auto* solver : exahype::solvers::RegisteredSolvers) {
+          allSolversAreADERDGSolvers &= solver->getType()==exahype::solvers::Solver::Type::ADERDG;
+        }
+        exahype::solvers::ADERDGSolver::SpeculativeTimeStepBatching =
+            allSolversAreADERDGSolvers &&
+            exahype::solvers::Solver::allSolversUseTimeSteppingScheme(exahype::solvers::Solver::TimeStepping::Global);
+
+        if (exahype::solvers::ADERDGSolver::SpeculativeTimeStepBatching) {
+          logInfo("run(...)","batch time steps speculatively");
+        } else {
+          logWarning("run(...)","speculative time step batching requires that all solvers "
+              "are pure ADER-DG solvers using global time stepping. Option is ignored");
+        }
+      }
     } else {
       bool abortProgram = false;
       for (unsigned int solverNumber = 0; solverNumber < exahype::solvers::RegisteredSolvers.size(); ++solverNumber) {
@@ -549,10 +629,15 @@ int exahype::runners::Runner::run() {
     }
     #endif
 
+    exahype::solvers::HeapEntryPool::logStatisticsOfAllPools();
+    exahype::solvers::OutOfCoreStorage::getInstance().logStatistics();
+    exahype::profilers::PerformanceReport::getInstance().writeReport("exit");
+
     shutdownSharedMemoryConfiguration();
     shutdownDistributedMemoryConfiguration();
 
     delete repository;
+    exahype::solvers::OutOfCoreStorage::getInstance().shutdown();
   }
   else {
     logError( "run(...)", "do not run code as parser reported errors" );
@@ -570,20 +655,44 @@ void exahype::runners::Runner::initSolvers(
   }
 }
 
+bool exahype::runners::Runner::statusSpreadingHasNotConverged(int& stableIterations, const bool statusHasChanged) {
+  if (statusHasChanged) {
+    stableIterations = 0;
+  } else {
+    stableIterations++;
+  }
+  return stableIterations < NumberOfStableIterationsToFinishStatusSpreading;
+}
+
 bool exahype::runners::Runner::createMesh(exahype::repositories::Repository& repository) {
   bool gridUpdate = false;
 
-  int gridSetupIterations = 0;
+  int gridSetupIterations        = 0;
+  int gridConstructionIterations = 0;
+  int statusSpreadingIterations  = 0;
+  int stableIterations           = 0;
+  bool continueMeshUpdate        = true;
   repository.switchToMeshRefinement();
 
-  while ( repository.getState().continueToConstructGrid()
-          || exahype::solvers::Solver::oneSolverHasNotAttainedStableState()
-  ) {
-    repository.iterate();
+  while ( continueMeshUpdate ) {
+    const bool constructGrid = repository.getState().continueToConstructGrid();
+    gridUpdate |= constructGrid || exahype::solvers::Solver::oneSolverHasNotAttainedStableState();
+
+    iterate(repository);
     gridSetupIterations++;
+    if (constructGrid) {
+      gridConstructionIterations++;
+    } else {
+      statusSpreadingIterations++;
+    }
 
     repository.getState().endedGridConstructionIteration( getFinestGridLevelOfAllSolvers(_boundingBoxSize) );
 
+    continueMeshUpdate = statusSpreadingHasNotConverged(
+        stableIterations,
+        repository.getState().continueToConstructGrid() ||
+        exahype::solvers::Solver::oneSolverHasNotAttainedStableState());
+
     #if defined(TrackGridStatistics) && defined(Asserts)
     logInfo("createGrid()",
         "grid setup iteration #" << gridSetupIterations <<
@@ -627,38 +736,16 @@ bool exahype::runners::Runner::createMesh(exahype::repositories::Repository& rep
     #endif
 
     #ifdef Asserts
-    if (exahype::solvers::ADERDGSolver::CompressionAccuracy>0.0) {
+    if (exahype::solvers::ADERDGSolver::usesCompressedStorage()) {
       DataHeap::getInstance().plotStatistics();
       peano::heap::PlainCharHeap::getInstance().plotStatistics();
     }
     #endif
-
-    gridUpdate = true;
-  }
-
-  // a few extra iterations for the limiter status spreading
-  logInfo("createGrid()", "more status spreading.");
-  int extraIterations = 3;
-  if (exahype::solvers::LimitingADERDGSolver::oneSolverRequestedGlobalRecomputation()) {
-    extraIterations = 5;
   }
-  while (
-      extraIterations > 0
-      || repository.getState().continueToConstructGrid()
-      || exahype::solvers::Solver::oneSolverHasNotAttainedStableState()
-  ) {
-    gridUpdate |=
-        repository.getState().continueToConstructGrid()
-        || exahype::solvers::Solver::oneSolverHasNotAttainedStableState();
-
-    repository.iterate();
-    extraIterations--;
-    gridSetupIterations++;
 
-    repository.getState().endedGridConstructionIteration( getFinestGridLevelOfAllSolvers(_boundingBoxSize) );
-  }
-
-  logInfo("createGrid(Repository)", "finished grid setup after " << gridSetupIterations << " iterations" );
+  logInfo("createGrid(Repository)", "finished grid setup after " << gridSetupIterations << " iterations" <<
+          " (grid construction: " << gridConstructionIterations <<
+          ", status spreading: " << statusSpreadingIterations << ")" );
 
   if (
     tarch::parallel::NodePool::getInstance().getNumberOfIdleNodes()>0
@@ -685,6 +772,26 @@ int exahype::runners::Runner::runAsMaster(exahype::repositories::Repository& rep
 
     logInfo( "runAsMaster(...)", "initialised all data and computed first time step size" );
 
+    #ifdef Parallel
+    if (exahype::mappings::TimeStepSizeComputation::NonBlockingTimeStepDataReduction &&
+        tarch::parallel::NodePool::getInstance().getNumberOfIdleNodes()>0) {
+      logError("runAsMaster(...)","non-blocking-time-step-reduction requires that all ranks are working but " <<
+               tarch::parallel::NodePool::getInstance().getNumberOfIdleNodes() << " ranks are idle. " <<
+               "Switch the feature off or reduce the number of ranks");
+      exit(-1);
+    }
+    for (auto* solver : exahype::solvers::RegisteredSolvers) {
+      if (solver->getInSituReductions()!=nullptr &&
+          tarch::parallel::NodePool::getInstance().getNumberOfIdleNodes()>0) {
+        logError("runAsMaster(...)","in-situ reductions of solver " << solver->getIdentifier() <<
+                 " require that all ranks are working but " <<
+                 tarch::parallel::NodePool::getInstance().getNumberOfIdleNodes() << " ranks are idle. " <<
+                 "Reduce the number of ranks");
+        exit(-1);
+      }
+    }
+    #endif
+
     bool plot = exahype::plotters::startPlottingIfAPlotterIsActive(
         solvers::Solver::getMinSolverTimeStampOfAllSolvers());
 
@@ -696,7 +803,7 @@ int exahype::runners::Runner::runAsMaster(exahype::repositories::Repository& rep
       } else {
         repository.switchToPredictionAndFusedTimeSteppingInitialisation();
       }
-      repository.iterate();
+      iterate(repository);
     } else {
       repository.getState().switchToPredictionContext();
       if (plot) {
@@ -704,7 +811,7 @@ int exahype::runners::Runner::runAsMaster(exahype::repositories::Repository& rep
       } else {
         repository.switchToPrediction();
       }
-      repository.iterate();
+      iterate(repository);
     }
     logInfo("runAsMaster(...)","plotted initial solution (if specified) and computed first predictor");
 
@@ -736,15 +843,38 @@ int exahype::runners::Runner::runAsMaster(exahype::repositories::Repository& rep
           }
           numberOfStepsToRun = numberOfStepsToRun<1 ? 1 : numberOfStepsToRun;
         }
+        else if (exahype::solvers::ADERDGSolver::SpeculativeTimeStepBatching) {
+          /**
+           * We do not know the time step sizes of the upcoming steps.
+           * We thus bound the batch by the current (largest) admissible
+           * time step size and let the batch size adapt to the
+           * number of violations of the stability condition.
+           */
+          numberOfStepsToRun = _speculativeBatchSize;
+          if (solvers::Solver::getMinSolverTimeStepSizeOfAllSolvers()>0.0) {
+            const double timeIntervalTillNextPlot = std::min(exahype::plotters::getTimeOfNextPlot(),simulationEndTime) - solvers::Solver::getMaxSolverTimeStampOfAllSolvers();
+            numberOfStepsToRun = std::min(
+                numberOfStepsToRun,
+                static_cast<int>(std::floor( timeIntervalTillNextPlot / solvers::Solver::getMinSolverTimeStepSizeOfAllSolvers() )));
+          }
+          numberOfStepsToRun = numberOfStepsToRun<1 ? 1 : numberOfStepsToRun;
+        }
 
-        runOneTimeStepWithFusedAlgorithmicSteps(
+        int numberOfStepsRan = 0;
+        const bool predictorWasRerun = runOneTimeStepWithFusedAlgorithmicSteps(
           repository,
           numberOfStepsToRun,
-          _parser.getExchangeBoundaryDataInBatchedTimeSteps() && repository.getState().isGridStationary()
+          _parser.getExchangeBoundaryDataInBatchedTimeSteps() && repository.getState().isGridStationary(),
+          numberOfStepsRan
         );
-        printTimeStepInfo(numberOfStepsToRun,repository);
+        if (exahype::solvers::ADERDGSolver::SpeculativeTimeStepBatching && numberOfStepsToRun>0) {
+          _speculativeBatchSize = adaptSpeculativeBatchSize(_speculativeBatchSize,predictorWasRerun);
+        }
+        printTimeStepInfo(numberOfStepsRan,repository);
+        exahype::profilers::PerformanceReport::getInstance().finishedTimeSteps(numberOfStepsRan);
       } else {
         runOneTimeStepWithThreeSeparateAlgorithmicSteps(repository, plot);
+        exahype::profilers::PerformanceReport::getInstance().finishedTimeSteps(1);
       }
 
       #if  defined(SharedMemoryParallelisation) && defined(PerformanceAnalysis) && !defined(Parallel)
@@ -762,6 +892,8 @@ int exahype::runners::Runner::runAsMaster(exahype::repositories::Repository& rep
     }
 
     repository.logIterationStatistics(false);
+
+    exahype::mappings::SolutionUpdate::finishInSituReductions();
   }
 
   repository.terminate();
@@ -882,7 +1014,7 @@ void exahype::runners::Runner::initialiseMesh(exahype::repositories::Repository&
   logInfo("initialiseMesh(...)","finalise mesh refinement and compute first time step size");
   repository.getState().switchToTimeStepSizeComputationContext();
   repository.switchToFinaliseMeshRefinementAndTimeStepSizeComputation();
-  repository.iterate();
+  iterate(repository);
 }
 
 void exahype::runners::Runner::updateMeshFusedTimeStepping(exahype::repositories::Repository& repository) {
@@ -890,14 +1022,25 @@ void exahype::runners::Runner::updateMeshFusedTimeStepping(exahype::repositories
   assertion(repository.getState().getAlgorithmSection()==exahype::records::State::AlgorithmSection::TimeStepping);
   repository.getState().switchToNeighbourDataDroppingContext();
   repository.switchToNeighbourDataMerging();
-  repository.iterate();
+  iterate(repository);
 
   // 1. Only the solvers with irregular limiter domain change do the limiter status spreading.
   if (exahype::solvers::LimitingADERDGSolver::oneSolverRequestedLimiterStatusSpreading()) {
     repository.getState().setAlgorithmSection(exahype::records::State::AlgorithmSection::LimiterStatusSpreading);
     logInfo("updateMeshFusedTimeStepping(...)","pre-spreading of limiter status");
     repository.switchToLimiterStatusSpreading();
-    repository.iterate(5);
+    int  spreadingIterations = 0;
+    int  stableIterations    = 0;
+    bool continueSpreading   = true;
+    while ( continueSpreading && spreadingIterations < MaxNumberOfLimiterStatusSpreadingIterations ) {
+      iterate(repository);
+      spreadingIterations++;
+
+      continueSpreading = statusSpreadingHasNotConverged(
+          stableIterations,
+          exahype::solvers::LimitingADERDGSolver::oneSolverHasNotFinishedLimiterStatusSpreading());
+    }
+    logInfo("updateMeshFusedTimeStepping(...)","finished pre-spreading of limiter status after " << spreadingIterations << " iterations");
   }
   if (exahype::solvers::LimitingADERDGSolver::oneSolverRequestedGlobalRecomputation()) {
     assertion(exahype::solvers::LimitingADERDGSolver::oneSolverRequestedMeshUpdate());
@@ -922,7 +1065,7 @@ void exahype::runners::Runner::updateMeshFusedTimeStepping(exahype::repositories
     logInfo("updateMeshFusedTimeStepping(...)","reinitialise cells and send data to neighbours");
     repository.getState().switchToReinitialisationContext();
     repository.switchToFinaliseMeshRefinementAndReinitialisation();
-    repository.iterate();
+    iterate(repository);
 
     // 4. Perform a local recomputation of the solution of the solvers that requested one.
     // Perform a time
@@ -934,7 +1077,7 @@ void exahype::runners::Runner::updateMeshFusedTimeStepping(exahype::repositories
     logInfo("updateMeshFusedTimeStepping(...)","recompute solution locally (if applicable) and compute new time step size");
     repository.getState().switchToLocalRecomputationAndTimeStepSizeComputationFusedTimeSteppingContext();
     repository.switchToLocalRecomputationAndTimeStepSizeComputation();
-    repository.iterate(); // local recomputation: has now recomputed predictor in interface cells
+    iterate(repository); // local recomputation: has now recomputed predictor in interface cells
   } // LocalRecomputation is done here
 
   if (exahype::solvers::Solver::oneSolverRequestedMeshUpdate() ||
@@ -946,7 +1089,7 @@ void exahype::runners::Runner::updateMeshFusedTimeStepping(exahype::repositories
     logInfo("updateMeshFusedTimeStepping(...)","recompute predictor globally and reinitialise fused time stepping");
     repository.getState().switchToPredictionAndFusedTimeSteppingInitialisationContext();
     repository.switchToPredictionAndFusedTimeSteppingInitialisation();
-    repository.iterate(); // At this stage all solvers that required a mesh update, have
+    iterate(repository); // At this stage all solvers that required a mesh update, have
                           // recomputed the predictor
   }  // MeshUpdate is done here
 
@@ -956,7 +1099,50 @@ void exahype::runners::Runner::updateMeshFusedTimeStepping(exahype::repositories
     logInfo("updateMeshFusedTimeStepping(...)","recompute solution and predictor globally");
     repository.getState().switchToADERDGTimeStepContext();
     repository.switchToADERDGTimeStep();
-    repository.iterate();
+    iterate(repository);
+  }
+}
+
+std::string exahype::runners::Runner::getActiveAdapterName(const exahype::repositories::Repository& repository) {
+  if (repository.isActiveAdapterMeshRefinement())                                      return "MeshRefinement";
+  if (repository.isActiveAdapterPredictionAndFusedTimeSteppingInitialisation())        return "PredictionAndFusedTimeSteppingInitialisation";
+  if (repository.isActiveAdapterPredictionAndFusedTimeSteppingInitialisationAndPlot()) return "PredictionAndFusedTimeSteppingInitialisationAndPlot";
+  if (repository.isActiveAdapterPredictionAndFusedTimeSteppingInitialisationAndPlot2d()) return "PredictionAndFusedTimeSteppingInitialisationAndPlot2d";
+  if (repository.isActiveAdapterGridErasing())                                         return "GridErasing";
+  if (repository.isActiveAdapterADERDGTimeStep())                                      return "ADERDGTimeStep";
+  if (repository.isActiveAdapterPlotAndADERDGTimeStep())                               return "PlotAndADERDGTimeStep";
+  if (repository.isActiveAdapterLimiterStatusSpreading())                              return "LimiterStatusSpreading";
+  if (repository.isActiveAdapterReinitialisation())                                    return "Reinitialisation";
+  if (repository.isActiveAdapterLocalRecomputationAndTimeStepSizeComputation())        return "LocalRecomputationAndTimeStepSizeComputation";
+  if (repository.isActiveAdapterNeighbourDataMerging())                                return "NeighbourDataMerging";
+  if (repository.isActiveAdapterSolutionUpdate())                                      return "SolutionUpdate";
+  if (repository.isActiveAdapterTimeStepSizeComputation())                             return "TimeStepSizeComputation";
+  if (repository.isActiveAdapterPrediction())                                          return "Prediction";
+  if (repository.isActiveAdapterPredictionAndPlot())                                   return "PredictionAndPlot";
+  if (repository.isActiveAdapterPredictionAndPlot2d())                                 return "PredictionAndPlot2d";
+  if (repository.isActiveAdapterFinaliseMeshRefinementAndTimeStepSizeComputation())    return "FinaliseMeshRefinementAndTimeStepSizeComputation";
+  if (repository.isActiveAdapterMergeTimeStepData())                                   return "MergeTimeStepData";
+  if (repository.isActiveAdapterMergeTimeStepDataDropFaceData())                       return "MergeTimeStepDataDropFaceData";
+  if (repository.isActiveAdapterFinaliseMeshRefinementAndReinitialisation())           return "FinaliseMeshRefinementAndReinitialisation";
+  if (repository.isActiveAdapterSolutionUpdateAndTimeStepSizeComputation())            return "SolutionUpdateAndTimeStepSizeComputation";
+  return "Unknown";
+}
+
+void exahype::runners::Runner::iterate(
+    exahype::repositories::Repository& repository,
+    int numberOfIterations,
+    bool exchangeBoundaryVertices) {
+  exahype::profilers::PerformanceReport& performanceReport =
+      exahype::profilers::PerformanceReport::getInstance();
+  if (performanceReport.isActive()) {
+    const auto start = exahype::profilers::PerformanceReport::Clock::now();
+    repository.iterate(numberOfIterations,exchangeBoundaryVertices);
+    const double seconds = std::chrono::duration<double>(
+        exahype::profilers::PerformanceReport::Clock::now()-start).count();
+    // workers learn the adapter from their master while iterating
+    performanceReport.recordTraversals(getActiveAdapterName(repository),numberOfIterations,seconds);
+  } else {
+    repository.iterate(numberOfIterations,exchangeBoundaryVertices);
   }
 }
 
@@ -1024,7 +1210,7 @@ void exahype::runners::Runner::printTimeStepInfo(int numberOfStepsRanSinceLastCa
   logInfo("startNewTimeStep(...)",
       "\tmemoryUsage    =" << peano::utils::UserInterface::getMemoryUsageMB() << " MB");
   #ifdef Asserts
-  if (exahype::solvers::ADERDGSolver::CompressionAccuracy>0.0) {
+  if (exahype::solvers::ADERDGSolver::usesCompressedStorage()) {
     DataHeap::getInstance().plotStatistics();
     peano::heap::PlainCharHeap::getInstance().plotStatistics();
 
@@ -1037,6 +1223,16 @@ void exahype::runners::Runner::printTimeStepInfo(int numberOfStepsRanSinceLastCa
   }
   #endif
 
+  #if defined(Asserts) || defined(TrackMixedPrecisionErrors)
+  if (exahype::solvers::ADERDGSolver::usesCompressedStorage()) {
+    logInfo("startNewTimeStep(...)",
+        "\treduced-precision-errors: extrapolated-predictor=" << exahype::solvers::ADERDGSolver::ExtrapolatedPredictorErrors.toString() <<
+        ",fluctuation="       << exahype::solvers::ADERDGSolver::FluctuationErrors.toString() <<
+        ",previous-solution=" << exahype::solvers::ADERDGSolver::PreviousSolutionErrors.toString() <<
+        ",update="            << exahype::solvers::ADERDGSolver::UpdateErrors.toString());
+  }
+  #endif
+
   #if defined(TrackGridStatistics)
   logInfo(
     "startNewTimeStep(...)",
@@ -1066,8 +1262,34 @@ void exahype::runners::Runner::printTimeStepInfo(int numberOfStepsRanSinceLastCa
 }
 
 
-void exahype::runners::Runner::runOneTimeStepWithFusedAlgorithmicSteps(
-    exahype::repositories::Repository& repository, int numberOfStepsToRun, bool exchangeBoundaryData) {
+int exahype::runners::Runner::adaptSpeculativeBatchSize(const int batchSize, const bool predictorWasRerun) {
+  return predictorWasRerun ?
+      std::max(1,batchSize/2) : std::min(2*batchSize,MaxSpeculativeBatchSize);
+}
+
+void exahype::runners::Runner::resetNumberOfStartedTimeSteps() {
+  for (auto* solver : exahype::solvers::RegisteredSolvers) {
+    if (solver->getType()==exahype::solvers::Solver::Type::ADERDG) {
+      static_cast<exahype::solvers::ADERDGSolver*>(solver)->resetNumberOfStartedTimeSteps();
+    }
+  }
+}
+
+int exahype::runners::Runner::getNumberOfStartedTimeStepsOfAllSolvers(const int numberOfStepsToRun) {
+  int numberOfStartedTimeSteps = std::numeric_limits<int>::max();
+  for (auto* solver : exahype::solvers::RegisteredSolvers) {
+    if (solver->getType()==exahype::solvers::Solver::Type::ADERDG) {
+      numberOfStartedTimeSteps = std::min(numberOfStartedTimeSteps,
+          static_cast<exahype::solvers::ADERDGSolver*>(solver)->getNumberOfStartedTimeSteps());
+    }
+  }
+  return numberOfStartedTimeSteps==std::numeric_limits<int>::max() ?
+      numberOfStepsToRun : numberOfStartedTimeSteps;
+}
+
+bool exahype::runners::Runner::runOneTimeStepWithFusedAlgorithmicSteps(
+    exahype::repositories::Repository& repository, int numberOfStepsToRun, bool exchangeBoundaryData,
+    int& numberOfStepsRan) {
   logInfo("runOneTimeStepWithFusedAlgorithmicSteps(...)","run "<<numberOfStepsToRun<< " iterations with fused algorithmic steps");
 
   /*
@@ -1087,12 +1309,21 @@ void exahype::runners::Runner::runOneTimeStepWithFusedAlgorithmicSteps(
   repository.getState().setAlgorithmSection(exahype::records::State::AlgorithmSection::TimeStepping);
   repository.getState().switchToADERDGTimeStepContext();
 
+  resetNumberOfStartedTimeSteps();
   if (numberOfStepsToRun==0) {
     repository.switchToPlotAndADERDGTimeStep();
-    repository.iterate();
+    iterate(repository);
   } else {
     repository.switchToADERDGTimeStep();
-    repository.iterate(numberOfStepsToRun,exchangeBoundaryData);
+    iterate(repository,numberOfStepsToRun,exchangeBoundaryData);
+  }
+  // The runner reads the time step data and flags below
+  exahype::mappings::TimeStepSizeComputation::finishNonBlockingTimeStepDataReduction();
+
+  numberOfStepsRan = std::max(1,numberOfStepsToRun);
+  if (exahype::solvers::ADERDGSolver::SpeculativeTimeStepBatching) {
+    // solvers which detected a violation sat out the rest of the batch
+    numberOfStepsRan = getNumberOfStartedTimeStepsOfAllSolvers(numberOfStepsRan);
   }
 
   if (exahype::solvers::LimitingADERDGSolver::oneSolverRequestedLocalRecomputation()) {
@@ -1111,15 +1342,18 @@ void exahype::runners::Runner::runOneTimeStepWithFusedAlgorithmicSteps(
     updateMeshFusedTimeStepping(repository);
   }
 
+  bool predictorWasRerun = false;
   if (exahype::solvers::Solver::stabilityConditionOfOneSolverWasViolated()) {
     logInfo("runOneTimeStepWithFusedAlgorithmicSteps(...)", "\t\t recompute space-time predictor");
     repository.getState().setAlgorithmSection(exahype::records::State::PredictionRerunAllSend);
     repository.getState().switchToPredictionRerunContext();
     repository.switchToPrediction();
-    repository.iterate();
+    iterate(repository);
+    predictorWasRerun = true;
   }
 
   // ---- reduction/broadcast barrier ----
+  return predictorWasRerun;
 }
 
 void exahype::runners::Runner::runOneTimeStepWithThreeSeparateAlgorithmicSteps(
@@ -1129,19 +1363,14 @@ void exahype::runners::Runner::runOneTimeStepWithThreeSeparateAlgorithmicSteps(
 
   repository.getState().switchToNeighbourDataMergingContext();
   repository.switchToNeighbourDataMerging();  // Riemann -> face2face
-  repository.iterate(); // todo uncomment
-
-//  logInfo("runOneTimeStepWithThreeSeparateAlgorithmicSteps(...)","update solution");
-
-  repository.getState().switchToSolutionUpdateContext();
-  repository.switchToSolutionUpdate();  // Face to cell + Inside cell
-  repository.iterate();
+  iterate(repository); // todo uncomment
 
-//  logInfo("runOneTimeStepWithThreeSeparateAlgorithmicSteps(...)","compute new time step size");
+//  logInfo("runOneTimeStepWithThreeSeparateAlgorithmicSteps(...)","update solution and compute new time step size");
 
+  // Both phases are cell-local. We thus fuse them into a single traversal.
   repository.getState().switchToTimeStepSizeComputationContext();
-  repository.switchToTimeStepSizeComputation();
-  repository.iterate();
+  repository.switchToSolutionUpdateAndTimeStepSizeComputation();  // Face to cell + Inside cell + time step size
+  iterate(repository);
 
   // TODO(Dominic): Will be merged with the mesh refinement
   // We mimic the flow of the fused time stepping scheme here
@@ -1186,7 +1415,7 @@ void exahype::runners::Runner::runOneTimeStepWithThreeSeparateAlgorithmicSteps(
   } else {
     repository.switchToPrediction();   // Cell onto faces
   }
-  repository.iterate();
+  iterate(repository);
 }
 
 void exahype::runners::Runner::validateSolverTimeStepDataForThreeAlgorithmicPhases(const bool fuseADERDGPhases) const {
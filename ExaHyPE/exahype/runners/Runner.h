@@ -26,6 +26,11 @@ class Runner;
 namespace repositories {
 class Repository;
 }
+namespace tests {
+namespace runners {
+class RunnerTest;
+}
+}
 }
 
 /**
@@ -34,10 +39,50 @@ class Repository;
  */
 class exahype::runners::Runner {
  private:
+  friend class exahype::tests::runners::RunnerTest;
+
   static tarch::logging::Log _log;
 
   exahype::Parser& _parser;
 
+  /**
+   * Number of consecutive iterations without any status change
+   * we require before we consider the status spreading
+   * during the mesh update to be finished.
+   *
+   * The workers report their flags to the master only in the
+   * next iteration. In the MPI case, we thus have to wait
+   * for a few more iterations until all changes have arrived at
+   * the global master. Without MPI, the first iteration
+   * without any change is a fixed point.
+   */
+  #ifdef Parallel
+  static constexpr int NumberOfStableIterationsToFinishStatusSpreading = 3;
+  #else
+  static constexpr int NumberOfStableIterationsToFinishStatusSpreading = 1;
+  #endif
+
+  /**
+   * Upper bound on the number of limiter status spreading
+   * iterations run before a mesh update.
+   */
+  static constexpr int MaxNumberOfLimiterStatusSpreadingIterations = 5;
+
+  /**
+   * Counts the consecutive iterations in which no status has changed.
+   *
+   * @param stableIterations   number of consecutive iterations without
+   *                           change so far; is reset or incremented.
+   * @param statusHasChanged   if any status has changed (or the grid is
+   *                           still under construction) in the iteration
+   *                           that just finished.
+   *
+   * @return true if the status spreading has not attained a fixed point
+   * yet, i.e. less than NumberOfStableIterationsToFinishStatusSpreading
+   * iterations in a row did not change anything.
+   */
+  static bool statusSpreadingHasNotConverged(int& stableIterations, const bool statusHasChanged);
+
   /**
    * The computational domain offset as used by the
    * repository.
@@ -66,6 +111,49 @@ class exahype::runners::Runner {
    */
   tarch::la::Vector<DIMENSIONS,double> _boundingBoxSize;
 
+  /**
+   * Number of fused time steps the runner batches speculatively
+   * if global (non-fixed) time stepping is used; see
+   * exahype::solvers::ADERDGSolver::SpeculativeTimeStepBatching.
+   *
+   * The size is doubled after every batch which completed
+   * without a violation of the stability condition and
+   * halved after every batch which required a predictor rerun.
+   */
+  int _speculativeBatchSize;
+
+  /**
+   * Upper bound on ::_speculativeBatchSize.
+   *
+   * The repository runs all traversals of a batch before it
+   * returns to the runner. A solver that detects a violation of
+   * the stability condition thus idles for the rest of the batch.
+   * The bound keeps the number of idle traversals small.
+   */
+  static constexpr int MaxSpeculativeBatchSize = 8;
+
+  /**
+   * \return the size of the next speculative batch:
+   * half of \p batchSize (but at least one) if the predictor
+   * had to be rerun, twice \p batchSize (but at most
+   * MaxSpeculativeBatchSize) otherwise.
+   */
+  static int adaptSpeculativeBatchSize(const int batchSize, const bool predictorWasRerun);
+
+  /**
+   * Resets the time step counters of all ADER-DG solvers; see
+   * exahype::solvers::ADERDGSolver::getNumberOfStartedTimeSteps().
+   */
+  static void resetNumberOfStartedTimeSteps();
+
+  /**
+   * \return the minimum number of time steps the ADER-DG solvers started
+   * since the last call of resetNumberOfStartedTimeSteps(), i.e. the number of
+   * time steps the simulation actually advanced in a speculative batch.
+   * Returns \p numberOfStepsToRun if there is no ADER-DG solver.
+   */
+  static int getNumberOfStartedTimeStepsOfAllSolvers(const int numberOfStepsToRun);
+
   /**
    * Setup the oracles for the shared memory parallelisation. Different
    * oracles can be employed:
@@ -134,6 +222,8 @@ class exahype::runners::Runner {
    * - Switch off Peano's performance analysis. Otherwise you'll get tons of
    *   data for the grid construction through codes typically are interested in
    *   performance data only.
+   * - Activate the performance report if the specification file names a
+   *   performance-report-file (see exahype::profilers::PerformanceReport).
    */
   void initHPCEnvironment();
 
@@ -152,14 +242,40 @@ class exahype::runners::Runner {
    */
   void printTimeStepInfo(int numberOfStepsRanSinceLastCall, const exahype::repositories::Repository& repository);
 
+  /**
+   * \return The name of the active adapter of \p repository.
+   */
+  static std::string getActiveAdapterName(const exahype::repositories::Repository& repository);
+
+  /**
+   * Runs \p numberOfIterations traversals of the active adapter
+   * and records their wall time in the performance report
+   * (see exahype::profilers::PerformanceReport).
+   *
+   * Use this operation instead of calling Repository::iterate(...) directly.
+   */
+  void iterate(
+      exahype::repositories::Repository& repository,
+      int numberOfIterations=1,
+      bool exchangeBoundaryVertices=true);
+
 
   /**
    * Do one time step where all phases are actually fused into one traversal
    *
    * @param numberOfStepsToRun Number of steps to run. If you hand in 0, then
    *           it runs one time step plus does a plot.
+   *
+   * @param numberOfStepsRan Is set to the number of time steps the
+   *           simulation actually advanced. A speculative batch stops
+   *           advancing after a violation of the stability condition.
+   *
+   * @return true if the space-time predictor had to be recomputed as the
+   *         stability condition of one solver was violated.
    */
-  void runOneTimeStepWithFusedAlgorithmicSteps(exahype::repositories::Repository& repository, int numberOfStepsToRun, bool exchangeBoundaryData);
+  bool runOneTimeStepWithFusedAlgorithmicSteps(
+      exahype::repositories::Repository& repository, int numberOfStepsToRun, bool exchangeBoundaryData,
+      int& numberOfStepsRan);
 
   /**
    * Run the three adapters necessary for updating the
@@ -280,6 +396,16 @@ class exahype::runners::Runner {
    *
    * TODO(Dominic): We might not need a few of the other checks anymore after I
    * have introduced the grid refinement requested flag.
+   *
+   * <h2>Status spreading</h2>
+   * The augmentation, helper, and limiter status travel one cell layer per
+   * iteration as the neighbours merge them at the vertices. We do not run a
+   * fixed number of extra iterations for the status spreading anymore. The
+   * MeshRefinement mapping instead reports if any cell has changed its
+   * status, and we stop as soon as
+   * NumberOfStableIterationsToFinishStatusSpreading iterations have not
+   * changed anything. We log the number of iterations which were required
+   * for the grid construction and for the status spreading separately.
    */
   bool createMesh(exahype::repositories::Repository& repository);
 
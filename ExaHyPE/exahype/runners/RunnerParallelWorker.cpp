@@ -15,6 +15,7 @@
 
 #ifdef Parallel
 #include "exahype/repositories/Repository.h"
+#include "exahype/mappings/SolutionUpdate.h"
 #include "peano/parallel/messages/ForkMessage.h"
 #include "peano/utils/Globals.h"
 #include "peano/utils/UserInterface.h"
@@ -49,7 +50,7 @@ int exahype::runners::Runner::runAsWorker(
         switch (repository.continueToIterate()) {
           case exahype::repositories::Repository::Continue:
             {
-              repository.iterate();
+              iterate(repository);
               logInfo("runAsWorker(...)",
                 "\tmemoryUsage    =" << peano::utils::UserInterface::getMemoryUsageMB() << " MB");
 
@@ -73,7 +74,7 @@ int exahype::runners::Runner::runAsWorker(
 
       // insert your postprocessing here
       // -------------------------------
-
+      exahype::mappings::SolutionUpdate::finishInSituReductions();
       // -------------------------------
 
       repository.terminate();
@@ -19,22 +19,31 @@
 #include <iomanip>
 
 #include <algorithm>
+#include <type_traits>
 
 #include "exahype/Cell.h"
+#include "exahype/State.h"
 #include "exahype/Vertex.h"
 #include "exahype/VertexOperations.h"
 
 #include "tarch/la/VectorVectorOperations.h"
+#include "tarch/la/VectorOperations.h"
 #include "tarch/multicore/Lock.h"
 
 #include "multiscalelinkedcell/HangingVertexBookkeeper.h"
 
 #include "exahype/amr/AdaptiveMeshRefinement.h"
 
+#include "kernels/GaussLegendreQuadrature.h"
+
 #include "peano/heap/CompressedFloatingPointNumbers.h"
 #include "peano/datatraversal/TaskSet.h"
+#include "peano/utils/Loop.h"
 
 #include "exahype/solvers/LimitingADERDGSolver.h"
+#include "exahype/solvers/OutOfCoreStorage.h"
+
+#include "exahype/profilers/PerformanceReport.h"
 
 
 namespace {
@@ -95,6 +104,32 @@ double exahype::solvers::ADERDGSolver::CompressionAccuracy = 0.0;
 
 bool exahype::solvers::ADERDGSolver::SpawnCompressionAsBackgroundThread = false;
 
+bool exahype::solvers::ADERDGSolver::SpeculativeTimeStepBatching = false;
+
+constexpr double exahype::solvers::ADERDGSolver::MinimumTimeStepSizeWeightScaling;
+constexpr double exahype::solvers::ADERDGSolver::TimeStepSizeWeightScalingDecrease;
+constexpr double exahype::solvers::ADERDGSolver::TimeStepSizeWeightScalingRelaxation;
+
+exahype::solvers::StoragePrecision exahype::solvers::ADERDGSolver::ExtrapolatedPredictorPrecision = exahype::solvers::StoragePrecision::Double;
+exahype::solvers::StoragePrecision exahype::solvers::ADERDGSolver::FluctuationPrecision           = exahype::solvers::StoragePrecision::Double;
+exahype::solvers::StoragePrecision exahype::solvers::ADERDGSolver::PreviousSolutionPrecision      = exahype::solvers::StoragePrecision::Double;
+exahype::solvers::StoragePrecision exahype::solvers::ADERDGSolver::UpdatePrecision                = exahype::solvers::StoragePrecision::Double;
+
+#if defined(Asserts) || defined(TrackMixedPrecisionErrors)
+exahype::solvers::MixedPrecisionErrors exahype::solvers::ADERDGSolver::ExtrapolatedPredictorErrors;
+exahype::solvers::MixedPrecisionErrors exahype::solvers::ADERDGSolver::FluctuationErrors;
+exahype::solvers::MixedPrecisionErrors exahype::solvers::ADERDGSolver::PreviousSolutionErrors;
+exahype::solvers::MixedPrecisionErrors exahype::solvers::ADERDGSolver::UpdateErrors;
+#endif
+
+bool exahype::solvers::ADERDGSolver::usesCompressedStorage() {
+  return CompressionAccuracy>0.0
+      || ExtrapolatedPredictorPrecision!=StoragePrecision::Double
+      || FluctuationPrecision!=StoragePrecision::Double
+      || PreviousSolutionPrecision!=StoragePrecision::Double
+      || UpdatePrecision!=StoragePrecision::Double;
+}
+
 void exahype::solvers::ADERDGSolver::addNewCellDescription(
   const int cellDescriptionsIndex,
   const int                                      solverNumber,
@@ -148,6 +183,7 @@ void exahype::solvers::ADERDGSolver::addNewCellDescription(
   #endif
 
   // Default field data indices
+  newCellDescription.setPreviousSolution(-1);
   newCellDescription.setSolution(-1);
   newCellDescription.setUpdate(-1);
   newCellDescription.setExtrapolatedPredictor(-1);
@@ -162,11 +198,13 @@ void exahype::solvers::ADERDGSolver::addNewCellDescription(
 
   // Compression
   newCellDescription.setCompressionState(exahype::records::ADERDGCellDescription::CompressionState::Uncompressed);
+  newCellDescription.setPreviousSolutionAverages(-1);
   newCellDescription.setSolutionAverages(-1);
   newCellDescription.setUpdateAverages(-1);
   newCellDescription.setExtrapolatedPredictorAverages(-1);
   newCellDescription.setFluctuationAverages(-1);
 
+  newCellDescription.setPreviousSolutionCompressed(-1);
   newCellDescription.setSolutionCompressed(-1);
   newCellDescription.setUpdateCompressed(-1);
   newCellDescription.setExtrapolatedPredictorCompressed(-1);
@@ -221,34 +259,54 @@ void exahype::solvers::ADERDGSolver::ensureNoUnnecessaryMemoryIsAllocated(exahyp
     waitUntilAllBackgroundTasksHaveTerminated();
 
     assertion(DataHeap::getInstance().isValidIndex(cellDescription.getSolution()));
-    assertion(DataHeap::getInstance().isValidIndex(cellDescription.getPreviousSolution()));
+    assertion(!_holdsPreviousSolution || DataHeap::getInstance().isValidIndex(cellDescription.getPreviousSolution()));
     assertion(DataHeap::getInstance().isValidIndex(cellDescription.getUpdate()));
 
-    tarch::multicore::Lock lock(_heapSemaphore);
-
     if (cellDescription.getUpdate()>=0) {
-      DataHeap::getInstance().deleteData(cellDescription.getUpdate());
+      _heapEntryPool.release(cellDescription.getUpdate());
       assertion(cellDescription.getUpdateCompressed()==-1);
     }
     else {
-      assertion(CompressionAccuracy>0.0);
+      assertion(usesCompressedStorage());
       assertion(cellDescription.getUpdate()==-1);
+      tarch::multicore::Lock lock(_heapSemaphore);
+      OutOfCoreStorage::getInstance().discard(cellDescription.getUpdateCompressed());
       CompressedDataHeap::getInstance().deleteData(cellDescription.getUpdateCompressed());
     }
 
     if (cellDescription.getSolution()>=0) {
-      DataHeap::getInstance().deleteData(cellDescription.getSolution());
+      _heapEntryPool.release(cellDescription.getSolution());
       assertion(cellDescription.getSolutionCompressed()==-1);
     }
     else {
-      assertion(CompressionAccuracy>0.0);
+      assertion(usesCompressedStorage());
       assertion(cellDescription.getSolution()==-1);
+      tarch::multicore::Lock lock(_heapSemaphore);
+      OutOfCoreStorage::getInstance().discard(cellDescription.getSolutionCompressed());
       CompressedDataHeap::getInstance().deleteData(cellDescription.getSolutionCompressed());
     }
 
-    DataHeap::getInstance().deleteData(cellDescription.getUpdateAverages());
-    DataHeap::getInstance().deleteData(cellDescription.getSolutionAverages());
-    DataHeap::getInstance().deleteData(cellDescription.getPreviousSolutionAverages());
+    if (!_holdsPreviousSolution) {
+      assertion(cellDescription.getPreviousSolution()==-1);
+      assertion(cellDescription.getPreviousSolutionCompressed()==-1);
+    }
+    else if (cellDescription.getPreviousSolution()>=0) {
+      _heapEntryPool.release(cellDescription.getPreviousSolution());
+      assertion(cellDescription.getPreviousSolutionCompressed()==-1);
+    }
+    else {
+      assertion(usesCompressedStorage());
+      assertion(cellDescription.getPreviousSolution()==-1);
+      tarch::multicore::Lock lock(_heapSemaphore);
+      OutOfCoreStorage::getInstance().discard(cellDescription.getPreviousSolutionCompressed());
+      CompressedDataHeap::getInstance().deleteData(cellDescription.getPreviousSolutionCompressed());
+    }
+
+    _heapEntryPool.release(cellDescription.getUpdateAverages());
+    _heapEntryPool.release(cellDescription.getSolutionAverages());
+    if (_holdsPreviousSolution) {
+      _heapEntryPool.release(cellDescription.getPreviousSolutionAverages());
+    }
 
     cellDescription.setPreviousSolution(-1);
     cellDescription.setSolution(-1);
@@ -279,36 +337,39 @@ void exahype::solvers::ADERDGSolver::ensureNoUnnecessaryMemoryIsAllocated(exahyp
     assertion(DataHeap::getInstance().isValidIndex(cellDescription.getFluctuation()));
 
     waitUntilAllBackgroundTasksHaveTerminated();
-    tarch::multicore::Lock lock(_heapSemaphore);
 
     if (cellDescription.getExtrapolatedPredictor()>=0) {
-      DataHeap::getInstance().deleteData(cellDescription.getExtrapolatedPredictor());
+      _heapEntryPool.release(cellDescription.getExtrapolatedPredictor());
       assertion(cellDescription.getExtrapolatedPredictorCompressed()==-1);
     }
     else {
-      assertion(CompressionAccuracy>0.0);
+      assertion(usesCompressedStorage());
       assertion(cellDescription.getExtrapolatedPredictor()==-1);
+      tarch::multicore::Lock lock(_heapSemaphore);
+      OutOfCoreStorage::getInstance().discard(cellDescription.getExtrapolatedPredictorCompressed());
       CompressedDataHeap::getInstance().deleteData(cellDescription.getExtrapolatedPredictorCompressed());
     }
 
     if (cellDescription.getFluctuation()>=0) {
-      DataHeap::getInstance().deleteData(cellDescription.getFluctuation());
+      _heapEntryPool.release(cellDescription.getFluctuation());
       assertion(cellDescription.getFluctuationCompressed()==-1);
     }
     else {
-      assertion(CompressionAccuracy>0.0);
+      assertion(usesCompressedStorage());
       assertion(cellDescription.getFluctuation()==-1);
+      tarch::multicore::Lock lock(_heapSemaphore);
+      OutOfCoreStorage::getInstance().discard(cellDescription.getFluctuationCompressed());
       CompressedDataHeap::getInstance().deleteData(cellDescription.getFluctuationCompressed());
     }
 
-    DataHeap::getInstance().deleteData(cellDescription.getExtrapolatedPredictorAverages());
-    DataHeap::getInstance().deleteData(cellDescription.getFluctuationAverages());
+    _heapEntryPool.release(cellDescription.getExtrapolatedPredictorAverages());
+    _heapEntryPool.release(cellDescription.getFluctuationAverages());
 
     if (getDMPObservables()>0) {
       assertion(DataHeap::getInstance().isValidIndex(cellDescription.getSolutionMin()));
       assertion(DataHeap::getInstance().isValidIndex(cellDescription.getSolutionMax()));
-      DataHeap::getInstance().deleteData(cellDescription.getSolutionMin());
-      DataHeap::getInstance().deleteData(cellDescription.getSolutionMax());
+      _heapEntryPool.release(cellDescription.getSolutionMin());
+      _heapEntryPool.release(cellDescription.getSolutionMax());
 
       cellDescription.setSolutionMin(-1);
       cellDescription.setSolutionMax(-1);
@@ -330,16 +391,20 @@ void exahype::solvers::ADERDGSolver::ensureNecessaryMemoryIsAllocated(exahype::r
   ) {
     waitUntilAllBackgroundTasksHaveTerminated();
 
-    tarch::multicore::Lock lock(_heapSemaphore);
     assertion(!DataHeap::getInstance().isValidIndex(cellDescription.getUpdate()));
     // Allocate volume DoF for limiter
     const int dofPerCell        = getUnknownsPerCell();
     const int dataPointsPerCell = getDataPerCell(); // Only the solution and previousSolution store material parameters
-    cellDescription.setPreviousSolution(DataHeap::getInstance().createData(dataPointsPerCell, dataPointsPerCell, DataHeap::Allocation::UseRecycledEntriesIfPossibleCreateNewEntriesIfRequired));
-    cellDescription.setSolution(DataHeap::getInstance().createData(dataPointsPerCell, dataPointsPerCell, DataHeap::Allocation::UseRecycledEntriesIfPossibleCreateNewEntriesIfRequired));
-    cellDescription.setUpdate(DataHeap::getInstance().createData(dofPerCell, dofPerCell, DataHeap::Allocation::UseRecycledEntriesIfPossibleCreateNewEntriesIfRequired));
+    if (_holdsPreviousSolution) {
+      cellDescription.setPreviousSolution(_heapEntryPool.acquire(dataPointsPerCell));
+      assertionEquals(DataHeap::getInstance().getData(cellDescription.getPreviousSolution()).size(),static_cast<unsigned int>(dataPointsPerCell));
+    }
+    else {
+      cellDescription.setPreviousSolution(-1);
+    }
+    cellDescription.setSolution(_heapEntryPool.acquire(dataPointsPerCell));
+    cellDescription.setUpdate(_heapEntryPool.acquire(dofPerCell));
 
-    assertionEquals(DataHeap::getInstance().getData(cellDescription.getPreviousSolution()).size(),static_cast<unsigned int>(dataPointsPerCell));
     assertionEquals(DataHeap::getInstance().getData(cellDescription.getUpdate()).capacity(),static_cast<unsigned int>(dofPerCell));
     assertionEquals(DataHeap::getInstance().getData(cellDescription.getUpdate()).size(),static_cast<unsigned int>(dofPerCell));
     assertionEquals(DataHeap::getInstance().getData(cellDescription.getSolution()).capacity(),static_cast<unsigned int>(dataPointsPerCell));
@@ -348,19 +413,22 @@ void exahype::solvers::ADERDGSolver::ensureNecessaryMemoryIsAllocated(exahype::r
     cellDescription.setSolutionCompressed(-1);
     cellDescription.setPreviousSolutionCompressed(-1);
 
-    if (CompressionAccuracy>0.0) {
+    if (usesCompressedStorage()) {
+      tarch::multicore::Lock lock(_heapSemaphore);
       CompressedDataHeap::getInstance().reserveHeapEntriesForRecycling(2);
     }
 
-    cellDescription.setPreviousSolutionAverages( DataHeap::getInstance().createData( getNumberOfVariables()+getNumberOfParameters(), getNumberOfVariables()+getNumberOfParameters(), DataHeap::Allocation::UseRecycledEntriesIfPossibleCreateNewEntriesIfRequired ) );
-    cellDescription.setUpdateAverages(           DataHeap::getInstance().createData( getNumberOfVariables(), getNumberOfVariables(), DataHeap::Allocation::UseRecycledEntriesIfPossibleCreateNewEntriesIfRequired ) );
-    cellDescription.setSolutionAverages(         DataHeap::getInstance().createData( getNumberOfVariables()+getNumberOfParameters(), getNumberOfVariables()+getNumberOfParameters(), DataHeap::Allocation::UseRecycledEntriesIfPossibleCreateNewEntriesIfRequired ) );
+    cellDescription.setPreviousSolutionAverages( _holdsPreviousSolution ? _heapEntryPool.acquire( getNumberOfVariables()+getNumberOfParameters() ) : -1 );
+    cellDescription.setUpdateAverages(           _heapEntryPool.acquire( getNumberOfVariables() ) );
+    cellDescription.setSolutionAverages(         _heapEntryPool.acquire( getNumberOfVariables()+getNumberOfParameters() ) );
 
-    assertionEquals3(
-        DataHeap::getInstance().getData(cellDescription.getPreviousSolutionAverages()).size(),static_cast<unsigned int>(getNumberOfVariables() + getNumberOfParameters()),
-        DataHeap::getInstance().getData(cellDescription.getPreviousSolutionAverages()).size(),static_cast<unsigned int>(getNumberOfVariables() + getNumberOfParameters()),
-        getNumberOfVariables()
-    );
+    if (_holdsPreviousSolution) {
+      assertionEquals3(
+          DataHeap::getInstance().getData(cellDescription.getPreviousSolutionAverages()).size(),static_cast<unsigned int>(getNumberOfVariables() + getNumberOfParameters()),
+          DataHeap::getInstance().getData(cellDescription.getPreviousSolutionAverages()).size(),static_cast<unsigned int>(getNumberOfVariables() + getNumberOfParameters()),
+          getNumberOfVariables()
+      );
+    }
     assertionEquals3(
         DataHeap::getInstance().getData(cellDescription.getUpdateAverages()).size(),static_cast<unsigned int>(getNumberOfVariables()),
         DataHeap::getInstance().getData(cellDescription.getUpdateAverages()).size(),static_cast<unsigned int>(getNumberOfVariables()),
@@ -388,13 +456,12 @@ void exahype::solvers::ADERDGSolver::ensureNecessaryMemoryIsAllocated(exahype::r
 
     waitUntilAllBackgroundTasksHaveTerminated();
 
-    tarch::multicore::Lock lock(_heapSemaphore);
     // Allocate face DoF
     const int dataPerBnd = getBndTotalSize();
     const int dofPerBnd  = getBndFluxTotalSize();
 
-    cellDescription.setExtrapolatedPredictor(DataHeap::getInstance().createData(dataPerBnd, dataPerBnd, DataHeap::Allocation::UseRecycledEntriesIfPossibleCreateNewEntriesIfRequired));
-    cellDescription.setFluctuation(          DataHeap::getInstance().createData(dofPerBnd, dofPerBnd, DataHeap::Allocation::UseRecycledEntriesIfPossibleCreateNewEntriesIfRequired));
+    cellDescription.setExtrapolatedPredictor(_heapEntryPool.acquire(dataPerBnd));
+    cellDescription.setFluctuation(          _heapEntryPool.acquire(dofPerBnd));
 
     assertionEquals3(
         DataHeap::getInstance().getData(cellDescription.getExtrapolatedPredictor()).size(),static_cast<unsigned int>(dataPerBnd),
@@ -412,23 +479,22 @@ void exahype::solvers::ADERDGSolver::ensureNecessaryMemoryIsAllocated(exahype::r
     cellDescription.setExtrapolatedPredictorCompressed(-1);
     cellDescription.setFluctuationCompressed(-1);
 
-    if (CompressionAccuracy>0.0) {
+    if (usesCompressedStorage()) {
+      tarch::multicore::Lock lock(_heapSemaphore);
       CompressedDataHeap::getInstance().reserveHeapEntriesForRecycling(2);
     }
 
     //TODO JMG / Dominic adapt for padding with optimized kernels
     int faceAverageCardinality = getNumberOfVariables() * DIMENSIONS_TIMES_TWO;
-    cellDescription.setExtrapolatedPredictorAverages( DataHeap::getInstance().createData( faceAverageCardinality, faceAverageCardinality, DataHeap::Allocation::UseRecycledEntriesIfPossibleCreateNewEntriesIfRequired ) );
-    cellDescription.setFluctuationAverages(           DataHeap::getInstance().createData( faceAverageCardinality, faceAverageCardinality, DataHeap::Allocation::UseRecycledEntriesIfPossibleCreateNewEntriesIfRequired ) );
+    cellDescription.setExtrapolatedPredictorAverages( _heapEntryPool.acquire( faceAverageCardinality ) );
+    cellDescription.setFluctuationAverages(           _heapEntryPool.acquire( faceAverageCardinality ) );
 
     // Allocate volume DoF for limiter (we need for every of the 2*DIMENSIONS faces an array of min values
     // and array of max values of the neighbour at this face).
     const int numberOfObservables = getDMPObservables();
     if (numberOfObservables>0) {
-      cellDescription.setSolutionMin(DataHeap::getInstance().createData(
-          numberOfObservables * DIMENSIONS_TIMES_TWO, numberOfObservables * DIMENSIONS_TIMES_TWO, DataHeap::Allocation::UseRecycledEntriesIfPossibleCreateNewEntriesIfRequired));
-      cellDescription.setSolutionMax(DataHeap::getInstance().createData(
-          numberOfObservables * DIMENSIONS_TIMES_TWO, numberOfObservables * DIMENSIONS_TIMES_TWO, DataHeap::Allocation::UseRecycledEntriesIfPossibleCreateNewEntriesIfRequired));
+      cellDescription.setSolutionMin(_heapEntryPool.acquire(numberOfObservables * DIMENSIONS_TIMES_TWO));
+      cellDescription.setSolutionMax(_heapEntryPool.acquire(numberOfObservables * DIMENSIONS_TIMES_TWO));
 
       for (int i=0; i<numberOfObservables * DIMENSIONS_TIMES_TWO; i++) {
         DataHeap::getInstance().getData( cellDescription.getSolutionMin() )[i] = std::numeric_limits<double>::max();
@@ -457,6 +523,9 @@ exahype::solvers::ADERDGSolver::ADERDGSolver(
      _minPredictorTimeStepSize( std::numeric_limits<double>::max() ),
      _minNextPredictorTimeStepSize( std::numeric_limits<double>::max() ),
      _stabilityConditionWasViolated( false ),
+     _numberOfStartedTimeSteps( 0 ),
+     _holdsPreviousSolution( false ),
+     _timeStepSizeWeightScaling( 1.0 ),
      _dofPerFace( numberOfVariables * power(DOFPerCoordinateAxis, DIMENSIONS - 1) ),
      _dofPerCellBoundary( DIMENSIONS_TIMES_TWO * _dofPerFace ),
      _dofPerCell( numberOfVariables * power(DOFPerCoordinateAxis, DIMENSIONS + 0) ),
@@ -464,7 +533,8 @@ exahype::solvers::ADERDGSolver::ADERDGSolver(
      _spaceTimeDofPerCell( numberOfVariables * power(DOFPerCoordinateAxis, DIMENSIONS + 1) ),
      _spaceTimeFluxDofPerCell( _spaceTimeDofPerCell * (DIMENSIONS + 1) ),  // +1 for sources
      _dataPointsPerCell( (numberOfVariables+numberOfParameters) * power(DOFPerCoordinateAxis, DIMENSIONS + 0) ),
-     _DMPObservables(DMPObservables)
+     _DMPObservables(DMPObservables),
+     _heapEntryPool(identifier,_heapSemaphore)
 {
   // register tags with profiler
   for (const char* tag : tags) {
@@ -586,6 +656,8 @@ void exahype::solvers::ADERDGSolver::startNewTimeStep() {
   _maxCellSize     = _nextMaxCellSize;
   _nextMinCellSize = std::numeric_limits<double>::max();
   _nextMaxCellSize = -std::numeric_limits<double>::max(); // "-", min
+
+  _numberOfStartedTimeSteps++;
 }
 
 void exahype::solvers::ADERDGSolver::zeroTimeStepSizes() {
@@ -768,7 +840,8 @@ bool exahype::solvers::ADERDGSolver::isSending(
 
   switch (section) {
     case exahype::records::State::AlgorithmSection::TimeStepping:
-      isSending = true;
+      // See isComputing(..).
+      isSending = !SpeculativeTimeStepBatching || !getStabilityConditionWasViolated();
       break;
     case exahype::records::State::AlgorithmSection::LimiterStatusSpreading:
       isSending = false;
@@ -804,7 +877,9 @@ bool exahype::solvers::ADERDGSolver::isComputing(
 
   switch (section) {
     case exahype::records::State::AlgorithmSection::TimeStepping:
-      isComputing = true;
+      // The predictor computed in the previous traversal of a speculative
+      // batch must not be consumed; see SpeculativeTimeStepBatching.
+      isComputing = !SpeculativeTimeStepBatching || !getStabilityConditionWasViolated();
       break;
     case exahype::records::State::AlgorithmSection::LimiterStatusSpreading:
       isComputing = false;
@@ -849,6 +924,37 @@ bool exahype::solvers::ADERDGSolver::getStabilityConditionWasViolated() const {
   return _stabilityConditionWasViolated;
 }
 
+int exahype::solvers::ADERDGSolver::getNumberOfStartedTimeSteps() const {
+  return _numberOfStartedTimeSteps;
+}
+
+void exahype::solvers::ADERDGSolver::resetNumberOfStartedTimeSteps() {
+  _numberOfStartedTimeSteps = 0;
+}
+
+void exahype::solvers::ADERDGSolver::setHoldsPreviousSolution(const bool holdsPreviousSolution) {
+  _holdsPreviousSolution = holdsPreviousSolution;
+}
+
+bool exahype::solvers::ADERDGSolver::holdsPreviousSolution() const {
+  return _holdsPreviousSolution;
+}
+
+void exahype::solvers::ADERDGSolver::updateTimeStepSizeWeight(bool stabilityConditionWasViolated) {
+  if (stabilityConditionWasViolated) {
+    _timeStepSizeWeightScaling = std::max(
+        MinimumTimeStepSizeWeightScaling,
+        TimeStepSizeWeightScalingDecrease * _timeStepSizeWeightScaling);
+    logDebug("updateTimeStepSizeWeight(...)","decreased time step size weight to " << getTimeStepSizeWeight());
+  } else {
+    _timeStepSizeWeightScaling += TimeStepSizeWeightScalingRelaxation * (1.0 - _timeStepSizeWeightScaling);
+  }
+}
+
+double exahype::solvers::ADERDGSolver::getTimeStepSizeWeight() const {
+  return exahype::State::getTimeStepSizeWeightForPredictionRerun() * _timeStepSizeWeightScaling;
+}
+
 bool exahype::solvers::ADERDGSolver::isValidCellDescriptionIndex(
       const int cellDescriptionsIndex) const {
     return Heap::getInstance().isValidIndex(cellDescriptionsIndex);
@@ -1418,15 +1524,17 @@ void exahype::solvers::ADERDGSolver::prolongateVolumeData(
       subcellIndex);
 
   // previous solution
-  assertion(DataHeap::getInstance().isValidIndex(fineGridCellDescription.getPreviousSolution()));
-  double* previousSolutionFine   = DataHeap::getInstance().getData(
-      fineGridCellDescription.getPreviousSolution()).data();
-  double* previousSolutionCoarse = DataHeap::getInstance().getData(
-      coarseGridCellDescription.getPreviousSolution()).data();
-  volumeUnknownsProlongation(
-      previousSolutionFine,previousSolutionCoarse,
-      levelCoarse,levelFine,
-      subcellIndex);
+  if (_holdsPreviousSolution) {
+    assertion(DataHeap::getInstance().isValidIndex(fineGridCellDescription.getPreviousSolution()));
+    double* previousSolutionFine   = DataHeap::getInstance().getData(
+        fineGridCellDescription.getPreviousSolution()).data();
+    double* previousSolutionCoarse = DataHeap::getInstance().getData(
+        coarseGridCellDescription.getPreviousSolution()).data();
+    volumeUnknownsProlongation(
+        previousSolutionFine,previousSolutionCoarse,
+        levelCoarse,levelFine,
+        subcellIndex);
+  }
 
   fineGridCellDescription.setCorrectorTimeStamp(coarseGridCellDescription.getCorrectorTimeStamp());
   fineGridCellDescription.setPredictorTimeStamp(coarseGridCellDescription.getPredictorTimeStamp());
@@ -1527,9 +1635,11 @@ void exahype::solvers::ADERDGSolver::prepareVolumeDataRestriction(
   double* solution =
       DataHeap::getInstance().getData(cellDescription.getSolution()).data();
   std::fill_n(solution,_dataPointsPerCell,0.0);
-  double* previousSolution =
-      DataHeap::getInstance().getData(cellDescription.getPreviousSolution()).data();
-  std::fill_n(previousSolution,_dataPointsPerCell,0.0);
+  if (_holdsPreviousSolution) {
+    double* previousSolution =
+        DataHeap::getInstance().getData(cellDescription.getPreviousSolution()).data();
+    std::fill_n(previousSolution,_dataPointsPerCell,0.0);
+  }
 }
 
 void exahype::solvers::ADERDGSolver::startOrFinishCollectiveRefinementOperations(
@@ -1671,9 +1781,9 @@ void exahype::solvers::ADERDGSolver::restrictVolumeData(
       fineGridCellDescription.getSolution()),fineGridCellDescription.toString());
   assertion1(DataHeap::getInstance().isValidIndex(
       coarseGridCellDescription.getSolution()),coarseGridCellDescription.toString());
-  assertion1(DataHeap::getInstance().isValidIndex(
+  assertion1(!_holdsPreviousSolution || DataHeap::getInstance().isValidIndex(
       fineGridCellDescription.getPreviousSolution()),fineGridCellDescription.toString());
-  assertion1(DataHeap::getInstance().isValidIndex(
+  assertion1(!_holdsPreviousSolution || DataHeap::getInstance().isValidIndex(
       coarseGridCellDescription.getPreviousSolution()),coarseGridCellDescription.toString());
 
   const int levelFine  = fineGridCellDescription.getLevel();
@@ -1691,14 +1801,16 @@ void exahype::solvers::ADERDGSolver::restrictVolumeData(
       subcellIndex);
 
   // restrict next solution
-  double* previousSolutionFine   = DataHeap::getInstance().getData(
-      fineGridCellDescription.getPreviousSolution()).data();
-  double* previousSolutionCoarse = DataHeap::getInstance().getData(
-      coarseGridCellDescription.getPreviousSolution()).data();
-  volumeUnknownsRestriction(
-      previousSolutionCoarse,previousSolutionFine,
-      levelCoarse,levelFine,
-      subcellIndex);
+  if (_holdsPreviousSolution) {
+    double* previousSolutionFine   = DataHeap::getInstance().getData(
+        fineGridCellDescription.getPreviousSolution()).data();
+    double* previousSolutionCoarse = DataHeap::getInstance().getData(
+        coarseGridCellDescription.getPreviousSolution()).data();
+    volumeUnknownsRestriction(
+        previousSolutionCoarse,previousSolutionFine,
+        levelCoarse,levelFine,
+        subcellIndex);
+  }
 
   // Reset the min and max
   const int numberOfObservables = getDMPObservables();
@@ -1935,10 +2047,11 @@ void exahype::solvers::ADERDGSolver::performPredictionAndVolumeIntegral(
   if(usePaddedData_nVar()) {
     //TODO JMG add assert ignoring padding
   } else {
-    for (int i=0; i<getDataPerCell(); i++) {
+    // The generic kernels keep the padding entries zero. We can check the padded arrays as a whole.
+    for (int i=0; i<getTempUnknownsSize(); i++) {
     assertion3(tarch::la::equals(cellDescription.getCorrectorTimeStepSize(),0.0) || std::isfinite(tempUnknowns[i]),cellDescription.toString(),"performPredictionAndVolumeIntegral(...)",i);
     } // Dead code elimination will get rid of this loop if Asserts/Debug flags are not set.
-    for (int i=0; i<getFluxUnknownsPerCell(); i++) {
+    for (int i=0; i<getTempFluxUnknownsSize(); i++) {
       assertion3(tarch::la::equals(cellDescription.getCorrectorTimeStepSize(),0.0) || std::isfinite(tempFluxUnknowns[i]),cellDescription.toString(),"performPredictionAndVolumeIntegral(...)",i);
     } // Dead code elimination will get rid of this loop if Asserts/Debug flags are not set.
   }
@@ -2104,6 +2217,21 @@ void exahype::solvers::ADERDGSolver::updateSolution(
     double** tempUnknowns,
     exahype::Vertex* const fineGridVertices,
     const peano::grid::VertexEnumerator& fineGridVerticesEnumerator) {
+  updateSolution(
+      cellDescriptionsIndex,element,
+      tempStateSizedArrays,tempUnknowns,
+      fineGridVertices,fineGridVerticesEnumerator,
+      false);
+}
+
+void exahype::solvers::ADERDGSolver::updateSolution(
+    const int cellDescriptionsIndex,
+    const int element,
+    double** tempStateSizedArrays,
+    double** tempUnknowns,
+    exahype::Vertex* const fineGridVertices,
+    const peano::grid::VertexEnumerator& fineGridVerticesEnumerator,
+    const bool backupPreviousSolution) {
   // reset helper variables
   CellDescription& cellDescription  = getCellDescription(cellDescriptionsIndex,element);
   assertion2(cellDescription.getType()!=CellDescription::Type::Cell ||
@@ -2114,15 +2242,18 @@ void exahype::solvers::ADERDGSolver::updateSolution(
 
   if (cellDescription.getType()==exahype::records::ADERDGCellDescription::Cell &&
       cellDescription.getRefinementEvent()==exahype::records::ADERDGCellDescription::None) {
-    double* solution    = DataHeap::getInstance().getData(cellDescription.getPreviousSolution()).data();
     double* newSolution = DataHeap::getInstance().getData(cellDescription.getSolution()).data();
-    std::copy(newSolution,newSolution+_dofPerCell,solution); // Copy (current solution) in old solution field.
+    assertion1(!backupPreviousSolution || _holdsPreviousSolution,cellDescription.toString());
+    if (backupPreviousSolution) {
+      double* solution = DataHeap::getInstance().getData(cellDescription.getPreviousSolution()).data();
+      std::copy(newSolution,newSolution+_dofPerCell,solution); // Copy (current solution) in old solution field.
+    }
 
     double* lduh   = exahype::DataHeap::getInstance().getData(cellDescription.getUpdate()).data();
     double* lFhbnd = exahype::DataHeap::getInstance().getData(cellDescription.getFluctuation()).data();
 
     for (int i=0; i<getDataPerCell(); i++) { // cellDescription.getCorrectorTimeStepSize()==0.0 is an initial condition
-      assertion3(tarch::la::equals(cellDescription.getCorrectorTimeStepSize(),0.0)  || std::isfinite(solution[i]),cellDescription.toString(),"updateSolution(...)",i);
+      assertion3(tarch::la::equals(cellDescription.getCorrectorTimeStepSize(),0.0)  || std::isfinite(newSolution[i]),cellDescription.toString(),"updateSolution(...)",i);
     } // Dead code elimination will get rid of this loop if Asserts/Debug flags are not set.
 
     for (int i=0; i<getUnknownsPerCell(); i++) {
@@ -2178,6 +2309,35 @@ void exahype::solvers::ADERDGSolver::updateSolution(
   assertion(cellDescription.getRefinementEvent()==exahype::records::ADERDGCellDescription::None);
 }
 
+void exahype::solvers::ADERDGSolver::reduceInSitu(
+    const int cellDescriptionsIndex,
+    const int element,
+    plotters::ascii::InSituReductions::Accumulator& accumulator) const {
+  const plotters::ascii::InSituReductions* inSituReductions = getInSituReductions();
+  assertion(inSituReductions!=nullptr);
+  CellDescription& cellDescription = getCellDescription(cellDescriptionsIndex,element);
+
+  if (cellDescription.getType()==exahype::records::ADERDGCellDescription::Cell &&
+      cellDescription.getRefinementEvent()==exahype::records::ADERDGCellDescription::None) {
+    const double* const solution = DataHeap::getInstance().getData(cellDescription.getSolution()).data();
+    const int order          = _nodesPerCoordinateAxis-1;
+    const int dataPerNode    = _numberOfVariables+_numberOfParameters;
+    const double cellVolume  = tarch::la::volume(cellDescription.getSize());
+
+    dfor(i,_nodesPerCoordinateAxis) {
+      double weight = cellVolume;
+      for (int d=0; d<DIMENSIONS; d++) {
+        weight *= kernels::gaussLegendreWeights[order][i(d)];
+      }
+      const int node = peano::utils::dLinearisedWithoutLookup(i,_nodesPerCoordinateAxis);
+      inSituReductions->accumulate(accumulator,solution+node*dataPerNode,weight);
+    }
+
+    inSituReductions->accumulateTimeStamp(accumulator,
+        cellDescription.getCorrectorTimeStamp()+cellDescription.getCorrectorTimeStepSize());
+  }
+}
+
 void exahype::solvers::ADERDGSolver::rollbackSolution(
     const int cellDescriptionsIndex,
     const int element,
@@ -2200,6 +2360,8 @@ void exahype::solvers::ADERDGSolver::swapSolutionAndPreviousSolution(
   assertion(cellDescription.getType()==exahype::records::ADERDGCellDescription::Cell);
   assertion(cellDescription.getRefinementEvent()==exahype::records::ADERDGCellDescription::None);
 
+  assertion(_holdsPreviousSolution);
+
   // Simply swap the heap indices
   const int previousSolution = cellDescription.getPreviousSolution();
   cellDescription.setPreviousSolution(cellDescription.getSolution());
@@ -2958,9 +3120,60 @@ void exahype::solvers::ADERDGSolver::prepareNextNeighbourMerging(
 
 #ifdef Parallel
 const int exahype::solvers::ADERDGSolver::DataMessagesPerNeighbourCommunication    = 2;
-const int exahype::solvers::ADERDGSolver::DataMessagesPerForkOrJoinCommunication   = 1;
 const int exahype::solvers::ADERDGSolver::DataMessagesPerMasterWorkerCommunication = 2;
 
+void exahype::solvers::ADERDGSolver::sendDataInPrecision(
+    const double*                                values,
+    const int                                    numberOfEntries,
+    const StoragePrecision&                      precision,
+    const int                                    toRank,
+    const tarch::la::Vector<DIMENSIONS, double>& x,
+    const int                                    level,
+    const peano::heap::MessageType&              messageType,
+    MixedPrecisionErrors*                        errors) {
+  if (precision==StoragePrecision::Double) {
+    DataHeap::getInstance().sendData(
+        values, numberOfEntries, toRank, x, level, messageType);
+  } else {
+    std::vector<double> packed(getPackedSize(numberOfEntries,precision));
+    packIntoDoubles(values,numberOfEntries,precision,packed.data());
+
+    #if defined(Asserts) || defined(TrackMixedPrecisionErrors)
+    if (errors!=nullptr) {
+      std::vector<double> unpacked(numberOfEntries);
+      unpackFromDoubles(packed.data(),numberOfEntries,precision,unpacked.data());
+      MixedPrecisionErrors messageErrors;
+      messageErrors.record(values,unpacked.data(),numberOfEntries);
+
+      tarch::multicore::Lock lock(_heapSemaphore);
+      errors->merge(messageErrors);
+    }
+    #endif
+
+    DataHeap::getInstance().sendData(
+        packed.data(), packed.size(), toRank, x, level, messageType);
+  }
+}
+
+void exahype::solvers::ADERDGSolver::receiveDataInPrecision(
+    double*                                      values,
+    const int                                    numberOfEntries,
+    const StoragePrecision&                      precision,
+    const int                                    fromRank,
+    const tarch::la::Vector<DIMENSIONS, double>& x,
+    const int                                    level,
+    const peano::heap::MessageType&              messageType) {
+  if (precision==StoragePrecision::Double) {
+    DataHeap::getInstance().receiveData(
+        values, numberOfEntries, fromRank, x, level, messageType);
+  } else {
+    std::vector<double> packed(getPackedSize(numberOfEntries,precision));
+    DataHeap::getInstance().receiveData(
+        packed.data(), packed.size(), fromRank, x, level, messageType);
+    unpackFromDoubles(packed.data(),numberOfEntries,precision,values);
+  }
+}
+
 /**
  * After the forking the master's cell descriptions
  * are not accessed by enterCell(...) on the master
@@ -2976,31 +3189,30 @@ void exahype::solvers::ADERDGSolver::sendCellDescriptions(
       cellDescriptionsIndex);
 
   if (Heap::getInstance().getInstance().getData(cellDescriptionsIndex).size()>0) {
-    for (CellDescription& cellDescription : Heap::getInstance().getData(cellDescriptionsIndex)) {
-      if (cellDescription.getType()==CellDescription::Type::Ancestor) {
-        Solver::SubcellPosition subcellPosition =
-            exahype::amr::computeSubcellPositionOfCellOrAncestorOrEmptyAncestor
-            <CellDescription,Heap>(cellDescription);
+    prepareCellDescriptionsForSending(cellDescriptionsIndex);
 
-        if (subcellPosition.parentElement!=NotFound) {
-          cellDescription.setHasToHoldDataForMasterWorkerCommunication(true);
+    logDebug("sendCellDescriptions(...)","send "<<
+            Heap::getInstance().getData(cellDescriptionsIndex).size()<<
+            " cell descriptions to rank "<<toRank<<
+            " at (center="<< x.toString() <<
+            ",level="<< level << ")");
 
-          auto* solver = exahype::solvers::RegisteredSolvers[cellDescription.getSolverNumber()];
+    Heap::getInstance().sendData(cellDescriptionsIndex,
+                                 toRank,x,level,messageType);
+  } else {
+    sendEmptyCellDescriptions(toRank,messageType,x,level);
+  }
+}
 
-          switch (solver->getType()) {
-            case exahype::solvers::Solver::Type::ADERDG:
-              static_cast<exahype::solvers::ADERDGSolver*>(solver)->ensureNecessaryMemoryIsAllocated(cellDescription);
-              break;
-            case exahype::solvers::Solver::Type::LimitingADERDG:
-              static_cast<exahype::solvers::LimitingADERDGSolver*>(solver)->getSolver()->ensureNecessaryMemoryIsAllocated(cellDescription);
-              break;
-            case exahype::solvers::Solver::Type::FiniteVolumes:
-              assertionMsg(false,"Solver type not supported!");
-              break;
-          }
-        }
-      } else if (cellDescription.getType()==CellDescription::Type::Descendant) {
+void exahype::solvers::ADERDGSolver::prepareCellDescriptionsForSending(
+    const int cellDescriptionsIndex) {
+  for (CellDescription& cellDescription : Heap::getInstance().getData(cellDescriptionsIndex)) {
+    if (cellDescription.getType()==CellDescription::Type::Ancestor) {
+      Solver::SubcellPosition subcellPosition =
+          exahype::amr::computeSubcellPositionOfCellOrAncestorOrEmptyAncestor
+          <CellDescription,Heap>(cellDescription);
 
+      if (subcellPosition.parentElement!=NotFound) {
         cellDescription.setHasToHoldDataForMasterWorkerCommunication(true);
 
         auto* solver = exahype::solvers::RegisteredSolvers[cellDescription.getSolverNumber()];
@@ -3017,18 +3229,24 @@ void exahype::solvers::ADERDGSolver::sendCellDescriptions(
             break;
         }
       }
-    }
+    } else if (cellDescription.getType()==CellDescription::Type::Descendant) {
 
-    logDebug("sendCellDescriptions(...)","send "<<
-            Heap::getInstance().getData(cellDescriptionsIndex).size()<<
-            " cell descriptions to rank "<<toRank<<
-            " at (center="<< x.toString() <<
-            ",level="<< level << ")");
+      cellDescription.setHasToHoldDataForMasterWorkerCommunication(true);
 
-    Heap::getInstance().sendData(cellDescriptionsIndex,
-                                 toRank,x,level,messageType);
-  } else {
-    sendEmptyCellDescriptions(toRank,messageType,x,level);
+      auto* solver = exahype::solvers::RegisteredSolvers[cellDescription.getSolverNumber()];
+
+      switch (solver->getType()) {
+        case exahype::solvers::Solver::Type::ADERDG:
+          static_cast<exahype::solvers::ADERDGSolver*>(solver)->ensureNecessaryMemoryIsAllocated(cellDescription);
+          break;
+        case exahype::solvers::Solver::Type::LimitingADERDG:
+          static_cast<exahype::solvers::LimitingADERDGSolver*>(solver)->getSolver()->ensureNecessaryMemoryIsAllocated(cellDescription);
+          break;
+        case exahype::solvers::Solver::Type::FiniteVolumes:
+          assertionMsg(false,"Solver type not supported!");
+          break;
+      }
+    }
   }
 }
 
@@ -3073,117 +3291,132 @@ void exahype::solvers::ADERDGSolver::mergeCellDescriptionsWithRemoteData(
     const peano::heap::MessageType&              messageType,
     const tarch::la::Vector<DIMENSIONS, double>& x,
     const int                                    level) {
-  waitUntilAllBackgroundTasksHaveTerminated();
   tarch::multicore::Lock lock(_heapSemaphore);
-
-  const int receivedCellDescriptionsIndex =
-      Heap::getInstance().createData(0,exahype::solvers::RegisteredSolvers.size());
-  Heap::getInstance().receiveData(
-      receivedCellDescriptionsIndex,fromRank,x,level,messageType);
+  Heap::HeapEntries receivedCellDescriptions =
+      Heap::getInstance().receiveData(fromRank,x,level,messageType);
+  lock.free();
 
   logDebug("mergeCellDescriptionsWithRemoteData(...)","received " <<
-          Heap::getInstance().getData(receivedCellDescriptionsIndex).size() <<
+          receivedCellDescriptions.size() <<
           " cell descriptions for cell ("
           "centre="<< x.toString() <<
           "level="<< level << ")");
 
-  if (Heap::getInstance().getData(receivedCellDescriptionsIndex).size()>0) {
-    // TODO(Dominic): We reset the parent and heap indices of a received cell
-    // to -1 and RemoteAdjacencyIndex, respectively.
-    // If we receive parent and children cells during a fork event,
-    //
-    // We use the information of a parentIndex of a fine grid cell description
-    // set to RemoteAdjacencyIndex to update the parent index with
-    // the index of the coarse grid cell description in enterCell(..).
-    resetDataHeapIndices(receivedCellDescriptionsIndex,
-                         multiscalelinkedcell::HangingVertexBookkeeper::RemoteAdjacencyIndex);
-
-    if (!localCell.isInitialised()) {
-      localCell.setupMetaData();
-
-      logDebug("mergeCellDescriptionsWithRemoteData(...)","setup metadata for " <<
-                    "cell ("
-                    "centre="<< x.toString() <<
-                    ",level="<< level <<
-                    ",isRoot="<< localCell.isRoot() <<
-                    ",isAssignedToRemoteRank="<< localCell.isAssignedToRemoteRank());
-    }
-    assertion1(Heap::getInstance().isValidIndex(localCell.getCellDescriptionsIndex()),
-               localCell.getCellDescriptionsIndex());
-    Heap::getInstance().getData(localCell.getCellDescriptionsIndex()).reserve(
-        std::max(Heap::getInstance().getData(localCell.getCellDescriptionsIndex()).size(),
-                 Heap::getInstance().getData(receivedCellDescriptionsIndex).size()));
-
-//    assertion(Heap::getInstance().getData(localCell.getCellDescriptionsIndex()).empty());
-    for (auto& pReceived : Heap::getInstance().getData(receivedCellDescriptionsIndex)) {
-      logDebug("mergeCellDescriptionsWithRemoteData(...)","received " <<
-              "cell description for cell ("
-              "centre="<< x.toString() <<
-              ",level="<< level <<
-              ",isRoot="<< localCell.isRoot() <<
-              ",isAssignedToRemoteRank="<< localCell.isAssignedToRemoteRank() <<
-              ") with type="<< pReceived.getType());
-
-      bool found = false;
-      for (auto& pLocal : Heap::getInstance().getData(localCell.getCellDescriptionsIndex())) {
-        if (pReceived.getSolverNumber()==pLocal.getSolverNumber()) {
-          found = true;
-
-          pLocal.setHasToHoldDataForMasterWorkerCommunication(false);
-
-          assertion8(pReceived.getType()==pLocal.getType(),pReceived.getType(),pLocal.getType(),
-                     pLocal.getOffset()+0.5*pLocal.getSize(),
-                     pLocal.getLevel(),
-                     pReceived.getOffset()+0.5*pReceived.getSize(),
-                     pReceived.getLevel(),
-                     x,
-                     tarch::parallel::Node::getInstance().getRank());
+  mergeCellDescriptionsWithReceivedData(receivedCellDescriptions,localCell,x,level);
+}
 
-          if (pLocal.getType()==CellDescription::Type::Cell ||
-              pLocal.getType()==CellDescription::Type::Ancestor ||
-              pLocal.getType()==CellDescription::Type::Descendant
-          ) {
-            assertionNumericalEquals2(pLocal.getCorrectorTimeStamp(),pReceived.getCorrectorTimeStamp(),
-                                      pLocal.toString(),pReceived.toString());
-            assertionNumericalEquals2(pLocal.getCorrectorTimeStepSize(),pReceived.getCorrectorTimeStepSize(),
-                                      pLocal.toString(),pReceived.toString());
-            assertionNumericalEquals2(pLocal.getPredictorTimeStamp(),pReceived.getPredictorTimeStamp(),
-                                      pLocal.toString(),pReceived.toString());
-            assertionNumericalEquals2(pLocal.getPredictorTimeStepSize(),pReceived.getPredictorTimeStepSize(),
-                                      pLocal.toString(),pReceived.toString());
-          }
-        }
-      }
+void exahype::solvers::ADERDGSolver::mergeCellDescriptionsWithReceivedData(
+    Heap::HeapEntries&                           receivedCellDescriptions,
+    exahype::Cell&                               localCell,
+    const tarch::la::Vector<DIMENSIONS, double>& x,
+    const int                                    level) {
+  if (receivedCellDescriptions.empty()) {
+    return;
+  }
 
-      if (!found) {
-        auto* solver = exahype::solvers::RegisteredSolvers[pReceived.getSolverNumber()];
+  // TODO(Dominic): We reset the parent and heap indices of a received cell
+  // to -1 and RemoteAdjacencyIndex, respectively.
+  // If we receive parent and children cells during a fork event,
+  //
+  // We use the information of a parentIndex of a fine grid cell description
+  // set to RemoteAdjacencyIndex to update the parent index with
+  // the index of the coarse grid cell description in enterCell(..).
+  resetDataHeapIndices(receivedCellDescriptions,
+                       multiscalelinkedcell::HangingVertexBookkeeper::RemoteAdjacencyIndex);
 
-        switch (solver->getType()) {
-          case exahype::solvers::Solver::Type::ADERDG:
-            static_cast<exahype::solvers::ADERDGSolver*>(solver)->ensureNecessaryMemoryIsAllocated(pReceived);
-            break;
-          case exahype::solvers::Solver::Type::LimitingADERDG:
-            static_cast<exahype::solvers::LimitingADERDGSolver*>(solver)->getSolver()->ensureNecessaryMemoryIsAllocated(pReceived);
-            break;
-          case exahype::solvers::Solver::Type::FiniteVolumes:
-            assertionMsg(false,"Solver type not supported!");
-            break;
+  waitUntilAllBackgroundTasksHaveTerminated();
+  tarch::multicore::Lock lock(_heapSemaphore);
+
+  if (!localCell.isInitialised()) {
+    localCell.setupMetaData();
+
+    logDebug("mergeCellDescriptionsWithReceivedData(...)","setup metadata for " <<
+                  "cell ("
+                  "centre="<< x.toString() <<
+                  ",level="<< level <<
+                  ",isRoot="<< localCell.isRoot() <<
+                  ",isAssignedToRemoteRank="<< localCell.isAssignedToRemoteRank());
+  }
+  assertion1(Heap::getInstance().isValidIndex(localCell.getCellDescriptionsIndex()),
+             localCell.getCellDescriptionsIndex());
+  Heap::getInstance().getData(localCell.getCellDescriptionsIndex()).reserve(
+      std::max(Heap::getInstance().getData(localCell.getCellDescriptionsIndex()).size(),
+               receivedCellDescriptions.size()));
+
+  for (auto& pReceived : receivedCellDescriptions) {
+    logDebug("mergeCellDescriptionsWithReceivedData(...)","received " <<
+            "cell description for cell ("
+            "centre="<< x.toString() <<
+            ",level="<< level <<
+            ",isRoot="<< localCell.isRoot() <<
+            ",isAssignedToRemoteRank="<< localCell.isAssignedToRemoteRank() <<
+            ") with type="<< pReceived.getType());
+
+    bool found = false;
+    for (auto& pLocal : Heap::getInstance().getData(localCell.getCellDescriptionsIndex())) {
+      if (pReceived.getSolverNumber()==pLocal.getSolverNumber()) {
+        found = true;
+
+        pLocal.setHasToHoldDataForMasterWorkerCommunication(false);
+
+        assertion8(pReceived.getType()==pLocal.getType(),pReceived.getType(),pLocal.getType(),
+                   pLocal.getOffset()+0.5*pLocal.getSize(),
+                   pLocal.getLevel(),
+                   pReceived.getOffset()+0.5*pReceived.getSize(),
+                   pReceived.getLevel(),
+                   x,
+                   tarch::parallel::Node::getInstance().getRank());
+
+        if (pLocal.getType()==CellDescription::Type::Cell ||
+            pLocal.getType()==CellDescription::Type::Ancestor ||
+            pLocal.getType()==CellDescription::Type::Descendant
+        ) {
+          assertionNumericalEquals2(pLocal.getCorrectorTimeStamp(),pReceived.getCorrectorTimeStamp(),
+                                    pLocal.toString(),pReceived.toString());
+          assertionNumericalEquals2(pLocal.getCorrectorTimeStepSize(),pReceived.getCorrectorTimeStepSize(),
+                                    pLocal.toString(),pReceived.toString());
+          assertionNumericalEquals2(pLocal.getPredictorTimeStamp(),pReceived.getPredictorTimeStamp(),
+                                    pLocal.toString(),pReceived.toString());
+          assertionNumericalEquals2(pLocal.getPredictorTimeStepSize(),pReceived.getPredictorTimeStepSize(),
+                                    pLocal.toString(),pReceived.toString());
         }
+      }
+    }
+
+    if (!found) {
+      // The heap entry pool takes the heap semaphore itself if it has to create new entries.
+      lock.free();
+      auto* solver = exahype::solvers::RegisteredSolvers[pReceived.getSolverNumber()];
 
-        Heap::getInstance().getData(localCell.getCellDescriptionsIndex()).
-            push_back(pReceived);
+      switch (solver->getType()) {
+        case exahype::solvers::Solver::Type::ADERDG:
+          static_cast<exahype::solvers::ADERDGSolver*>(solver)->ensureNecessaryMemoryIsAllocated(pReceived);
+          break;
+        case exahype::solvers::Solver::Type::LimitingADERDG:
+          static_cast<exahype::solvers::LimitingADERDGSolver*>(solver)->getSolver()->ensureNecessaryMemoryIsAllocated(pReceived);
+          break;
+        case exahype::solvers::Solver::Type::FiniteVolumes:
+          assertionMsg(false,"Solver type not supported!");
+          break;
       }
+      lock.lock();
+
+      Heap::getInstance().getData(localCell.getCellDescriptionsIndex()).
+          push_back(pReceived);
     }
   }
-
-  Heap::getInstance().deleteData(receivedCellDescriptionsIndex);
-  assertion(!Heap::getInstance().isValidIndex(receivedCellDescriptionsIndex));
 }
 
 void exahype::solvers::ADERDGSolver::resetDataHeapIndices(
     const int cellDescriptionsIndex,
     const int parentIndex) {
-  for (auto& p : Heap::getInstance().getData(cellDescriptionsIndex)) {
+  resetDataHeapIndices(Heap::getInstance().getData(cellDescriptionsIndex),parentIndex);
+}
+
+void exahype::solvers::ADERDGSolver::resetDataHeapIndices(
+    Heap::HeapEntries& cellDescriptions,
+    const int          parentIndex) {
+  for (auto& p : cellDescriptions) {
     p.setParentIndex(parentIndex);
 
     // Default field data indices
@@ -3245,79 +3478,6 @@ void exahype::solvers::ADERDGSolver::mergeWithMasterWorkerMetadata(
   }
 }
 
-///////////////////////////////////
-// FORK OR JOIN
-///////////////////////////////////
-
-void exahype::solvers::ADERDGSolver::sendDataToWorkerOrMasterDueToForkOrJoin(
-    const int                                     toRank,
-    const int                                     cellDescriptionsIndex,
-    const int                                     element,
-    const tarch::la::Vector<DIMENSIONS, double>&  x,
-    const int                                     level) {
-  assertion1(Heap::getInstance().isValidIndex(cellDescriptionsIndex),cellDescriptionsIndex);
-  assertion1(element>=0,element);
-  assertion2(static_cast<unsigned int>(element)<Heap::getInstance().getData(cellDescriptionsIndex).size(),
-             element,Heap::getInstance().getData(cellDescriptionsIndex).size());
-  CellDescription& cellDescription = Heap::getInstance().getData(cellDescriptionsIndex)[element];
-
-  if (cellDescription.getType()==CellDescription::Cell) {
-    double* solution = DataHeap::getInstance().getData(cellDescription.getSolution()).data();
-
-    logDebug("sendDataToWorkerOrMasterDueToForkOrJoin(...)",""
-        "solution of solver " << cellDescription.getSolverNumber() << " sent to rank "<<toRank<<
-             ", cell: "<< x << ", level: " << level);
-
-    DataHeap::getInstance().sendData(
-        solution, getUnknownsPerCell(), toRank, x, level,
-        peano::heap::MessageType::ForkOrJoinCommunication);
-  }
-}
-
-
-void exahype::solvers::ADERDGSolver::sendEmptyDataToWorkerOrMasterDueToForkOrJoin(
-    const int                                     toRank,
-    const tarch::la::Vector<DIMENSIONS, double>&  x,
-    const int                                     level) {
-  std::vector<double> emptyMessage(0);
-  for(int sends=0; sends<DataMessagesPerForkOrJoinCommunication; ++sends)
-    DataHeap::getInstance().sendData(
-        emptyMessage, toRank, x, level,
-        peano::heap::MessageType::ForkOrJoinCommunication);
-}
-
-
-void exahype::solvers::ADERDGSolver::mergeWithWorkerOrMasterDataDueToForkOrJoin(
-    const int                                     fromRank,
-    const int                                     cellDescriptionsIndex,
-    const int                                     element,
-    const tarch::la::Vector<DIMENSIONS, double>&  x,
-    const int                                     level) {
-  auto& p = exahype::solvers::ADERDGSolver::Heap::getInstance().getData(cellDescriptionsIndex)[element];
-  assertion4(tarch::la::equals(x,p.getOffset()+0.5*p.getSize()),x,p.getOffset()+0.5*p.getSize(),level,p.getLevel());
-  assertion2(p.getLevel()==level,p.getLevel(),level);
-
-  if (p.getType()==CellDescription::Cell) {
-    logDebug("mergeWithRemoteDataDueToForkOrJoin(...)","[solution] receive from rank "<<fromRank<<
-             ", cell: "<< x << ", level: " << level);
-
-    DataHeap::getInstance().getData(p.getSolution()).clear();
-    DataHeap::getInstance().receiveData(
-        p.getSolution(),fromRank,x,level,
-        peano::heap::MessageType::ForkOrJoinCommunication);
-  }
-}
-
-void exahype::solvers::ADERDGSolver::dropWorkerOrMasterDataDueToForkOrJoin(
-    const int                                     fromRank,
-    const tarch::la::Vector<DIMENSIONS, double>&  x,
-    const int                                     level) {
-  for(int receives=0; receives<DataMessagesPerForkOrJoinCommunication; ++receives)
-    DataHeap::getInstance().receiveData(
-        fromRank, x, level,
-        peano::heap::MessageType::ForkOrJoinCommunication);
-}
-
 ///////////////////////////////////
 // NEIGHBOUR
 ///////////////////////////////////
@@ -3405,6 +3565,14 @@ void exahype::solvers::ADERDGSolver::sendDataToNeighbour(
         cellDescription.getFluctuation()).data() +
         (faceIndex * numberOfFluxDof);
 
+    #if defined(Asserts) || defined(TrackMixedPrecisionErrors)
+    MixedPrecisionErrors* extrapolatedPredictorErrors = &ExtrapolatedPredictorErrors;
+    MixedPrecisionErrors* fluctuationErrors           = &FluctuationErrors;
+    #else
+    MixedPrecisionErrors* extrapolatedPredictorErrors = nullptr;
+    MixedPrecisionErrors* fluctuationErrors           = nullptr;
+    #endif
+
     logDebug(
         "sendDataToNeighbour(...)",
         "send "<<DataMessagesPerNeighbourCommunication<<" arrays to rank " <<
@@ -3416,12 +3584,12 @@ void exahype::solvers::ADERDGSolver::sendDataToNeighbour(
 
     // Send order: lQhbnd,lFhbnd
     // Receive order: lFhbnd,lQhbnd
-    DataHeap::getInstance().sendData(
-        lQhbnd, numberOfFaceDof, toRank, x, level,
-        peano::heap::MessageType::NeighbourCommunication);
-    DataHeap::getInstance().sendData(
-        lFhbnd, numberOfFluxDof, toRank, x, level,
-        peano::heap::MessageType::NeighbourCommunication);
+    sendDataInPrecision(
+        lQhbnd, numberOfFaceDof, ExtrapolatedPredictorPrecision, toRank, x, level,
+        peano::heap::MessageType::NeighbourCommunication,extrapolatedPredictorErrors);
+    sendDataInPrecision(
+        lFhbnd, numberOfFluxDof, FluctuationPrecision, toRank, x, level,
+        peano::heap::MessageType::NeighbourCommunication,fluctuationErrors);
     // TODO(Dominic): If anarchic time stepping send the time step over too.
   } else {
     std::vector<double> emptyMessage(0);
@@ -3500,11 +3668,11 @@ void exahype::solvers::ADERDGSolver::mergeWithNeighbourData(
 
     // Send order: lQhbnd,lFhbnd
     // Receive order: lFhbnd,lQhbnd // TODO change to double variant
-    DataHeap::getInstance().receiveData(
-        DataHeap::getInstance().getData(receivedlFhbndIndex).data(),dataPerFace,
+    receiveDataInPrecision(
+        DataHeap::getInstance().getData(receivedlFhbndIndex).data(),dofPerFace,FluctuationPrecision,
         fromRank, x, level,peano::heap::MessageType::NeighbourCommunication);
-    DataHeap::getInstance().receiveData(
-        DataHeap::getInstance().getData(receivedlQhbndIndex).data(),dataPerFace,
+    receiveDataInPrecision(
+        DataHeap::getInstance().getData(receivedlQhbndIndex).data(),dataPerFace,ExtrapolatedPredictorPrecision,
         fromRank, x, level,peano::heap::MessageType::NeighbourCommunication);
     logDebug(
         "mergeWithNeighbourData(...)", "[pre] solve Riemann problem with received data." <<
@@ -3708,6 +3876,33 @@ void exahype::solvers::ADERDGSolver::mergeWithWorkerData(const DataHeap::HeapEnt
   }
 }
 
+exahype::DataHeap::HeapEntries
+exahype::solvers::ADERDGSolver::compileTimeStepDataForGlobalReduction() const {
+  DataHeap::HeapEntries message(0,4);
+  message.push_back(_minNextPredictorTimeStepSize);
+  message.push_back(_nextMinCellSize);
+  message.push_back(-_nextMaxCellSize);
+  message.push_back(_nextMeshUpdateRequest ? -1.0 : 1.0);
+  return message;
+}
+
+void exahype::solvers::ADERDGSolver::mergeWithGloballyReducedTimeStepData(const DataHeap::HeapEntries& message) {
+  assertion1(message.size()==4,message.size());
+  assertion1(std::isfinite(message[0]),message[0]);
+
+  int index=0;
+  _minNextPredictorTimeStepSize = message[index++];
+  _nextMinCellSize              = message[index++];
+  _nextMaxCellSize              = -message[index++];
+  _nextMeshUpdateRequest        = (message[index++] < 0.0) ? true : false;
+
+  logDebug("mergeWithGloballyReducedTimeStepData(...)","Updated time step fields: " <<
+      "_minNextPredictorTimeStepSize=" << _minNextPredictorTimeStepSize <<
+      ",_nextMeshUpdateRequest=" << _nextMeshUpdateRequest <<
+      ",_nextMinCellSize=" << _nextMinCellSize <<
+      ",_nextMaxCellSize=" << _nextMaxCellSize);
+}
+
 /**
  * At the time of the merging,
  * the workers and the master have already performed
@@ -3775,12 +3970,12 @@ void exahype::solvers::ADERDGSolver::sendDataToMaster(
 
     // No inverted message order since we do synchronous data exchange.
     // Order: extrapolatedPredictor,fluctuations.
-    DataHeap::getInstance().sendData(
-        extrapolatedPredictor, getBndTotalSize(), masterRank, x, level,
-        peano::heap::MessageType::MasterWorkerCommunication);
-    DataHeap::getInstance().sendData(
-        fluctuations, getBndFluxTotalSize(), masterRank, x, level,
-        peano::heap::MessageType::MasterWorkerCommunication);
+    sendDataInPrecision(
+        extrapolatedPredictor, getBndTotalSize(), ExtrapolatedPredictorPrecision, masterRank, x, level,
+        peano::heap::MessageType::MasterWorkerCommunication,nullptr);
+    sendDataInPrecision(
+        fluctuations, getBndFluxTotalSize(), FluctuationPrecision, masterRank, x, level,
+        peano::heap::MessageType::MasterWorkerCommunication,nullptr);
   } else {
     sendEmptyDataToMaster(masterRank,x,level);
   }
@@ -3815,15 +4010,13 @@ void exahype::solvers::ADERDGSolver::mergeWithWorkerData(
 
     // No inverted message order since we do synchronous data exchange.
     // Order: extrapolatedPredictor,fluctuations.
-    // Make sure you clear the arrays before you append(!) data via receive!
-    DataHeap::getInstance().getData(cellDescription.getExtrapolatedPredictor()).clear();
-    DataHeap::getInstance().getData(cellDescription.getFluctuation()).clear();
-
-    DataHeap::getInstance().receiveData(
-        cellDescription.getExtrapolatedPredictor(), workerRank, x, level,
+    receiveDataInPrecision(
+        DataHeap::getInstance().getData(cellDescription.getExtrapolatedPredictor()).data(),
+        getBndTotalSize(), ExtrapolatedPredictorPrecision, workerRank, x, level,
         peano::heap::MessageType::MasterWorkerCommunication);
-    DataHeap::getInstance().receiveData(
-        cellDescription.getFluctuation(), workerRank, x, level,
+    receiveDataInPrecision(
+        DataHeap::getInstance().getData(cellDescription.getFluctuation()).data(),
+        getBndFluxTotalSize(), FluctuationPrecision, workerRank, x, level,
         peano::heap::MessageType::MasterWorkerCommunication);
 
     exahype::solvers::Solver::SubcellPosition subcellPosition =
@@ -4021,13 +4214,13 @@ void exahype::solvers::ADERDGSolver::sendDataToWorker(
     double* extrapolatedPredictor = DataHeap::getInstance().getData(cellDescription.getExtrapolatedPredictor()).data();
     double* fluctuations          = DataHeap::getInstance().getData(cellDescription.getFluctuation()).data();
 
-    DataHeap::getInstance().sendData(
-        extrapolatedPredictor, getBndTotalSize(), workerRank, x, level,
-        peano::heap::MessageType::MasterWorkerCommunication); // No inverted message order since we do synchronous data exchange.
-                                                              // Order: extraplolatedPredictor,fluctuations.
-    DataHeap::getInstance().sendData(
-        fluctuations, getBndFluxTotalSize(), workerRank, x, level,
-        peano::heap::MessageType::MasterWorkerCommunication);
+    sendDataInPrecision(
+        extrapolatedPredictor, getBndTotalSize(), ExtrapolatedPredictorPrecision, workerRank, x, level,
+        peano::heap::MessageType::MasterWorkerCommunication,nullptr); // No inverted message order since we do synchronous data exchange.
+                                                                      // Order: extraplolatedPredictor,fluctuations.
+    sendDataInPrecision(
+        fluctuations, getBndFluxTotalSize(), FluctuationPrecision, workerRank, x, level,
+        peano::heap::MessageType::MasterWorkerCommunication,nullptr);
 
     logDebug("sendDataToWorker(...)","sent face data of solver " <<
              cellDescription.getSolverNumber() << " to rank "<< workerRank <<
@@ -4073,11 +4266,13 @@ void exahype::solvers::ADERDGSolver::mergeWithMasterData(
 
     // No inverted send and receives order since we do synchronous data exchange.
     // Order: extraplolatedPredictor,fluctuations
-    DataHeap::getInstance().receiveData(
-        cellDescription.getExtrapolatedPredictor(), masterRank, x, level,
+    receiveDataInPrecision(
+        DataHeap::getInstance().getData(cellDescription.getExtrapolatedPredictor()).data(),
+        getBndTotalSize(), ExtrapolatedPredictorPrecision, masterRank, x, level,
         peano::heap::MessageType::MasterWorkerCommunication);
-    DataHeap::getInstance().receiveData(
-        cellDescription.getFluctuation(), masterRank, x, level,
+    receiveDataInPrecision(
+        DataHeap::getInstance().getData(cellDescription.getFluctuation()).data(),
+        getBndFluxTotalSize(), FluctuationPrecision, masterRank, x, level,
         peano::heap::MessageType::MasterWorkerCommunication);
   } else {
     dropMasterData(masterRank,x,level);
@@ -4152,6 +4347,8 @@ exahype::solvers::ADERDGSolver::CompressionTask::CompressionTask(
 
 
 void exahype::solvers::ADERDGSolver::CompressionTask::operator()() {
+  exahype::profilers::PerformanceReport::ScopedPhase phase(
+      exahype::profilers::PerformanceReport::Phase::Compression);
   _solver.determineUnknownAverages(_cellDescription);
   _solver.computeHierarchicalTransform(_cellDescription,-1.0);
   _solver.putUnknownsIntoByteStream(_cellDescription);
@@ -4165,7 +4362,7 @@ void exahype::solvers::ADERDGSolver::CompressionTask::operator()() {
 
 void exahype::solvers::ADERDGSolver::compress(exahype::records::ADERDGCellDescription& cellDescription) {
   assertion1( cellDescription.getCompressionState() ==  exahype::records::ADERDGCellDescription::Uncompressed, cellDescription.toString() );
-  if (CompressionAccuracy>0.0) {
+  if (usesCompressedStorage()) {
     if (SpawnCompressionAsBackgroundThread) {
       cellDescription.setCompressionState(exahype::records::ADERDGCellDescription::CurrentlyProcessed);
 
@@ -4177,6 +4374,8 @@ void exahype::solvers::ADERDGSolver::compress(exahype::records::ADERDGCellDescri
       peano::datatraversal::TaskSet spawnedSet( myTask );
     }
     else {
+      exahype::profilers::PerformanceReport::ScopedPhase phase(
+          exahype::profilers::PerformanceReport::Phase::Compression);
       determineUnknownAverages(cellDescription);
       computeHierarchicalTransform(cellDescription,-1.0);
       putUnknownsIntoByteStream(cellDescription);
@@ -4188,7 +4387,7 @@ void exahype::solvers::ADERDGSolver::compress(exahype::records::ADERDGCellDescri
 
 void exahype::solvers::ADERDGSolver::uncompress(exahype::records::ADERDGCellDescription& cellDescription) {
   #ifdef SharedMemoryParallelisation
-  bool madeDecision = CompressionAccuracy<=0.0;
+  bool madeDecision = !usesCompressedStorage();
   bool uncompress   = false;
 
   while (!madeDecision) {
@@ -4203,7 +4402,7 @@ void exahype::solvers::ADERDGSolver::uncompress(exahype::records::ADERDGCellDesc
     tarch::multicore::BooleanSemaphore::sendTaskToBack();
   }
   #else
-  bool uncompress = CompressionAccuracy>0.0
+  bool uncompress = usesCompressedStorage()
       && cellDescription.getCompressionState() == exahype::records::ADERDGCellDescription::Compressed;
   #endif
 
@@ -4215,6 +4414,8 @@ void exahype::solvers::ADERDGSolver::uncompress(exahype::records::ADERDGCellDesc
 */
 
   if (uncompress) {
+    exahype::profilers::PerformanceReport::ScopedPhase phase(
+        exahype::profilers::PerformanceReport::Phase::Uncompression);
     pullUnknownsFromByteStream(cellDescription);
     computeHierarchicalTransform(cellDescription,1.0);
 
@@ -4235,11 +4436,15 @@ void exahype::solvers::ADERDGSolver::determineUnknownAverages(
     int    numberOfDoFsPerVariable  = power(getNodesPerCoordinateAxis(), DIMENSIONS);
     for (int i=0; i<numberOfDoFsPerVariable; i++) {
       solutionAverage         += DataHeap::getInstance().getData( cellDescription.getSolution()         )[i + variableNumber * numberOfDoFsPerVariable];
-      previousSolutionAverage += DataHeap::getInstance().getData( cellDescription.getPreviousSolution() )[i + variableNumber * numberOfDoFsPerVariable];
+      if (_holdsPreviousSolution) {
+        previousSolutionAverage += DataHeap::getInstance().getData( cellDescription.getPreviousSolution() )[i + variableNumber * numberOfDoFsPerVariable];
+      }
       updateAverage           += DataHeap::getInstance().getData( cellDescription.getUpdate()           )[i + variableNumber * numberOfDoFsPerVariable];
     }
     DataHeap::getInstance().getData( cellDescription.getSolutionAverages()         )[variableNumber] = solutionAverage         / numberOfDoFsPerVariable;
-    DataHeap::getInstance().getData( cellDescription.getPreviousSolutionAverages() )[variableNumber] = previousSolutionAverage / numberOfDoFsPerVariable;
+    if (_holdsPreviousSolution) {
+      DataHeap::getInstance().getData( cellDescription.getPreviousSolutionAverages() )[variableNumber] = previousSolutionAverage / numberOfDoFsPerVariable;
+    }
     DataHeap::getInstance().getData( cellDescription.getUpdateAverages()           )[variableNumber] = updateAverage           / numberOfDoFsPerVariable;
 
     for (int face=0; face<2*DIMENSIONS; face++) {
@@ -4262,7 +4467,9 @@ void exahype::solvers::ADERDGSolver::computeHierarchicalTransform(exahype::recor
     int    numberOfDoFsPerVariable  = power(getNodesPerCoordinateAxis(), DIMENSIONS);
     for (int i=0; i<numberOfDoFsPerVariable; i++) {
       DataHeap::getInstance().getData( cellDescription.getSolution()         )[i + variableNumber * numberOfDoFsPerVariable] += sign * DataHeap::getInstance().getData( cellDescription.getSolutionAverages() )[variableNumber];
-      DataHeap::getInstance().getData( cellDescription.getPreviousSolution() )[i + variableNumber * numberOfDoFsPerVariable] += sign * DataHeap::getInstance().getData( cellDescription.getPreviousSolutionAverages() )[variableNumber];
+      if (_holdsPreviousSolution) {
+        DataHeap::getInstance().getData( cellDescription.getPreviousSolution() )[i + variableNumber * numberOfDoFsPerVariable] += sign * DataHeap::getInstance().getData( cellDescription.getPreviousSolutionAverages() )[variableNumber];
+      }
       DataHeap::getInstance().getData( cellDescription.getUpdate()           )[i + variableNumber * numberOfDoFsPerVariable] += sign * DataHeap::getInstance().getData( cellDescription.getUpdateAverages()   )[variableNumber];
     }
 
@@ -4277,7 +4484,15 @@ void exahype::solvers::ADERDGSolver::computeHierarchicalTransform(exahype::recor
 }
 
 
-void exahype::solvers::ADERDGSolver::tearApart(int numberOfEntries, int normalHeapIndex, int compressedHeapIndex, int bytesForMantissa) {
+int exahype::solvers::ADERDGSolver::determineBytesForMantissa(
+    const double* data,const int numberOfEntries,const StoragePrecision& precision) {
+  const int bytesForMantissa = (CompressionAccuracy>0.0) ?
+      peano::heap::findMostAgressiveCompression(data,numberOfEntries,CompressionAccuracy) : 7;
+  return std::min(bytesForMantissa,getBytesForMantissa(precision));
+}
+
+
+void exahype::solvers::ADERDGSolver::tearApart(int numberOfEntries, int normalHeapIndex, int compressedHeapIndex, int bytesForMantissa, MixedPrecisionErrors* errors) {
   char exponent;
   long int mantissa;
   char* pMantissa = reinterpret_cast<char*>( &(mantissa) );
@@ -4297,11 +4512,26 @@ void exahype::solvers::ADERDGSolver::tearApart(int numberOfEntries, int normalHe
     );
     CompressedDataHeap::getInstance().getData( compressedHeapIndex )[compressedDataHeapIndex]._persistentRecords._u = exponent;
     compressedDataHeapIndex++;
+    if (errors!=nullptr) {
+      const double reconstructedValue = peano::heap::compose(exponent, mantissa, bytesForMantissa);
+      errors->record(&(DataHeap::getInstance().getData( normalHeapIndex )[i]),&reconstructedValue,1);
+    }
     for (int j=0; j<bytesForMantissa; j++) {
       CompressedDataHeap::getInstance().getData( compressedHeapIndex )[compressedDataHeapIndex]._persistentRecords._u = pMantissa[j];
       compressedDataHeapIndex++;
     }
   }
+
+  auto& compressedData = CompressedDataHeap::getInstance().getData( compressedHeapIndex );
+  if (
+    OutOfCoreStorage::getInstance().isActive() &&
+    OutOfCoreStorage::getInstance().store(
+      compressedHeapIndex,
+      reinterpret_cast<const char*>(compressedData.data()),
+      compressedData.size() * sizeof(compressedData[0]))
+  ) {
+    std::remove_reference<decltype(compressedData)>::type().swap(compressedData);
+  }
 }
 
 
@@ -4312,6 +4542,16 @@ void exahype::solvers::ADERDGSolver::glueTogether(int numberOfEntries, int norma
 
   assertion( DataHeap::getInstance().isValidIndex(normalHeapIndex) );
   assertion( CompressedDataHeap::getInstance().isValidIndex(compressedHeapIndex) );
+
+  if (OutOfCoreStorage::getInstance().contains(compressedHeapIndex)) {
+    auto& compressedData = CompressedDataHeap::getInstance().getData( compressedHeapIndex );
+    compressedData.resize(numberOfEntries * (bytesForMantissa+1));
+    OutOfCoreStorage::getInstance().load(
+      compressedHeapIndex,
+      reinterpret_cast<char*>(compressedData.data()),
+      compressedData.size() * sizeof(compressedData[0]));
+  }
+
   assertion5(
     static_cast<int>(CompressedDataHeap::getInstance().getData(compressedHeapIndex).size())==numberOfEntries * (bytesForMantissa+1),
     CompressedDataHeap::getInstance().getData(compressedHeapIndex).size(), numberOfEntries * (bytesForMantissa+1),
@@ -4351,7 +4591,7 @@ void exahype::solvers::ADERDGSolver::glueTogether(int numberOfEntries, int norma
 
 
 void exahype::solvers::ADERDGSolver::putUnknownsIntoByteStream(exahype::records::ADERDGCellDescription& cellDescription) {
-  assertion(CompressionAccuracy>0.0);
+  assertion(usesCompressedStorage());
 
   assertion( cellDescription.getPreviousSolutionCompressed()==-1 );
   assertion( cellDescription.getSolutionCompressed()==-1 );
@@ -4366,36 +4606,36 @@ void exahype::solvers::ADERDGSolver::putUnknownsIntoByteStream(exahype::records:
   int compressionOfFluctuation;
 
   assertion( DataHeap::getInstance().isValidIndex( cellDescription.getSolution() ));
-  assertion( DataHeap::getInstance().isValidIndex( cellDescription.getPreviousSolution() ));
+  assertion( !_holdsPreviousSolution || DataHeap::getInstance().isValidIndex( cellDescription.getPreviousSolution() ));
   assertion( DataHeap::getInstance().isValidIndex( cellDescription.getUpdate() ));
   assertion( DataHeap::getInstance().isValidIndex( cellDescription.getExtrapolatedPredictor() ));
   assertion( DataHeap::getInstance().isValidIndex( cellDescription.getFluctuation() ));
 
   peano::datatraversal::TaskSet compressionFactorIdentification(
-    [&]() -> void  { compressionOfPreviousSolution = peano::heap::findMostAgressiveCompression(
+    [&]() -> void  { compressionOfPreviousSolution = !_holdsPreviousSolution ? 7 : determineBytesForMantissa(
       DataHeap::getInstance().getData( cellDescription.getPreviousSolution() ).data(),
       getNumberOfVariables() * power(getNodesPerCoordinateAxis(), DIMENSIONS),
-      CompressionAccuracy
+      PreviousSolutionPrecision
       );},
-    [&] () -> void  { compressionOfSolution = peano::heap::findMostAgressiveCompression(
+    [&] () -> void  { compressionOfSolution = determineBytesForMantissa(
       DataHeap::getInstance().getData( cellDescription.getSolution() ).data(),
       getNumberOfVariables() * power(getNodesPerCoordinateAxis(), DIMENSIONS),
-      CompressionAccuracy
+      StoragePrecision::Double
       );},
-    [&]() -> void  { compressionOfUpdate = peano::heap::findMostAgressiveCompression(
+    [&]() -> void  { compressionOfUpdate = determineBytesForMantissa(
       DataHeap::getInstance().getData( cellDescription.getUpdate() ).data(),
       getNumberOfVariables() * power(getNodesPerCoordinateAxis(), DIMENSIONS),
-      CompressionAccuracy
+      UpdatePrecision
       );},
-    [&]() -> void  { compressionOfExtrapolatedPredictor = peano::heap::findMostAgressiveCompression(
+    [&]() -> void  { compressionOfExtrapolatedPredictor = determineBytesForMantissa(
       DataHeap::getInstance().getData( cellDescription.getExtrapolatedPredictor() ).data(),
       getNumberOfVariables() * power(getNodesPerCoordinateAxis(), DIMENSIONS-1) * 2 * DIMENSIONS,
-      CompressionAccuracy
+      ExtrapolatedPredictorPrecision
       );},
-    [&]() -> void  { compressionOfFluctuation = peano::heap::findMostAgressiveCompression(
+    [&]() -> void  { compressionOfFluctuation = determineBytesForMantissa(
       DataHeap::getInstance().getData( cellDescription.getFluctuation() ).data(),
       getNumberOfVariables() * power(getNodesPerCoordinateAxis(), DIMENSIONS-1) * 2 * DIMENSIONS,
-      CompressionAccuracy
+      FluctuationPrecision
       );},
       true
   );
@@ -4422,12 +4662,20 @@ void exahype::solvers::ADERDGSolver::putUnknownsIntoByteStream(exahype::records:
         lock.free();
 
         const int numberOfEntries = getNumberOfVariables() * power(getNodesPerCoordinateAxis(), DIMENSIONS);
+        #if defined(Asserts) || defined(TrackMixedPrecisionErrors)
+        MixedPrecisionErrors errors;
+        tearApart(numberOfEntries, cellDescription.getPreviousSolution(), cellDescription.getPreviousSolutionCompressed(), compressionOfPreviousSolution, &errors);
+        lock.lock();
+        PreviousSolutionErrors.merge(errors);
+        lock.free();
+        #else
         tearApart(numberOfEntries, cellDescription.getPreviousSolution(), cellDescription.getPreviousSolutionCompressed(), compressionOfPreviousSolution);
+        #endif
 
         #if defined(Asserts)
         lock.lock();
         PipedUncompressedBytes += DataHeap::getInstance().getData( cellDescription.getPreviousSolution() ).size() * 8.0;
-        PipedCompressedBytes   += CompressedDataHeap::getInstance().getData( cellDescription.getPreviousSolutionCompressed() ).size();
+        PipedCompressedBytes   += numberOfEntries * (compressionOfPreviousSolution+1);
         lock.free();
         #endif
 
@@ -4437,7 +4685,7 @@ void exahype::solvers::ADERDGSolver::putUnknownsIntoByteStream(exahype::records:
         cellDescription.setPreviousSolution( -1 );
         #endif
       }
-      else {
+      else if (_holdsPreviousSolution) {
         #if defined(Asserts)
         tarch::multicore::Lock lock(_heapSemaphore);
         PipedUncompressedBytes += DataHeap::getInstance().getData( cellDescription.getPreviousSolution() ).size() * 8.0;
@@ -4460,7 +4708,7 @@ void exahype::solvers::ADERDGSolver::putUnknownsIntoByteStream(exahype::records:
         #if defined(Asserts)
         lock.lock();
         PipedUncompressedBytes += DataHeap::getInstance().getData( cellDescription.getSolution() ).size() * 8.0;
-        PipedCompressedBytes   += CompressedDataHeap::getInstance().getData( cellDescription.getSolutionCompressed() ).size();
+        PipedCompressedBytes   += numberOfEntries * (compressionOfSolution+1);
         lock.free();
         #endif
 
@@ -4487,12 +4735,20 @@ void exahype::solvers::ADERDGSolver::putUnknownsIntoByteStream(exahype::records:
         lock.free();
 
         const int numberOfEntries = getNumberOfVariables() * power(getNodesPerCoordinateAxis(), DIMENSIONS);
+        #if defined(Asserts) || defined(TrackMixedPrecisionErrors)
+        MixedPrecisionErrors errors;
+        tearApart(numberOfEntries, cellDescription.getUpdate(), cellDescription.getUpdateCompressed(), compressionOfUpdate, &errors);
+        lock.lock();
+        UpdateErrors.merge(errors);
+        lock.free();
+        #else
         tearApart(numberOfEntries, cellDescription.getUpdate(), cellDescription.getUpdateCompressed(), compressionOfUpdate);
+        #endif
 
         #if defined(Asserts)
         lock.lock();
         PipedUncompressedBytes += DataHeap::getInstance().getData( cellDescription.getUpdate() ).size() * 8.0;
-        PipedCompressedBytes   += CompressedDataHeap::getInstance().getData( cellDescription.getUpdateCompressed() ).size();
+        PipedCompressedBytes   += numberOfEntries * (compressionOfUpdate+1);
         lock.free();
         #endif
 
@@ -4519,12 +4775,20 @@ void exahype::solvers::ADERDGSolver::putUnknownsIntoByteStream(exahype::records:
         lock.free();
 
         const int numberOfEntries = getNumberOfVariables() * power(getNodesPerCoordinateAxis(), DIMENSIONS-1) * 2 * DIMENSIONS;
+        #if defined(Asserts) || defined(TrackMixedPrecisionErrors)
+        MixedPrecisionErrors errors;
+        tearApart(numberOfEntries, cellDescription.getExtrapolatedPredictor(), cellDescription.getExtrapolatedPredictorCompressed(), compressionOfExtrapolatedPredictor, &errors);
+        lock.lock();
+        ExtrapolatedPredictorErrors.merge(errors);
+        lock.free();
+        #else
         tearApart(numberOfEntries, cellDescription.getExtrapolatedPredictor(), cellDescription.getExtrapolatedPredictorCompressed(), compressionOfExtrapolatedPredictor);
+        #endif
 
         #if defined(Asserts)
         lock.lock();
         PipedUncompressedBytes += DataHeap::getInstance().getData( cellDescription.getExtrapolatedPredictor() ).size() * 8.0;
-        PipedCompressedBytes   += CompressedDataHeap::getInstance().getData( cellDescription.getExtrapolatedPredictorCompressed() ).size();
+        PipedCompressedBytes   += numberOfEntries * (compressionOfExtrapolatedPredictor+1);
         lock.free();
         #endif
 
@@ -4551,12 +4815,20 @@ void exahype::solvers::ADERDGSolver::putUnknownsIntoByteStream(exahype::records:
         lock.free();
 
         const int numberOfEntries = getNumberOfVariables() * power(getNodesPerCoordinateAxis(), DIMENSIONS-1) * 2 * DIMENSIONS;
+        #if defined(Asserts) || defined(TrackMixedPrecisionErrors)
+        MixedPrecisionErrors errors;
+        tearApart(numberOfEntries, cellDescription.getFluctuation(), cellDescription.getFluctuationCompressed(), compressionOfFluctuation, &errors);
+        lock.lock();
+        FluctuationErrors.merge(errors);
+        lock.free();
+        #else
         tearApart(numberOfEntries, cellDescription.getFluctuation(), cellDescription.getFluctuationCompressed(), compressionOfFluctuation);
+        #endif
 
         #if defined(Asserts)
         lock.lock();
         PipedUncompressedBytes += DataHeap::getInstance().getData( cellDescription.getFluctuation() ).size() * 8.0;
-        PipedCompressedBytes   += CompressedDataHeap::getInstance().getData( cellDescription.getFluctuationCompressed() ).size();
+        PipedCompressedBytes   += numberOfEntries * (compressionOfFluctuation+1);
         lock.free();
         #endif
 
@@ -4580,7 +4852,7 @@ void exahype::solvers::ADERDGSolver::putUnknownsIntoByteStream(exahype::records:
 
 
 void exahype::solvers::ADERDGSolver::pullUnknownsFromByteStream(exahype::records::ADERDGCellDescription& cellDescription) {
-  assertion(CompressionAccuracy>0.0);
+  assertion(usesCompressedStorage());
 
   #if !defined(ValidateCompressedVsUncompressedData)
   const int unknownsPerCell         = getUnknownsPerCell();
@@ -4589,7 +4861,9 @@ void exahype::solvers::ADERDGSolver::pullUnknownsFromByteStream(exahype::records
 
   {
     tarch::multicore::Lock lock(_heapSemaphore);
-    cellDescription.setPreviousSolution( DataHeap::getInstance().createData( dataPointsPerCell,         dataPointsPerCell,         DataHeap::Allocation::UseOnlyRecycledEntries) );
+    if (_holdsPreviousSolution) {
+      cellDescription.setPreviousSolution( DataHeap::getInstance().createData( dataPointsPerCell,         dataPointsPerCell,         DataHeap::Allocation::UseOnlyRecycledEntries) );
+    }
     cellDescription.setSolution( DataHeap::getInstance().createData(         dataPointsPerCell,         dataPointsPerCell,         DataHeap::Allocation::UseOnlyRecycledEntries) );
     cellDescription.setUpdate( DataHeap::getInstance().createData(           unknownsPerCell,         unknownsPerCell,         DataHeap::Allocation::UseOnlyRecycledEntries) );
 
@@ -4597,7 +4871,7 @@ void exahype::solvers::ADERDGSolver::pullUnknownsFromByteStream(exahype::records
     cellDescription.setFluctuation( DataHeap::getInstance().createData(           unknownsPerCellBoundary, unknownsPerCellBoundary, DataHeap::Allocation::UseOnlyRecycledEntries) );
     lock.free();
 
-    if (cellDescription.getPreviousSolution()==-1) {
+    if (_holdsPreviousSolution && cellDescription.getPreviousSolution()==-1) {
       waitUntilAllBackgroundTasksHaveTerminated();
       lock.lock();
       cellDescription.setPreviousSolution( DataHeap::getInstance().createData( dataPointsPerCell, dataPointsPerCell, DataHeap::Allocation::UseRecycledEntriesIfPossibleCreateNewEntriesIfRequired) );
@@ -4629,7 +4903,7 @@ void exahype::solvers::ADERDGSolver::pullUnknownsFromByteStream(exahype::records
     }
   }
   #else
-  assertion( DataHeap::getInstance().isValidIndex( cellDescription.getPreviousSolution() ));
+  assertion( !_holdsPreviousSolution || DataHeap::getInstance().isValidIndex( cellDescription.getPreviousSolution() ));
   assertion( DataHeap::getInstance().isValidIndex( cellDescription.getSolution() ));
   assertion( DataHeap::getInstance().isValidIndex( cellDescription.getUpdate() ));
   assertion( DataHeap::getInstance().isValidIndex( cellDescription.getExtrapolatedPredictor() ));
@@ -4637,7 +4911,7 @@ void exahype::solvers::ADERDGSolver::pullUnknownsFromByteStream(exahype::records
   #endif
 
   assertion1(
-      CompressedDataHeap::getInstance().isValidIndex( cellDescription.getPreviousSolutionCompressed() ),
+      !_holdsPreviousSolution || CompressedDataHeap::getInstance().isValidIndex( cellDescription.getPreviousSolutionCompressed() ),
       cellDescription.getPreviousSolutionCompressed()
     );
   assertion1(
@@ -21,7 +21,9 @@
 #include <vector>
 
 #include "exahype/solvers/Solver.h"
+#include "exahype/solvers/HeapEntryPool.h"
 #include "exahype/solvers/UserSolverInterface.h"
+#include "exahype/solvers/MixedPrecision.h"
 
 #include "peano/heap/Heap.h"
 #include "peano/utils/Globals.h"
@@ -50,6 +52,56 @@ public:
 
   static bool SpawnCompressionAsBackgroundThread;
 
+  /**
+   * If set, the runner batches several fused time steps although the
+   * solver uses global (non-fixed) time stepping. The batch is
+   * speculative: A solver which detects at the end of a time step that
+   * its last predictor used an unstable time step size stops computing
+   * and sending for the remaining traversals of the batch (see
+   * isComputing() and isSending()). The runner then reruns the predictor
+   * as it does after a single time step.
+   *
+   * The solver does not take part in the time step data reduction
+   * during the remaining traversals either. This is consistent across
+   * ranks as the flag is set from the globally reduced time step data.
+   * The rerun predictor resets the flag; see
+   * exahype::mappings::Prediction::endIteration().
+   */
+  static bool SpeculativeTimeStepBatching;
+
+  /**
+   * Precision the respective arrays are stored in between two
+   * traversals (via the data compression) and, for the face data,
+   * communicated in to neighbour and master/worker ranks.
+   * The kernels always compute in double precision.
+   *
+   * Configured via the optimisation section of the specification file.
+   * Reduced storage precision is only supported for the fused time stepping
+   * (see exahype::runners::Runner::initDataCompression()).
+   */
+  static StoragePrecision ExtrapolatedPredictorPrecision;
+  static StoragePrecision FluctuationPrecision;
+  static StoragePrecision PreviousSolutionPrecision;
+  static StoragePrecision UpdatePrecision;
+
+  /**
+   * \return true if the unknowns are put into a byte stream in between
+   * two traversals. This is the case if either a compression accuracy
+   * is set or if one of the arrays is stored in reduced precision.
+   */
+  static bool usesCompressedStorage();
+
+  #if defined(Asserts) || defined(TrackMixedPrecisionErrors)
+  /**
+   * Errors introduced by the reduced precision per array compared
+   * to the full precision values.
+   */
+  static MixedPrecisionErrors ExtrapolatedPredictorErrors;
+  static MixedPrecisionErrors FluctuationErrors;
+  static MixedPrecisionErrors PreviousSolutionErrors;
+  static MixedPrecisionErrors UpdateErrors;
+  #endif
+
   /**
    * The maximum helper status.
    * This value is assigned to cell descriptions
@@ -147,6 +199,41 @@ private:
    */
   bool _stabilityConditionWasViolated;
 
+  /**
+   * Number of time steps started since the last
+   * call of resetNumberOfStartedTimeSteps().
+   */
+  int _numberOfStartedTimeSteps;
+
+  /**
+   * Flag indicating that the cells of this solver store a previous solution.
+   *
+   * Only a solver which might roll back its solution needs it,
+   * i.e. the ADER-DG solver wrapped by a LimitingADERDGSolver.
+   * A pure ADER-DG solver thus neither allocates, compresses,
+   * prolongates, nor restricts a previous solution.
+   * Its cell descriptions store -1 instead of the heap indices of the previous
+   * solution and its averages.
+   *
+   * \see setHoldsPreviousSolution
+   */
+  bool _holdsPreviousSolution;
+
+  /**
+   * Scales the user's time step size weight for the fused
+   * time stepping (see exahype::State::getTimeStepSizeWeightForPredictionRerun()).
+   *
+   * The scaling is decreased multiplicatively whenever the stability
+   * condition was violated and relaxed slowly towards 1 after every
+   * time step which was stable. Runs whose admissible time step size
+   * shrinks frequently thus settle at a weight which requires
+   * fewer predictor reruns.
+   *
+   * The scaling is updated on every rank which reinitialises the
+   * time step data; all of these ranks see the same reduced data.
+   */
+  double _timeStepSizeWeightScaling;
+
   /**
    * The number of unknowns/basis functions associated with each face of an
    * element.
@@ -208,7 +295,32 @@ private:
    */
   const int _DMPObservables;
 
-  void tearApart(int numberOfEntries, int normalHeapIndex, int compressedHeapIndex, int bytesForMantissa);
+  /**
+   * Recycles the heap entries of cells which change their type
+   * during mesh refinement.
+   *
+   * @see ensureNecessaryMemoryIsAllocated, ensureNoUnnecessaryMemoryIsAllocated
+   */
+  HeapEntryPool _heapEntryPool;
+
+  /**
+   * Combine the adaptive compression (if CompressionAccuracy is set) with the
+   * fixed storage \p precision of the array \p data.
+   *
+   * \return the number of mantissa bytes; 7 indicates that no compression is
+   * used.
+   */
+  static int determineBytesForMantissa(const double* data,const int numberOfEntries,const StoragePrecision& precision);
+
+  /**
+   * If the OutOfCoreStorage is active, tearApart() hands the byte stream over
+   * to the storage and releases the compressed heap entry's memory.
+   * glueTogether() fetches it back.
+   *
+   * \param[in,out] errors accumulates the error introduced by the compression
+   * if not nullptr.
+   */
+  void tearApart(int numberOfEntries, int normalHeapIndex, int compressedHeapIndex, int bytesForMantissa, MixedPrecisionErrors* errors=nullptr);
   void glueTogether(int numberOfEntries, int normalHeapIndex, int compressedHeapIndex, int bytesForMantissa);
 
   /**
@@ -565,12 +677,6 @@ private:
    * methods.
    */
   static const int DataMessagesPerNeighbourCommunication;
-  /**
-   * Data messages per fork/join communication.
-   * This information is required by the sendEmpty...(...)
-   * methods.
-   */
-  static const int DataMessagesPerForkOrJoinCommunication;
   /**
    * Data messages per master worker communication.
    * This information is required by the sendEmpty...(...)
@@ -578,6 +684,36 @@ private:
    */
   static const int DataMessagesPerMasterWorkerCommunication;
 
+  /**
+   * Send \p numberOfEntries values in \p precision via the DataHeap.
+   * The values are packed bitwise into doubles, i.e. the message
+   * shrinks according to the precision.
+   *
+   * \param[in,out] errors accumulates the error introduced by the reduced
+   * precision if not nullptr.
+   */
+  static void sendDataInPrecision(
+      const double*                                values,
+      const int                                    numberOfEntries,
+      const StoragePrecision&                      precision,
+      const int                                    toRank,
+      const tarch::la::Vector<DIMENSIONS, double>& x,
+      const int                                    level,
+      const peano::heap::MessageType&              messageType,
+      MixedPrecisionErrors*                        errors);
+
+  /**
+   * Counterpart of sendDataInPrecision. Writes into \p values.
+   */
+  static void receiveDataInPrecision(
+      double*                                      values,
+      const int                                    numberOfEntries,
+      const StoragePrecision&                      precision,
+      const int                                    fromRank,
+      const tarch::la::Vector<DIMENSIONS, double>& x,
+      const int                                    level,
+      const peano::heap::MessageType&              messageType);
+
   /**
    * Single-sided version of the other solveRiemannProblemAtInterface(). It
    * works only on one cell and one solver within this cell and in return
@@ -616,6 +752,14 @@ private:
       const int cellDescriptionsIndex,
       const int parentIndex);
 
+  /**
+   * Same as above for cell descriptions which are not (yet)
+   * stored on the heap, e.g. because they were just received.
+   */
+  static void resetDataHeapIndices(
+      Heap::HeapEntries& cellDescriptions,
+      const int          parentIndex);
+
 #endif
   /**
    * Run over the persistent fields of the ADER-DG cell and determine the
@@ -945,7 +1089,10 @@ public:
    * Checks if no unnecessary memory is allocated for the cell description.
    * If this is not the case, it deallocates the unnecessarily allocated memory.
    *
-   * \note This operation is thread safe as we serialise it.
+   * Uncompressed arrays are handed back to the solver's HeapEntryPool.
+   *
+   * \note This operation is thread safe. Only the deletion of
+   * compressed data is serialised.
    */
   void ensureNoUnnecessaryMemoryIsAllocated(CellDescription& cellDescription);
 
@@ -954,7 +1101,10 @@ public:
    * If this is not the case, it allocates the necessary
    * memory for the cell description.
    *
-   * \note This operation is thread safe as we serialise it.
+   * The arrays are taken from the solver's HeapEntryPool.
+   *
+   * \note This operation is thread safe. The pool
+   * only serialises if it has to create new heap entries.
    */
   void ensureNecessaryMemoryIsAllocated(exahype::records::ADERDGCellDescription& cellDescription);
 
@@ -963,18 +1113,33 @@ public:
    * Getter for the size of the array allocated that can be overriden
    * to change the allocated size independently of the solver parameters.
    * For example to add padding forthe optimised kernel
+   *
+   * The temporary arrays of the predictor are large enough for the padded
+   * variable dimension of the generic nonlinear kernels
+   * (see kernels::aderdg::generic::c::spaceTimePredictorNonlinear).
+   * The face data is not padded.
    */
-  virtual int getTempSpaceTimeUnknownsSize()     const {return getSpaceTimeDataPerCell()+getDataPerCell();} // TODO function should be renamed
-  virtual int getTempSpaceTimeFluxUnknownsSize() const {return getSpaceTimeFluxUnknownsPerCell();}
-  virtual int getTempUnknownsSize()              const {return getDataPerCell();} // TODO function should be renamed
-  virtual int getTempFluxUnknownsSize()          const {return getFluxUnknownsPerCell();}
+  virtual int getTempSpaceTimeUnknownsSize()     const {return (power(_nodesPerCoordinateAxis,DIMENSIONS+1)+power(_nodesPerCoordinateAxis,DIMENSIONS)) * addPadding(_numberOfVariables+_numberOfParameters);} // TODO function should be renamed
+  virtual int getTempSpaceTimeFluxUnknownsSize() const {return power(_nodesPerCoordinateAxis,DIMENSIONS+1) * (DIMENSIONS+1) * addPadding(_numberOfVariables);}
+  virtual int getTempUnknownsSize()              const {return power(_nodesPerCoordinateAxis,DIMENSIONS)   * addPadding(_numberOfVariables+_numberOfParameters);} // TODO function should be renamed
+  virtual int getTempFluxUnknownsSize()          const {return power(_nodesPerCoordinateAxis,DIMENSIONS)   * (DIMENSIONS+1) * addPadding(_numberOfVariables);}
   virtual int getBndFaceSize()                   const {return getDataPerFace();} // TODO function should be renamed
   virtual int getBndTotalSize()                  const {return getDataPerCellBoundary();} // TODO function should be renamed
   virtual int getBndFluxSize()                   const {return getUnknownsPerFace();} // TODO function should be renamed
   virtual int getBndFluxTotalSize()              const {return getUnknownsPerCellBoundary();} // TODO function should be renamed
   virtual int getTempStateSizedVectorsSize()     const {return getNumberOfVariables()+getNumberOfParameters();} //dataPoints
   
-  virtual bool alignTempArray()                  const {return false;}
+  /**
+   * Allocate the temporary arrays aligned to ALIGNMENT. This is the case
+   * whenever the toolkit knows the architecture.
+   */
+  virtual bool alignTempArray()                  const {
+    #ifdef ALIGNMENT
+    return true;
+    #else
+    return false;
+    #endif
+  }
 
   /**
    * False for generic solver, may be true for optimized one
@@ -1493,6 +1658,63 @@ public:
    */
   bool getStabilityConditionWasViolated() const;
 
+  /**
+   * \return the number of time steps started (see startNewTimeStep())
+   * since the last call of resetNumberOfStartedTimeSteps().
+   *
+   * A solver that detected a violation of the stability condition
+   * does not start any further time steps in a speculative batch
+   * (see SpeculativeTimeStepBatching). The runner uses the counter
+   * to find out how many time steps a batch actually advanced.
+   */
+  int getNumberOfStartedTimeSteps() const;
+
+  void resetNumberOfStartedTimeSteps();
+
+  /**
+   * Lets the cells of this solver store a previous solution,
+   * which is then available for rollbackSolution(...).
+   *
+   * Has to be called before any cell memory is allocated.
+   * The LimitingADERDGSolver does so in its constructor.
+   */
+  void setHoldsPreviousSolution(const bool holdsPreviousSolution);
+
+  /**
+   * eturn if the cells of this solver store a previous solution.
+   */
+  bool holdsPreviousSolution() const;
+
+  /**
+   * Lower bound for _timeStepSizeWeightScaling.
+   */
+  static constexpr double MinimumTimeStepSizeWeightScaling = 0.5;
+
+  /**
+   * Factor _timeStepSizeWeightScaling is multiplied with
+   * after a violation of the stability condition.
+   */
+  static constexpr double TimeStepSizeWeightScalingDecrease = 0.9;
+
+  /**
+   * Fraction of the distance to 1 _timeStepSizeWeightScaling
+   * recovers per stable time step.
+   */
+  static constexpr double TimeStepSizeWeightScalingRelaxation = 0.05;
+
+  /**
+   * Learns from the violation history of the stability condition,
+   * see _timeStepSizeWeightScaling.
+   */
+  void updateTimeStepSizeWeight(bool stabilityConditionWasViolated);
+
+  /**
+   * \return the weight the fused time stepping multiplies the
+   * admissible time step size with. This is the user's weight scaled by
+   * the factor learned from the history of violations.
+   */
+  double getTimeStepSizeWeight() const;
+
   void initSolver(
       const double timeStamp,
       const tarch::la::Vector<DIMENSIONS,double>& domainOffset,
@@ -1705,6 +1927,14 @@ public:
    * \todo We will not store the update field anymore
    * but a previous solution. We will thus only perform
    * a solution adjustment and adding of source term contributions here.
+   *
+   * <h2>Previous solution</h2>
+   * A pure ADER-DG solver never rolls back its solution.
+   * We thus do not take a snapshot of the
+   * current solution before we update it here.
+   * Its cells do not even allocate a previous solution (see holdsPreviousSolution()).
+   * The LimitingADERDGSolver invokes the variant with the
+   * additional argument instead.
    */
   void updateSolution(
       const int cellDescriptionsIndex,
@@ -1714,6 +1944,37 @@ public:
       exahype::Vertex* const fineGridVertices,
       const peano::grid::VertexEnumerator& fineGridVerticesEnumerator) override;
 
+  /**
+   * Same as above but allows to keep the current solution
+   * as previous solution.
+   *
+   * \param[in] backupPreviousSolution Copy the current solution into the
+   *                                   previous solution field before the
+   *                                   update is added. Only cells which might
+   *                                   be rolled back later on (see rollbackSolution(...)
+   *                                   and swapSolutionAndPreviousSolution(...))
+   *                                   need this snapshot. Otherwise, the content of the
+   *                                   previous solution field is stale.
+   *                                   Requires holdsPreviousSolution().
+   */
+  void updateSolution(
+      const int cellDescriptionsIndex,
+      const int element,
+      double** tempStateSizedArrays,
+      double** tempUnknowns,
+      exahype::Vertex* const fineGridVertices,
+      const peano::grid::VertexEnumerator& fineGridVerticesEnumerator,
+      const bool backupPreviousSolution);
+
+  /**
+   * Accumulates the solution values at the Gauss-Legendre nodes
+   * weighted with the quadrature weights times the cell volume.
+   */
+  void reduceInSitu(
+      const int cellDescriptionsIndex,
+      const int element,
+      plotters::ascii::InSituReductions::Accumulator& accumulator) const override;
+
   /**
    * Rolls back the solver's solution on the
    * particular cell description.
@@ -1861,6 +2122,17 @@ public:
       const tarch::la::Vector<DIMENSIONS, double>& x,
       const int                                    level);
 
+  /**
+   * Flags the Ancestors (with a parent) and Descendants
+   * at address \p cellDescriptionsIndex to hold data for the
+   * master-worker communication and allocates this data.
+   * Has to be called before the cell descriptions are sent
+   * away due to a fork or join.
+   *
+   * \see sendCellDescriptions
+   */
+  static void prepareCellDescriptionsForSending(const int cellDescriptionsIndex);
+
   /**
    * Erase all cell descriptions of type \p Cell.
    *
@@ -1895,10 +2167,8 @@ public:
    * the back of the array at address \p cellDescriptions
    * Index.
    *
-   * This operation is intended to be used in combination
-   * with the solver method mergeWithWorkerOrMasterDataDueToForkOrJoin(...).
-   * Here, we would merge first the cell descriptions sent by the master and worker
-   * and then merge the data that is sent out right after.
+   * Forks and joins do not use this operation. They send the cell descriptions
+   * and the solution in a single message, see PackedCellMigration.
    */
   static void mergeCellDescriptionsWithRemoteData(
       const int                                    fromRank,
@@ -1907,6 +2177,20 @@ public:
       const tarch::la::Vector<DIMENSIONS, double>& x,
       const int                                    level);
 
+  /**
+   * Merges the cell descriptions \p receivedCellDescriptions
+   * into the cell descriptions of \p localCell as described for
+   * mergeCellDescriptionsWithRemoteData. The received cell descriptions
+   * are modified, i.e. their heap indices are reset.
+   *
+   * Takes the heap semaphore itself.
+   */
+  static void mergeCellDescriptionsWithReceivedData(
+      Heap::HeapEntries&                           receivedCellDescriptions,
+      exahype::Cell&                               localCell,
+      const tarch::la::Vector<DIMENSIONS, double>& x,
+      const int                                    level);
+
   /**
    * Drop cell descriptions received from \p fromRank.
    */
@@ -1969,35 +2253,6 @@ public:
       const tarch::la::Vector<DIMENSIONS, double>& x,
       const int                                    level) override;
 
-  ///////////////////////////////////
-  // FORK OR JOIN
-  ///////////////////////////////////
-
-  void sendDataToWorkerOrMasterDueToForkOrJoin(
-      const int                                    toRank,
-      const int                                    cellDescriptionsIndex,
-      const int                                    element,
-      const tarch::la::Vector<DIMENSIONS, double>& x,
-      const int                                    level) override;
-
-  void sendEmptyDataToWorkerOrMasterDueToForkOrJoin(
-      const int                                    toRank,
-      const tarch::la::Vector<DIMENSIONS, double>& x,
-      const int                                    level) override;
-
-  void mergeWithWorkerOrMasterDataDueToForkOrJoin(
-      const int                                    fromRank,
-      const int                                    cellDescriptionsIndex,
-      const int                                    element,
-      const tarch::la::Vector<DIMENSIONS, double>& x,
-      const int                                    level) override;
-
-  void dropWorkerOrMasterDataDueToForkOrJoin(
-      const int                                     fromRank,
-      const tarch::la::Vector<DIMENSIONS, double>&  x,
-      const int                                     level) override;
-
-
   ///////////////////////////////////
   // WORKER->MASTER
   ///////////////////////////////////
@@ -2036,6 +2291,10 @@ public:
       const tarch::la::Vector<DIMENSIONS, double>& x,
       const int                                    level) override;
 
+  DataHeap::HeapEntries compileTimeStepDataForGlobalReduction() const override;
+
+  void mergeWithGloballyReducedTimeStepData(const DataHeap::HeapEntries& message) override;
+
   void sendDataToMaster(
       const int                                    masterRank,
       const int                                    cellDescriptionsIndex,
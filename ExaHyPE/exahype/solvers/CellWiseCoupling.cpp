@@ -2,5 +2,13 @@
 
 
 exahype::solvers::CellWiseCoupling::CellWiseCoupling(double time, double repeat):
-  SolverCoupling( SolverCoupling::Type::CellWise, time, repeat) {
+  SolverCoupling( SolverCoupling::Type::CellWise, time, repeat),
+  _hasBeenActive(false) {
+}
+
+
+bool exahype::solvers::CellWiseCoupling::isActiveFirstTime() {
+  const bool result = !_hasBeenActive;
+  _hasBeenActive = true;
+  return result;
 }
@@ -35,13 +35,31 @@ namespace exahype {
 }
 
 class exahype::solvers::CellWiseCoupling: public exahype::solvers::SolverCoupling {
+  private:
+    /**
+     * Flag indicating that the coupling has already been active
+     * in an earlier time step.
+     */
+    bool _hasBeenActive;
+
   public:
     CellWiseCoupling(double time, double repeat);
     virtual ~CellWiseCoupling() {};
 
     /**
-     * Couple the solvers before performing the
-     * first time step.
+     * Identifies whether the coupling becomes active for the first time
+     * and, if this is the case, remembers that it has been active.
+     *
+     * Call it only for time steps in which isActive(...) holds.
+     */
+    bool isActiveFirstTime();
+
+    /**
+     * Couple the solvers in the first time step
+     * in which the coupling is active.
+     *
+     * Invoked by mappings::SolutionUpdate::enterCell(...) instead of
+     * couple(...). Same arguments and restrictions as couple(...).
      */
     virtual void coupleFirstTime(
         const int cellDescriptionsIndex,
@@ -50,6 +68,16 @@ class exahype::solvers::CellWiseCoupling: public exahype::solvers::SolverCouplin
 
     /**
      * Couple the solvers in the following iterations.
+     *
+     * Invoked by mappings::SolutionUpdate::enterCell(...) for every
+     * cell in time steps where the coupling is active, right after all
+     * solvers have updated their solution in the cell. The
+     * ADER-DG and finite volumes cell descriptions of all solvers of the
+     * cell are found at \p cellDescriptionsIndex in ADERDGSolver::Heap
+     * and FiniteVolumesSolver::Heap, respectively.
+     *
+     * \note Cells are processed concurrently. An implementation
+     * may only modify the data of the cell at \p cellDescriptionsIndex.
      */
     virtual void couple(
         const int cellDescriptionsIndex,
@@ -23,9 +23,13 @@
 
 #include "peano/utils/Loop.h"
 
+#include "tarch/la/ScalarOperations.h"
+#include "tarch/la/VectorOperations.h"
+
 #include "tarch/multicore/Lock.h"
 
 #include "exahype/amr/AdaptiveMeshRefinement.h"
+#include "exahype/solvers/LimitingADERDGSolver.h"
 
 
 namespace {
@@ -52,7 +56,8 @@ exahype::solvers::FiniteVolumesSolver::FiniteVolumesSolver(
             _dataPerPatch( (numberOfVariables+numberOfParameters) * power(nodesPerCoordinateAxis, DIMENSIONS + 0) ),
             _ghostDataPerPatch( (numberOfVariables+numberOfParameters) * power(nodesPerCoordinateAxis+2*ghostLayerWidth, DIMENSIONS + 0) - _dataPerPatch ),
             _dataPerPatchFace( _ghostLayerWidth*(numberOfVariables+numberOfParameters)*power(nodesPerCoordinateAxis, DIMENSIONS - 1) ),
-            _dataPerPatchBoundary( DIMENSIONS_TIMES_TWO *_dataPerPatchFace) {
+            _dataPerPatchBoundary( DIMENSIONS_TIMES_TWO *_dataPerPatchFace),
+            _heapEntryPool(identifier,_heapSemaphore) {
   assertion3(_dataPerPatch > 0, numberOfVariables, numberOfParameters,
              nodesPerCoordinateAxis);
   // register tags with profiler
@@ -345,13 +350,12 @@ void exahype::solvers::FiniteVolumesSolver::ensureNoUnnecessaryMemoryIsAllocated
     switch (cellDescription.getType()) {
       case CellDescription::Erased: {
         waitUntilAllBackgroundTasksHaveTerminated();
-        tarch::multicore::Lock lock(_heapSemaphore);
 
         assertion(DataHeap::getInstance().isValidIndex(cellDescription.getSolution()));
         assertion(DataHeap::getInstance().isValidIndex(cellDescription.getPreviousSolution()));
 
-        DataHeap::getInstance().deleteData(cellDescription.getSolution());
-        DataHeap::getInstance().deleteData(cellDescription.getPreviousSolution());
+        _heapEntryPool.release(cellDescription.getSolution());
+        _heapEntryPool.release(cellDescription.getPreviousSolution());
 
         cellDescription.setSolution(-1);
         cellDescription.setPreviousSolution(-1);
@@ -375,10 +379,9 @@ void exahype::solvers::FiniteVolumesSolver::ensureNecessaryMemoryIsAllocated(Cel
         const int size = _dataPerPatch+_ghostDataPerPatch;
 
         waitUntilAllBackgroundTasksHaveTerminated();
-        tarch::multicore::Lock lock(_heapSemaphore);
 
-        cellDescription.setSolution(DataHeap::getInstance().createData(size, size, DataHeap::Allocation::DoNotUseAnyRecycledEntry));
-        cellDescription.setPreviousSolution(DataHeap::getInstance().createData(size, size, DataHeap::Allocation::DoNotUseAnyRecycledEntry));
+        cellDescription.setSolution(_heapEntryPool.acquire(size));
+        cellDescription.setPreviousSolution(_heapEntryPool.acquire(size));
       }
       break;
     case CellDescription::Erased:
@@ -582,6 +585,39 @@ void exahype::solvers::FiniteVolumesSolver::updateSolution(
 }
 
 
+void exahype::solvers::FiniteVolumesSolver::reduceInSitu(
+    const int cellDescriptionsIndex,
+    const int element,
+    plotters::ascii::InSituReductions::Accumulator& accumulator) const {
+  const plotters::ascii::InSituReductions* inSituReductions = getInSituReductions();
+  assertion(inSituReductions!=nullptr);
+  reduceInSitu(*inSituReductions,cellDescriptionsIndex,element,accumulator);
+}
+
+void exahype::solvers::FiniteVolumesSolver::reduceInSitu(
+    const plotters::ascii::InSituReductions&        inSituReductions,
+    const int                                       cellDescriptionsIndex,
+    const int                                       element,
+    plotters::ascii::InSituReductions::Accumulator& accumulator) const {
+  CellDescription& cellDescription = getCellDescription(cellDescriptionsIndex,element);
+
+  if (cellDescription.getType()==CellDescription::Cell) {
+    const double* const solution = DataHeap::getInstance().getData(cellDescription.getSolution()).data();
+    const int dataPerSubcell     = _numberOfVariables+_numberOfParameters;
+    const double subcellVolume   =
+        tarch::la::volume(cellDescription.getSize()) / tarch::la::aPowI(DIMENSIONS,_nodesPerCoordinateAxis);
+
+    dfor(i,_nodesPerCoordinateAxis) {
+      const int subcell = peano::utils::dLinearisedWithoutLookup(
+          i+_ghostLayerWidth,_nodesPerCoordinateAxis+2*_ghostLayerWidth); // !!! Be aware of the "2*_ghostLayerWidth" !!!
+      inSituReductions.accumulate(accumulator,solution+subcell*dataPerSubcell,subcellVolume);
+    }
+
+    inSituReductions.accumulateTimeStamp(accumulator,
+        cellDescription.getTimeStamp()+cellDescription.getTimeStepSize());
+  }
+}
+
 void exahype::solvers::FiniteVolumesSolver::rollbackSolution(
     const int cellDescriptionsIndex,
     const int element,
@@ -748,7 +784,6 @@ void exahype::solvers::FiniteVolumesSolver::prepareNextNeighbourMerging(
 
 #ifdef Parallel
 const int exahype::solvers::FiniteVolumesSolver::DataMessagesPerNeighbourCommunication    = 1;
-const int exahype::solvers::FiniteVolumesSolver::DataMessagesPerForkOrJoinCommunication   = 1;
 const int exahype::solvers::FiniteVolumesSolver::DataMessagesPerMasterWorkerCommunication = 1;
 
 void exahype::solvers::FiniteVolumesSolver::sendCellDescriptions(
@@ -804,92 +839,118 @@ void exahype::solvers::FiniteVolumesSolver::mergeCellDescriptionsWithRemoteData(
     const peano::heap::MessageType&               messageType,
     const tarch::la::Vector<DIMENSIONS, double>&  x,
     const int                                     level) {
-  waitUntilAllBackgroundTasksHaveTerminated();
-  tarch::multicore::Lock lock(_heapSemaphore);
-
   logDebug("mergeCellDescriptionsWithRemoteData(...)","[pre] receive for cell ("
         "offset="<< x.toString() <<
         "level="<< level << ")");
 
-  const int receivedCellDescriptionsIndex =
-      Heap::getInstance().createData(0,exahype::solvers::RegisteredSolvers.size());
-  Heap::getInstance().receiveData(
-      receivedCellDescriptionsIndex,fromRank,x,level,messageType);
+  tarch::multicore::Lock lock(_heapSemaphore);
+  Heap::HeapEntries receivedCellDescriptions =
+      Heap::getInstance().receiveData(fromRank,x,level,messageType);
+  lock.free();
 
   logDebug("mergeCellDescriptionsWithRemoteData(...)","received " <<
-      Heap::getInstance().getData(receivedCellDescriptionsIndex).size() <<
+      receivedCellDescriptions.size() <<
       " cell descriptions for cell ("
       "offset="<< x.toString() <<
       "level="<< level << ")");
 
-  if (Heap::getInstance().getData(receivedCellDescriptionsIndex).size()>0) {
-    // TODO(Dominic): We reset the parent and heap indices of a received cell
-    // to -1 and RemoteAdjacencyIndex, respectively.
-    // If we receive parent and children cells during a fork event,
-    //
-    // We use the information of a parentIndex of a fine grid cell description
-    // set to RemoteAdjacencyIndex to update the parent index with
-    // the index of the coarse grid cell description in enterCell(..).
-    resetDataHeapIndices(receivedCellDescriptionsIndex,
-        multiscalelinkedcell::HangingVertexBookkeeper::RemoteAdjacencyIndex);
-
-    if (!localCell.isInitialised()) {
-      localCell.setupMetaData();
-    }
-    assertion1(Heap::getInstance().isValidIndex(localCell.getCellDescriptionsIndex()),
-        localCell.getCellDescriptionsIndex());
-    Heap::getInstance().getData(localCell.getCellDescriptionsIndex()).reserve(
-        std::max(Heap::getInstance().getData(localCell.getCellDescriptionsIndex()).size(),
-            Heap::getInstance().getData(receivedCellDescriptionsIndex).size()));
-
-    for (auto& pReceived : Heap::getInstance().getData(receivedCellDescriptionsIndex)) {
-      logDebug("mergeCellDescriptionsWithRemoteData(...)","Received " <<
-          " cell description for cell ("
-          "offset="<< x.toString() <<
-          ",level="<< level <<
-          ",isRoot="<< localCell.isRoot() <<
-          ",isAssignedToRemoteRank="<< localCell.isAssignedToRemoteRank() <<
-          ") with type="<< pReceived.getType());
-
-      bool found = false;
-      for (auto& pLocal : Heap::getInstance().getData(localCell.getCellDescriptionsIndex())) {
-        if (pReceived.getSolverNumber()==pLocal.getSolverNumber()) {
-          found = true;
-
-          assertion(pReceived.getType()==pLocal.getType());
-          if (pLocal.getType()==CellDescription::Type::Cell
-//              || // TODO(Dominic)
-//              pLocal.getType()==CellDescription::Type::EmptyAncestor ||
-//              pLocal.getType()==CellDescription::Type::Ancestor ||
-//              pLocal.getType()==CellDescription::Type::Descendant
-          ) {
-            assertionNumericalEquals2(pLocal.getTimeStamp(),pReceived.getTimeStamp(),
-                pLocal.toString(),pReceived.toString());
-            assertionNumericalEquals2(pLocal.getTimeStepSize(),pReceived.getTimeStepSize(),
-                pLocal.toString(),pReceived.toString());
-          }
+  mergeCellDescriptionsWithReceivedData(receivedCellDescriptions,localCell,x,level);
+}
+
+void exahype::solvers::FiniteVolumesSolver::mergeCellDescriptionsWithReceivedData(
+    Heap::HeapEntries&                            receivedCellDescriptions,
+    exahype::Cell&                                localCell,
+    const tarch::la::Vector<DIMENSIONS, double>&  x,
+    const int                                     level) {
+  if (receivedCellDescriptions.empty()) {
+    return;
+  }
+
+  // TODO(Dominic): We reset the parent and heap indices of a received cell
+  // to -1 and RemoteAdjacencyIndex, respectively.
+  // If we receive parent and children cells during a fork event,
+  //
+  // We use the information of a parentIndex of a fine grid cell description
+  // set to RemoteAdjacencyIndex to update the parent index with
+  // the index of the coarse grid cell description in enterCell(..).
+  resetDataHeapIndices(receivedCellDescriptions,
+      multiscalelinkedcell::HangingVertexBookkeeper::RemoteAdjacencyIndex);
+
+  waitUntilAllBackgroundTasksHaveTerminated();
+  tarch::multicore::Lock lock(_heapSemaphore);
+
+  if (!localCell.isInitialised()) {
+    localCell.setupMetaData();
+  }
+  assertion1(Heap::getInstance().isValidIndex(localCell.getCellDescriptionsIndex()),
+      localCell.getCellDescriptionsIndex());
+  Heap::getInstance().getData(localCell.getCellDescriptionsIndex()).reserve(
+      std::max(Heap::getInstance().getData(localCell.getCellDescriptionsIndex()).size(),
+          receivedCellDescriptions.size()));
+
+  for (auto& pReceived : receivedCellDescriptions) {
+    logDebug("mergeCellDescriptionsWithReceivedData(...)","Received " <<
+        " cell description for cell ("
+        "offset="<< x.toString() <<
+        ",level="<< level <<
+        ",isRoot="<< localCell.isRoot() <<
+        ",isAssignedToRemoteRank="<< localCell.isAssignedToRemoteRank() <<
+        ") with type="<< pReceived.getType());
+
+    bool found = false;
+    for (auto& pLocal : Heap::getInstance().getData(localCell.getCellDescriptionsIndex())) {
+      if (pReceived.getSolverNumber()==pLocal.getSolverNumber()) {
+        found = true;
+
+        assertion(pReceived.getType()==pLocal.getType());
+        if (pLocal.getType()==CellDescription::Type::Cell
+//            || // TODO(Dominic)
+//            pLocal.getType()==CellDescription::Type::EmptyAncestor ||
+//            pLocal.getType()==CellDescription::Type::Ancestor ||
+//            pLocal.getType()==CellDescription::Type::Descendant
+        ) {
+          assertionNumericalEquals2(pLocal.getTimeStamp(),pReceived.getTimeStamp(),
+              pLocal.toString(),pReceived.toString());
+          assertionNumericalEquals2(pLocal.getTimeStepSize(),pReceived.getTimeStepSize(),
+              pLocal.toString(),pReceived.toString());
         }
       }
+    }
 
-      if (!found) {
-        FiniteVolumesSolver* solver =
-            static_cast<FiniteVolumesSolver*>(RegisteredSolvers[pReceived.getSolverNumber()]);
-
-        solver->ensureNecessaryMemoryIsAllocated(pReceived);
-        Heap::getInstance().getData(localCell.getCellDescriptionsIndex()).
-            push_back(pReceived);
+    if (!found) {
+      // The heap entry pool takes the heap semaphore itself if it has to create new entries.
+      lock.free();
+      auto* solver = RegisteredSolvers[pReceived.getSolverNumber()];
+
+      switch (solver->getType()) {
+        case exahype::solvers::Solver::Type::FiniteVolumes:
+          static_cast<FiniteVolumesSolver*>(solver)->ensureNecessaryMemoryIsAllocated(pReceived);
+          break;
+        case exahype::solvers::Solver::Type::LimitingADERDG:
+          static_cast<LimitingADERDGSolver*>(solver)->getLimiter()->ensureNecessaryMemoryIsAllocated(pReceived);
+          break;
+        case exahype::solvers::Solver::Type::ADERDG:
+          assertionMsg(false,"Solver type not supported!");
+          break;
       }
+      lock.lock();
+
+      Heap::getInstance().getData(localCell.getCellDescriptionsIndex()).
+          push_back(pReceived);
     }
   }
-
-  Heap::getInstance().deleteData(receivedCellDescriptionsIndex);
-  assertion(!Heap::getInstance().isValidIndex(receivedCellDescriptionsIndex));
 }
 
 void exahype::solvers::FiniteVolumesSolver::resetDataHeapIndices(
     const int cellDescriptionsIndex,
     const int parentIndex) {
-  for (auto& p : Heap::getInstance().getData(cellDescriptionsIndex)) {
+  resetDataHeapIndices(Heap::getInstance().getData(cellDescriptionsIndex),parentIndex);
+}
+
+void exahype::solvers::FiniteVolumesSolver::resetDataHeapIndices(
+    Heap::HeapEntries& cellDescriptions,
+    const int          parentIndex) {
+  for (auto& p : cellDescriptions) {
     p.setParentIndex(parentIndex);
 
     // Default field data indices
@@ -942,79 +1003,6 @@ void exahype::solvers::FiniteVolumesSolver::mergeWithMasterWorkerMetadata(
   // do nothing
 }
 
-///////////////////////////////////
-// FORK OR JOIN
-///////////////////////////////////
-
-void exahype::solvers::FiniteVolumesSolver::sendDataToWorkerOrMasterDueToForkOrJoin(
-    const int                                     toRank,
-    const int                                     cellDescriptionsIndex,
-    const int                                     element,
-    const tarch::la::Vector<DIMENSIONS, double>&  x,
-    const int                                     level) {
-  assertion1(Heap::getInstance().isValidIndex(cellDescriptionsIndex),cellDescriptionsIndex);
-  assertion1(element>=0,element);
-  assertion2(static_cast<unsigned int>(element)<Heap::getInstance().getData(cellDescriptionsIndex).size(),
-      element,Heap::getInstance().getData(cellDescriptionsIndex).size());
-
-  CellDescription& p = Heap::getInstance().getData(cellDescriptionsIndex)[element];
-
-  if (p.getType()==CellDescription::Cell) {
-    double* solution = DataHeap::getInstance().getData(p.getSolution()).data();
-
-    logDebug("sendDataToWorkerOrMasterDueToForkOrJoin(...)","solution of solver " << p.getSolverNumber() << " sent to rank "<<toRank<<
-        ", cell: "<< x << ", level: " << level);
-
-    DataHeap::getInstance().sendData(
-        solution, getUnknownsPerPatch()+getGhostValuesPerPatch(), toRank, x, level,
-        peano::heap::MessageType::ForkOrJoinCommunication);
-  }
-}
-
-
-void exahype::solvers::FiniteVolumesSolver::sendEmptyDataToWorkerOrMasterDueToForkOrJoin(
-    const int                                     toRank,
-    const tarch::la::Vector<DIMENSIONS, double>&  x,
-    const int                                     level) {
-  std::vector<double> emptyMessage(0);
-  for(int sends=0; sends<DataMessagesPerForkOrJoinCommunication; ++sends)
-    DataHeap::getInstance().sendData(
-        emptyMessage, toRank, x, level,
-        peano::heap::MessageType::ForkOrJoinCommunication);
-}
-
-
-void exahype::solvers::FiniteVolumesSolver::mergeWithWorkerOrMasterDataDueToForkOrJoin(
-    const int                                     fromRank,
-    const int                                     cellDescriptionsIndex,
-    const int                                     element,
-    const tarch::la::Vector<DIMENSIONS, double>&  x,
-    const int                                     level) {
-  auto& cellDescription = getCellDescription(cellDescriptionsIndex,element);
-  assertion4(tarch::la::equals(x,cellDescription.getOffset()+0.5*cellDescription.getSize()),x,cellDescription.getOffset()+0.5*cellDescription.getSize(),level,cellDescription.getLevel());
-  assertion2(cellDescription.getLevel()==level,cellDescription.getLevel(),level);
-
-  if (cellDescription.getType()==CellDescription::Cell) {
-    logDebug("mergeWithRemoteDataDueToForkOrJoin(...)","[solution] receive from rank "<<fromRank<<
-             ", cell: "<< x << ", level: " << level);
-
-    DataHeap::getInstance().getData(cellDescription.getSolution()).clear();
-    DataHeap::getInstance().receiveData(
-        cellDescription.getSolution(),fromRank,x,level,
-        peano::heap::MessageType::ForkOrJoinCommunication);
-  }
-}
-
-void exahype::solvers::FiniteVolumesSolver::dropWorkerOrMasterDataDueToForkOrJoin(
-    const int                                     fromRank,
-    const tarch::la::Vector<DIMENSIONS, double>&  x,
-    const int                                     level) {
-  for(int receives=0; receives<DataMessagesPerForkOrJoinCommunication; ++receives)
-    DataHeap::getInstance().receiveData(
-        fromRank, x, level,
-        peano::heap::MessageType::ForkOrJoinCommunication);
-}
-
 ///////////////////////////////////
 // NEIGHBOUR
 ///////////////////////////////////
@@ -1330,6 +1318,27 @@ void exahype::solvers::FiniteVolumesSolver::mergeWithWorkerData(
   }
 }
 
+exahype::DataHeap::HeapEntries
+exahype::solvers::FiniteVolumesSolver::compileTimeStepDataForGlobalReduction() const {
+  DataHeap::HeapEntries message(0,4);
+  message.push_back(_minNextTimeStepSize);
+  message.push_back(_nextMinCellSize);
+  message.push_back(-_nextMaxCellSize);
+  message.push_back(_nextMeshUpdateRequest ? -1.0 : 1.0);
+  return message;
+}
+
+void exahype::solvers::FiniteVolumesSolver::mergeWithGloballyReducedTimeStepData(const DataHeap::HeapEntries& message) {
+  assertion1(message.size()==4,message.size());
+  assertion1(std::isfinite(message[0]),message[0]);
+
+  int index=0;
+  _minNextTimeStepSize   = message[index++];
+  _nextMinCellSize       = message[index++];
+  _nextMaxCellSize       = -message[index++];
+  _nextMeshUpdateRequest = (message[index++] < 0.0) ? true : false;
+}
+
 void exahype::solvers::FiniteVolumesSolver::sendEmptyDataToMaster(
     const int                                     masterRank,
     const tarch::la::Vector<DIMENSIONS, double>&  x,
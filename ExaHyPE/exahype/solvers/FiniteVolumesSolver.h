@@ -18,6 +18,7 @@
 
 
 #include "exahype/solvers/Solver.h"
+#include "exahype/solvers/HeapEntryPool.h"
 #include "exahype/solvers/UserSolverInterface.h"
 
 #include "exahype/records/FiniteVolumesCellDescription.h"
@@ -107,6 +108,13 @@ private:
    */
   int _dataPerPatchBoundary;
 
+  /**
+   * Recycles the heap entries of erased patches. This is
+   * in particular relevant for the limiter patches of the
+   * LimitingADERDGSolver which follow the troubled cells.
+   */
+  HeapEntryPool _heapEntryPool;
+
   /**
    * Synchonises the cell description time stamps
    * and time step sizes with the solver ones
@@ -122,12 +130,6 @@ private:
    * method.
    */
   static const int DataMessagesPerNeighbourCommunication;
-  /**
-   * Data messages per fork/join communication.
-   * This information is required by the sendEmpty...(...)
-   * method.
-   */
-  static const int DataMessagesPerForkOrJoinCommunication;
   /**
    * Data messages per master worker communication.
    * This information is required by the sendEmpty...(...)
@@ -147,6 +149,14 @@ private:
       const int cellDescriptionsIndex,
       const int parentIndex);
 
+  /**
+   * Same as above for cell descriptions which are not (yet)
+   * stored on the heap, e.g. because they were just received.
+   */
+  static void resetDataHeapIndices(
+      Heap::HeapEntries& cellDescriptions,
+      const int          parentIndex);
+
   /**
    * Checks if the parent index of a fine grid cell description
    * was set to RemoteAdjacencyIndex during a previous forking event.
@@ -523,6 +533,8 @@ public:
   /**
    * Checks if no unnecessary memory is allocated for the cell description.
    * If this is not the case, it deallocates the unnecessarily allocated memory.
+   *
+   * The arrays are handed back to the solver's HeapEntryPool.
    */
   void ensureNoUnnecessaryMemoryIsAllocated(CellDescription& cellDescription);
 
@@ -530,6 +542,8 @@ public:
    * Checks if all the necessary memory is allocated for the cell description.
    * If this is not the case, it allocates the necessary
    * memory for the cell description.
+   *
+   * The arrays are taken from the solver's HeapEntryPool.
    */
   void ensureNecessaryMemoryIsAllocated(CellDescription& cellDescription);
 
@@ -620,6 +634,26 @@ public:
       exahype::Vertex* const fineGridVertices,
       const peano::grid::VertexEnumerator& fineGridVerticesEnumerator) override;
 
+  /**
+   * Accumulates the subcell averages of the patch (without
+   * ghost layers) weighted with the subcell volume.
+   */
+  void reduceInSitu(
+      const int cellDescriptionsIndex,
+      const int element,
+      plotters::ascii::InSituReductions::Accumulator& accumulator) const override;
+
+  /**
+   * Same as reduceInSitu(...) but evaluates the reductions \p inSituReductions
+   * declared by another solver. The LimitingADERDGSolver uses this
+   * to reduce the limiter solution in troubled cells.
+   */
+  void reduceInSitu(
+      const plotters::ascii::InSituReductions&        inSituReductions,
+      const int                                       cellDescriptionsIndex,
+      const int                                       element,
+      plotters::ascii::InSituReductions::Accumulator& accumulator) const;
+
   /**
    * Rolls back the solver's solution on the
    * particular cell description.
@@ -773,10 +807,8 @@ public:
    * the back of the array at address \p cellDescriptions
    * Index.
    *
-   * This operation is intended to be used in combination
-   * with the solver method mergeWithWorkerOrMasterDataDueToForkOrJoin(...).
-   * Here, we would merge first the cell descriptions sent by the master and worker
-   * and then merge the data that is sent out right after.
+   * Forks and joins do not use this operation. They send the cell descriptions
+   * and the solution in a single message, see PackedCellMigration.
    */
   static void mergeCellDescriptionsWithRemoteData(
       const int                                     fromRank,
@@ -785,6 +817,20 @@ public:
       const tarch::la::Vector<DIMENSIONS, double>&  x,
       const int                                     level);
 
+  /**
+   * Merges the cell descriptions \p receivedCellDescriptions
+   * into the cell descriptions of \p localCell as described for
+   * mergeCellDescriptionsWithRemoteData. The received cell descriptions
+   * are modified, i.e. their heap indices are reset.
+   *
+   * Takes the heap semaphore itself.
+   */
+  static void mergeCellDescriptionsWithReceivedData(
+      Heap::HeapEntries&                            receivedCellDescriptions,
+      exahype::Cell&                                localCell,
+      const tarch::la::Vector<DIMENSIONS, double>&  x,
+      const int                                     level);
+
   /**
    * Drop cell descriptions received from \p fromRank.
    */
@@ -848,30 +894,6 @@ public:
       const tarch::la::Vector<DIMENSIONS, double>&  x,
       const int                                     level) override;
 
-  void sendDataToWorkerOrMasterDueToForkOrJoin(
-      const int                                     toRank,
-      const int                                     cellDescriptionsIndex,
-      const int                                     element,
-      const tarch::la::Vector<DIMENSIONS, double>&  x,
-      const int                                     level) override;
-
-  void sendEmptyDataToWorkerOrMasterDueToForkOrJoin(
-      const int                                     toRank,
-      const tarch::la::Vector<DIMENSIONS, double>&  x,
-      const int                                     level) override;
-
-  void mergeWithWorkerOrMasterDataDueToForkOrJoin(
-      const int                                     fromRank,
-      const int                                     cellDescriptionsIndex,
-      const int                                     element,
-      const tarch::la::Vector<DIMENSIONS, double>&  x,
-      const int                                     level) override;
-
-  void dropWorkerOrMasterDataDueToForkOrJoin(
-      const int                                     fromRank,
-      const tarch::la::Vector<DIMENSIONS, double>&  x,
-      const int                                     level) override;
-
   ///////////////////////////////////
   // WORKER->MASTER
   ///////////////////////////////////
@@ -889,6 +911,10 @@ public:
       const tarch::la::Vector<DIMENSIONS, double>& x,
       const int                                    level) override;
 
+  DataHeap::HeapEntries compileTimeStepDataForGlobalReduction() const override;
+
+  void mergeWithGloballyReducedTimeStepData(const DataHeap::HeapEntries& message) override;
+
   void sendDataToMaster(
       const int                                     masterRank,
       const int                                     cellDescriptionsIndex,
@@ -0,0 +1,188 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/solvers/HeapEntryPool.h"
+
+#include <algorithm>
+
+#include "tarch/Assertions.h"
+#include "tarch/multicore/Lock.h"
+
+tarch::logging::Log exahype::solvers::HeapEntryPool::_log("exahype::solvers::HeapEntryPool");
+
+std::vector<exahype::solvers::HeapEntryPool*> exahype::solvers::HeapEntryPool::Pools;
+
+tarch::multicore::BooleanSemaphore exahype::solvers::HeapEntryPool::PoolsSemaphore;
+
+int exahype::solvers::HeapEntryPool::NumberOfCreatedPools = 0;
+
+constexpr int exahype::solvers::HeapEntryPool::MaximumNumberOfThreadLocalEntriesPerSize;
+
+exahype::solvers::HeapEntryPool::ThreadLocalFreeLists::~ThreadLocalFreeLists() {
+  tarch::multicore::Lock lock(PoolsSemaphore);
+  for (auto* pool : Pools) {
+    auto freeLists = freeListsOfPools.find(pool->_poolNumber);
+    if (freeLists!=freeListsOfPools.end()) {
+      pool->spillAll(freeLists->second);
+      pool->_threadLocalFreeLists.erase(
+          std::remove(pool->_threadLocalFreeLists.begin(),pool->_threadLocalFreeLists.end(),&freeLists->second),
+          pool->_threadLocalFreeLists.end());
+    }
+  }
+}
+
+exahype::solvers::HeapEntryPool::FreeLists& exahype::solvers::HeapEntryPool::getThreadLocalFreeLists() {
+  static thread_local ThreadLocalFreeLists threadLocalFreeLists;
+  auto freeLists = threadLocalFreeLists.freeListsOfPools.find(_poolNumber);
+  if (freeLists==threadLocalFreeLists.freeListsOfPools.end()) {
+    freeLists = threadLocalFreeLists.freeListsOfPools.insert(std::make_pair(_poolNumber,FreeLists())).first;
+
+    tarch::multicore::Lock lock(PoolsSemaphore);
+    _threadLocalFreeLists.push_back(&freeLists->second);
+  }
+  return freeLists->second;
+}
+
+exahype::solvers::HeapEntryPool::HeapEntryPool(
+    const std::string& identifier,
+    tarch::multicore::BooleanSemaphore& heapSemaphore):
+  _identifier(identifier),
+  _poolNumber(NumberOfCreatedPools++),
+  _heapSemaphore(heapSemaphore),
+  _numberOfAcquisitions(0),
+  _numberOfHits(0),
+  _liveBytes(0),
+  _peakLiveBytes(0),
+  _allocatedBytes(0) {
+  tarch::multicore::Lock lock(PoolsSemaphore);
+  Pools.push_back(this);
+}
+
+exahype::solvers::HeapEntryPool::~HeapEntryPool() {
+  tarch::multicore::Lock lock(PoolsSemaphore);
+  Pools.erase(std::remove(Pools.begin(),Pools.end(),this),Pools.end());
+  for (auto* freeLists : _threadLocalFreeLists) {
+    spillAll(*freeLists);
+  }
+  _threadLocalFreeLists.clear();
+  lock.free();
+
+  tarch::multicore::Lock heapLock(_heapSemaphore);
+  for (auto& sharedFreeList : _sharedFreeLists) {
+    for (const int heapIndex : sharedFreeList.second) {
+      DataHeap::getInstance().deleteData(heapIndex);
+    }
+  }
+  _sharedFreeLists.clear();
+}
+
+void exahype::solvers::HeapEntryPool::updateLiveBytes(const long delta) {
+  const long liveBytes = (_liveBytes += delta);
+  long peakLiveBytes   = _peakLiveBytes.load();
+  while (liveBytes>peakLiveBytes &&
+         !_peakLiveBytes.compare_exchange_weak(peakLiveBytes,liveBytes)) {}
+}
+
+void exahype::solvers::HeapEntryPool::refill(std::vector<int>& localFreeList,const int size) {
+  tarch::multicore::Lock lock(_semaphore);
+  auto sharedFreeList = _sharedFreeLists.find(size);
+  if (sharedFreeList!=_sharedFreeLists.end() && !sharedFreeList->second.empty()) {
+    std::vector<int>& entries = sharedFreeList->second;
+    const int numberOfMovedEntries =
+        std::min(static_cast<int>(entries.size()),MaximumNumberOfThreadLocalEntriesPerSize/2);
+    localFreeList.insert(localFreeList.end(),entries.end()-numberOfMovedEntries,entries.end());
+    entries.resize(entries.size()-numberOfMovedEntries);
+  }
+}
+
+void exahype::solvers::HeapEntryPool::spill(std::vector<int>& localFreeList,const int size) {
+  const int numberOfKeptEntries = MaximumNumberOfThreadLocalEntriesPerSize/2;
+
+  tarch::multicore::Lock lock(_semaphore);
+  std::vector<int>& entries = _sharedFreeLists[size];
+  entries.insert(entries.end(),localFreeList.begin()+numberOfKeptEntries,localFreeList.end());
+  lock.free();
+
+  localFreeList.resize(numberOfKeptEntries);
+}
+
+void exahype::solvers::HeapEntryPool::spillAll(FreeLists& freeLists) {
+  tarch::multicore::Lock lock(_semaphore);
+  for (auto& localFreeList : freeLists) {
+    std::vector<int>& entries = _sharedFreeLists[localFreeList.first];
+    entries.insert(entries.end(),localFreeList.second.begin(),localFreeList.second.end());
+  }
+  lock.free();
+
+  freeLists.clear();
+}
+
+int exahype::solvers::HeapEntryPool::acquire(const int size) {
+  assertion1(size>0,size);
+  _numberOfAcquisitions++;
+  updateLiveBytes(static_cast<long>(size)*sizeof(double));
+
+  std::vector<int>& localFreeList = getThreadLocalFreeLists()[size];
+  if (localFreeList.empty()) {
+    refill(localFreeList,size);
+  }
+
+  if (!localFreeList.empty()) {
+    const int heapIndex = localFreeList.back();
+    localFreeList.pop_back();
+    _numberOfHits++;
+
+    auto& data = DataHeap::getInstance().getData(heapIndex);
+    assertionEquals1(data.size(),static_cast<unsigned int>(size),_identifier);
+    std::fill(data.begin(),data.end(),0.0);
+    return heapIndex;
+  }
+
+  _allocatedBytes += static_cast<long>(size)*sizeof(double);
+  // Entries released by the data compression are left to the compression.
+  tarch::multicore::Lock lock(_heapSemaphore);
+  return DataHeap::getInstance().createData(size,size,DataHeap::Allocation::DoNotUseAnyRecycledEntry);
+}
+
+void exahype::solvers::HeapEntryPool::release(const int heapIndex) {
+  assertion1(DataHeap::getInstance().isValidIndex(heapIndex),heapIndex);
+  const int size = DataHeap::getInstance().getData(heapIndex).size();
+  updateLiveBytes(-static_cast<long>(size)*sizeof(double));
+
+  std::vector<int>& localFreeList = getThreadLocalFreeLists()[size];
+  localFreeList.push_back(heapIndex);
+  if (static_cast<int>(localFreeList.size())>MaximumNumberOfThreadLocalEntriesPerSize) {
+    spill(localFreeList,size);
+  }
+}
+
+void exahype::solvers::HeapEntryPool::logStatistics() const {
+  const long   numberOfAcquisitions = _numberOfAcquisitions.load();
+  const long   numberOfHits         = _numberOfHits.load();
+  const double hitRate              = numberOfAcquisitions>0 ?
+      static_cast<double>(numberOfHits)/numberOfAcquisitions : 0.0;
+  const double MB = 1024.0*1024.0;
+
+  logInfo("logStatistics()", "heap entry pool of " << _identifier <<
+      ": acquisitions=" << numberOfAcquisitions <<
+      ", hit rate=" << hitRate <<
+      ", peak live data=" << _peakLiveBytes.load()/MB << " MB" <<
+      ", allocated=" << _allocatedBytes.load()/MB << " MB" <<
+      ", pooled=" << (_allocatedBytes.load()-_liveBytes.load())/MB << " MB");
+}
+
+void exahype::solvers::HeapEntryPool::logStatisticsOfAllPools() {
+  for (const auto* pool : Pools) {
+    pool->logStatistics();
+  }
+}
@@ -0,0 +1,209 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_SOLVERS_HEAP_ENTRY_POOL_H_
+#define _EXAHYPE_SOLVERS_HEAP_ENTRY_POOL_H_
+
+#include <atomic>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "tarch/logging/Log.h"
+#include "tarch/multicore/BooleanSemaphore.h"
+
+#include "exahype/solvers/Solver.h"
+
+namespace exahype {
+  namespace solvers {
+    class HeapEntryPool;
+  }
+  namespace tests {
+    namespace solvers {
+      class HeapEntryPoolTest;
+    }
+  }
+}
+
+/**
+ * Recycles the DataHeap entries a solver allocates for its cell descriptions.
+ *
+ * Cells change their type (Cell/Ancestor/Descendant) during mesh refinement and
+ * limiter patches are allocated and freed whenever the troubled zone moves.
+ * Each of these events used to create or delete individual DataHeap entries
+ * while holding the global Solver::_heapSemaphore. This serialised the
+ * threads and reallocated the same arrays over and over again.
+ *
+ * The pool keeps released heap entries alive and sorts them into
+ * free lists by their size. As each array kind of a solver (solution, update,
+ * boundary data, averages, ...) has a fixed size, every size class
+ * effectively belongs to one or a few array kinds of one solver.
+ *
+ * The free lists are organised in two layers:
+ *
+ * - Every thread owns a small cache per pool and size class. Acquiring and
+ *   releasing entries via this cache requires no synchronisation at all.
+ * - If a thread's cache runs empty or exceeds
+ *   MaximumNumberOfThreadLocalEntriesPerSize, it moves a batch of entries
+ *   from or to the pool's shared free list. The shared list is protected by
+ *   a semaphore owned by the pool.
+ *
+ * Only if both layers are empty, we create a new heap entry while holding
+ * the global heap semaphore.
+ *
+ * Entries handed out by the pool are zeroed like newly created heap entries.
+ * While a pool is alive, it does not return entries to the heap. Its memory
+ * footprint thus is the peak number of entries that were used at the same
+ * time plus the entries held back in the caches.
+ *
+ * Entries are given back as follows:
+ *
+ * - If a thread terminates, its caches are moved to the shared free lists of
+ *   the pools which are still alive.
+ * - If a pool is destroyed, it deletes all entries in its shared free lists
+ *   and in the caches of all threads from the DataHeap. This must not happen
+ *   while other threads still use the pool.
+ *
+ * \note Only uncompressed data is recycled via the pool. The data compression
+ * keeps using the heap's own recycling mechanism.
+ */
+class exahype::solvers::HeapEntryPool {
+  private:
+    friend class exahype::tests::solvers::HeapEntryPoolTest;
+
+    /**
+     * Maps the size of the heap entries onto a list of heap indices.
+     */
+    typedef std::map<int,std::vector<int>> FreeLists;
+
+    /**
+     * The caches of one thread for all pools, indexed by the pool number.
+     * Hands the cached entries back to the pools once the thread terminates.
+     */
+    struct ThreadLocalFreeLists {
+      /**
+       * A map as the pools hold pointers to its elements.
+       */
+      std::map<int,FreeLists> freeListsOfPools;
+      ~ThreadLocalFreeLists();
+    };
+
+    static tarch::logging::Log _log;
+
+    /**
+     * All pools which are alive. Used for the statistics and
+     * to number the pools.
+     */
+    static std::vector<HeapEntryPool*> Pools;
+
+    /**
+     * Guards Pools and the registration of the threads' caches.
+     */
+    static tarch::multicore::BooleanSemaphore PoolsSemaphore;
+
+    static int NumberOfCreatedPools;
+
+    /**
+     * @return the free lists of the calling thread for this pool.
+     * Registers them with the pool on the first call.
+     */
+    FreeLists& getThreadLocalFreeLists();
+
+    const std::string                   _identifier;
+    const int                           _poolNumber;
+
+    /**
+     * The semaphore guarding the DataHeap's index map.
+     */
+    tarch::multicore::BooleanSemaphore& _heapSemaphore;
+
+    /**
+     * Guards _sharedFreeLists.
+     */
+    tarch::multicore::BooleanSemaphore  _semaphore;
+    FreeLists                           _sharedFreeLists;
+
+    /**
+     * The caches of all threads which have used this pool.
+     * Guarded by PoolsSemaphore.
+     */
+    std::vector<FreeLists*>             _threadLocalFreeLists;
+
+    std::atomic<long> _numberOfAcquisitions;
+    std::atomic<long> _numberOfHits;
+    std::atomic<long> _liveBytes;
+    std::atomic<long> _peakLiveBytes;
+    std::atomic<long> _allocatedBytes;
+
+    /**
+     * Moves up to MaximumNumberOfThreadLocalEntriesPerSize/2 entries
+     * of size \p size from the shared free list to \p localFreeList.
+     */
+    void refill(std::vector<int>& localFreeList,const int size);
+
+    /**
+     * Moves the upper half of \p localFreeList to the shared free list.
+     */
+    void spill(std::vector<int>& localFreeList,const int size);
+
+    void updateLiveBytes(const long delta);
+
+    /**
+     * Moves all entries of \p freeLists to the shared free lists.
+     */
+    void spillAll(FreeLists& freeLists);
+
+  public:
+    /**
+     * Maximum number of entries a thread keeps in its cache per size class.
+     */
+    static constexpr int MaximumNumberOfThreadLocalEntriesPerSize = 16;
+
+    /**
+     * @param identifier    Used for the statistics only.
+     * @param heapSemaphore Semaphore that has to be held while entries are created on the DataHeap.
+     */
+    HeapEntryPool(const std::string& identifier,tarch::multicore::BooleanSemaphore& heapSemaphore);
+
+    /**
+     * Deletes all pooled entries from the DataHeap. Entries which have
+     * been acquired and not released are left to their owner.
+     */
+    ~HeapEntryPool();
+
+    HeapEntryPool(const HeapEntryPool& other) = delete;
+    HeapEntryPool& operator=(const HeapEntryPool& other) = delete;
+
+    /**
+     * @return the index of a DataHeap entry of size \p size whose values are zero.
+     */
+    int acquire(const int size);
+
+    /**
+     * Hands the DataHeap entry \p heapIndex back to the pool.
+     * The entry must not be used by the caller afterwards.
+     */
+    void release(const int heapIndex);
+
+    /**
+     * Logs the hit rate and the memory footprint of this pool.
+     */
+    void logStatistics() const;
+
+    /**
+     * Logs the statistics of all pools on this rank.
+     */
+    static void logStatisticsOfAllPools();
+};
+
+#endif
@@ -72,6 +72,19 @@ bool exahype::solvers::LimitingADERDGSolver::oneSolverRequestedGlobalRecomputati
   return false;
 }
 
+bool exahype::solvers::LimitingADERDGSolver::oneSolverHasNotFinishedLimiterStatusSpreading(){
+  for (auto* solver : exahype::solvers::RegisteredSolvers) {
+    if (solver->getType()==exahype::solvers::Solver::Type::LimitingADERDG &&
+        static_cast<exahype::solvers::LimitingADERDGSolver*>(solver)->getLimiterDomainChange()
+        !=exahype::solvers::LimiterDomainChange::Regular &&
+        !solver->getAttainedStableState()
+    ) {
+      return true;
+    }
+  }
+  return false;
+}
+
 bool exahype::solvers::LimitingADERDGSolver::isValidCellDescriptionIndex(
     const int cellDescriptionsIndex) const  {
   return _solver->isValidCellDescriptionIndex(cellDescriptionsIndex);
@@ -105,6 +118,9 @@ exahype::solvers::LimitingADERDGSolver::LimitingADERDGSolver(
 {
   assertion(_solver->getNumberOfParameters() == 0);
   assertion(_solver->getTimeStepping()==_limiter->getTimeStepping());
+
+  // Troubled cells roll back the ADER-DG solution
+  _solver->setHoldsPreviousSolution(true);
 }
 
 void exahype::solvers::LimitingADERDGSolver::updateNextMeshUpdateRequest(const bool& meshUpdateRequest)  {
@@ -366,16 +382,19 @@ bool exahype::solvers::LimitingADERDGSolver::markForRefinementBasedOnLimiterStat
   return false;
 }
 
-void exahype::solvers::LimitingADERDGSolver::updateLimiterStatusDuringLimiterStatusSpreading(
+bool exahype::solvers::LimitingADERDGSolver::updateLimiterStatusDuringLimiterStatusSpreading(
     const int cellDescriptionsIndex, const int solverElement) const {
   SolverPatch& solverPatch =
       _solver->getCellDescription(cellDescriptionsIndex,solverElement);
+  const int previousLimiterStatus = solverPatch.getLimiterStatus();
   if (solverPatch.getLimiterStatus()>=static_cast<int>(SolverPatch::LimiterStatus::Troubled)) {
     ADERDGSolver::overwriteFacewiseLimiterStatus(solverPatch);
   }
   updateLimiterStatus(cellDescriptionsIndex,solverElement);
   deallocateLimiterPatchOnHelperCell(cellDescriptionsIndex,solverElement);
   ensureRequiredLimiterPatchIsAllocated(cellDescriptionsIndex,solverElement);
+
+  return solverPatch.getLimiterStatus()!=previousLimiterStatus;
 }
 
 bool exahype::solvers::LimitingADERDGSolver::markForRefinement(
@@ -747,14 +766,16 @@ void exahype::solvers::LimitingADERDGSolver::updateSolution(
         _solver->updateSolution(
             cellDescriptionsIndex,element,
             tempStateSizedVectors,tempUnknowns,
-            fineGridVertices,fineGridVerticesEnumerator);
+            fineGridVertices,fineGridVerticesEnumerator,
+            true);
         break;
       case SolverPatch::LimiterStatus::NeighbourOfTroubled3:
       case SolverPatch::LimiterStatus::NeighbourOfTroubled4: {
         _solver->updateSolution(
             cellDescriptionsIndex,element,
             tempStateSizedVectors,tempUnknowns,
-            fineGridVertices,fineGridVerticesEnumerator);
+            fineGridVertices,fineGridVerticesEnumerator,
+            true);
 
         assertion1(limiterElement!=exahype::solvers::Solver::NotFound,solverPatch.toString());
         LimiterPatch& limiterPatch =
@@ -809,7 +830,8 @@ void exahype::solvers::LimitingADERDGSolver::updateSolution(
       _solver->updateSolution(
           cellDescriptionsIndex,element,
           tempStateSizedVectors,tempUnknowns,
-          fineGridVertices,fineGridVerticesEnumerator);
+          fineGridVertices,fineGridVerticesEnumerator,
+          true);
     }
   }
 }
@@ -1529,6 +1551,34 @@ exahype::solvers::LimitingADERDGSolver::updateLimiterStatus(
   return updateLimiterStatus(solverPatch);
 }
 
+exahype::plotters::ascii::InSituReductions* exahype::solvers::LimitingADERDGSolver::getInSituReductions() const {
+  return _solver->getInSituReductions();
+}
+
+void exahype::solvers::LimitingADERDGSolver::reduceInSitu(
+    const int cellDescriptionsIndex,
+    const int element,
+    plotters::ascii::InSituReductions::Accumulator& accumulator) const {
+  SolverPatch& solverPatch = _solver->getCellDescription(cellDescriptionsIndex,element);
+
+  if (solverPatch.getType()==SolverPatch::Type::Cell &&
+      solverPatch.getLevel()==getMaximumAdaptiveMeshLevel()) {
+    switch (solverPatch.getLimiterStatus()) {
+      case SolverPatch::LimiterStatus::Troubled:
+      case SolverPatch::LimiterStatus::NeighbourOfTroubled1:
+      case SolverPatch::LimiterStatus::NeighbourOfTroubled2: {
+        const int limiterElement = tryGetLimiterElementFromSolverElement(cellDescriptionsIndex,element);
+        assertion1(limiterElement!=exahype::solvers::Solver::NotFound,solverPatch.toString());
+        _limiter->reduceInSitu(*getInSituReductions(),cellDescriptionsIndex,limiterElement,accumulator);
+        return;
+      }
+      default:
+        break;
+    }
+  }
+  _solver->reduceInSitu(cellDescriptionsIndex,element,accumulator);
+}
+
 void exahype::solvers::LimitingADERDGSolver::preProcess(
     const int cellDescriptionsIndex,
     const int element) {
@@ -1925,7 +1975,6 @@ void exahype::solvers::LimitingADERDGSolver::mergeWithBoundaryOrEmptyCellMetadat
 
 #ifdef Parallel
 const int exahype::solvers::LimitingADERDGSolver::DataMessagesPerNeighbourCommunication    = 1;
-const int exahype::solvers::LimitingADERDGSolver::DataMessagesPerForkOrJoinCommunication   = 0;
 const int exahype::solvers::LimitingADERDGSolver::DataMessagesPerMasterWorkerCommunication = 0;
 
 ///////////////////////////////////
@@ -2272,67 +2321,6 @@ void exahype::solvers::LimitingADERDGSolver::mergeWithMasterWorkerMetadata(
       metadata,cellDescriptionsIndex,element);
 }
 
-///////////////////////////////////////
-// FORK OR JOIN
-///////////////////////////////////////
-void exahype::solvers::LimitingADERDGSolver::sendDataToWorkerOrMasterDueToForkOrJoin(
-    const int                                     toRank,
-    const int                                     cellDescriptionsIndex,
-    const int                                     element,
-    const tarch::la::Vector<DIMENSIONS, double>&  x,
-    const int                                     level) {
-  _solver->sendDataToWorkerOrMasterDueToForkOrJoin(
-      toRank,cellDescriptionsIndex,element,x,level);
-
-  const int limiterElement = tryGetLimiterElementFromSolverElement(cellDescriptionsIndex,element);
-  if (limiterElement!=exahype::solvers::Solver::NotFound) {
-    _limiter->sendDataToWorkerOrMasterDueToForkOrJoin(
-          toRank,cellDescriptionsIndex,limiterElement,x,level);
-  } else {
-    _limiter->sendEmptyDataToWorkerOrMasterDueToForkOrJoin(
-          toRank,x,level);
-  }
-}
-
-void exahype::solvers::LimitingADERDGSolver::sendEmptyDataToWorkerOrMasterDueToForkOrJoin(
-    const int                                     toRank,
-    const tarch::la::Vector<DIMENSIONS, double>&  x,
-    const int                                     level) {
-  _solver->sendEmptyDataToWorkerOrMasterDueToForkOrJoin(
-        toRank,x,level);
-  _limiter->sendEmptyDataToWorkerOrMasterDueToForkOrJoin(
-        toRank,x,level);
-}
-
-void exahype::solvers::LimitingADERDGSolver::mergeWithWorkerOrMasterDataDueToForkOrJoin(
-    const int                                     fromRank,
-    const int                                     cellDescriptionsIndex,
-    const int                                     element,
-    const tarch::la::Vector<DIMENSIONS, double>&  x,
-    const int                                     level) {
-  _solver->mergeWithWorkerOrMasterDataDueToForkOrJoin(
-      fromRank,cellDescriptionsIndex,element,x,level);
-
-  const int limiterElement = tryGetLimiterElementFromSolverElement(cellDescriptionsIndex,element);
-  if (limiterElement!=exahype::solvers::Solver::NotFound) {
-    _limiter->mergeWithWorkerOrMasterDataDueToForkOrJoin(
-        fromRank,cellDescriptionsIndex,limiterElement,x,level);
-  } else {
-    _limiter->dropWorkerOrMasterDataDueToForkOrJoin(
-        fromRank,x,level);
-  } // !!! Receive order must be the same in master<->worker comm.
-}
-
-void exahype::solvers::LimitingADERDGSolver::dropWorkerOrMasterDataDueToForkOrJoin(
-    const int                                     fromRank,
-    const tarch::la::Vector<DIMENSIONS, double>&  x,
-    const int                                     level) {
-  _solver->dropWorkerOrMasterDataDueToForkOrJoin(
-          fromRank,x,level);
-  _limiter->dropWorkerOrMasterDataDueToForkOrJoin(
-          fromRank,x,level);
-}
-
 ///////////////////////////////////
 // WORKER->MASTER
 ///////////////////////////////////
@@ -2393,6 +2381,27 @@ void exahype::solvers::LimitingADERDGSolver::mergeWithWorkerData(
   }
 }
 
+exahype::DataHeap::HeapEntries
+exahype::solvers::LimitingADERDGSolver::compileTimeStepDataForGlobalReduction() const {
+  DataHeap::HeapEntries message =
+      _solver->compileTimeStepDataForGlobalReduction();
+  message.push_back(
+      -exahype::solvers::convertToDouble(_nextLimiterDomainChange));
+  assertion1(message.size()==5,message.size());
+  return message;
+}
+
+void exahype::solvers::LimitingADERDGSolver::mergeWithGloballyReducedTimeStepData(const DataHeap::HeapEntries& message) {
+  assertion1(message.size()==5,message.size());
+  const int firstEntry=4;
+  // the ADER-DG solver expects exactly its own entries
+  _solver->mergeWithGloballyReducedTimeStepData(
+      DataHeap::HeapEntries(message.begin(),message.begin()+firstEntry));
+
+  _nextLimiterDomainChange =
+      exahype::solvers::convertToLimiterDomainChange(-message[firstEntry]);
+}
+
 bool exahype::solvers::LimitingADERDGSolver::hasToSendDataToMaster(
       const int cellDescriptionsIndex,
       const int element) {
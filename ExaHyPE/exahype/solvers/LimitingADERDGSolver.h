@@ -333,12 +333,6 @@ private:
    * methods.
    */
   static const int DataMessagesPerNeighbourCommunication;
-  /**
-   * Data messages per fork/join communication.
-   * This information is required by the sendEmpty...(...)
-   * methods.
-   */
-  static const int DataMessagesPerForkOrJoinCommunication;
   /**
    * Data messages per master worker communication.
    * This information is required by the sendEmpty...(...)
@@ -424,6 +418,15 @@ public:
    */
   static bool oneSolverRequestedGlobalRecomputation();
 
+  /*
+   * Check if a solver which performs the limiter status
+   * spreading has not attained a stable state yet,
+   * i.e. at least one cell has changed its limiter status
+   * during the last iteration or a mesh update is
+   * requested.
+   */
+  static bool oneSolverHasNotFinishedLimiterStatusSpreading();
+
   /**
    * Create a limiting ADER-DG solver.
    *
@@ -680,8 +683,12 @@ public:
    * \note We overwrite the facewise limiter status values with the new value
    * in order to use the updateLimiterStatusAfterSetInitialConditions function
    * afterwards which calls determineLimiterStatus(...) again.
+   *
+   * @return true if the cellwise limiter status has changed. The
+   * LimiterStatusSpreading mapping uses this information to stop
+   * the spreading as soon as the limiter status does not change anymore.
    */
-  void updateLimiterStatusDuringLimiterStatusSpreading(
+  bool updateLimiterStatusDuringLimiterStatusSpreading(
       const int cellDescriptionsIndex, const int solverElement) const;
 
   bool markForRefinement(
@@ -796,6 +803,21 @@ public:
    * set the ADER-DG time step sizes for the limiter patch.
    * (ADER-DG is always dictating the time step sizes.)
    *
+   * <h2>Previous solution</h2>
+   * Only the wrapped ADER-DG solver's cells that are evolved with
+   * the ADER-DG scheme keep a snapshot of the previous solution.
+   * We cannot know in advance which of them are rolled back:
+   * Each cell with limiter status Ok might be
+   * marked as troubled or as neighbour of a troubled cell
+   * after the update and is then rolled back in reinitialiseSolvers(...).
+   * Cells on coarser mesh levels need the snapshot for the prolongation
+   * after a mesh update.
+   * The ADER-DG solution of cells which are evolved with the limiter is
+   * overwritten by the projected limiter solution and does not need a snapshot.
+   *
+   * All rollbacks swap the heap indices of the solution and
+   * previous solution fields. They do not copy.
+   *
    * \see determineLimiterStatusAfterLimiterStatusSpreading(...)
    */
   void updateSolution(
@@ -806,6 +828,25 @@ public:
       exahype::Vertex* const fineGridVertices,
       const peano::grid::VertexEnumerator& fineGridVerticesEnumerator) override;
 
+  /**
+   * The in-situ reductions are declared by and computed
+   * on the DG solution of the wrapped ADER-DG solver.
+   */
+  plotters::ascii::InSituReductions* getInSituReductions() const override;
+
+  /**
+   * Reduces the limiter solution in cells where the limiter
+   * computes the solution, i.e. the troubled cells and their
+   * first two neighbours on the finest mesh level. The DG solution is
+   * only a projection of the limiter solution there. The limiting
+   * plotters plot the limiter solution in these cells as well.
+   * Reduces the DG solution everywhere else.
+   */
+  void reduceInSitu(
+      const int cellDescriptionsIndex,
+      const int element,
+      plotters::ascii::InSituReductions::Accumulator& accumulator) const override;
+
   /**
    * Determine the new cell-local min max values.
    *
@@ -1357,33 +1398,6 @@ public:
       const int                                 cellDescriptionsIndex,
       const int                                 element) override;
 
-  /////////////////////////////////////
-  // FORK OR JOIN
-  /////////////////////////////////////
-  void sendDataToWorkerOrMasterDueToForkOrJoin(
-      const int                                     toRank,
-      const int                                     cellDescriptionsIndex,
-      const int                                     element,
-      const tarch::la::Vector<DIMENSIONS, double>&  x,
-      const int                                     level) override;
-
-  void sendEmptyDataToWorkerOrMasterDueToForkOrJoin(
-      const int                                     toRank,
-      const tarch::la::Vector<DIMENSIONS, double>&  x,
-      const int                                     level) override;
-
-  void mergeWithWorkerOrMasterDataDueToForkOrJoin(
-      const int                                     fromRank,
-      const int                                     cellDescriptionsIndex,
-      const int                                     element,
-      const tarch::la::Vector<DIMENSIONS, double>&  x,
-      const int                                     level) override;
-
-  void dropWorkerOrMasterDataDueToForkOrJoin(
-      const int                                     fromRank,
-      const tarch::la::Vector<DIMENSIONS, double>&  x,
-      const int                                     level) override;
-
   ///////////////////////////////////
   // WORKER->MASTER
   ///////////////////////////////////
@@ -1401,6 +1415,10 @@ public:
       const tarch::la::Vector<DIMENSIONS, double>& x,
       const int                                    level) override;
 
+  DataHeap::HeapEntries compileTimeStepDataForGlobalReduction() const override;
+
+  void mergeWithGloballyReducedTimeStepData(const DataHeap::HeapEntries& message) override;
+
   void sendDataToMaster(
       const int                                     masterRank,
       const int                                     cellDescriptionsIndex,
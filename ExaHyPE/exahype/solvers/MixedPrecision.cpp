@@ -0,0 +1,170 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/solvers/MixedPrecision.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+
+namespace {
+  /**
+   * Round a single precision number to bfloat16 (round to nearest even).
+   * NaNs are kept quiet.
+   */
+  std::uint16_t floatToBFloat16(const float value) {
+    std::uint32_t bits;
+    std::memcpy(&bits,&value,sizeof(float));
+    if ((bits & 0x7fffffff) > 0x7f800000) { // NaN
+      return static_cast<std::uint16_t>((bits >> 16) | 0x0040);
+    }
+    const std::uint32_t roundingBias = 0x00007fff + ((bits >> 16) & 1);
+    return static_cast<std::uint16_t>((bits + roundingBias) >> 16);
+  }
+
+  float bfloat16ToFloat(const std::uint16_t value) {
+    const std::uint32_t bits = static_cast<std::uint32_t>(value) << 16;
+    float result;
+    std::memcpy(&result,&bits,sizeof(float));
+    return result;
+  }
+}
+
+exahype::solvers::StoragePrecision exahype::solvers::convertToStoragePrecision(
+    const std::string& value,bool& valid) {
+  valid = true;
+  if (value.compare("double")==0) {
+    return StoragePrecision::Double;
+  } else if (value.compare("single")==0) {
+    return StoragePrecision::Single;
+  } else if (value.compare("bfloat16")==0) {
+    return StoragePrecision::BFloat16;
+  }
+  valid = false;
+  return StoragePrecision::Double;
+}
+
+std::string exahype::solvers::toString(const StoragePrecision& precision) {
+  switch (precision) {
+    case StoragePrecision::Double:   return "double";
+    case StoragePrecision::Single:   return "single";
+    case StoragePrecision::BFloat16: return "bfloat16";
+  }
+  return "undefined";
+}
+
+int exahype::solvers::getBytesPerEntry(const StoragePrecision& precision) {
+  switch (precision) {
+    case StoragePrecision::Double:   return sizeof(double);
+    case StoragePrecision::Single:   return sizeof(float);
+    case StoragePrecision::BFloat16: return sizeof(std::uint16_t);
+  }
+  return sizeof(double);
+}
+
+int exahype::solvers::getBytesForMantissa(const StoragePrecision& precision) {
+  switch (precision) {
+    case StoragePrecision::Double:   return 7;
+    case StoragePrecision::Single:   return 3;
+    case StoragePrecision::BFloat16: return 1;
+  }
+  return 7;
+}
+
+int exahype::solvers::getPackedSize(const int numberOfEntries,const StoragePrecision& precision) {
+  const int bytes = numberOfEntries * getBytesPerEntry(precision);
+  return (bytes + sizeof(double) - 1) / sizeof(double);
+}
+
+void exahype::solvers::packIntoDoubles(
+    const double*            values,
+    const int                numberOfEntries,
+    const StoragePrecision&  precision,
+    double*                  packed) {
+  char* bytes = reinterpret_cast<char*>(packed);
+  switch (precision) {
+    case StoragePrecision::Double:
+      std::copy(values,values+numberOfEntries,packed);
+      break;
+    case StoragePrecision::Single:
+      for (int i=0; i<numberOfEntries; i++) {
+        const float value = static_cast<float>(values[i]);
+        std::memcpy(bytes+i*sizeof(float),&value,sizeof(float));
+      }
+      break;
+    case StoragePrecision::BFloat16:
+      for (int i=0; i<numberOfEntries; i++) {
+        const std::uint16_t value = floatToBFloat16(static_cast<float>(values[i]));
+        std::memcpy(bytes+i*sizeof(std::uint16_t),&value,sizeof(std::uint16_t));
+      }
+      break;
+  }
+  // zero the padding bytes of the last double
+  const int usedBytes = numberOfEntries * getBytesPerEntry(precision);
+  std::fill(bytes+usedBytes,bytes+getPackedSize(numberOfEntries,precision)*sizeof(double),0);
+}
+
+void exahype::solvers::unpackFromDoubles(
+    const double*            packed,
+    const int                numberOfEntries,
+    const StoragePrecision&  precision,
+    double*                  values) {
+  const char* bytes = reinterpret_cast<const char*>(packed);
+  switch (precision) {
+    case StoragePrecision::Double:
+      std::copy(packed,packed+numberOfEntries,values);
+      break;
+    case StoragePrecision::Single:
+      for (int i=0; i<numberOfEntries; i++) {
+        float value;
+        std::memcpy(&value,bytes+i*sizeof(float),sizeof(float));
+        values[i] = value;
+      }
+      break;
+    case StoragePrecision::BFloat16:
+      for (int i=0; i<numberOfEntries; i++) {
+        std::uint16_t value;
+        std::memcpy(&value,bytes+i*sizeof(std::uint16_t),sizeof(std::uint16_t));
+        values[i] = bfloat16ToFloat(value);
+      }
+      break;
+  }
+}
+
+void exahype::solvers::MixedPrecisionErrors::record(
+    const double* original,const double* reduced,const int numberOfEntries) {
+  for (int i=0; i<numberOfEntries; i++) {
+    const double absoluteError = std::abs(original[i]-reduced[i]);
+    maxAbsoluteError = std::max(maxAbsoluteError,absoluteError);
+    if (std::abs(original[i])>0.0) {
+      maxRelativeError = std::max(maxRelativeError,absoluteError/std::abs(original[i]));
+    }
+  }
+  numberOfValues += numberOfEntries;
+}
+
+void exahype::solvers::MixedPrecisionErrors::merge(const MixedPrecisionErrors& other) {
+  maxAbsoluteError = std::max(maxAbsoluteError,other.maxAbsoluteError);
+  maxRelativeError = std::max(maxRelativeError,other.maxRelativeError);
+  numberOfValues  += other.numberOfValues;
+}
+
+std::string exahype::solvers::MixedPrecisionErrors::toString() const {
+  std::ostringstream out;
+  out << "(max-absolute-error=" << maxAbsoluteError
+      << ",max-relative-error=" << maxRelativeError
+      << ",values=" << numberOfValues << ")";
+  return out.str();
+}
@@ -0,0 +1,104 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef EXAHYPE_SOLVERS_MIXEDPRECISION_H_
+#define EXAHYPE_SOLVERS_MIXEDPRECISION_H_
+
+#include <string>
+#include <vector>
+
+namespace exahype {
+  namespace solvers {
+    /**
+     * Precision a heap array is stored and/or communicated in.
+     * The kernels always compute in double precision.
+     *
+     * BFloat16 keeps the 8 exponent bits of a single precision number
+     * but only 7 (explicit) mantissa bits.
+     */
+    enum class StoragePrecision {
+      Double,
+      Single,
+      BFloat16
+    };
+
+    /**
+     * Parse one of "double", "single", "bfloat16".
+     *
+     * \param[out] valid is set to false if \p value is not one of the above.
+     */
+    StoragePrecision convertToStoragePrecision(const std::string& value,bool& valid);
+
+    std::string toString(const StoragePrecision& precision);
+
+    /**
+     * \return the number of bytes one entry occupies when stored in \p precision.
+     */
+    int getBytesPerEntry(const StoragePrecision& precision);
+
+    /**
+     * \return the number of mantissa bytes that have to be used
+     * by the floating point compression (see peano::heap::decompose) in order to
+     * store a value with (at least) the accuracy of \p precision.
+     * Returns 7, i.e. no compression, for StoragePrecision::Double.
+     */
+    int getBytesForMantissa(const StoragePrecision& precision);
+
+    /**
+     * \return the number of doubles a message of \p numberOfEntries
+     * values occupies if the values are packed in \p precision.
+     */
+    int getPackedSize(const int numberOfEntries,const StoragePrecision& precision);
+
+    /**
+     * Convert \p numberOfEntries doubles into \p precision and pack them
+     * bitwise into \p packed which has to hold getPackedSize(...) entries.
+     * This allows us to send reduced precision data via the DataHeap.
+     */
+    void packIntoDoubles(
+        const double*            values,
+        const int                numberOfEntries,
+        const StoragePrecision&  precision,
+        double*                  packed);
+
+    /**
+     * Counterpart of packIntoDoubles.
+     */
+    void unpackFromDoubles(
+        const double*            packed,
+        const int                numberOfEntries,
+        const StoragePrecision&  precision,
+        double*                  values);
+
+    /**
+     * Accumulates the error which is introduced by storing or communicating
+     * an array in reduced precision, i.e. the difference to the values of
+     * a full precision run at the same point in time.
+     *
+     * Only recorded if the code is translated with Asserts or
+     * TrackMixedPrecisionErrors.
+     */
+    class MixedPrecisionErrors {
+      public:
+        double maxAbsoluteError = 0.0;
+        double maxRelativeError = 0.0;
+        double numberOfValues   = 0.0;
+
+        void record(const double* original,const double* reduced,const int numberOfEntries);
+        void merge(const MixedPrecisionErrors& other);
+        std::string toString() const;
+    };
+  }
+}
+
+#endif
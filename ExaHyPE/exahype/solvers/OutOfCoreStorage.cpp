@@ -0,0 +1,282 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/solvers/OutOfCoreStorage.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "tarch/Assertions.h"
+#include "tarch/multicore/Lock.h"
+#include "tarch/parallel/Node.h"
+
+tarch::logging::Log exahype::solvers::OutOfCoreStorage::_log("exahype::solvers::OutOfCoreStorage");
+
+constexpr long exahype::solvers::OutOfCoreStorage::SegmentSize;
+
+exahype::solvers::OutOfCoreStorage& exahype::solvers::OutOfCoreStorage::getInstance() {
+  static OutOfCoreStorage singleton;
+  return singleton;
+}
+
+exahype::solvers::OutOfCoreStorage::OutOfCoreStorage():
+  _fileDescriptor(-1),
+  _fileName(""),
+  _numberOfResidentSegments(1),
+  _currentSegment(-1),
+  _numberOfStores(0),
+  _numberOfPrefetches(0),
+  _liveBytes(0),
+  _peakLiveBytes(0) {
+}
+
+exahype::solvers::OutOfCoreStorage::~OutOfCoreStorage() {
+  shutdown();
+}
+
+void exahype::solvers::OutOfCoreStorage::configure(const std::string& directory, long windowSize) {
+  assertion1(!isActive(),_fileName);
+
+  std::ostringstream fileName;
+  fileName << directory << "/exahype-out-of-core-rank-" << tarch::parallel::Node::getInstance().getRank() << ".bin";
+  _fileName = fileName.str();
+
+  _fileDescriptor = open(_fileName.c_str(), O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+  if (_fileDescriptor<0) {
+    logError("configure(...)", "could not create file " << _fileName << " for out-of-core storage: " << std::strerror(errno)
+        << ". Keep all data in memory");
+    return;
+  }
+  // The file vanishes as soon as we close it.
+  unlink(_fileName.c_str());
+
+  // The segment we write to, the one we read from, and the prefetched one.
+  _numberOfResidentSegments = std::max(3,static_cast<int>(windowSize / SegmentSize));
+  logInfo("configure(...)", "move compressed unknowns out of core into " << _fileName <<
+      ". Keep at most " << _numberOfResidentSegments << " segment(s) of " << SegmentSize/1024/1024 << " MB in memory");
+}
+
+void exahype::solvers::OutOfCoreStorage::shutdown() {
+  if (isActive()) {
+    for (auto& segment : _segments) {
+      munmap(segment.data,SegmentSize);
+    }
+    _segments.clear();
+    _freeSegments.clear();
+    _residentSegments.clear();
+    _slots.clear();
+    _currentSegment = -1;
+
+    close(_fileDescriptor);
+    _fileDescriptor = -1;
+  }
+}
+
+bool exahype::solvers::OutOfCoreStorage::isActive() const {
+  return _fileDescriptor>=0;
+}
+
+bool exahype::solvers::OutOfCoreStorage::openNewSegment() {
+  // freeSlot(...) does not recycle the current segment
+  const int retiredSegment = _currentSegment;
+  _currentSegment = -1;
+  if (retiredSegment>=0 && _segments[retiredSegment].liveBytes==0) {
+    recycleSegment(retiredSegment);
+  }
+
+  int segmentNumber = -1;
+  if (!_freeSegments.empty()) {
+    segmentNumber = _freeSegments.back();
+    _freeSegments.pop_back();
+  }
+  else {
+    const long fileSize = (_segments.size()+1) * SegmentSize;
+    if (ftruncate(_fileDescriptor,fileSize)!=0) {
+      logWarning("openNewSegment()", "could not extend " << _fileName << " to " << fileSize << " bytes: " << std::strerror(errno));
+      return false;
+    }
+    void* data = mmap(nullptr, SegmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, _fileDescriptor, _segments.size() * SegmentSize);
+    if (data==MAP_FAILED) {
+      logWarning("openNewSegment()", "could not map segment " << _segments.size() << " of " << _fileName << ": " << std::strerror(errno));
+      return false;
+    }
+    segmentNumber = _segments.size();
+    _segments.push_back(Segment{static_cast<char*>(data),0,0,-1,false});
+  }
+
+  Segment& segment    = _segments[segmentNumber];
+  segment.usedBytes   = 0;
+  segment.liveBytes   = 0;
+  segment.predecessor = (retiredSegment>=0 && _segments[retiredSegment].liveBytes>0) ? retiredSegment : -1;
+  if (!segment.isResident) {
+    segment.isResident = true;
+    _residentSegments.push_back(segmentNumber);
+  }
+  _currentSegment = segmentNumber;
+
+  shrinkWindow();
+  return true;
+}
+
+void exahype::solvers::OutOfCoreStorage::shrinkWindow() {
+  auto residentSegment = _residentSegments.begin();
+  while (static_cast<int>(_residentSegments.size())>_numberOfResidentSegments &&
+         residentSegment!=_residentSegments.end()) {
+    if (*residentSegment==_currentSegment) {
+      ++residentSegment;
+    }
+    else {
+      Segment& segment   = _segments[*residentSegment];
+      segment.isResident = false;
+      releaseMemory(segment);
+      residentSegment = _residentSegments.erase(residentSegment);
+    }
+  }
+}
+
+void exahype::solvers::OutOfCoreStorage::releaseMemory(Segment& segment) const {
+  // The mapping is shared, i.e. no data is lost if we drop the pages.
+  // Writing them back first allows the kernel to free the memory right away.
+  msync(segment.data, SegmentSize, MS_ASYNC);
+  madvise(segment.data, SegmentSize, MADV_DONTNEED);
+}
+
+bool exahype::solvers::OutOfCoreStorage::store(const int key, const char* const data, const long bytes) {
+  assertion1(isActive(),key);
+  assertion2(bytes>=0,key,bytes);
+
+  if (bytes>SegmentSize) {
+    return false;
+  }
+
+  tarch::multicore::Lock lock(_semaphore);
+  assertion1(_slots.count(key)==0,key);
+  if (
+    (_currentSegment<0 || _segments[_currentSegment].usedBytes+bytes>SegmentSize) &&
+    !openNewSegment()
+  ) {
+    return false;
+  }
+
+  Segment& segment = _segments[_currentSegment];
+  const Slot slot{_currentSegment,segment.usedBytes,bytes};
+  segment.usedBytes += bytes;
+  segment.liveBytes += bytes;
+  _slots[key] = slot;
+
+  _numberOfStores++;
+  _liveBytes    += bytes;
+  _peakLiveBytes = std::max(_peakLiveBytes,_liveBytes);
+  char* const destination = segment.data + slot.offset;
+  lock.free();
+
+  // Nobody else touches the slot before it is freed again.
+  std::memcpy(destination,data,bytes);
+  return true;
+}
+
+bool exahype::solvers::OutOfCoreStorage::contains(const int key) {
+  if (!isActive()) {
+    return false;
+  }
+  tarch::multicore::Lock lock(_semaphore);
+  return _slots.count(key)>0;
+}
+
+void exahype::solvers::OutOfCoreStorage::load(const int key, char* const data, const long bytes) {
+  assertion1(isActive(),key);
+
+  tarch::multicore::Lock lock(_semaphore);
+  auto slot = _slots.find(key);
+  assertion1(slot!=_slots.end(),key);
+  assertion3(slot->second.bytes==bytes,key,slot->second.bytes,bytes);
+
+  Segment& segment = _segments[slot->second.segment];
+  const char* const source = segment.data + slot->second.offset;
+
+  char* prefetchedSegment = nullptr;
+  if (!segment.isResident) {
+    segment.isResident = true;
+    _residentSegments.push_back(slot->second.segment);
+  }
+  if (segment.predecessor>=0 && !_segments[segment.predecessor].isResident) {
+    Segment& predecessor = _segments[segment.predecessor];
+    predecessor.isResident = true;
+    _residentSegments.push_back(segment.predecessor);
+    prefetchedSegment = predecessor.data;
+    _numberOfPrefetches++;
+  }
+  shrinkWindow();
+  lock.free();
+
+  if (prefetchedSegment!=nullptr) {
+    madvise(prefetchedSegment, SegmentSize, MADV_WILLNEED);
+  }
+  std::memcpy(data,source,bytes);
+
+  lock.lock();
+  freeSlot(_slots.find(key));
+}
+
+void exahype::solvers::OutOfCoreStorage::discard(const int key) {
+  if (isActive()) {
+    tarch::multicore::Lock lock(_semaphore);
+    auto slot = _slots.find(key);
+    if (slot!=_slots.end()) {
+      freeSlot(slot);
+    }
+  }
+}
+
+void exahype::solvers::OutOfCoreStorage::freeSlot(std::unordered_map<int,Slot>::iterator slot) {
+  assertion(slot!=_slots.end());
+  const int segmentNumber = slot->second.segment;
+  Segment& segment        = _segments[segmentNumber];
+  segment.liveBytes -= slot->second.bytes;
+  _liveBytes        -= slot->second.bytes;
+  _slots.erase(slot);
+
+  if (segment.liveBytes==0 && segmentNumber!=_currentSegment) {
+    recycleSegment(segmentNumber);
+  }
+}
+
+void exahype::solvers::OutOfCoreStorage::recycleSegment(const int segmentNumber) {
+  Segment& segment = _segments[segmentNumber];
+  assertion2(segment.liveBytes==0,segmentNumber,segment.liveBytes);
+  if (segment.isResident) {
+    segment.isResident = false;
+    _residentSegments.erase(std::find(_residentSegments.begin(),_residentSegments.end(),segmentNumber));
+  }
+  // The content is obsolete. We only release the memory.
+  madvise(segment.data, SegmentSize, MADV_DONTNEED);
+  _freeSegments.push_back(segmentNumber);
+}
+
+void exahype::solvers::OutOfCoreStorage::logStatistics() {
+  if (isActive()) {
+    tarch::multicore::Lock lock(_semaphore);
+    const double MB = 1024.0*1024.0;
+    logInfo("logStatistics()", "out-of-core storage: stores=" << _numberOfStores <<
+        ", prefetched segments=" << _numberOfPrefetches <<
+        ", peak data out of core=" << _peakLiveBytes/MB << " MB" <<
+        ", file size=" << _segments.size()*SegmentSize/MB << " MB" <<
+        ", resident window=" << _numberOfResidentSegments*SegmentSize/MB << " MB");
+  }
+}
@@ -0,0 +1,224 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_SOLVERS_OUT_OF_CORE_STORAGE_H_
+#define _EXAHYPE_SOLVERS_OUT_OF_CORE_STORAGE_H_
+
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "tarch/logging/Log.h"
+#include "tarch/multicore/BooleanSemaphore.h"
+
+namespace exahype {
+  namespace solvers {
+    class OutOfCoreStorage;
+  }
+  namespace tests {
+    namespace solvers {
+      class OutOfCoreStorageTest;
+    }
+  }
+}
+
+/**
+ * Moves the compressed unknowns of the cells into a memory-mapped file
+ * on node-local storage while they are not needed.
+ *
+ * With data compression or reduced storage precision switched on, the
+ * solvers put the unknowns of a cell into a byte stream when the cell
+ * is left (see ADERDGSolver::compress()) and restore them from the byte
+ * stream when the cell is entered again in the next traversal. In between,
+ * the byte stream is not touched at all. The storage takes over these
+ * byte streams and keeps them in a file instead of the compressed data heap.
+ *
+ * <h2>Streaming</h2>
+ *
+ * Peano's traversals are stack-based and invert the traversal order from one
+ * traversal to the next. The byte stream stored last is thus the first one
+ * to be restored. We append the byte streams to fixed-size segments of the
+ * file in the order they are stored. Only the window of the most recently
+ * filled segments is kept in memory. Older segments are written back and
+ * released. Whenever we restore data from a segment, we ask the operating
+ * system to prefetch the segment which was filled right before it, as the
+ * traversal will read that segment next.
+ *
+ * A segment is recycled as soon as all byte streams stored in it have been
+ * restored or discarded.
+ *
+ * <h2>Limitations</h2>
+ *
+ * The vertex and cell stacks of the grid as well as the cell descriptions
+ * themselves stay in memory. Only the (compressed) unknowns are moved
+ * out of core. The file is unlinked right after it has been created, i.e.
+ * it vanishes as soon as the application terminates.
+ */
+class exahype::solvers::OutOfCoreStorage {
+  private:
+    friend class exahype::tests::solvers::OutOfCoreStorageTest;
+
+    static tarch::logging::Log _log;
+
+    struct Segment {
+      char* data;
+      /**
+       * Bytes appended to the segment since it has been (re)opened.
+       */
+      long  usedBytes;
+      /**
+       * Bytes of the segment which still have to be restored.
+       */
+      long  liveBytes;
+      /**
+       * The segment that was filled right before this one.
+       * This is the segment the traversal reads next.
+       */
+      int   predecessor;
+      bool  isResident;
+    };
+
+    struct Slot {
+      int  segment;
+      long offset;
+      long bytes;
+    };
+
+    int                            _fileDescriptor;
+    std::string                    _fileName;
+
+    /**
+     * Maximum number of segments which are kept in memory.
+     */
+    int                            _numberOfResidentSegments;
+
+    std::vector<Segment>           _segments;
+    std::vector<int>               _freeSegments;
+    int                            _currentSegment;
+
+    /**
+     * Segments which are in memory in the order they were filled or reloaded.
+     */
+    std::deque<int>                _residentSegments;
+
+    /**
+     * Maps the keys (the compressed heap indices) onto their slots in the file.
+     */
+    std::unordered_map<int,Slot>   _slots;
+
+    /**
+     * Guards all the attributes above.
+     */
+    tarch::multicore::BooleanSemaphore _semaphore;
+
+    long _numberOfStores;
+    long _numberOfPrefetches;
+    long _liveBytes;
+    long _peakLiveBytes;
+
+    OutOfCoreStorage();
+
+    /**
+     * Maps a new segment or takes a recycled one and makes it the
+     * current segment. Has to be called while holding _semaphore.
+     *
+     * \return false if the file could not be extended.
+     */
+    bool openNewSegment();
+
+    /**
+     * Releases the memory of the oldest resident segments
+     * until at most _numberOfResidentSegments are left.
+     * Has to be called while holding _semaphore.
+     */
+    void shrinkWindow();
+
+    /**
+     * Writes back the segment and releases its memory. The
+     * content remains available via the file.
+     */
+    void releaseMemory(Segment& segment) const;
+
+    /**
+     * Removes \p slot and recycles its segment if the segment holds no
+     * live data anymore. Has to be called while holding _semaphore.
+     */
+    void freeSlot(std::unordered_map<int,Slot>::iterator slot);
+
+    /**
+     * Drops the memory of a segment without live data and puts it onto
+     * the list of free segments. Has to be called while holding _semaphore.
+     */
+    void recycleSegment(const int segmentNumber);
+
+  public:
+    /**
+     * Size of the segments the file is organised in.
+     */
+    static constexpr long SegmentSize = 16l*1024l*1024l;
+
+    static OutOfCoreStorage& getInstance();
+
+    ~OutOfCoreStorage();
+
+    OutOfCoreStorage(const OutOfCoreStorage& other) = delete;
+    OutOfCoreStorage& operator=(const OutOfCoreStorage& other) = delete;
+
+    /**
+     * Creates the file in \p directory and activates the storage.
+     *
+     * \param windowSize Memory in bytes the storage may keep
+     *                   resident. At least three segments are resident.
+     */
+    void configure(const std::string& directory, long windowSize);
+
+    /**
+     * Unmaps and closes the file.
+     */
+    void shutdown();
+
+    bool isActive() const;
+
+    /**
+     * Copies \p bytes bytes from \p data into the file.
+     *
+     * \return false if the data could not be stored. The caller then has
+     *         to keep the data in memory.
+     */
+    bool store(const int key, const char* const data, const long bytes);
+
+    /**
+     * \return true if the data belonging to \p key has been moved out of core.
+     */
+    bool contains(const int key);
+
+    /**
+     * Copies the data belonging to \p key from the file into \p data and
+     * frees its slot. \p bytes has to match the number of bytes stored.
+     */
+    void load(const int key, char* const data, const long bytes);
+
+    /**
+     * Frees the slot of \p key without restoring the data. Does nothing if
+     * no data has been stored for \p key.
+     */
+    void discard(const int key);
+
+    /**
+     * Logs how much data has been kept out of core.
+     */
+    void logStatistics();
+};
+
+#endif
@@ -0,0 +1,280 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/solvers/PackedCellMigration.h"
+
+#ifdef Parallel
+
+#include <algorithm>
+#include <cstring>
+
+#include "tarch/Assertions.h"
+
+#include "peano/heap/CompressedFloatingPointNumbers.h"
+
+#include "exahype/Cell.h"
+#include "exahype/solvers/ADERDGSolver.h"
+#include "exahype/solvers/FiniteVolumesSolver.h"
+#include "exahype/solvers/LimitingADERDGSolver.h"
+
+tarch::logging::Log exahype::solvers::PackedCellMigration::_log("exahype::solvers::PackedCellMigration");
+
+namespace {
+  template <typename CellDescription>
+  constexpr int getDoublesPerRecord() {
+    return (sizeof(typename CellDescription::PersistentRecords)+sizeof(double)-1)/sizeof(double);
+  }
+
+  template <typename CellDescription>
+  void appendRecords(std::vector<double>& buffer,const std::vector<CellDescription>& cellDescriptions) {
+    for (const CellDescription& cellDescription : cellDescriptions) {
+      const int position = buffer.size();
+      buffer.resize(position+getDoublesPerRecord<CellDescription>(),0.0);
+      std::memcpy(buffer.data()+position,&(cellDescription.getPersistentRecords()),
+                  sizeof(typename CellDescription::PersistentRecords));
+    }
+  }
+
+  template <typename CellDescription>
+  void readRecords(
+      const std::vector<double>& buffer,int& position,
+      const int numberOfRecords,std::vector<CellDescription>& cellDescriptions) {
+    cellDescriptions.reserve(numberOfRecords);
+    for (int i=0; i<numberOfRecords; i++) {
+      typename CellDescription::PersistentRecords persistentRecords;
+      std::memcpy(&persistentRecords,buffer.data()+position,
+                  sizeof(typename CellDescription::PersistentRecords));
+      cellDescriptions.push_back(CellDescription(persistentRecords));
+      position += getDoublesPerRecord<CellDescription>();
+    }
+  }
+
+  exahype::solvers::ADERDGSolver* getADERDGSolver(const int solverNumber) {
+    auto* solver = exahype::solvers::RegisteredSolvers[solverNumber];
+    switch (solver->getType()) {
+      case exahype::solvers::Solver::Type::ADERDG:
+        return static_cast<exahype::solvers::ADERDGSolver*>(solver);
+      case exahype::solvers::Solver::Type::LimitingADERDG:
+        return static_cast<exahype::solvers::LimitingADERDGSolver*>(solver)->getSolver().get();
+      case exahype::solvers::Solver::Type::FiniteVolumes:
+        assertionMsg(false,"Solver type not supported!");
+        break;
+    }
+    return nullptr;
+  }
+
+  exahype::solvers::FiniteVolumesSolver* getFiniteVolumesSolver(const int solverNumber) {
+    auto* solver = exahype::solvers::RegisteredSolvers[solverNumber];
+    switch (solver->getType()) {
+      case exahype::solvers::Solver::Type::FiniteVolumes:
+        return static_cast<exahype::solvers::FiniteVolumesSolver*>(solver);
+      case exahype::solvers::Solver::Type::LimitingADERDG:
+        return static_cast<exahype::solvers::LimitingADERDGSolver*>(solver)->getLimiter().get();
+      case exahype::solvers::Solver::Type::ADERDG:
+        assertionMsg(false,"Solver type not supported!");
+        break;
+    }
+    return nullptr;
+  }
+}
+
+void exahype::solvers::PackedCellMigration::appendArray(
+    std::vector<double>& buffer,
+    const double* const  data,
+    const int            numberOfEntries) {
+  const int bytesForMantissa = (ADERDGSolver::CompressionAccuracy>0.0) ?
+      peano::heap::findMostAgressiveCompression(data,numberOfEntries,ADERDGSolver::CompressionAccuracy) : 7;
+  assertion1(1<=bytesForMantissa && bytesForMantissa<=7,bytesForMantissa);
+
+  buffer.push_back(numberOfEntries);
+  buffer.push_back(bytesForMantissa);
+
+  const int position = buffer.size();
+  if (bytesForMantissa==7) {
+    buffer.insert(buffer.end(),data,data+numberOfEntries);
+  } else {
+    const int bytes = numberOfEntries * (bytesForMantissa+1);
+    buffer.resize(position + (bytes+sizeof(double)-1)/sizeof(double),0.0);
+
+    char exponent;
+    long int mantissa;
+    char* pMantissa = reinterpret_cast<char*>( &(mantissa) );
+    char* packed    = reinterpret_cast<char*>( buffer.data()+position );
+    for (int i=0; i<numberOfEntries; i++) {
+      peano::heap::decompose(data[i], exponent, mantissa, bytesForMantissa);
+      *packed = exponent;
+      packed++;
+      for (int j=0; j<bytesForMantissa; j++) {
+        *packed = pMantissa[j];
+        packed++;
+      }
+    }
+  }
+}
+
+void exahype::solvers::PackedCellMigration::readArray(
+    const std::vector<double>& buffer,
+    int&                       position,
+    double* const              data,
+    const int                  numberOfEntries) {
+  assertion2(static_cast<int>(buffer[position])==numberOfEntries,buffer[position],numberOfEntries);
+  const int bytesForMantissa = static_cast<int>(buffer[position+1]);
+  position += 2;
+
+  if (bytesForMantissa==7) {
+    std::copy_n(buffer.data()+position,numberOfEntries,data);
+    position += numberOfEntries;
+  } else {
+    char exponent;
+    long int mantissa;
+    char* pMantissa = reinterpret_cast<char*>( &(mantissa) );
+    const char* packed = reinterpret_cast<const char*>( buffer.data()+position );
+    for (int i=0; i<numberOfEntries; i++) {
+      exponent = *packed;
+      packed++;
+      mantissa = 0;
+      for (int j=0; j<bytesForMantissa; j++) {
+        pMantissa[j] = *packed;
+        packed++;
+      }
+      data[i] = peano::heap::compose(exponent, mantissa, bytesForMantissa);
+    }
+    const int bytes = numberOfEntries * (bytesForMantissa+1);
+    position += (bytes+sizeof(double)-1)/sizeof(double);
+  }
+  assertion2(position<=static_cast<int>(buffer.size()),position,buffer.size());
+}
+
+void exahype::solvers::PackedCellMigration::sendCell(
+    const int                                    toRank,
+    const int                                    cellDescriptionsIndex,
+    const tarch::la::Vector<DIMENSIONS, double>& x,
+    const int                                    level) {
+  assertion1(ADERDGSolver::Heap::getInstance().isValidIndex(cellDescriptionsIndex),cellDescriptionsIndex);
+  assertion1(FiniteVolumesSolver::Heap::getInstance().isValidIndex(cellDescriptionsIndex),cellDescriptionsIndex);
+
+  ADERDGSolver::prepareCellDescriptionsForSending(cellDescriptionsIndex);
+
+  const auto& aderdgCellDescriptions = ADERDGSolver::Heap::getInstance().getData(cellDescriptionsIndex);
+  const auto& finiteVolumesCellDescriptions = FiniteVolumesSolver::Heap::getInstance().getData(cellDescriptionsIndex);
+
+  std::vector<double> buffer;
+  buffer.reserve(
+      2 +
+      aderdgCellDescriptions.size()        * getDoublesPerRecord<ADERDGSolver::CellDescription>() +
+      finiteVolumesCellDescriptions.size() * getDoublesPerRecord<FiniteVolumesSolver::CellDescription>());
+  buffer.push_back(aderdgCellDescriptions.size());
+  buffer.push_back(finiteVolumesCellDescriptions.size());
+  appendRecords(buffer,aderdgCellDescriptions);
+  appendRecords(buffer,finiteVolumesCellDescriptions);
+
+  for (const auto& cellDescription : aderdgCellDescriptions) {
+    if (cellDescription.getType()==ADERDGSolver::CellDescription::Type::Cell) {
+      assertion1(DataHeap::getInstance().isValidIndex(cellDescription.getSolution()),cellDescription.toString());
+      appendArray(buffer,
+          DataHeap::getInstance().getData(cellDescription.getSolution()).data(),
+          getADERDGSolver(cellDescription.getSolverNumber())->getUnknownsPerCell());
+    }
+  }
+  for (const auto& cellDescription : finiteVolumesCellDescriptions) {
+    if (cellDescription.getType()==FiniteVolumesSolver::CellDescription::Type::Cell) {
+      assertion1(DataHeap::getInstance().isValidIndex(cellDescription.getSolution()),cellDescription.toString());
+      const auto* solver = getFiniteVolumesSolver(cellDescription.getSolverNumber());
+      appendArray(buffer,
+          DataHeap::getInstance().getData(cellDescription.getSolution()).data(),
+          solver->getUnknownsPerPatch()+solver->getGhostValuesPerPatch());
+    }
+  }
+
+  logDebug("sendCell(...)","send " << aderdgCellDescriptions.size() << " ADER-DG and " <<
+           finiteVolumesCellDescriptions.size() << " finite volumes cell descriptions in " <<
+           buffer.size() << " doubles to rank " << toRank <<
+           " at (center=" << x.toString() << ",level=" << level << ")");
+
+  DataHeap::getInstance().sendData(
+      buffer.data(), buffer.size(), toRank, x, level,
+      peano::heap::MessageType::ForkOrJoinCommunication);
+}
+
+void exahype::solvers::PackedCellMigration::sendEmptyCell(
+    const int                                    toRank,
+    const tarch::la::Vector<DIMENSIONS, double>& x,
+    const int                                    level) {
+  std::vector<double> emptyMessage(0);
+  DataHeap::getInstance().sendData(
+      emptyMessage, toRank, x, level,
+      peano::heap::MessageType::ForkOrJoinCommunication);
+}
+
+void exahype::solvers::PackedCellMigration::mergeCell(
+    const int                                    fromRank,
+    exahype::Cell&                               localCell,
+    const tarch::la::Vector<DIMENSIONS, double>& x,
+    const int                                    level) {
+  std::vector<double> buffer = DataHeap::getInstance().receiveData(
+      fromRank, x, level, peano::heap::MessageType::ForkOrJoinCommunication);
+  if (buffer.empty()) {
+    return;
+  }
+
+  int position = 0;
+  const int numberOfADERDGCellDescriptions        = static_cast<int>(buffer[position++]);
+  const int numberOfFiniteVolumesCellDescriptions = static_cast<int>(buffer[position++]);
+
+  ADERDGSolver::Heap::HeapEntries        receivedADERDGCellDescriptions;
+  FiniteVolumesSolver::Heap::HeapEntries receivedFiniteVolumesCellDescriptions;
+  readRecords(buffer,position,numberOfADERDGCellDescriptions,receivedADERDGCellDescriptions);
+  readRecords(buffer,position,numberOfFiniteVolumesCellDescriptions,receivedFiniteVolumesCellDescriptions);
+
+  logDebug("mergeCell(...)","received " << numberOfADERDGCellDescriptions << " ADER-DG and " <<
+           numberOfFiniteVolumesCellDescriptions << " finite volumes cell descriptions in " <<
+           buffer.size() << " doubles from rank " << fromRank <<
+           " at (center=" << x.toString() << ",level=" << level << ")");
+
+  ADERDGSolver::mergeCellDescriptionsWithReceivedData(
+      receivedADERDGCellDescriptions,localCell,x,level);
+  FiniteVolumesSolver::mergeCellDescriptionsWithReceivedData(
+      receivedFiniteVolumesCellDescriptions,localCell,x,level);
+
+  // The merge has allocated the arrays of the cell descriptions we did not hold before.
+  for (const auto& receivedCellDescription : receivedADERDGCellDescriptions) {
+    if (receivedCellDescription.getType()==ADERDGSolver::CellDescription::Type::Cell) {
+      for (auto& cellDescription : ADERDGSolver::Heap::getInstance().getData(localCell.getCellDescriptionsIndex())) {
+        if (cellDescription.getSolverNumber()==receivedCellDescription.getSolverNumber()) {
+          const int unknownsPerCell = getADERDGSolver(cellDescription.getSolverNumber())->getUnknownsPerCell();
+          assertion1(DataHeap::getInstance().isValidIndex(cellDescription.getSolution()),cellDescription.toString());
+          auto& solution = DataHeap::getInstance().getData(cellDescription.getSolution());
+          assertion2(static_cast<int>(solution.size())>=unknownsPerCell,solution.size(),unknownsPerCell);
+          readArray(buffer,position,solution.data(),unknownsPerCell);
+        }
+      }
+    }
+  }
+  for (const auto& receivedCellDescription : receivedFiniteVolumesCellDescriptions) {
+    if (receivedCellDescription.getType()==FiniteVolumesSolver::CellDescription::Type::Cell) {
+      for (auto& cellDescription : FiniteVolumesSolver::Heap::getInstance().getData(localCell.getCellDescriptionsIndex())) {
+        if (cellDescription.getSolverNumber()==receivedCellDescription.getSolverNumber()) {
+          const auto* solver = getFiniteVolumesSolver(cellDescription.getSolverNumber());
+          const int dataPerPatch = solver->getUnknownsPerPatch()+solver->getGhostValuesPerPatch();
+          assertion1(DataHeap::getInstance().isValidIndex(cellDescription.getSolution()),cellDescription.toString());
+          auto& solution = DataHeap::getInstance().getData(cellDescription.getSolution());
+          assertion2(static_cast<int>(solution.size())>=dataPerPatch,solution.size(),dataPerPatch);
+          readArray(buffer,position,solution.data(),dataPerPatch);
+        }
+      }
+    }
+  }
+  assertionEquals(position,static_cast<int>(buffer.size()));
+}
+
+#endif
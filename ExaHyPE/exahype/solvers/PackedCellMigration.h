@@ -0,0 +1,135 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_SOLVERS_PACKED_CELL_MIGRATION_H_
+#define _EXAHYPE_SOLVERS_PACKED_CELL_MIGRATION_H_
+
+#ifdef Parallel
+
+#include <vector>
+
+#include "tarch/la/Vector.h"
+#include "tarch/logging/Log.h"
+
+#include "peano/utils/Globals.h"
+
+namespace exahype {
+  class Cell;
+
+  namespace solvers {
+    class PackedCellMigration;
+  }
+
+  namespace tests {
+    namespace solvers {
+      class PackedCellMigrationTest;
+    }
+  }
+}
+
+/**
+ * Moves the cell descriptions of a cell and the solution of all its
+ * compute cells to another rank in a single message.
+ *
+ * Previously, a fork or join sent the ADER-DG and the finite volumes
+ * cell descriptions of a cell via the RLE heaps and then one data heap
+ * message per registered solver (two for a LimitingADERDGSolver), i.e.
+ * 2+2*(number of solvers) messages per cell. For large subtrees, the
+ * message latency dominated the fork and join.
+ *
+ * <h2>Message layout</h2>
+ *
+ * All data is packed into one buffer of doubles:
+ *
+ * - the number of ADER-DG and finite volumes cell descriptions;
+ * - the persistent records of the ADER-DG cell descriptions, followed
+ *   by the ones of the finite volumes cell descriptions. Each record
+ *   is copied bytewise and occupies a whole number of doubles;
+ * - the solution of each cell description of type Cell in the order of the
+ *   records. Each array is preceded by its number of entries and the
+ *   number of bytes used for the mantissae. If ADERDGSolver::CompressionAccuracy
+ *   is set, we store the solution with as few bytes as the accuracy admits
+ *   (see peano::heap::findMostAgressiveCompression()). Otherwise, we copy it.
+ *
+ * An empty buffer is sent for cells which are not initialised.
+ *
+ * The receiver merges the cell descriptions as
+ * ADERDGSolver::mergeCellDescriptionsWithRemoteData(...) and
+ * FiniteVolumesSolver::mergeCellDescriptionsWithRemoteData(...) do and writes
+ * the solution directly into the heap arrays of the local cell descriptions.
+ *
+ * \note Sender and receiver have to be built with the same cell description
+ * records as we copy the records bytewise.
+ */
+class exahype::solvers::PackedCellMigration {
+  private:
+    friend class exahype::tests::solvers::PackedCellMigrationTest;
+
+    static tarch::logging::Log _log;
+
+    /**
+     * Appends \p numberOfEntries, the number of bytes per mantissa,
+     * and the (compressed) \p data to \p buffer.
+     */
+    static void appendArray(
+        std::vector<double>& buffer,
+        const double* const  data,
+        const int            numberOfEntries);
+
+    /**
+     * Reads an array written by appendArray(...) from \p buffer starting
+     * at \p position into \p data, which must hold at least \p numberOfEntries
+     * entries. Advances \p position.
+     */
+    static void readArray(
+        const std::vector<double>& buffer,
+        int&                       position,
+        double* const              data,
+        const int                  numberOfEntries);
+
+  public:
+    /**
+     * Sends the cell descriptions and the solution of the cell at
+     * \p cellDescriptionsIndex to rank \p toRank.
+     *
+     * Calls ADERDGSolver::prepareCellDescriptionsForSending(...) first.
+     * The cell descriptions are not erased.
+     */
+    static void sendCell(
+        const int                                    toRank,
+        const int                                    cellDescriptionsIndex,
+        const tarch::la::Vector<DIMENSIONS, double>& x,
+        const int                                    level);
+
+    /**
+     * Sends an empty message to rank \p toRank.
+     */
+    static void sendEmptyCell(
+        const int                                    toRank,
+        const tarch::la::Vector<DIMENSIONS, double>& x,
+        const int                                    level);
+
+    /**
+     * Receives a message sent by sendCell(...) or sendEmptyCell(...)
+     * from rank \p fromRank and merges it into \p localCell.
+     */
+    static void mergeCell(
+        const int                                    fromRank,
+        exahype::Cell&                               localCell,
+        const tarch::la::Vector<DIMENSIONS, double>& x,
+        const int                                    level);
+};
+
+#endif
+
+#endif
@@ -36,16 +36,19 @@ tarch::logging::Log exahype::solvers::Solver::_log( "exahype::solvers::Solver");
 void exahype::solvers::initialiseSolverFlags(exahype::solvers::SolverFlags& solverFlags) {
   assertion(solverFlags._limiterDomainChange==nullptr);
   assertion(solverFlags._meshUpdateRequest  ==nullptr);
+  assertion(solverFlags._attainedStableState==nullptr);
 
   int numberOfSolvers    = exahype::solvers::RegisteredSolvers.size();
   solverFlags._limiterDomainChange = new LimiterDomainChange[numberOfSolvers];
   solverFlags._meshUpdateRequest   = new bool               [numberOfSolvers];
+  solverFlags._attainedStableState = new bool               [numberOfSolvers];
 }
 
 void exahype::solvers::prepareSolverFlags(exahype::solvers::SolverFlags& solverFlags) {
   for (unsigned int solverNumber=0; solverNumber < exahype::solvers::RegisteredSolvers.size(); ++solverNumber) {
     solverFlags._limiterDomainChange[solverNumber] = LimiterDomainChange::Regular;
     solverFlags._meshUpdateRequest[solverNumber]   = false;
+    solverFlags._attainedStableState[solverNumber] = true;
   }
 }
 
@@ -53,11 +56,14 @@ void exahype::solvers::deleteSolverFlags(exahype::solvers::SolverFlags& solverFl
   if (solverFlags._limiterDomainChange!=nullptr) {
     assertion(solverFlags._limiterDomainChange!=nullptr);
     assertion(solverFlags._meshUpdateRequest  !=nullptr);
+    assertion(solverFlags._attainedStableState!=nullptr);
 
     delete[] solverFlags._limiterDomainChange;
     delete[] solverFlags._meshUpdateRequest;
+    delete[] solverFlags._attainedStableState;
     solverFlags._limiterDomainChange = nullptr;
     solverFlags._meshUpdateRequest   = nullptr;
+    solverFlags._attainedStableState = nullptr;
   }
 }
 
@@ -123,6 +129,36 @@ exahype::solvers::Solver::Solver(
       _nextAttainedStableState(false){ }
 
 
+void exahype::solvers::Solver::addInSituReduction(
+    const std::string& name,const int unknown,
+    const plotters::ascii::InSituReductions::Kind kind) {
+  if (_inSituReductions==nullptr) {
+    _inSituReductions.reset(new plotters::ascii::InSituReductions(_numberOfVariables+_numberOfParameters));
+  }
+  _inSituReductions->add(name,unknown,kind);
+}
+
+void exahype::solvers::Solver::addInSituReduction(
+    const std::string& name,
+    const plotters::ascii::InSituReductions::Integrand& integrand,
+    const plotters::ascii::InSituReductions::Kind kind) {
+  if (_inSituReductions==nullptr) {
+    _inSituReductions.reset(new plotters::ascii::InSituReductions(_numberOfVariables+_numberOfParameters));
+  }
+  _inSituReductions->add(name,integrand,kind);
+}
+
+void exahype::solvers::Solver::setInSituReductionsOutput(const std::string& filename,const int timeStepInterval) {
+  if (_inSituReductions==nullptr) {
+    _inSituReductions.reset(new plotters::ascii::InSituReductions(_numberOfVariables+_numberOfParameters));
+  }
+  _inSituReductions->setOutput(filename,timeStepInterval);
+}
+
+exahype::plotters::ascii::InSituReductions* exahype::solvers::Solver::getInSituReductions() const {
+  return _inSituReductions.get();
+}
+
 std::string exahype::solvers::Solver::getIdentifier() const {
   return _identifier;
 }
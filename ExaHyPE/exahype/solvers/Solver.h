@@ -34,6 +34,8 @@
 #include "exahype/profilers/Profiler.h"
 #include "exahype/profilers/simple/NoOpProfiler.h"
 
+#include "exahype/plotters/ascii/InSituReductions.h"
+
 #include "multiscalelinkedcell/HangingVertexBookkeeper.h"
 
 // Some helpers
@@ -373,6 +375,16 @@ public:
    * if the solver has requested a mesh update.
    */
   bool* _meshUpdateRequest = nullptr;
+
+  /**
+   * Per solver, we hold a flag indicating
+   * if none of the cells has changed its
+   * status during the traversal.
+   *
+   * The status spreading stops as soon
+   * as this flag holds for all solvers.
+   */
+  bool* _attainedStableState = nullptr;
 };
 
 /**
@@ -700,6 +712,40 @@ class exahype::solvers::Solver {
    */
   bool _nextAttainedStableState;
 
+  /**
+   * The in-situ reductions declared by the user solver.
+   * Is nullptr if no reduction was declared.
+   *
+   * @see addInSituReduction(...)
+   */
+  std::unique_ptr<plotters::ascii::InSituReductions> _inSituReductions;
+
+  /**
+   * Declares an in-situ reduction of the unknown or parameter with
+   * index \p unknown. The reduction is computed by the SolutionUpdate
+   * mapping while the solution is updated; see plotters::ascii::InSituReductions.
+   *
+   * Call this method from your solver's init(...) routine.
+   */
+  void addInSituReduction(
+      const std::string& name,const int unknown,
+      const plotters::ascii::InSituReductions::Kind kind);
+
+  /**
+   * Declares an in-situ reduction of the value of \p integrand,
+   * which receives the unknowns and parameters of a point.
+   */
+  void addInSituReduction(
+      const std::string& name,
+      const plotters::ascii::InSituReductions::Integrand& integrand,
+      const plotters::ascii::InSituReductions::Kind kind);
+
+  /**
+   * Writes the in-situ reductions to \p filename every
+   * \p timeStepInterval time steps.
+   */
+  void setInSituReductionsOutput(const std::string& filename,const int timeStepInterval);
+
  public:
   Solver(const std::string& identifier, exahype::solvers::Solver::Type type,
          int numberOfVariables, int numberOfParameters,
@@ -1234,6 +1280,24 @@ class exahype::solvers::Solver {
       exahype::Vertex* const fineGridVertices,
       const peano::grid::VertexEnumerator& fineGridVerticesEnumerator) = 0;
 
+  /**
+   * @return the in-situ reductions declared by the user solver
+   * or nullptr if there are none.
+   */
+  virtual plotters::ascii::InSituReductions* getInSituReductions() const;
+
+  /**
+   * Accumulates the in-situ reductions of the solution of a cell
+   * description into \p accumulator. This is called directly after
+   * updateSolution(...) while the cell's solution is still in cache.
+   *
+   * Nop for cell descriptions which are not of type Cell.
+   */
+  virtual void reduceInSitu(
+      const int cellDescriptionsIndex,
+      const int element,
+      plotters::ascii::InSituReductions::Accumulator& accumulator) const = 0;
+
   /**
      * In this method, the solver can perform post-processing
      * operations, e.g., compression of the
@@ -1548,61 +1612,6 @@ class exahype::solvers::Solver {
       const tarch::la::Vector<DIMENSIONS, double>& x,
       const int                                    level) = 0;
 
-  /**
-   * Send solver data to master or worker rank. Read the data from
-   * the cell description \p element in
-   * the cell descriptions vector stored at \p
-   * cellDescriptionsIndex.
-   *
-   * \param[in] element Index of the cell description
-   *                    holding the data to send out in
-   *                    the array with address \p cellDescriptionsIndex.
-   *                    This is not the solver number.
-   */
-  virtual void sendDataToWorkerOrMasterDueToForkOrJoin(
-      const int                                    toRank,
-      const int                                    cellDescriptionsIndex,
-      const int                                    element,
-      const tarch::la::Vector<DIMENSIONS, double>& x,
-      const int                                    level) = 0;
-
-  /**
-   * Send empty solver data to master or worker rank
-   * due to fork or join.
-   */
-  virtual void sendEmptyDataToWorkerOrMasterDueToForkOrJoin(
-      const int                                    toRank,
-      const tarch::la::Vector<DIMENSIONS, double>& x,
-      const int                                    level) = 0;
-
-  /**
-   * Merge with solver data from master or worker rank
-   * that was sent out due to a fork or join. Wrote the data to
-   * the cell description \p element in
-   * the cell descriptions vector stored at \p
-   * cellDescriptionsIndex.
-   *
-   * \param[in] element Index of the cell description
-   *                    holding the data to send out in
-   *                    the array with address \p cellDescriptionsIndex.
-   *                    This is not the solver number.
-   */
-  virtual void mergeWithWorkerOrMasterDataDueToForkOrJoin(
-      const int                                    fromRank,
-      const int                                    cellDescriptionsIndex,
-      const int                                    element,
-      const tarch::la::Vector<DIMENSIONS, double>& x,
-      const int                                    level) = 0;
-
-  /**
-   * Drop solver data from master or worker rank
-   * that was sent out due to a fork or join.
-   */
-  virtual void dropWorkerOrMasterDataDueToForkOrJoin(
-      const int                                    fromRank,
-      const tarch::la::Vector<DIMENSIONS, double>& x,
-      const int                                    level) = 0;
-
   ///////////////////////////////////
   // WORKER->MASTER
   ///////////////////////////////////
@@ -1653,6 +1662,29 @@ class exahype::solvers::Solver {
       const tarch::la::Vector<DIMENSIONS, double>& x,
       const int                                    level) = 0;
 
+  /**
+   * Compile the global time step data of this rank into a message
+   * that is reduced with a single elementwise minimum over all ranks,
+   * i.e. entries that are originally maximised or or-ed
+   * are stored negated.
+   *
+   * In contrast to sendDataToMaster(...), this message is compiled
+   * before startNewTimeStep() is called, i.e. it contains the
+   * "next" values.
+   *
+   * \see exahype::mappings::TimeStepSizeComputation::endIteration,
+   * mergeWithGloballyReducedTimeStepData
+   */
+  virtual DataHeap::HeapEntries compileTimeStepDataForGlobalReduction() const = 0;
+
+  /**
+   * Overwrite the "next" time step data fields with the
+   * entries of the globally reduced \p message.
+   *
+   * \see compileTimeStepDataForGlobalReduction
+   */
+  virtual void mergeWithGloballyReducedTimeStepData(const DataHeap::HeapEntries& message) = 0;
+
   /**
    * Compile a message containing mesh update flags
    * for the master.
@@ -93,6 +93,9 @@ void exahype::solvers::initialiseTemporaryVariables(exahype::solvers::Prediction
          //
         temporaryVariables._tempStateSizedVectors[solverNumber] = new double[aderdgSolver->getTempStateSizedVectorsSize()];
         #endif
+        // the padding entries have to be zero
+        std::memset(temporaryVariables._tempUnknowns    [solverNumber], 0, sizeof(double)*aderdgSolver->getTempUnknownsSize());
+        std::memset(temporaryVariables._tempFluxUnknowns[solverNumber], 0, sizeof(double)*aderdgSolver->getTempFluxUnknownsSize());
 
         if(aderdgSolver->usePointSource()) { //TODO KD
           #ifdef ALIGNMENT
@@ -116,9 +119,9 @@ void exahype::solvers::initialiseTemporaryVariables(exahype::solvers::Prediction
               new double[aderdgSolver->getTempSpaceTimeFluxUnknownsSize()]();
         }
         //
-        temporaryVariables._tempUnknowns    [solverNumber]      = new double[aderdgSolver->getTempUnknownsSize()];
+        temporaryVariables._tempUnknowns    [solverNumber]      = new double[aderdgSolver->getTempUnknownsSize()]();
         //
-        temporaryVariables._tempFluxUnknowns[solverNumber]      = new double[aderdgSolver->getTempFluxUnknownsSize()];
+        temporaryVariables._tempFluxUnknowns[solverNumber]      = new double[aderdgSolver->getTempFluxUnknownsSize()]();
          //
         temporaryVariables._tempStateSizedVectors[solverNumber] = new double[aderdgSolver->getTempStateSizedVectorsSize()];
 
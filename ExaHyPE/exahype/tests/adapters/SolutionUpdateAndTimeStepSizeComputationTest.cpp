@@ -0,0 +1,101 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+
+#include "exahype/tests/adapters/SolutionUpdateAndTimeStepSizeComputationTest.h"
+
+#include "tarch/compiler/CompilerSpecificSettings.h"
+#include "tarch/tests/TestCaseFactory.h"
+
+#include "exahype/State.h"
+#include "exahype/adapters/SolutionUpdateAndTimeStepSizeComputation.h"
+#include "exahype/tests/solvers/DummyADERDGSolver.h"
+
+#include <string>
+#include <vector>
+
+registerTest(exahype::tests::adapters::SolutionUpdateAndTimeStepSizeComputationTest)
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", off)
+#endif
+
+namespace {
+  /**
+   * Records the calls the mappings make on the solver at
+   * the begin and at the end of an iteration.
+   */
+  class RecordingADERDGSolver : public exahype::tests::solvers::DummyADERDGSolver {
+    public:
+      std::vector<std::string> events;
+
+      void setNextMeshUpdateRequest() override {
+        events.push_back("setNextMeshUpdateRequest");
+        DummyADERDGSolver::setNextMeshUpdateRequest();
+      }
+
+      void updateNextMeshUpdateRequest(const bool& meshUpdateRequest) override {
+        events.push_back("updateNextMeshUpdateRequest");
+        DummyADERDGSolver::updateNextMeshUpdateRequest(meshUpdateRequest);
+      }
+
+      void startNewTimeStep() override {
+        events.push_back("startNewTimeStep");
+        DummyADERDGSolver::startNewTimeStep();
+      }
+  };
+}
+
+exahype::tests::adapters::SolutionUpdateAndTimeStepSizeComputationTest::SolutionUpdateAndTimeStepSizeComputationTest()
+    : tarch::tests::TestCase("exahype::tests::adapters::SolutionUpdateAndTimeStepSizeComputationTest") {
+}
+
+exahype::tests::adapters::SolutionUpdateAndTimeStepSizeComputationTest::~SolutionUpdateAndTimeStepSizeComputationTest() {}
+
+void exahype::tests::adapters::SolutionUpdateAndTimeStepSizeComputationTest::run() {
+  testMethod(testMappingEventOrder);
+}
+
+void exahype::tests::adapters::SolutionUpdateAndTimeStepSizeComputationTest::testMappingEventOrder() {
+  RecordingADERDGSolver solver;
+  solver.setMinPredictorTimeStamp(0.0);
+  solver.setMinPredictorTimeStepSize(0.1);
+  // as if the traversal had visited a cell
+  solver.updateNextMinCellSize(0.1);
+  solver.updateNextMaxCellSize(0.1);
+  exahype::solvers::RegisteredSolvers.push_back(&solver);
+
+  // no communication
+  exahype::State state;
+  state.setAlgorithmSection(exahype::records::State::AlgorithmSection::TimeStepping);
+  state.switchToSolutionUpdateContext();
+
+  {
+    exahype::adapters::SolutionUpdateAndTimeStepSizeComputation adapter;
+    adapter.beginIteration(state);
+    validateEquals(solver.events.size(),1u);
+    validateEquals(solver.events[0],"setNextMeshUpdateRequest"); // SolutionUpdate
+
+    solver.events.clear();
+    adapter.endIteration(state);
+  }
+  exahype::solvers::RegisteredSolvers.pop_back();
+
+  validateEquals(solver.events.size(),3u);
+  validateEquals(solver.events[0],"updateNextMeshUpdateRequest"); // SolutionUpdate
+  validateEquals(solver.events[1],"startNewTimeStep");            // TimeStepSizeComputation
+  validateEquals(solver.events[2],"setNextMeshUpdateRequest");    // TimeStepSizeComputation
+}
+
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", on)
+#endif
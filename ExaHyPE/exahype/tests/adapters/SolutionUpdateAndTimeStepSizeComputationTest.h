@@ -0,0 +1,50 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+
+#ifndef _EXAHYPE_TESTS_ADAPTERS_SOLUTION_UPDATE_AND_TIME_STEP_SIZE_COMPUTATION_TEST_H_
+#define _EXAHYPE_TESTS_ADAPTERS_SOLUTION_UPDATE_AND_TIME_STEP_SIZE_COMPUTATION_TEST_H_
+
+#include "tarch/tests/TestCase.h"
+
+namespace exahype {
+namespace tests {
+namespace adapters {
+class SolutionUpdateAndTimeStepSizeComputationTest;
+}
+}
+}
+
+/**
+ * Tests the adapter which fuses the solution update and
+ * the time step size computation into one traversal.
+ */
+class exahype::tests::adapters::SolutionUpdateAndTimeStepSizeComputationTest : public tarch::tests::TestCase {
+ private:
+  /**
+   * Runs the begin and end of an iteration of the adapter with a
+   * registered solver which records the calls of the mappings.
+   * The SolutionUpdate mapping has to merge its mesh update request
+   * before the TimeStepSizeComputation mapping starts the new
+   * time step, which moves the request into the solver's current state.
+   */
+  void testMappingEventOrder();
+
+ public:
+  SolutionUpdateAndTimeStepSizeComputationTest();
+  virtual ~SolutionUpdateAndTimeStepSizeComputationTest();
+
+  virtual void run();
+};
+
+#endif
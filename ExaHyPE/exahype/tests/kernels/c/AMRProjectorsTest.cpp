@@ -0,0 +1,258 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/tests/kernels/c/AMRProjectorsTest.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "tarch/compiler/CompilerSpecificSettings.h"
+#include "tarch/la/ScalarOperations.h"
+#include "tarch/tests/TestCaseFactory.h"
+
+#include "kernels/GaussLegendreQuadrature.h"
+#include "kernels/aderdg/generic/Kernels.h"
+
+registerTest(exahype::tests::c::AMRProjectorsTest)
+
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", off)
+#endif
+
+tarch::logging::Log exahype::tests::c::AMRProjectorsTest::_log( "exahype::tests::c::AMRProjectorsTest" );
+
+namespace exahype {
+namespace tests {
+namespace c {
+
+constexpr int    AMRProjectorsTest::Order;
+constexpr int    AMRProjectorsTest::NumberOfVariables;
+constexpr int    AMRProjectorsTest::NumberOfParameters;
+constexpr double AMRProjectorsTest::eps;
+
+namespace {
+  constexpr int BasisSize      = 4;
+  constexpr int NumberOfData   = 3;
+  constexpr int CoarseLevel    = 1;
+  constexpr int MaxLevelDelta  = 3;
+
+  /**
+   * Decodes the linear index \p subinterval of a fine grid cell or face
+   * into one subinterval index per axis, first axis running fastest.
+   */
+  void delinearise(int* const subintervalIndex, const int numberOfAxes, const int subintervalsPerAxis, int subinterval) {
+    for (int axis=0; axis<numberOfAxes; axis++) {
+      subintervalIndex[axis] = subinterval % subintervalsPerAxis;
+      subinterval           /= subintervalsPerAxis;
+    }
+  }
+}
+
+AMRProjectorsTest::AMRProjectorsTest()
+    : tarch::tests::TestCase("exahype::tests::c::AMRProjectorsTest") {}
+
+AMRProjectorsTest::~AMRProjectorsTest() {}
+
+void AMRProjectorsTest::run() {
+  static_assert(BasisSize==Order+1,"BasisSize must match Order");
+  static_assert(NumberOfData==NumberOfVariables+NumberOfParameters,"NumberOfData must match the number of unknowns");
+
+  testMethod(testVolumeUnknownsProlongation);
+  testMethod(testVolumeUnknownsRestriction);
+  testMethod(testFaceUnknownsProlongation);
+  testMethod(testFaceUnknownsRestriction);
+}
+
+double AMRProjectorsTest::polynomial(const double* const x, const int numberOfAxes, const int unknown) {
+  double result = 1.0;
+  for (int d=0; d<numberOfAxes; d++) {
+    const double s = x[d];
+    // degree Order=3 per axis
+    result *= (1.0+unknown) + (d+1.0)*s - (2.0+unknown)*s*s + 0.5*(d+1.0)*s*s*s;
+  }
+  return result;
+}
+
+void AMRProjectorsTest::sample(
+    double* const values, const int numberOfAxes, const int numberOfUnknowns,
+    const int levelDelta, const int* const subintervalIndex) {
+  const int subintervalsPerAxis = tarch::la::aPowI(levelDelta,3);
+  const int numberOfNodes       = tarch::la::aPowI(numberOfAxes,BasisSize);
+
+  int    node[DIMENSIONS];
+  double x[DIMENSIONS];
+  for (int n=0; n<numberOfNodes; n++) {
+    delinearise(node,numberOfAxes,BasisSize,n);
+    for (int d=0; d<numberOfAxes; d++) {
+      x[d] = (subintervalIndex[d] + kernels::gaussLegendreNodes[Order][node[d]]) / subintervalsPerAxis;
+    }
+    for (int unknown=0; unknown<numberOfUnknowns; unknown++) {
+      values[n*numberOfUnknowns+unknown] = polynomial(x,numberOfAxes,unknown);
+    }
+  }
+}
+
+void AMRProjectorsTest::testVolumeUnknownsProlongation() {
+  logInfo("testVolumeUnknownsProlongation()", "Test multi-level volume unknowns prolongation, ORDER=3");
+
+  const int size = tarch::la::aPowI(DIMENSIONS,BasisSize)*NumberOfData;
+  std::vector<double> luhCoarse(size), luhFine(size), expected(size);
+
+  const int coarseIndex[DIMENSIONS] = {0};
+  sample(luhCoarse.data(),DIMENSIONS,NumberOfData,0,coarseIndex);
+
+  for (int levelDelta=2; levelDelta<=MaxLevelDelta; levelDelta++) {
+    const int subintervalsPerAxis = tarch::la::aPowI(levelDelta,3);
+    const int numberOfSubcells    = tarch::la::aPowI(DIMENSIONS,subintervalsPerAxis);
+    for (int subcell=0; subcell<numberOfSubcells; subcell++) {
+      int subintervalIndex[DIMENSIONS];
+      delinearise(subintervalIndex,DIMENSIONS,subintervalsPerAxis,subcell);
+      tarch::la::Vector<DIMENSIONS,int> subcellIndex;
+      for (int d=0; d<DIMENSIONS; d++) {
+        subcellIndex[d] = subintervalIndex[d];
+      }
+
+      kernels::aderdg::generic::c::volumeUnknownsProlongation<NumberOfVariables,NumberOfParameters,BasisSize>(
+          luhFine.data(),luhCoarse.data(),CoarseLevel,CoarseLevel+levelDelta,subcellIndex);
+
+      sample(expected.data(),DIMENSIONS,NumberOfData,levelDelta,subintervalIndex);
+      for (int i=0; i<size; i++) {
+        validateNumericalEqualsWithEpsWithParams1(luhFine[i],expected[i],eps,subcell);
+      }
+    }
+  }
+}
+
+void AMRProjectorsTest::testVolumeUnknownsRestriction() {
+  logInfo("testVolumeUnknownsRestriction()", "Test multi-level volume unknowns restriction, ORDER=3");
+
+  const int size = tarch::la::aPowI(DIMENSIONS,BasisSize)*NumberOfData;
+  std::vector<double> luhCoarse(size), luhFine(size), expected(size);
+
+  const int coarseIndex[DIMENSIONS] = {0};
+  sample(expected.data(),DIMENSIONS,NumberOfData,0,coarseIndex);
+
+  for (int levelDelta=2; levelDelta<=MaxLevelDelta; levelDelta++) {
+    const int subintervalsPerAxis = tarch::la::aPowI(levelDelta,3);
+    const int numberOfSubcells    = tarch::la::aPowI(DIMENSIONS,subintervalsPerAxis);
+
+    // the kernel adds the contributions of all fine grid cells
+    std::fill(luhCoarse.begin(),luhCoarse.end(),0.0);
+    for (int subcell=0; subcell<numberOfSubcells; subcell++) {
+      int subintervalIndex[DIMENSIONS];
+      delinearise(subintervalIndex,DIMENSIONS,subintervalsPerAxis,subcell);
+      tarch::la::Vector<DIMENSIONS,int> subcellIndex;
+      for (int d=0; d<DIMENSIONS; d++) {
+        subcellIndex[d] = subintervalIndex[d];
+      }
+
+      sample(luhFine.data(),DIMENSIONS,NumberOfData,levelDelta,subintervalIndex);
+      kernels::aderdg::generic::c::volumeUnknownsRestriction<NumberOfVariables,NumberOfParameters,BasisSize>(
+          luhCoarse.data(),luhFine.data(),CoarseLevel,CoarseLevel+levelDelta,subcellIndex);
+    }
+
+    for (int i=0; i<size; i++) {
+      validateNumericalEqualsWithEpsWithParams1(luhCoarse[i],expected[i],eps,levelDelta);
+    }
+  }
+}
+
+void AMRProjectorsTest::testFaceUnknownsProlongation() {
+  logInfo("testFaceUnknownsProlongation()", "Test multi-level face unknowns prolongation, ORDER=3");
+
+  const int numberOfNodes = tarch::la::aPowI(DIMENSIONS-1,BasisSize);
+  std::vector<double> lQhbndCoarse(numberOfNodes*NumberOfData),      lQhbndFine(numberOfNodes*NumberOfData);
+  std::vector<double> lFhbndCoarse(numberOfNodes*NumberOfVariables), lFhbndFine(numberOfNodes*NumberOfVariables);
+  std::vector<double> expectedQ(numberOfNodes*NumberOfData),         expectedF(numberOfNodes*NumberOfVariables);
+
+  const int coarseIndex[DIMENSIONS] = {0};
+  sample(lQhbndCoarse.data(),DIMENSIONS-1,NumberOfData,0,coarseIndex);
+  sample(lFhbndCoarse.data(),DIMENSIONS-1,NumberOfVariables,0,coarseIndex);
+
+  for (int levelDelta=2; levelDelta<=MaxLevelDelta; levelDelta++) {
+    const int subintervalsPerAxis = tarch::la::aPowI(levelDelta,3);
+    const int numberOfSubfaces    = tarch::la::aPowI(DIMENSIONS-1,subintervalsPerAxis);
+    for (int subface=0; subface<numberOfSubfaces; subface++) {
+      int subintervalIndex[DIMENSIONS];
+      delinearise(subintervalIndex,DIMENSIONS-1,subintervalsPerAxis,subface);
+      tarch::la::Vector<DIMENSIONS-1,int> subfaceIndex;
+      for (int d=0; d<DIMENSIONS-1; d++) {
+        subfaceIndex[d] = subintervalIndex[d];
+      }
+
+      kernels::aderdg::generic::c::faceUnknownsProlongation<NumberOfVariables,NumberOfParameters,BasisSize>(
+          lQhbndFine.data(),lFhbndFine.data(),lQhbndCoarse.data(),lFhbndCoarse.data(),
+          CoarseLevel,CoarseLevel+levelDelta,subfaceIndex);
+
+      sample(expectedQ.data(),DIMENSIONS-1,NumberOfData,levelDelta,subintervalIndex);
+      sample(expectedF.data(),DIMENSIONS-1,NumberOfVariables,levelDelta,subintervalIndex);
+      for (unsigned int i=0; i<expectedQ.size(); i++) {
+        validateNumericalEqualsWithEpsWithParams1(lQhbndFine[i],expectedQ[i],eps,subface);
+      }
+      for (unsigned int i=0; i<expectedF.size(); i++) {
+        validateNumericalEqualsWithEpsWithParams1(lFhbndFine[i],expectedF[i],eps,subface);
+      }
+    }
+  }
+}
+
+void AMRProjectorsTest::testFaceUnknownsRestriction() {
+  logInfo("testFaceUnknownsRestriction()", "Test multi-level face unknowns restriction, ORDER=3");
+
+  const int numberOfNodes = tarch::la::aPowI(DIMENSIONS-1,BasisSize);
+  std::vector<double> lQhbndCoarse(numberOfNodes*NumberOfData),      lQhbndFine(numberOfNodes*NumberOfData);
+  std::vector<double> lFhbndCoarse(numberOfNodes*NumberOfVariables), lFhbndFine(numberOfNodes*NumberOfVariables);
+  std::vector<double> expectedQ(numberOfNodes*NumberOfData),         expectedF(numberOfNodes*NumberOfVariables);
+
+  const int coarseIndex[DIMENSIONS] = {0};
+  sample(expectedQ.data(),DIMENSIONS-1,NumberOfData,0,coarseIndex);
+  sample(expectedF.data(),DIMENSIONS-1,NumberOfVariables,0,coarseIndex);
+
+  for (int levelDelta=2; levelDelta<=MaxLevelDelta; levelDelta++) {
+    const int subintervalsPerAxis = tarch::la::aPowI(levelDelta,3);
+    const int numberOfSubfaces    = tarch::la::aPowI(DIMENSIONS-1,subintervalsPerAxis);
+
+    // the kernel adds the contributions of all fine grid faces
+    std::fill(lQhbndCoarse.begin(),lQhbndCoarse.end(),0.0);
+    std::fill(lFhbndCoarse.begin(),lFhbndCoarse.end(),0.0);
+    for (int subface=0; subface<numberOfSubfaces; subface++) {
+      int subintervalIndex[DIMENSIONS];
+      delinearise(subintervalIndex,DIMENSIONS-1,subintervalsPerAxis,subface);
+      tarch::la::Vector<DIMENSIONS-1,int> subfaceIndex;
+      for (int d=0; d<DIMENSIONS-1; d++) {
+        subfaceIndex[d] = subintervalIndex[d];
+      }
+
+      sample(lQhbndFine.data(),DIMENSIONS-1,NumberOfData,levelDelta,subintervalIndex);
+      sample(lFhbndFine.data(),DIMENSIONS-1,NumberOfVariables,levelDelta,subintervalIndex);
+      kernels::aderdg::generic::c::faceUnknownsRestriction<NumberOfVariables,NumberOfParameters,BasisSize>(
+          lQhbndCoarse.data(),lFhbndCoarse.data(),lQhbndFine.data(),lFhbndFine.data(),
+          CoarseLevel,CoarseLevel+levelDelta,subfaceIndex);
+    }
+
+    for (unsigned int i=0; i<expectedQ.size(); i++) {
+      validateNumericalEqualsWithEpsWithParams1(lQhbndCoarse[i],expectedQ[i],eps,levelDelta);
+    }
+    for (unsigned int i=0; i<expectedF.size(); i++) {
+      validateNumericalEqualsWithEpsWithParams1(lFhbndCoarse[i],expectedF[i],eps,levelDelta);
+    }
+  }
+}
+
+}  // namespace c
+}  // namespace tests
+}  // namespace exahype
+
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", on)
+#endif
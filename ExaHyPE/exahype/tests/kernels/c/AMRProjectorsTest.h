@@ -0,0 +1,76 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_TESTS_AMR_PROJECTORS_TEST_H_
+#define _EXAHYPE_TESTS_AMR_PROJECTORS_TEST_H_
+
+#include "peano/utils/Globals.h"
+#include "tarch/logging/Log.h"
+#include "tarch/tests/TestCase.h"
+
+namespace exahype {
+namespace tests {
+namespace c {
+
+/**
+ * Checks the generic ADER-DG prolongation and restriction kernels across
+ * several levels, i.e. the composite projectors of amrProjectors.cpph.
+ *
+ * A polynomial of degree Order per axis lies in the DG space of every
+ * level. Prolongation thus has to reproduce it at the fine grid nodes and
+ * restricting it from all fine grid cells (faces) has to reproduce the
+ * coarse grid coefficients. GenericEulerKernelTest only checks constants
+ * and, for the volume, a single level.
+ */
+class AMRProjectorsTest : public tarch::tests::TestCase {
+ public:
+  AMRProjectorsTest();
+  virtual ~AMRProjectorsTest();
+
+  void run() override;
+
+ private:
+  static tarch::logging::Log _log;
+
+  static constexpr int    Order              = 3;
+  static constexpr int    NumberOfVariables  = 2;
+  static constexpr int    NumberOfParameters = 1;
+  static constexpr double eps                = 1.0e-9;
+
+  /**
+   * A polynomial of degree Order per coordinate axis in the first
+   * \p numberOfAxes coordinates of \p x. Every unknown uses
+   * different coefficients.
+   */
+  static double polynomial(const double* const x, const int numberOfAxes, const int unknown);
+
+  /**
+   * Samples polynomial(...) at the Gauss-Legendre nodes of the subinterval
+   * \p subintervalIndex per axis of a cell which is \p levelDelta levels
+   * finer than the unit cell.
+   */
+  static void sample(
+      double* const values, const int numberOfAxes, const int numberOfUnknowns,
+      const int levelDelta, const int* const subintervalIndex);
+
+  void testVolumeUnknownsProlongation();
+  void testVolumeUnknownsRestriction();
+  void testFaceUnknownsProlongation();
+  void testFaceUnknownsRestriction();
+};
+
+}  // namespace c
+}  // namespace tests
+}  // namespace exahype
+
+#endif  // _EXAHYPE_TESTS_AMR_PROJECTORS_TEST_H_
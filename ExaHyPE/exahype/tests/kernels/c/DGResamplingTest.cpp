@@ -0,0 +1,134 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/tests/kernels/c/DGResamplingTest.h"
+
+#include <vector>
+
+#include "tarch/compiler/CompilerSpecificSettings.h"
+#include "tarch/la/ScalarOperations.h"
+#include "tarch/tests/TestCaseFactory.h"
+
+#include "peano/utils/Loop.h"
+
+#include "kernels/GaussLegendreQuadrature.h"
+
+registerTest(exahype::tests::c::DGResamplingTest)
+
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", off)
+#endif
+
+tarch::logging::Log exahype::tests::c::DGResamplingTest::_log( "exahype::tests::c::DGResamplingTest" );
+
+namespace exahype {
+namespace tests {
+namespace c {
+
+constexpr int    DGResamplingTest::Order;
+constexpr int    DGResamplingTest::NumberOfUnknowns;
+constexpr double DGResamplingTest::eps;
+
+DGResamplingTest::DGResamplingTest()
+    : tarch::tests::TestCase("exahype::tests::c::DGResamplingTest") {}
+
+DGResamplingTest::~DGResamplingTest() {}
+
+void DGResamplingTest::run() {
+  testMethod(testEquidistantVertices);
+  testMethod(testEquidistantCellCentres);
+  testMethod(testGaussLegendreCellCentres);
+}
+
+double DGResamplingTest::polynomial(const double* const x, const int unknown) {
+  double result = 1.0;
+  for (int d=0; d<DIMENSIONS; d++) {
+    const double s = x[d];
+    // degree Order=3 per axis
+    result *= (1.0+unknown) + (d+1.0)*s - (2.0+unknown)*s*s + 0.5*(d+1.0)*s*s*s;
+  }
+  return result;
+}
+
+void DGResamplingTest::testResampling(const int numberOfPoints, const kernels::ResamplingPoints points) {
+  constexpr int basisSize = Order+1;
+
+  // nodal values, first coordinate running fastest
+  std::vector<double> u(tarch::la::aPowI(DIMENSIONS,basisSize)*NumberOfUnknowns);
+  dfor(i,basisSize) {
+    const int node = peano::utils::dLinearisedWithoutLookup(i,basisSize);
+    double x[DIMENSIONS];
+    for (int d=0; d<DIMENSIONS; d++) {
+      x[d] = kernels::gaussLegendreNodes[Order][i[d]];
+    }
+    for (int unknown=0; unknown<NumberOfUnknowns; unknown++) {
+      u[node*NumberOfUnknowns+unknown] = polynomial(x,unknown);
+    }
+  }
+
+  std::vector<double> xRef(numberOfPoints);
+  for (int p=0; p<numberOfPoints; p++) {
+    switch (points) {
+      case kernels::ResamplingPoints::EquidistantVertices:
+        xRef[p] = static_cast<double>(p)/(numberOfPoints-1);
+        break;
+      case kernels::ResamplingPoints::EquidistantCellCentres:
+        xRef[p] = (p+0.5)/numberOfPoints;
+        break;
+      case kernels::ResamplingPoints::GaussLegendreCellCentres:
+        xRef[p] = 0.5*(kernels::gaussLegendreNodes[Order][p]+kernels::gaussLegendreNodes[Order][p+1]);
+        break;
+    }
+  }
+
+  std::vector<double> result(tarch::la::aPowI(DIMENSIONS,numberOfPoints)*NumberOfUnknowns);
+  kernels::resample(u.data(),NumberOfUnknowns,Order,numberOfPoints,points,result.data());
+
+  dfor(p,numberOfPoints) {
+    const int point = peano::utils::dLinearisedWithoutLookup(p,numberOfPoints);
+    double x[DIMENSIONS];
+    for (int d=0; d<DIMENSIONS; d++) {
+      x[d] = xRef[p[d]];
+    }
+    for (int unknown=0; unknown<NumberOfUnknowns; unknown++) {
+      validateNumericalEqualsWithEpsWithParams1(
+          result[point*NumberOfUnknowns+unknown], polynomial(x,unknown), eps,
+          point*NumberOfUnknowns+unknown);
+    }
+  }
+}
+
+void DGResamplingTest::testEquidistantVertices() {
+  logInfo("testEquidistantVertices()", "Test resampling onto equidistant vertices, ORDER=3");
+  testResampling(2,kernels::ResamplingPoints::EquidistantVertices);
+  testResampling(7,kernels::ResamplingPoints::EquidistantVertices);
+}
+
+void DGResamplingTest::testEquidistantCellCentres() {
+  logInfo("testEquidistantCellCentres()", "Test resampling onto equidistant cell centres, ORDER=3");
+  testResampling(1,kernels::ResamplingPoints::EquidistantCellCentres);
+  testResampling(5,kernels::ResamplingPoints::EquidistantCellCentres);
+}
+
+void DGResamplingTest::testGaussLegendreCellCentres() {
+  logInfo("testGaussLegendreCellCentres()", "Test resampling onto the Gauss-Legendre cell centres, ORDER=3");
+  testResampling(Order,kernels::ResamplingPoints::GaussLegendreCellCentres);
+}
+
+}  // namespace c
+}  // namespace tests
+}  // namespace exahype
+
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", on)
+#endif
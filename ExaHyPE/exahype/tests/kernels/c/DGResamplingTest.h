@@ -0,0 +1,67 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_TESTS_DG_RESAMPLING_TEST_H_
+#define _EXAHYPE_TESTS_DG_RESAMPLING_TEST_H_
+
+#include "peano/utils/Globals.h"
+#include "tarch/logging/Log.h"
+#include "tarch/tests/TestCase.h"
+
+#include "kernels/DGResampling.h"
+
+namespace exahype {
+namespace tests {
+namespace c {
+
+/**
+ * Checks that kernels::resample(...) reproduces the DG polynomial exactly
+ * at all point sets the plotters use.
+ */
+class DGResamplingTest : public tarch::tests::TestCase {
+ public:
+  DGResamplingTest();
+  virtual ~DGResamplingTest();
+
+  void run() override;
+
+ private:
+  static tarch::logging::Log _log;
+
+  static constexpr int    Order            = 3;
+  static constexpr int    NumberOfUnknowns = 2;
+  static constexpr double eps              = 1.0e-10;
+
+  /**
+   * A polynomial of degree Order per coordinate axis. Every unknown
+   * uses different coefficients.
+   */
+  static double polynomial(const double* const x, const int unknown);
+
+  /**
+   * Samples polynomial(...) at the Gauss-Legendre nodes, resamples it onto
+   * \p numberOfPoints points of kind \p points per axis, and compares
+   * with polynomial(...) evaluated at these points.
+   */
+  void testResampling(const int numberOfPoints, const kernels::ResamplingPoints points);
+
+  void testEquidistantVertices();
+  void testEquidistantCellCentres();
+  void testGaussLegendreCellCentres();
+};
+
+}  // namespace c
+}  // namespace tests
+}  // namespace exahype
+
+#endif  // _EXAHYPE_TESTS_DG_RESAMPLING_TEST_H_
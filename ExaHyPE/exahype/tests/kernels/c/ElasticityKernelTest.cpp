@@ -49,6 +49,7 @@ void ElasticityKernelTest::run() {
 //  testMethod(testPDEFluxes);
   logWarning("run()","Test testSpaceTimePredictorLinear is disabled! Test data might be outdated.");
 //  testMethod(testSpaceTimePredictorLinear); // TODO(Dominic): Fix
+  testMethod(testSpaceTimePredictorLinearConstantCoefficients);
 //  testMethod(testSpaceTimePredictorNonlinear); // OPTIONAL
   testMethod(testVolumeIntegralLinear);
 //  testMethod(testVolumeIntegralNonlinear); // OPTIONAL
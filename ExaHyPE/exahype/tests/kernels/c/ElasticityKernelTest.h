@@ -35,6 +35,7 @@ class ElasticityKernelTest : public tarch::tests::TestCase {
 
   //  void testPDEFluxes();
   void testSpaceTimePredictorLinear();
+  void testSpaceTimePredictorLinearConstantCoefficients();
   //  void testSpaceTimePredictorNonlinear();
   void testVolumeIntegralLinear();
   //  void testVolumeIntegralNonlinear();
@@ -17,6 +17,7 @@
 #include <cstring>
 #include <limits>
 #include <numeric>
+#include <vector>
 
 #include "../testdata/elasticity_testdata.h"
 #include "kernels/KernelUtils.h"
@@ -534,6 +535,92 @@ void ElasticityKernelTest::testSurfaceIntegralLinear() {
 }
 
 
+void ElasticityKernelTest::testSpaceTimePredictorLinearConstantCoefficients() {
+  logInfo("ElasticityKernelTest::testSpaceTimePredictorLinearConstantCoefficients()",
+          "Test SpaceTimePredictor linear with constant coefficients, ORDER=4, DIM=2");
+
+  constexpr int nVar       = NumberOfVariables;
+  constexpr int nPar       = NumberOfParameters;
+  constexpr int nData      = nVar+nPar;
+  constexpr int basisSize  = (Order+1);
+  constexpr int basisSize2 = basisSize*basisSize;
+  constexpr int basisSize3 = basisSize2*basisSize;
+
+  // Assemble luh from the reference input but use the material of the first node everywhere
+  double luh[nData * basisSize2];
+  kernels::idx3 idx_luh(basisSize, basisSize, nData);
+  kernels::idx3 idx_luh_IN(basisSize, basisSize, nVar);
+  for (int i = 0; i < basisSize; i++) {
+    for (int j = 0; j < basisSize; j++) {
+      std::copy_n (exahype::tests::testdata::elasticity::testSpaceTimePredictorLinear::luh_IN + idx_luh_IN(i, j, 0),
+                   nVar, luh + idx_luh(i, j, 0));
+      std::copy_n (exahype::tests::testdata::elasticity::testSpaceTimePredictorLinear::param_IN,
+                   nPar, luh + idx_luh(i, j, nVar));
+    }
+  }
+
+  const tarch::la::Vector<DIMENSIONS, double> dx(38.4615384615385,
+                                                 35.7142857142857);
+  const double dt = 0.813172798364530;
+
+  // Reference: generic linear space-time predictor
+  std::vector<double> lQiRef(nData*basisSize2*(basisSize+1));
+  std::vector<double> lFiRef((2*DIMENSIONS+1)*nVar*basisSize3);
+  std::vector<double> gradQRef(DIMENSIONS*nVar*basisSize3);
+  double* tempSpaceTimeUnknownsRef[1]     = {lQiRef.data()};
+  double* tempSpaceTimeFluxUnknownsRef[2] = {lFiRef.data(), gradQRef.data()};
+
+  std::vector<double> lQhRef(nData*basisSize2);
+  std::vector<double> lFhRef((DIMENSIONS+1)*nVar*basisSize2);
+  std::vector<double> lQbndRef(2*DIMENSIONS*nData*basisSize);
+  std::vector<double> lFbndRef(2*DIMENSIONS*nVar*basisSize);
+
+  kernels::aderdg::generic::c::spaceTimePredictorLinear<false,false,false,true,ElasticityKernelTest>(
+      *this,
+      lQbndRef.data(), lFbndRef.data(),
+      tempSpaceTimeUnknownsRef,tempSpaceTimeFluxUnknownsRef,
+      lQhRef.data(),lFhRef.data(),
+      nullptr,
+      luh, dx, dt, nullptr);
+
+  // Constant coefficient variant
+  std::vector<double> tempSpaceTimeUnknownsStorage(3*nVar*basisSize2);
+  std::vector<double> tempSpaceTimeFluxUnknownsStorage(nVar*basisSize2);
+  double* tempSpaceTimeUnknowns[3] = {
+      tempSpaceTimeUnknownsStorage.data(),
+      tempSpaceTimeUnknownsStorage.data()+nVar*basisSize2,
+      tempSpaceTimeUnknownsStorage.data()+2*nVar*basisSize2};
+  double* tempSpaceTimeFluxUnknowns[1] = {tempSpaceTimeFluxUnknownsStorage.data()};
+
+  std::vector<double> lQh(nData*basisSize2);
+  std::vector<double> lFh((DIMENSIONS+1)*nVar*basisSize2);
+  std::vector<double> lQbnd(2*DIMENSIONS*nData*basisSize);
+  std::vector<double> lFbnd(2*DIMENSIONS*nVar*basisSize);
+
+  kernels::aderdg::generic::c::spaceTimePredictorLinearConstantCoefficients<ElasticityKernelTest>(
+      *this,
+      lQbnd.data(), lFbnd.data(),
+      tempSpaceTimeUnknowns,tempSpaceTimeFluxUnknowns,
+      lQh.data(),lFh.data(),
+      nullptr,
+      luh, dx, dt);
+
+  // Check result
+  for (int i = 0; i < nData*basisSize2; i++) {
+    validateNumericalEqualsWithEpsWithParams1(lQh[i], lQhRef[i], eps, i);
+  }
+  for (int i = 0; i < (DIMENSIONS+1)*nVar*basisSize2; i++) {
+    validateNumericalEqualsWithEpsWithParams1(lFh[i], lFhRef[i], eps, i);
+  }
+  for (int i = 0; i < 2*DIMENSIONS*nData*basisSize; i++) {
+    validateNumericalEqualsWithEpsWithParams1(lQbnd[i], lQbndRef[i], eps, i);
+  }
+  for (int i = 0; i < 2*DIMENSIONS*nVar*basisSize; i++) {
+    validateNumericalEqualsWithEpsWithParams1(lFbnd[i], lFbndRef[i], eps, i);
+  }
+}
+
+
 }  // namespace c
 }  // namespace tests
 }  // namespace exahype
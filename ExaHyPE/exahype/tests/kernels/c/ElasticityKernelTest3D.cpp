@@ -13,6 +13,10 @@
 
 #include "exahype/tests/kernels/c/ElasticityKernelTest.h"
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include "../testdata/elasticity_testdata.h"
 #include "kernels/KernelUtils.h"
 #include "kernels/aderdg/generic/Kernels.h"
@@ -23,7 +27,148 @@ namespace exahype {
 namespace tests {
 namespace c {
 
-// This test does not exist.
+/*
+ * Q stores parameters, F doesn't.
+ *
+ * The linear kernels only use the non-conservative product.
+ */
+void ElasticityKernelTest::flux(const double *Q, double **F) {
+  constexpr int nVar = NumberOfVariables;
+
+  for (int d = 0; d < DIMENSIONS; d++) {
+    std::fill_n (F[d], nVar, 0.0);
+  }
+}
+
+/*
+ * Q stores parameters, S doesn't.
+ */
+void ElasticityKernelTest::algebraicSource(const double *Q, double *S) {
+  constexpr int nVar = NumberOfVariables;
+
+  std::fill_n (S, nVar, 0.0);
+}
+
+void ElasticityKernelTest::eigenvalues(const double *const Q,
+                                           const int normalNonZeroIndex,
+                                           double *lambda) {
+  constexpr int nVar = NumberOfVariables;
+
+  std::fill_n (lambda, nVar, 0.0); // We can ignore the parameters here
+
+  double lam = Q[9];    // par(1)
+  double mu = Q[10];    // par(2)
+  double rho0 = Q[11];  // par(3)
+  double cp = std::sqrt((lam + 2 * mu) / rho0);
+  double cs = std::sqrt(mu / rho0);
+
+  lambda[1 - 1] = -cp;
+  lambda[2 - 1] = -cs;
+  lambda[3 - 1] = -cs;
+  lambda[7 - 1] = +cs;
+  lambda[8 - 1] = +cs;
+  lambda[9 - 1] = +cp;
+}
+
+/*
+ * Q stores parameters, gradQ and BgradQ doesn't.
+ */
+void ElasticityKernelTest::nonConservativeProduct(const double *const Q,
+                                   const double *const gradQ, double *BgradQ) {
+  constexpr int nVar = NumberOfVariables;
+
+  std::fill_n (BgradQ, nVar * DIMENSIONS, 0.0); // !!! For the linear kernels, BgradQ is a nVar*dim sized 2-tensor
+
+  double lam  = Q[NumberOfVariables];           // par(1)
+  double mu   = Q[NumberOfVariables + 1];       // par(2)
+  double irho = 1.0 / Q[NumberOfVariables + 2]; // 1.0 / par(3)
+
+  const double *gradQx = gradQ + 0 * nVar;
+  const double *gradQy = gradQ + 1 * nVar;
+  const double *gradQz = gradQ + 2 * nVar;
+
+  double *BgradQx = BgradQ + 0 * nVar;
+  double *BgradQy = BgradQ + 1 * nVar;
+  double *BgradQz = BgradQ + 2 * nVar;
+
+  BgradQx[1 - 1] = -(lam + 2 * mu) * gradQx[7 - 1];
+  BgradQx[2 - 1] = -lam * gradQx[7 - 1];
+  BgradQx[3 - 1] = -lam * gradQx[7 - 1];
+  BgradQx[4 - 1] = -mu * gradQx[8 - 1];
+  BgradQx[6 - 1] = -mu * gradQx[9 - 1];
+  BgradQx[7 - 1] = -irho * gradQx[1 - 1];
+  BgradQx[8 - 1] = -irho * gradQx[4 - 1];
+  BgradQx[9 - 1] = -irho * gradQx[6 - 1];
+
+  BgradQy[1 - 1] = -lam * gradQy[8 - 1];
+  BgradQy[2 - 1] = -(lam + 2 * mu) * gradQy[8 - 1];
+  BgradQy[3 - 1] = -lam * gradQy[8 - 1];
+  BgradQy[4 - 1] = -mu * gradQy[7 - 1];
+  BgradQy[5 - 1] = -mu * gradQy[9 - 1];
+  BgradQy[7 - 1] = -irho * gradQy[4 - 1];
+  BgradQy[8 - 1] = -irho * gradQy[2 - 1];
+  BgradQy[9 - 1] = -irho * gradQy[5 - 1];
+
+  BgradQz[1 - 1] = -lam * gradQz[9 - 1];
+  BgradQz[2 - 1] = -lam * gradQz[9 - 1];
+  BgradQz[3 - 1] = -(lam + 2 * mu) * gradQz[9 - 1];
+  BgradQz[5 - 1] = -mu * gradQz[8 - 1];
+  BgradQz[6 - 1] = -mu * gradQz[7 - 1];
+  BgradQz[7 - 1] = -irho * gradQz[6 - 1];
+  BgradQz[8 - 1] = -irho * gradQz[5 - 1];
+  BgradQz[9 - 1] = -irho * gradQz[3 - 1];
+}  // ncp
+
+void ElasticityKernelTest::coefficientMatrix(const double *const Q, const int normalNonZero, double *Bn) {
+  constexpr int nVar       = NumberOfVariables;
+  constexpr int nVar2      = nVar*nVar;
+
+  std::fill_n (Bn, nVar2, 0.0);
+
+  kernels::idx2 idx_Bn(nVar, nVar);
+
+  double lam = Q[9];          // par(1)
+  double mu = Q[10];          // par(2)
+  double irho = 1.0 / Q[11];  // 1./par(3)
+
+  switch (normalNonZero) {
+    case 0:
+      Bn[idx_Bn(7 - 1, 1 - 1)] = -(lam + 2 * mu);
+      Bn[idx_Bn(7 - 1, 2 - 1)] = -lam;
+      Bn[idx_Bn(7 - 1, 3 - 1)] = -lam;
+      Bn[idx_Bn(8 - 1, 4 - 1)] = -mu;
+      Bn[idx_Bn(9 - 1, 6 - 1)] = -mu;
+      Bn[idx_Bn(1 - 1, 7 - 1)] = -irho;
+      Bn[idx_Bn(4 - 1, 8 - 1)] = -irho;
+      Bn[idx_Bn(6 - 1, 9 - 1)] = -irho;
+      break;
+    case 1:
+      Bn[idx_Bn(8 - 1, 1 - 1)] = -lam;
+      Bn[idx_Bn(8 - 1, 2 - 1)] = -(lam + 2 * mu);
+      Bn[idx_Bn(8 - 1, 3 - 1)] = -lam;
+      Bn[idx_Bn(7 - 1, 4 - 1)] = -mu;
+      Bn[idx_Bn(9 - 1, 5 - 1)] = -mu;
+      Bn[idx_Bn(4 - 1, 7 - 1)] = -irho;
+      Bn[idx_Bn(2 - 1, 8 - 1)] = -irho;
+      Bn[idx_Bn(5 - 1, 9 - 1)] = -irho;
+      break;
+    case 2:
+      Bn[idx_Bn(9 - 1, 1 - 1)] = -lam;
+      Bn[idx_Bn(9 - 1, 2 - 1)] = -lam;
+      Bn[idx_Bn(9 - 1, 3 - 1)] = -(lam + 2 * mu);
+      Bn[idx_Bn(8 - 1, 5 - 1)] = -mu;
+      Bn[idx_Bn(7 - 1, 6 - 1)] = -mu;
+      Bn[idx_Bn(6 - 1, 7 - 1)] = -irho;
+      Bn[idx_Bn(5 - 1, 8 - 1)] = -irho;
+      Bn[idx_Bn(3 - 1, 9 - 1)] = -irho;
+      break;
+    default:
+      assert(false);
+      break;
+  }
+}  // matrixb
+
+// These tests do not exist.
 
 void ElasticityKernelTest::testRiemannSolverLinear() {}
 
@@ -33,6 +178,94 @@ void ElasticityKernelTest::testVolumeIntegralLinear() {}
 
 void ElasticityKernelTest::testSurfaceIntegralLinear() {}
 
+void ElasticityKernelTest::testSpaceTimePredictorLinearConstantCoefficients() {
+  logInfo("ElasticityKernelTest::testSpaceTimePredictorLinearConstantCoefficients()",
+          "Test SpaceTimePredictor linear with constant coefficients, ORDER=4, DIM=3");
+
+  constexpr int nVar       = NumberOfVariables;
+  constexpr int nPar       = NumberOfParameters;
+  constexpr int nData      = nVar+nPar;
+  constexpr int basisSize  = (Order+1);
+  constexpr int basisSize2 = basisSize*basisSize;
+  constexpr int basisSize3 = basisSize2*basisSize;
+  constexpr int basisSize4 = basisSize2*basisSize2;
+
+  // There is no 3D reference data. Use a smooth wave field and a constant material.
+  double luh[nData * basisSize3];
+  kernels::idx4 idx_luh(basisSize, basisSize, basisSize, nData);
+  for (int i = 0; i < basisSize; i++) {
+    for (int j = 0; j < basisSize; j++) {
+      for (int k = 0; k < basisSize; k++) {
+        for (int m = 0; m < nVar; m++) {
+          luh[idx_luh(i, j, k, m)] = std::sin(0.3*(m+1)*i + 0.2*j - 0.1*(m+2)*k);
+        }
+        luh[idx_luh(i, j, k, nVar+0)] = 2.0;  // lambda
+        luh[idx_luh(i, j, k, nVar+1)] = 1.0;  // mu
+        luh[idx_luh(i, j, k, nVar+2)] = 1.5;  // rho
+      }
+    }
+  }
+
+  const tarch::la::Vector<DIMENSIONS, double> dx(0.5, 0.4, 0.25);
+  const double dt = 0.05;
+
+  // Reference: generic linear space-time predictor
+  std::vector<double> lQiRef(nData*basisSize3*(basisSize+1));
+  std::vector<double> lFiRef((DIMENSIONS+1)*nVar*basisSize4);
+  std::vector<double> gradQRef(DIMENSIONS*nVar*basisSize4);
+  double* tempSpaceTimeUnknownsRef[1]     = {lQiRef.data()};
+  double* tempSpaceTimeFluxUnknownsRef[2] = {lFiRef.data(), gradQRef.data()};
+
+  std::vector<double> lQhRef(nData*basisSize3);
+  std::vector<double> lFhRef((DIMENSIONS+1)*nVar*basisSize3);
+  std::vector<double> lQbndRef(2*DIMENSIONS*nData*basisSize2);
+  std::vector<double> lFbndRef(2*DIMENSIONS*nVar*basisSize2);
+
+  kernels::aderdg::generic::c::spaceTimePredictorLinear<false,false,false,true,ElasticityKernelTest>(
+      *this,
+      lQbndRef.data(), lFbndRef.data(),
+      tempSpaceTimeUnknownsRef,tempSpaceTimeFluxUnknownsRef,
+      lQhRef.data(),lFhRef.data(),
+      nullptr,
+      luh, dx, dt, nullptr);
+
+  // Constant coefficient variant
+  std::vector<double> tempSpaceTimeUnknownsStorage(3*nVar*basisSize3);
+  std::vector<double> tempSpaceTimeFluxUnknownsStorage(nVar*basisSize3);
+  double* tempSpaceTimeUnknowns[3] = {
+      tempSpaceTimeUnknownsStorage.data(),
+      tempSpaceTimeUnknownsStorage.data()+nVar*basisSize3,
+      tempSpaceTimeUnknownsStorage.data()+2*nVar*basisSize3};
+  double* tempSpaceTimeFluxUnknowns[1] = {tempSpaceTimeFluxUnknownsStorage.data()};
+
+  std::vector<double> lQh(nData*basisSize3);
+  std::vector<double> lFh((DIMENSIONS+1)*nVar*basisSize3);
+  std::vector<double> lQbnd(2*DIMENSIONS*nData*basisSize2);
+  std::vector<double> lFbnd(2*DIMENSIONS*nVar*basisSize2);
+
+  kernels::aderdg::generic::c::spaceTimePredictorLinearConstantCoefficients<ElasticityKernelTest>(
+      *this,
+      lQbnd.data(), lFbnd.data(),
+      tempSpaceTimeUnknowns,tempSpaceTimeFluxUnknowns,
+      lQh.data(),lFh.data(),
+      nullptr,
+      luh, dx, dt);
+
+  // Check result
+  for (int i = 0; i < nData*basisSize3; i++) {
+    validateNumericalEqualsWithEpsWithParams1(lQh[i], lQhRef[i], eps, i);
+  }
+  for (int i = 0; i < (DIMENSIONS+1)*nVar*basisSize3; i++) {
+    validateNumericalEqualsWithEpsWithParams1(lFh[i], lFhRef[i], eps, i);
+  }
+  for (int i = 0; i < 2*DIMENSIONS*nData*basisSize2; i++) {
+    validateNumericalEqualsWithEpsWithParams1(lQbnd[i], lQbndRef[i], eps, i);
+  }
+  for (int i = 0; i < 2*DIMENSIONS*nVar*basisSize2; i++) {
+    validateNumericalEqualsWithEpsWithParams1(lFbnd[i], lFbndRef[i], eps, i);
+  }
+}
+
 }  // namespace c
 }  // namespace tests
 }  // namespace exahype
@@ -0,0 +1,145 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/tests/kernels/c/GemmTest.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "tarch/compiler/CompilerSpecificSettings.h"
+#include "tarch/tests/TestCaseFactory.h"
+
+#include "kernels/Gemm.h"
+
+registerTest(exahype::tests::c::GemmTest)
+
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", off)
+#endif
+
+tarch::logging::Log exahype::tests::c::GemmTest::_log( "exahype::tests::c::GemmTest" );
+
+namespace exahype {
+namespace tests {
+namespace c {
+
+constexpr double GemmTest::eps;
+
+namespace {
+  /**
+   * Deterministic, non-trivial entries.
+   */
+  double entry(const int i, const int offset) {
+    return 0.25*((7*i+offset) % 13) - 1.5;
+  }
+}
+
+GemmTest::GemmTest()
+    : tarch::tests::TestCase("exahype::tests::c::GemmTest") {}
+
+GemmTest::~GemmTest() {}
+
+void GemmTest::run() {
+  testMethod(testGemm);
+  testMethod(testCopyTransposed);
+}
+
+void GemmTest::testGemm() {
+  constexpr int M   = 5;
+  constexpr int N   = 3;
+  constexpr int K   = 4;
+  constexpr int LDA = 8;
+  constexpr int LDB = 6;
+  constexpr int LDC = 7;
+
+  std::vector<double> A(LDA*K), B(LDB*N), C0(LDC*N);
+  for (int i=0; i<LDA*K; i++) { A[i]  = entry(i,1); }
+  for (int i=0; i<LDB*N; i++) { B[i]  = entry(i,2); }
+  for (int i=0; i<LDC*N; i++) { C0[i] = entry(i,3); }
+
+  const double coefficients[3][2] = { {1.0,1.0}, {-0.5,0.0}, {2.0,-1.5} }; // alpha, beta
+  for (const auto& coefficient : coefficients) {
+    const double alpha = coefficient[0];
+    const double beta  = coefficient[1];
+
+    std::vector<double> C(C0);
+    kernels::gemm<M,N,K,LDA,LDB,LDC>(A.data(),B.data(),C.data(),alpha,beta);
+
+    for (int n=0; n<N; n++) {
+      for (int m=0; m<LDC; m++) {
+        double expected = C0[n*LDC+m];
+        if (m<M) {
+          double product = 0.0;
+          for (int k=0; k<K; k++) {
+            product += A[k*LDA+m] * B[n*LDB+k];
+          }
+          expected = alpha*product + beta*C0[n*LDC+m];
+        }
+        validateNumericalEqualsWithEpsWithParams1(C[n*LDC+m],expected,eps,"m="<<m<<",n="<<n<<",alpha="<<alpha<<",beta="<<beta);
+      }
+    }
+  }
+
+  // beta=0 must not read C
+  std::vector<double> C(LDC*N,std::numeric_limits<double>::quiet_NaN());
+  kernels::gemm<M,N,K,LDA,LDB,LDC>(A.data(),B.data(),C.data(),1.0,0.0);
+  for (int n=0; n<N; n++) {
+    for (int m=0; m<M; m++) {
+      validateWithParams1(std::isfinite(C[n*LDC+m]),"m="<<m<<",n="<<n);
+    }
+  }
+}
+
+void GemmTest::testCopyTransposed() {
+  constexpr int rows    = 4;
+  constexpr int columns = 3;
+  constexpr int M       = 2;
+  constexpr int LDA     = 3;
+
+  // lookup table as allocated by initDGMatrices()
+  double  data[rows][columns];
+  double* matrix[rows];
+  for (int i=0; i<rows; i++) {
+    for (int j=0; j<columns; j++) {
+      data[i][j] = entry(i*columns+j,4);
+    }
+    matrix[i] = data[i];
+  }
+
+  double transposed[rows*columns];
+  kernels::copyTransposed<rows,columns>(transposed,matrix);
+
+  // C(l,i) = sum_j A(l,j) * matrix[i][j], i.e. B = transpose of the table
+  std::vector<double> A(LDA*columns), C(M*rows,0.0);
+  for (int i=0; i<LDA*columns; i++) { A[i] = entry(i,5); }
+  kernels::gemm<M,rows,columns,LDA,columns,M>(A.data(),transposed,C.data(),1.0,0.0);
+
+  for (int i=0; i<rows; i++) {
+    for (int l=0; l<M; l++) {
+      double expected = 0.0;
+      for (int j=0; j<columns; j++) {
+        expected += A[j*LDA+l] * matrix[i][j];
+      }
+      validateNumericalEqualsWithEpsWithParams1(C[i*M+l],expected,eps,"l="<<l<<",i="<<i);
+    }
+  }
+}
+
+}  // namespace c
+}  // namespace tests
+}  // namespace exahype
+
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", on)
+#endif
@@ -0,0 +1,58 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_TESTS_GEMM_TEST_H_
+#define _EXAHYPE_TESTS_GEMM_TEST_H_
+
+#include "tarch/logging/Log.h"
+#include "tarch/tests/TestCase.h"
+
+namespace exahype {
+namespace tests {
+namespace c {
+
+/**
+ * Compares kernels::gemm(...) and kernels::copyTransposed(...) with
+ * naive loops.
+ */
+class GemmTest : public tarch::tests::TestCase {
+ public:
+  GemmTest();
+  virtual ~GemmTest();
+
+  void run() override;
+
+ private:
+  static tarch::logging::Log _log;
+
+  static constexpr double eps = 1.0e-12;
+
+  /**
+   * Multiplies sub-blocks of larger matrices, i.e. all leading dimensions
+   * exceed the matrix sizes. Checks all combinations of alpha and beta
+   * the kernels use and that the padding rows of C are not touched.
+   */
+  void testGemm();
+
+  /**
+   * Checks that the product with the matrix written by copyTransposed(...)
+   * equals the product with the transposed lookup table.
+   */
+  void testCopyTransposed();
+};
+
+}  // namespace c
+}  // namespace tests
+}  // namespace exahype
+
+#endif  // _EXAHYPE_TESTS_GEMM_TEST_H_
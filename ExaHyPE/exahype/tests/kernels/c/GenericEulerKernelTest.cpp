@@ -16,8 +16,14 @@
 #include "tarch/compiler/CompilerSpecificSettings.h"
 #include "tarch/tests/TestCaseFactory.h"
 
+#include <cmath>
+#include <vector>
+
+#include "tarch/la/ScalarOperations.h"
+
 #include "peano/utils/Loop.h"
 #include "kernels/DGBasisFunctions.h"
+#include "kernels/KernelUtils.h"
 
 #include "kernels/aderdg/generic/Kernels.h"
 
@@ -50,6 +56,7 @@ void GenericEulerKernelTest::run() {
   logWarning("run()","Test testSpaceTimePredictorLinear is failing. Test data might not be correct anymore.");
 //  testMethod(testSpaceTimePredictorLinear);
   testMethod(testSpaceTimePredictorNonlinear);
+  testMethod(testSpaceTimePredictorNonlinearPadded);
   testMethod(testVolumeIntegralLinear);
   testMethod(testVolumeIntegralNonlinear);
 
@@ -119,6 +126,107 @@ void GenericEulerKernelTest::testEquidistantGridProjection() {
   }
 }
 
+void GenericEulerKernelTest::testSpaceTimePredictorNonlinearPadded() {
+  logInfo( "testSpaceTimePredictorNonlinearPadded()", "Test padded against unpadded space time predictor nonlinear, ORDER=3, DIM=" << DIMENSIONS );
+
+  constexpr int nVar        = NumberOfVariables;
+  constexpr int nPar        = NumberOfParameters;
+  constexpr int nData       = nVar+nPar;
+  constexpr int basisSize   = Order+1;
+  const int nodes           = tarch::la::aPowI(DIMENSIONS,basisSize);
+  const int spaceTimeNodes  = nodes*basisSize;
+  const int faceNodes       = nodes/basisSize;
+  const int nVarPadded      = kernels::getPaddedSize(nVar);
+  const int nDataPadded     = kernels::getPaddedSize(nData);
+
+  const tarch::la::Vector<DIMENSIONS, double> dx(5e-02);
+  const double dt = 1e-03;
+
+  // smooth state with positive density and pressure
+  std::vector<double> luh(nodes*nData,0.0);
+  for (int i = 0; i < nodes; i++) {
+    luh[i*nData+0] = 1.0 + 0.1*std::sin(0.3*i);
+    luh[i*nData+1] = 0.1*std::cos(0.2*i);
+    luh[i*nData+2] = 0.1*std::sin(0.7*i);
+    luh[i*nData+3] = 0.1*std::cos(0.4*i);
+    luh[i*nData+4] = 2.5 + 0.1*std::sin(0.5*i);
+  }
+
+  // 0: unpadded, 1: padded
+  std::vector<double> lQhbnd[2], lFhbnd[2], lduh[2];
+  for (int padded = 0; padded < 2; padded++) {
+    const int nVarStride  = padded ? nVarPadded  : nVar;
+    const int nDataStride = padded ? nDataPadded : nData;
+
+    // sized and zeroed as the ADERDGSolver does
+    std::vector<double> spaceTimeUnknowns(4*(spaceTimeNodes+nodes)*nDataStride,0.0);
+    std::vector<double> spaceTimeFluxUnknowns(2*spaceTimeNodes*(DIMENSIONS+1)*nVarStride,0.0);
+    double* tempSpaceTimeUnknowns[4];
+    for (int i = 0; i < 4; i++) {
+      tempSpaceTimeUnknowns[i] = spaceTimeUnknowns.data() + i*(spaceTimeNodes+nodes)*nDataStride;
+    }
+    double* tempSpaceTimeFluxUnknowns[2];
+    for (int i = 0; i < 2; i++) {
+      tempSpaceTimeFluxUnknowns[i] = spaceTimeFluxUnknowns.data() + i*spaceTimeNodes*(DIMENSIONS+1)*nVarStride;
+    }
+    std::vector<double> tempUnknowns(nodes*nDataStride,0.0);
+    std::vector<double> tempFluxUnknowns(nodes*(DIMENSIONS+1)*nVarStride,0.0);
+    std::vector<double> tempStateSizedVector(nData,0.0);
+
+    lQhbnd[padded].assign(2*DIMENSIONS*faceNodes*nData,0.0);
+    lFhbnd[padded].assign(2*DIMENSIONS*faceNodes*nVar,0.0);
+    lduh[padded].assign(nodes*nVar,0.0);
+
+    _setNcpAndMatrixBToZero = true;
+    if (padded) {
+      kernels::aderdg::generic::c::spaceTimePredictorNonlinear<true,true,true,GenericEulerKernelTest,true>(
+          *this,
+          lQhbnd[padded].data(), lFhbnd[padded].data(),
+          tempSpaceTimeUnknowns,tempSpaceTimeFluxUnknowns,
+          tempUnknowns.data(),tempFluxUnknowns.data(),
+          tempStateSizedVector.data(),
+          luh.data(),
+          dx, dt);
+      kernels::aderdg::generic::c::volumeIntegralNonlinear<true,true,nVar,basisSize,true>(
+          lduh[padded].data(), tempFluxUnknowns.data(), dx);
+
+      // the padding entries have to stay zero
+      for (int i = 0; i < nodes; i++) {
+        for (int m = nData; m < nDataPadded; m++) {
+          validateEqualsWithParams1(tempUnknowns[i*nDataPadded+m],0.0,i);
+        }
+      }
+      for (int i = 0; i < nodes*(DIMENSIONS+1); i++) {
+        for (int m = nVar; m < nVarPadded; m++) {
+          validateEqualsWithParams1(tempFluxUnknowns[i*nVarPadded+m],0.0,i);
+        }
+      }
+    } else {
+      kernels::aderdg::generic::c::spaceTimePredictorNonlinear<true,true,true,GenericEulerKernelTest>(
+          *this,
+          lQhbnd[padded].data(), lFhbnd[padded].data(),
+          tempSpaceTimeUnknowns,tempSpaceTimeFluxUnknowns,
+          tempUnknowns.data(),tempFluxUnknowns.data(),
+          tempStateSizedVector.data(),
+          luh.data(),
+          dx, dt);
+      kernels::aderdg::generic::c::volumeIntegralNonlinear<true,true,nVar,basisSize>(
+          lduh[padded].data(), tempFluxUnknowns.data(), dx);
+    }
+    _setNcpAndMatrixBToZero = false;
+  }
+
+  for (int i = 0; i < static_cast<int>(lQhbnd[0].size()); i++) {
+    validateNumericalEqualsWithEpsWithParams1(lQhbnd[1][i], lQhbnd[0][i], eps, i);
+  }
+  for (int i = 0; i < static_cast<int>(lFhbnd[0].size()); i++) {
+    validateNumericalEqualsWithEpsWithParams1(lFhbnd[1][i], lFhbnd[0][i], eps, i);
+  }
+  for (int i = 0; i < static_cast<int>(lduh[0].size()); i++) {
+    validateNumericalEqualsWithEpsWithParams1(lduh[1][i], lduh[0][i], eps, i);
+  }
+}
+
 }  // namespace c
 }  // namespace tests
 }  // namespace exahype
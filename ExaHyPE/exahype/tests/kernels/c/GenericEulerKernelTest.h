@@ -44,6 +44,12 @@ class GenericEulerKernelTest : public tarch::tests::TestCase {
   void testPDEFluxes();
   void testSpaceTimePredictorLinear();
   void testSpaceTimePredictorNonlinear();
+  /**
+   * Runs the nonlinear predictor and volume integral with and without
+   * padded temporaries and compares the face data and lduh. Only pads
+   * if ALIGNMENT is defined (see kernels::SimdWidth).
+   */
+  void testSpaceTimePredictorNonlinearPadded();
   void testVolumeIntegralLinear();
   void testVolumeIntegralNonlinear();
   void testRiemannSolverLinear();
@@ -0,0 +1,109 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/tests/kernels/c/KernelSchedulerTest.h"
+
+#include <atomic>
+#include <vector>
+
+#include "tarch/compiler/CompilerSpecificSettings.h"
+#include "tarch/tests/TestCaseFactory.h"
+
+#include "kernels/KernelScheduler.h"
+
+#include "SharedMemoryLabels.h"
+
+registerTest(exahype::tests::c::KernelSchedulerTest)
+
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", off)
+#endif
+
+tarch::logging::Log exahype::tests::c::KernelSchedulerTest::_log( "exahype::tests::c::KernelSchedulerTest" );
+
+namespace exahype {
+namespace tests {
+namespace c {
+
+KernelSchedulerTest::KernelSchedulerTest()
+    : tarch::tests::TestCase("exahype::tests::c::KernelSchedulerTest") {}
+
+KernelSchedulerTest::~KernelSchedulerTest() {}
+
+void KernelSchedulerTest::run() {
+  testMethod(testDecision);
+  testMethod(testParallelFor);
+}
+
+void KernelSchedulerTest::testDecision() {
+  kernels::KernelScheduler& scheduler = kernels::KernelScheduler::getInstance();
+
+  // no cell count known yet: split as before
+  scheduler.setNumberOfReadyCells(-1);
+  scheduler.configure(8,4);
+  validate(scheduler.splitKernels());
+
+  // 4 cells per thread keep all threads busy
+  scheduler.setNumberOfReadyCells(31);
+  validate(scheduler.splitKernels());
+  scheduler.setNumberOfReadyCells(32);
+  validate(!scheduler.splitKernels());
+  scheduler.setNumberOfReadyCells(1000);
+  validate(!scheduler.splitKernels());
+
+  // a new thread count redoes the decision for the last count
+  scheduler.configure(512,4);
+  validate(scheduler.splitKernels());
+
+  // a single thread never splits
+  scheduler.configure(1);
+  scheduler.setNumberOfReadyCells(0);
+  validate(!scheduler.splitKernels());
+  validateEquals(scheduler.getMinimalNumberOfCellsPerThread(),kernels::KernelScheduler::DefaultMinimalNumberOfCellsPerThread);
+
+  scheduler.setNumberOfReadyCells(-1);
+}
+
+void KernelSchedulerTest::testParallelFor() {
+  constexpr int ProblemSize = 10;
+  kernels::KernelScheduler& scheduler = kernels::KernelScheduler::getInstance();
+
+  for (int splitKernels=0; splitKernels<2; splitKernels++) {
+    scheduler.configure(splitKernels==1 ? 8 : 1);
+    scheduler.setNumberOfReadyCells(splitKernels==1 ? 0 : 1000);
+
+    std::vector<std::atomic<int>> visits(ProblemSize);
+    for (auto& v : visits) {
+      v = 0;
+    }
+    kernels::parallelFor(ProblemSize,sharedmemorylabels::GenericKernelsFluxSourceNCPLoop,
+        [&visits] (const int i) -> void {
+          visits[i]++;
+        });
+
+    for (int i=0; i<ProblemSize; i++) {
+      validateEqualsWithParams2(visits[i].load(),1,i,splitKernels);
+    }
+  }
+
+  scheduler.configure(1);
+  scheduler.setNumberOfReadyCells(-1);
+}
+
+}  // namespace c
+}  // namespace tests
+}  // namespace exahype
+
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", on)
+#endif
@@ -0,0 +1,60 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_TESTS_KERNEL_SCHEDULER_TEST_H_
+#define _EXAHYPE_TESTS_KERNEL_SCHEDULER_TEST_H_
+
+#include "tarch/logging/Log.h"
+#include "tarch/tests/TestCase.h"
+
+namespace exahype {
+namespace tests {
+namespace c {
+
+/**
+ * Checks when kernels::KernelScheduler decides for intra-cell parallelism
+ * and that kernels::parallelFor(...) visits every index once.
+ *
+ * The scheduler is a singleton. The tests reset it to a single thread and
+ * an unknown cell count when they are done.
+ */
+class KernelSchedulerTest : public tarch::tests::TestCase {
+ public:
+  KernelSchedulerTest();
+  virtual ~KernelSchedulerTest();
+
+  void run() override;
+
+ private:
+  static tarch::logging::Log _log;
+
+  /**
+   * Runs through the cell counts around the threshold of
+   * getMinimalNumberOfCellsPerThread() cells per thread, with an unknown
+   * count, and with a single thread.
+   */
+  void testDecision();
+
+  /**
+   * Counts how often the loop body is invoked per index if the kernels
+   * run serially and, where shared memory parallelisation is enabled,
+   * if they split their loops.
+   */
+  void testParallelFor();
+};
+
+}  // namespace c
+}  // namespace tests
+}  // namespace exahype
+
+#endif  // _EXAHYPE_TESTS_KERNEL_SCHEDULER_TEST_H_
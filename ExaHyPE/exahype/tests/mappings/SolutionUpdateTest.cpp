@@ -0,0 +1,118 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/tests/mappings/SolutionUpdateTest.h"
+
+#include "tarch/compiler/CompilerSpecificSettings.h"
+#include "tarch/tests/TestCaseFactory.h"
+
+#include "peano/grid/SingleLevelEnumerator.h"
+
+#include "exahype/State.h"
+#include "exahype/mappings/SolutionUpdate.h"
+#include "exahype/solvers/CellWiseCoupling.h"
+#include "exahype/tests/solvers/DummyADERDGSolver.h"
+
+#include <string>
+#include <vector>
+
+registerTest(exahype::tests::mappings::SolutionUpdateTest)
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", off)
+#endif
+
+namespace {
+  /**
+   * Records the invocations of the coupling.
+   */
+  class RecordingCellWiseCoupling : public exahype::solvers::CellWiseCoupling {
+    public:
+      std::vector<std::string> events;
+
+      RecordingCellWiseCoupling(double time, double repeat) :
+        exahype::solvers::CellWiseCoupling(time,repeat) {}
+
+      void coupleFirstTime(
+          const int cellDescriptionsIndex,
+          exahype::Vertex* const fineGridVertices,
+          const peano::grid::VertexEnumerator& fineGridVerticesEnumerator) override {
+        events.push_back("coupleFirstTime");
+      }
+
+      void couple(
+          const int cellDescriptionsIndex,
+          exahype::Vertex* const fineGridVertices,
+          const peano::grid::VertexEnumerator& fineGridVerticesEnumerator) override {
+        events.push_back("couple");
+      }
+  };
+}
+
+exahype::tests::mappings::SolutionUpdateTest::SolutionUpdateTest()
+    : tarch::tests::TestCase("exahype::tests::mappings::SolutionUpdateTest") {
+}
+
+exahype::tests::mappings::SolutionUpdateTest::~SolutionUpdateTest() {}
+
+void exahype::tests::mappings::SolutionUpdateTest::run() {
+  testMethod(testSolverCoupling);
+}
+
+void exahype::tests::mappings::SolutionUpdateTest::testSolverCoupling() {
+  exahype::tests::solvers::DummyADERDGSolver solver;
+  exahype::solvers::RegisteredSolvers.push_back(&solver);
+  RecordingCellWiseCoupling coupling(0.0,0.5);
+  exahype::solvers::RegisteredSolverCouplings.push_back(&coupling);
+
+  const peano::grid::SingleLevelEnumerator fineGridVerticesEnumerator(
+      tarch::la::Vector<DIMENSIONS,double>(1.0),
+      tarch::la::Vector<DIMENSIONS,double>(0.0),
+      1);
+
+  exahype::mappings::SolutionUpdate mapping;
+  // Sets the solver's time stamp and the algorithm section and couples a single cell.
+  auto coupleCell = [&] (const double timeStamp, const exahype::records::State::AlgorithmSection section) -> void {
+    solver.setMinCorrectorTimeStamp(timeStamp);
+    mapping._localState.setAlgorithmSection(section);
+    mapping.determineActiveCouplings();
+    mapping.coupleSolvers(0,nullptr,fineGridVerticesEnumerator);
+  };
+
+  coupleCell(0.0,exahype::records::State::AlgorithmSection::TimeStepping); // not yet active
+  validateEquals(coupling.events.size(),0u);
+
+  coupleCell(0.1,exahype::records::State::AlgorithmSection::TimeStepping);
+  validateEquals(coupling.events.size(),1u);
+  validateEquals(coupling.events[0],"coupleFirstTime");
+
+  coupleCell(0.2,exahype::records::State::AlgorithmSection::TimeStepping); // next snapshot at 0.5
+  validateEquals(coupling.events.size(),1u);
+
+  coupleCell(0.6,exahype::records::State::AlgorithmSection::TimeStepping);
+  validateEquals(coupling.events.size(),2u);
+  validateEquals(coupling.events[1],"couple");
+
+  coupleCell(1.2,exahype::records::State::AlgorithmSection::GlobalRecomputationAllSend); // rerun
+  validateEquals(coupling.events.size(),2u);
+
+  coupleCell(1.2,exahype::records::State::AlgorithmSection::TimeStepping);
+  validateEquals(coupling.events.size(),3u);
+  validateEquals(coupling.events[2],"couple");
+
+  exahype::solvers::RegisteredSolverCouplings.pop_back();
+  exahype::solvers::RegisteredSolvers.pop_back();
+}
+
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", on)
+#endif
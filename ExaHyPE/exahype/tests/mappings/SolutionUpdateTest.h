@@ -0,0 +1,50 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_TESTS_MAPPINGS_SOLUTION_UPDATE_TEST_H_
+#define _EXAHYPE_TESTS_MAPPINGS_SOLUTION_UPDATE_TEST_H_
+
+#include "tarch/tests/TestCase.h"
+
+namespace exahype {
+namespace tests {
+namespace mappings {
+class SolutionUpdateTest;
+}
+}
+}
+
+/**
+ * Tests the evaluation of the cell-wise solver couplings
+ * within the SolutionUpdate mapping.
+ */
+class exahype::tests::mappings::SolutionUpdateTest : public tarch::tests::TestCase {
+ private:
+  /**
+   * Advances a registered solver through a sequence of time stamps
+   * and couples a cell after each of them with a registered
+   * coupling which records its invocations. The coupling has to run
+   * coupleFirstTime(...) the first time it is active, couple(...)
+   * afterwards, and not at all in time steps where it is inactive or
+   * if the solution update is rerun.
+   */
+  void testSolverCoupling();
+
+ public:
+  SolutionUpdateTest();
+  virtual ~SolutionUpdateTest();
+
+  virtual void run();
+};
+
+#endif
@@ -0,0 +1,80 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/tests/plotters/ADERDG2CartesianSliceVTKTest.h"
+
+#include "tarch/compiler/CompilerSpecificSettings.h"
+#include "tarch/tests/TestCaseFactory.h"
+
+#include "exahype/plotters/VTK/ADERDG2CartesianSliceVTK.h"
+
+registerTest(exahype::tests::plotters::ADERDG2CartesianSliceVTKTest)
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", off)
+#endif
+
+exahype::tests::plotters::ADERDG2CartesianSliceVTKTest::ADERDG2CartesianSliceVTKTest()
+    : tarch::tests::TestCase("exahype::tests::plotters::ADERDG2CartesianSliceVTKTest") {
+}
+
+exahype::tests::plotters::ADERDG2CartesianSliceVTKTest::~ADERDG2CartesianSliceVTKTest() {}
+
+void exahype::tests::plotters::ADERDG2CartesianSliceVTKTest::run() {
+  testMethod(testInteriorFace);
+  testMethod(testUpperDomainFace);
+}
+
+void exahype::tests::plotters::ADERDG2CartesianSliceVTKTest::testInteriorFace() {
+  // domain [-1,1]^d split into two patches along x
+  const tarch::la::Vector<DIMENSIONS, double> domainOffset(-1.0);
+  const tarch::la::Vector<DIMENSIONS, double> domainSize(2.0);
+  const tarch::la::Vector<DIMENSIONS, double> sizeOfPatch(1.0);
+  tarch::la::Vector<DIMENSIONS, double> lowerPatch(-1.0);
+  tarch::la::Vector<DIMENSIONS, double> upperPatch(-1.0);
+  upperPatch(0) = 0.0;
+
+  exahype::plotters::ADERDG2CartesianSliceVTKAscii plotter(nullptr,domainOffset,domainSize);
+  plotter.init("slice",3,1,1,"{x:0.0}");
+
+  validate(!plotter.isPatchActive(lowerPatch,sizeOfPatch));
+  validate(plotter.isPatchActive(upperPatch,sizeOfPatch));
+}
+
+void exahype::tests::plotters::ADERDG2CartesianSliceVTKTest::testUpperDomainFace() {
+  const tarch::la::Vector<DIMENSIONS, double> domainOffset(-1.0);
+  const tarch::la::Vector<DIMENSIONS, double> sizeOfPatch(1.0);
+  tarch::la::Vector<DIMENSIONS, double> lowerPatch(-1.0);
+  tarch::la::Vector<DIMENSIONS, double> upperPatch(-1.0);
+  upperPatch(0) = 0.0;
+
+  // the upper patch's face x=1 is the domain boundary
+  exahype::plotters::ADERDG2CartesianSliceVTKAscii plotter(
+      nullptr,domainOffset,tarch::la::Vector<DIMENSIONS, double>(2.0));
+  plotter.init("slice",3,1,1,"{x:1.0}");
+
+  validate(!plotter.isPatchActive(lowerPatch,sizeOfPatch));
+  validate(plotter.isPatchActive(upperPatch,sizeOfPatch));
+
+  // the face x=1 lies inside the domain [-1,3]^d; the neighbour
+  // beyond it is responsible
+  exahype::plotters::ADERDG2CartesianSliceVTKAscii largerDomainPlotter(
+      nullptr,domainOffset,tarch::la::Vector<DIMENSIONS, double>(4.0));
+  largerDomainPlotter.init("slice",3,1,1,"{x:1.0}");
+
+  validate(!largerDomainPlotter.isPatchActive(lowerPatch,sizeOfPatch));
+  validate(!largerDomainPlotter.isPatchActive(upperPatch,sizeOfPatch));
+}
+
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", on)
+#endif
@@ -0,0 +1,53 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_TESTS_PLOTTERS_ADERDG2_CARTESIAN_SLICE_VTK_TEST_H_
+#define _EXAHYPE_TESTS_PLOTTERS_ADERDG2_CARTESIAN_SLICE_VTK_TEST_H_
+
+#include "tarch/tests/TestCase.h"
+
+namespace exahype {
+namespace tests {
+namespace plotters {
+class ADERDG2CartesianSliceVTKTest;
+}
+}
+}
+
+/**
+ * Tests which patches the Cartesian slice plotter makes
+ * responsible for a slice.
+ */
+class exahype::tests::plotters::ADERDG2CartesianSliceVTKTest : public tarch::tests::TestCase {
+ private:
+  /**
+   * A slice on the face between two patches has to be
+   * written by the upper patch only.
+   */
+  void testInteriorFace();
+
+  /**
+   * A slice on the upper face of the domain has to be written
+   * by the patch touching this face, while the same slice is
+   * dropped if the face lies inside the domain.
+   */
+  void testUpperDomainFace();
+
+ public:
+  ADERDG2CartesianSliceVTKTest();
+  virtual ~ADERDG2CartesianSliceVTKTest();
+
+  virtual void run();
+};
+
+#endif
@@ -0,0 +1,107 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/tests/plotters/InSituReductionsTest.h"
+
+#include "tarch/compiler/CompilerSpecificSettings.h"
+#include "tarch/tests/TestCaseFactory.h"
+
+#include "exahype/plotters/ascii/InSituReductions.h"
+
+registerTest(exahype::tests::plotters::InSituReductionsTest)
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", off)
+#endif
+
+namespace {
+  /**
+   * The slot of the first user-declared sum; the accumulators
+   * keep the volume and the number of NaNs in front of it.
+   */
+  constexpr int FirstSum = 2;
+}
+
+exahype::tests::plotters::InSituReductionsTest::InSituReductionsTest()
+    : tarch::tests::TestCase("exahype::tests::plotters::InSituReductionsTest") {
+}
+
+exahype::tests::plotters::InSituReductionsTest::~InSituReductionsTest() {}
+
+void exahype::tests::plotters::InSituReductionsTest::run() {
+  testMethod(testNeumaierSummation);
+  testMethod(testMerge);
+  testMethod(testAccumulate);
+}
+
+void exahype::tests::plotters::InSituReductionsTest::testNeumaierSummation() {
+  typedef exahype::plotters::ascii::InSituReductions InSituReductions;
+  InSituReductions reductions(1);
+  reductions.add("integral",0,InSituReductions::Kind::Integral);
+
+  InSituReductions::Accumulator accumulator;
+  reductions.initialiseAccumulator(accumulator);
+
+  accumulator.addToSum(FirstSum,1.0);
+  accumulator.addToSum(FirstSum,1.0e100);
+  accumulator.addToSum(FirstSum,1.0);
+  accumulator.addToSum(FirstSum,-1.0e100);
+
+  validateNumericalEquals(accumulator.getSum(FirstSum),2.0);
+}
+
+void exahype::tests::plotters::InSituReductionsTest::testMerge() {
+  typedef exahype::plotters::ascii::InSituReductions InSituReductions;
+  InSituReductions reductions(1);
+  reductions.add("integral",0,InSituReductions::Kind::Integral);
+
+  InSituReductions::Accumulator accumulator1, accumulator2;
+  reductions.initialiseAccumulator(accumulator1);
+  reductions.initialiseAccumulator(accumulator2);
+
+  accumulator1.addToSum(FirstSum,1.0e16);
+  accumulator1.addToSum(FirstSum,1.0);
+  accumulator2.addToSum(FirstSum,1.0);
+  accumulator2.addToSum(FirstSum,-1.0e16);
+
+  accumulator1.merge(accumulator2);
+  validateNumericalEquals(accumulator1.getSum(FirstSum),2.0);
+}
+
+void exahype::tests::plotters::InSituReductionsTest::testAccumulate() {
+  typedef exahype::plotters::ascii::InSituReductions InSituReductions;
+  InSituReductions reductions(2);
+  reductions.add("integral",0,InSituReductions::Kind::Integral);
+  reductions.add("l1",1,InSituReductions::Kind::L1Norm);
+  reductions.add("min",1,InSituReductions::Kind::Minimum);
+  reductions.add("max",0,InSituReductions::Kind::Maximum);
+
+  InSituReductions::Accumulator accumulator;
+  reductions.initialiseAccumulator(accumulator);
+
+  const double Q1[2] = { 2.0, -3.0 };
+  const double Q2[2] = { 4.0,  1.0 };
+  reductions.accumulate(accumulator,Q1,0.25);
+  reductions.accumulate(accumulator,Q2,0.75);
+
+  // sums: volume, NaNs, integral, l1; maxima: time, min, max
+  validateNumericalEquals(accumulator.getSum(0),1.0);
+  validateNumericalEquals(accumulator.getSum(1),0.0);
+  validateNumericalEquals(accumulator.getSum(FirstSum),0.25*2.0+0.75*4.0);
+  validateNumericalEquals(accumulator.getSum(FirstSum+1),0.25*3.0+0.75*1.0);
+  validateNumericalEquals(accumulator.getMaximum(1),3.0); // negated minimum
+  validateNumericalEquals(accumulator.getMaximum(2),4.0);
+}
+
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", on)
+#endif
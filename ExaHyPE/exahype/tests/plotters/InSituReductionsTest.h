@@ -0,0 +1,59 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_TESTS_PLOTTERS_IN_SITU_REDUCTIONS_TEST_H_
+#define _EXAHYPE_TESTS_PLOTTERS_IN_SITU_REDUCTIONS_TEST_H_
+
+#include "tarch/tests/TestCase.h"
+
+namespace exahype {
+namespace tests {
+namespace plotters {
+class InSituReductionsTest;
+}
+}
+}
+
+/**
+ * Tests the compensated summation of the in-situ reductions'
+ * accumulators.
+ */
+class exahype::tests::plotters::InSituReductionsTest : public tarch::tests::TestCase {
+ private:
+  /**
+   * Adds 1, 1e100, 1, -1e100. Naive and Kahan summation
+   * return 0 while Neumaier's variant returns the exact sum 2.
+   */
+  void testNeumaierSummation();
+
+  /**
+   * Splits a badly conditioned sum onto two accumulators as two
+   * threads or ranks would and checks that merging them keeps
+   * the compensation.
+   */
+  void testMerge();
+
+  /**
+   * Checks the weighted integral and the extrema accumulated
+   * from point values.
+   */
+  void testAccumulate();
+
+ public:
+  InSituReductionsTest();
+  virtual ~InSituReductionsTest();
+
+  virtual void run();
+};
+
+#endif
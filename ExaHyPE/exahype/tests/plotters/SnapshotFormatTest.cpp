@@ -0,0 +1,146 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/tests/plotters/SnapshotFormatTest.h"
+
+#include <cmath>
+#include <limits>
+
+#include "tarch/compiler/CompilerSpecificSettings.h"
+#include "tarch/tests/TestCaseFactory.h"
+
+#include "exahype/plotters/Snapshot/SnapshotFormat.h"
+
+registerTest(exahype::tests::plotters::SnapshotFormatTest)
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", off)
+#endif
+
+namespace {
+  constexpr int NumberOfValues = 125;
+
+  /**
+   * A wave with a trend such that the values span several
+   * orders of magnitude of the error bounds we test.
+   */
+  std::vector<double> getSmoothValues() {
+    std::vector<double> values(NumberOfValues);
+    for (int i=0; i<NumberOfValues; i++) {
+      values[i] = 1.0 + 0.01*i + std::sin(0.3*i);
+    }
+    return values;
+  }
+}
+
+exahype::tests::plotters::SnapshotFormatTest::SnapshotFormatTest()
+    : tarch::tests::TestCase("exahype::tests::plotters::SnapshotFormatTest") {
+}
+
+exahype::tests::plotters::SnapshotFormatTest::~SnapshotFormatTest() {}
+
+void exahype::tests::plotters::SnapshotFormatTest::run() {
+  testMethod(testErrorBound);
+  testMethod(testLossless);
+  testMethod(testCorruptedBlocks);
+}
+
+void exahype::tests::plotters::SnapshotFormatTest::validateRoundTrip(
+    const std::vector<double>& values, const double errorBound) {
+  const int numberOfValues = values.size();
+
+  std::vector<unsigned char> block;
+  exahype::plotters::snapshot::compressBlock(values.data(),numberOfValues,errorBound,block);
+
+  std::vector<double> decompressed(numberOfValues);
+  const std::size_t blockSize = exahype::plotters::snapshot::decompressBlock(
+      block.data(),block.size(),numberOfValues,decompressed.data());
+  validateEquals(blockSize,block.size());
+
+  for (int i=0; i<numberOfValues; i++) {
+    if (std::isnan(values[i])) {
+      validateWithParams1(std::isnan(decompressed[i]),i);
+    }
+    else if (std::isfinite(values[i]) && errorBound>0.0) {
+      validateWithParams1(std::abs(decompressed[i]-values[i])<=errorBound,i);
+    }
+    else {
+      validateEqualsWithParams1(decompressed[i],values[i],i);
+    }
+  }
+}
+
+void exahype::tests::plotters::SnapshotFormatTest::testErrorBound() {
+  const std::vector<double> values = getSmoothValues();
+  for (double errorBound : {10.0, 1.0e-1, 1.0e-4, 1.0e-8, 1.0e-12}) {
+    validateRoundTrip(values,errorBound);
+  }
+
+  std::vector<unsigned char> block;
+  exahype::plotters::snapshot::compressBlock(values.data(),NumberOfValues,10.0,block);
+  validateEquals(block[0],static_cast<unsigned char>(exahype::plotters::snapshot::Encoding::Constant));
+
+  block.clear();
+  exahype::plotters::snapshot::compressBlock(values.data(),NumberOfValues,1.0e-4,block);
+  validateEquals(block[0],static_cast<unsigned char>(exahype::plotters::snapshot::Encoding::Quantised));
+  validate(block.size()<NumberOfValues*sizeof(double));
+
+  // alternating signs give the largest differences of the quantised values
+  std::vector<double> oscillating(NumberOfValues);
+  for (int i=0; i<NumberOfValues; i++) {
+    oscillating[i] = (i%2==0 ? 1.0e3 : -1.0e3) + i;
+  }
+  validateRoundTrip(oscillating,1.0e-6);
+}
+
+void exahype::tests::plotters::SnapshotFormatTest::testLossless() {
+  std::vector<double> values = getSmoothValues();
+  validateRoundTrip(values,0.0);
+
+  values[3]  = std::numeric_limits<double>::quiet_NaN();
+  values[17] = std::numeric_limits<double>::infinity();
+  validateRoundTrip(values,1.0e-2);
+
+  std::vector<unsigned char> block;
+  exahype::plotters::snapshot::compressBlock(values.data(),NumberOfValues,1.0e-2,block);
+  validateEquals(block[0],static_cast<unsigned char>(exahype::plotters::snapshot::Encoding::Raw));
+}
+
+void exahype::tests::plotters::SnapshotFormatTest::testCorruptedBlocks() {
+  const std::vector<double> values = getSmoothValues();
+  std::vector<double> decompressed(NumberOfValues);
+
+  for (double errorBound : {10.0, 1.0e-4, 0.0}) {
+    std::vector<unsigned char> block;
+    exahype::plotters::snapshot::compressBlock(values.data(),NumberOfValues,errorBound,block);
+    for (std::size_t numberOfBytes=0; numberOfBytes<block.size(); numberOfBytes++) {
+      validateEqualsWithParams1(
+          exahype::plotters::snapshot::decompressBlock(block.data(),numberOfBytes,NumberOfValues,decompressed.data()),
+          0,numberOfBytes);
+    }
+  }
+
+  // the bit width is stored behind the encoding, the minimum and the step
+  std::vector<unsigned char> block;
+  exahype::plotters::snapshot::compressBlock(values.data(),NumberOfValues,1.0e-4,block);
+  const std::size_t bitWidthPosition = 1+2*sizeof(double);
+  block[bitWidthPosition] = 65;
+  block.resize(block.size()+NumberOfValues*sizeof(double),0);
+  validateEquals(exahype::plotters::snapshot::decompressBlock(block.data(),block.size(),NumberOfValues,decompressed.data()),0);
+
+  block[0] = 3;
+  validateEquals(exahype::plotters::snapshot::decompressBlock(block.data(),block.size(),NumberOfValues,decompressed.data()),0);
+}
+
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", on)
+#endif
@@ -0,0 +1,66 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_TESTS_PLOTTERS_SNAPSHOT_FORMAT_TEST_H_
+#define _EXAHYPE_TESTS_PLOTTERS_SNAPSHOT_FORMAT_TEST_H_
+
+#include <vector>
+
+#include "tarch/tests/TestCase.h"
+
+namespace exahype {
+namespace tests {
+namespace plotters {
+class SnapshotFormatTest;
+}
+}
+}
+
+/**
+ * Tests the block compression of the compressed snapshots.
+ */
+class exahype::tests::plotters::SnapshotFormatTest : public tarch::tests::TestCase {
+ private:
+  /**
+   * Compresses and decompresses \p values and checks that every value
+   * is reproduced within \p errorBound and that the block size returned
+   * by the decompression matches the number of bytes written.
+   */
+  void validateRoundTrip(const std::vector<double>& values, const double errorBound);
+
+  /**
+   * Smooth and oscillating data with several error bounds; this
+   * covers the constant and the quantised encoding.
+   */
+  void testErrorBound();
+
+  /**
+   * An error bound of zero and non-finite values have to
+   * be stored without loss.
+   */
+  void testLossless();
+
+  /**
+   * Truncated blocks, unknown encodings and bit widths beyond 64
+   * have to be rejected instead of being read out of bounds.
+   */
+  void testCorruptedBlocks();
+
+ public:
+  SnapshotFormatTest();
+  virtual ~SnapshotFormatTest();
+
+  virtual void run();
+};
+
+#endif
@@ -0,0 +1,113 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+
+#include "exahype/tests/profilers/PerformanceReportTest.h"
+
+#include "tarch/compiler/CompilerSpecificSettings.h"
+#include "tarch/tests/TestCaseFactory.h"
+
+#include "exahype/profilers/PerformanceReport.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+registerTest(exahype::tests::profilers::PerformanceReportTest)
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", off)
+#endif
+
+namespace {
+  /**
+   * \return the value of TMPDIR if it is set, /tmp otherwise.
+   */
+  std::string getTemporaryDirectory() {
+    const char* const directory = std::getenv("TMPDIR");
+    return (directory!=nullptr && *directory!='\0') ? directory : "/tmp";
+  }
+
+  std::vector<std::string> readLines(const std::string& fileName) {
+    std::vector<std::string> lines;
+    std::ifstream file(fileName);
+    std::string line;
+    while (std::getline(file,line)) {
+      lines.push_back(line);
+    }
+    return lines;
+  }
+
+  bool contains(const std::string& line, const std::string& entry) {
+    return line.find(entry)!=std::string::npos;
+  }
+}
+
+exahype::tests::profilers::PerformanceReportTest::PerformanceReportTest()
+    : tarch::tests::TestCase("exahype::tests::profilers::PerformanceReportTest") {
+}
+
+exahype::tests::profilers::PerformanceReportTest::~PerformanceReportTest() {}
+
+void exahype::tests::profilers::PerformanceReportTest::run() {
+  testMethod(testReport);
+}
+
+void exahype::tests::profilers::PerformanceReportTest::testReport() {
+  exahype::profilers::PerformanceReport& report = exahype::profilers::PerformanceReport::getInstance();
+  validate(!report.isActive());
+  // Counters of threads which recorded before the test
+  for (auto& counters : report._threadCounters) {
+    for (int category=0; category<exahype::profilers::PerformanceReport::NumberOfCellCategories; category++) {
+      counters->cells[category].store(0);
+    }
+    counters->degreesOfFreedom.store(0);
+  }
+
+  report.configure(getTemporaryDirectory()+"/exahype-performance-report-test.json",2);
+  validate(report.isActive());
+
+  report.countCell(exahype::profilers::PerformanceReport::CellCategory::Cell,10);
+  report.finishedTimeSteps(1);
+  validate(readLines(report._fileName).empty());
+
+  // A speculative batch of four steps in which the solvers started three
+  report.recordTraversals("ADERDGTimeStep",4,0.5);
+  report.finishedTimeSteps(3);
+  validateEquals(report._numberOfTimeStepsSinceLastReport,0);
+
+  report.finishedTimeSteps(1);
+  report.writeReport("exit");
+
+  const std::vector<std::string> lines = readLines(report._fileName);
+  validateEquals(static_cast<int>(lines.size()),2);
+  validateWithParams1(contains(lines[0],"{\"event\":\"interval\""),lines[0]);
+  validateWithParams1(contains(lines[0],"\"timeSteps\":4,"),lines[0]);
+  validateWithParams1(contains(lines[0],"\"adapters\":{\"ADERDGTimeStep\":{\"traversals\":4,\"seconds\":0.5}}"),lines[0]);
+  validateWithParams1(contains(lines[0],"\"cells\":{\"Cell\":1,\"Descendant\":0,\"Ancestor\":0,\"Troubled\":0}"),lines[0]);
+  validateWithParams1(contains(lines[0],"\"dofUpdates\":10,"),lines[0]);
+  validateWithParams1(contains(lines[1],"{\"event\":\"exit\""),lines[1]);
+  validateWithParams1(contains(lines[1],"\"timeSteps\":5,"),lines[1]);
+  validateWithParams1(lines[1].back()=='}',lines[1]);
+
+  std::remove(report._fileName.c_str());
+  report._active                           = false;
+  report._numberOfTimeSteps                = 0;
+  report._numberOfTimeStepsSinceLastReport = 0;
+  report._adapters.clear();
+}
+
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", on)
+#endif
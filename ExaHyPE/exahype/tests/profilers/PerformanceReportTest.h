@@ -0,0 +1,50 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+
+#ifndef _EXAHYPE_TESTS_PROFILERS_PERFORMANCE_REPORT_TEST_H_
+#define _EXAHYPE_TESTS_PROFILERS_PERFORMANCE_REPORT_TEST_H_
+
+#include "tarch/tests/TestCase.h"
+
+namespace exahype {
+namespace tests {
+namespace profilers {
+class PerformanceReportTest;
+}
+}
+}
+
+/**
+ * Tests the JSON lines the performance report writes to a file
+ * in the directory given by TMPDIR (or /tmp).
+ */
+class exahype::tests::profilers::PerformanceReportTest : public tarch::tests::TestCase {
+ private:
+  /**
+   * Reports a single step and a speculative batch which ran three of
+   * four steps. Checks that the interval report is written once the
+   * executed steps reach the interval and that the interval and the
+   * exit report carry the executed steps, the adapter statistics and
+   * the cell counts.
+   */
+  void testReport();
+
+ public:
+  PerformanceReportTest();
+  virtual ~PerformanceReportTest();
+
+  virtual void run();
+};
+
+#endif
@@ -0,0 +1,87 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/tests/runners/RunnerTest.h"
+
+#include "tarch/compiler/CompilerSpecificSettings.h"
+#include "tarch/tests/TestCaseFactory.h"
+
+#include "exahype/runners/Runner.h"
+
+registerTest(exahype::tests::runners::RunnerTest)
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", off)
+#endif
+
+exahype::tests::runners::RunnerTest::RunnerTest()
+    : tarch::tests::TestCase("exahype::tests::runners::RunnerTest") {
+}
+
+exahype::tests::runners::RunnerTest::~RunnerTest() {}
+
+void exahype::tests::runners::RunnerTest::run() {
+  testMethod(testStatusSpreadingConvergence);
+  testMethod(testSpeculativeBatchSizeAdaption);
+}
+
+void exahype::tests::runners::RunnerTest::testStatusSpreadingConvergence() {
+  typedef exahype::runners::Runner Runner;
+  const int stableIterationsRequired = Runner::NumberOfStableIterationsToFinishStatusSpreading;
+
+  // the status changes in the first three iterations only
+  int stableIterations = 0;
+  int iterations       = 0;
+  bool continueSpreading = true;
+  while (continueSpreading) {
+    iterations++;
+    continueSpreading = Runner::statusSpreadingHasNotConverged(stableIterations,iterations<=3);
+  }
+  validateEquals(iterations,3+stableIterationsRequired);
+  validateEquals(stableIterations,stableIterationsRequired);
+
+  // a change resets the count of stable iterations
+  stableIterations = stableIterationsRequired-1;
+  validate(Runner::statusSpreadingHasNotConverged(stableIterations,true));
+  validateEquals(stableIterations,0);
+
+  // nothing changes at all: the fixed point is detected
+  // without any extra iterations
+  stableIterations = 0;
+  iterations       = 0;
+  continueSpreading = true;
+  while (continueSpreading) {
+    iterations++;
+    continueSpreading = Runner::statusSpreadingHasNotConverged(stableIterations,false);
+  }
+  validateEquals(iterations,stableIterationsRequired);
+}
+
+void exahype::tests::runners::RunnerTest::testSpeculativeBatchSizeAdaption() {
+  typedef exahype::runners::Runner Runner;
+
+  int batchSize = 1;
+  for (int batch=0; batch<10; batch++) {
+    batchSize = Runner::adaptSpeculativeBatchSize(batchSize,false);
+    validate(batchSize<=Runner::MaxSpeculativeBatchSize);
+  }
+  validateEquals(batchSize,Runner::MaxSpeculativeBatchSize);
+
+  for (int batch=0; batch<10; batch++) {
+    batchSize = Runner::adaptSpeculativeBatchSize(batchSize,true);
+  }
+  validateEquals(batchSize,1);
+}
+
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", on)
+#endif
@@ -0,0 +1,54 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_TESTS_RUNNERS_RUNNER_TEST_H_
+#define _EXAHYPE_TESTS_RUNNERS_RUNNER_TEST_H_
+
+#include "tarch/tests/TestCase.h"
+
+namespace exahype {
+namespace tests {
+namespace runners {
+class RunnerTest;
+}
+}
+}
+
+/**
+ * Tests the iteration control of the runner which does not
+ * require a grid.
+ */
+class exahype::tests::runners::RunnerTest : public tarch::tests::TestCase {
+ private:
+  /**
+   * Feeds a sequence of iterations with and without status changes
+   * into the status spreading's convergence check and counts the
+   * iterations the mesh update would run.
+   */
+  void testStatusSpreadingConvergence();
+
+  /**
+   * Checks that the speculative batch size grows up to
+   * its bound without and shrinks down to one with
+   * violations of the stability condition.
+   */
+  void testSpeculativeBatchSizeAdaption();
+
+ public:
+  RunnerTest();
+  virtual ~RunnerTest();
+
+  virtual void run();
+};
+
+#endif
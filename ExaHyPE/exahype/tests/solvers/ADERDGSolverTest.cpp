@@ -0,0 +1,180 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/tests/solvers/ADERDGSolverTest.h"
+
+#include "tarch/compiler/CompilerSpecificSettings.h"
+#include "tarch/tests/TestCaseFactory.h"
+
+#include "exahype/State.h"
+#include "exahype/records/ADERDGCellDescription.h"
+#include "exahype/solvers/ADERDGSolver.h"
+#include "exahype/tests/solvers/DummyADERDGSolver.h"
+
+#include <algorithm>
+
+registerTest(exahype::tests::solvers::ADERDGSolverTest)
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", off)
+#endif
+
+exahype::tests::solvers::ADERDGSolverTest::ADERDGSolverTest()
+    : tarch::tests::TestCase("exahype::tests::solvers::ADERDGSolverTest") {
+}
+
+exahype::tests::solvers::ADERDGSolverTest::~ADERDGSolverTest() {}
+
+void exahype::tests::solvers::ADERDGSolverTest::run() {
+  testMethod(testSpeculativeTimeStepBatching);
+  testMethod(testTimeStepSizeWeightAdaption);
+  testMethod(testPreviousSolutionAllocation);
+  #ifdef Parallel
+  testMethod(testGlobalTimeStepDataReduction);
+  #endif
+}
+
+void exahype::tests::solvers::ADERDGSolverTest::testSpeculativeTimeStepBatching() {
+  typedef exahype::records::State::AlgorithmSection AlgorithmSection;
+
+  const bool speculativeTimeStepBatching =
+      exahype::solvers::ADERDGSolver::SpeculativeTimeStepBatching;
+  exahype::solvers::ADERDGSolver::SpeculativeTimeStepBatching = true;
+
+  exahype::tests::solvers::DummyADERDGSolver solver;
+  solver.setMinPredictorTimeStamp(0.0);
+  solver.setMinPredictorTimeStepSize(0.1);
+  solver.resetNumberOfStartedTimeSteps();
+
+  // A batch of eight time stepping traversals as run by the
+  // TimeStepSizeComputation mapping. The stability condition
+  // is violated at the end of the third traversal.
+  for (int traversal=0; traversal<8; traversal++) {
+    if (solver.isComputing(AlgorithmSection::TimeStepping)) {
+      solver.updateMinNextPredictorTimeStepSize(0.1);
+      solver.setStabilityConditionWasViolated(traversal==2);
+      solver.startNewTimeStep();
+    }
+  }
+  validateEquals(solver.getNumberOfStartedTimeSteps(),3);
+  validateNumericalEquals(solver.getMinPredictorTimeStamp(),0.3);
+  validate(solver.isComputing(AlgorithmSection::PredictionRerunAllSend));
+
+  exahype::solvers::ADERDGSolver::SpeculativeTimeStepBatching = speculativeTimeStepBatching;
+}
+
+void exahype::tests::solvers::ADERDGSolverTest::testTimeStepSizeWeightAdaption() {
+  typedef exahype::solvers::ADERDGSolver ADERDGSolver;
+
+  exahype::tests::solvers::DummyADERDGSolver solver;
+  const double userWeight = exahype::State::getTimeStepSizeWeightForPredictionRerun();
+  validateNumericalEquals(solver.getTimeStepSizeWeight(),userWeight);
+
+  solver.updateTimeStepSizeWeight(true);
+  validateNumericalEquals(solver.getTimeStepSizeWeight(),
+      ADERDGSolver::TimeStepSizeWeightScalingDecrease*userWeight);
+
+  // frequent violations: the weight shrinks down to its bound
+  for (int step=0; step<100; step++) {
+    solver.updateTimeStepSizeWeight(true);
+  }
+  validateNumericalEquals(solver.getTimeStepSizeWeight(),
+      ADERDGSolver::MinimumTimeStepSizeWeightScaling*userWeight);
+
+  // stable time steps: the weight recovers the user's weight but never exceeds it
+  double previousWeight = solver.getTimeStepSizeWeight();
+  for (int step=0; step<500; step++) {
+    solver.updateTimeStepSizeWeight(false);
+    validate(solver.getTimeStepSizeWeight()>previousWeight);
+    validate(solver.getTimeStepSizeWeight()<userWeight);
+    previousWeight = solver.getTimeStepSizeWeight();
+  }
+  validateNumericalEqualsWithEps(solver.getTimeStepSizeWeight(),userWeight,1e-6);
+}
+
+void exahype::tests::solvers::ADERDGSolverTest::testPreviousSolutionAllocation() {
+  typedef exahype::records::ADERDGCellDescription CellDescription;
+
+  exahype::tests::solvers::DummyADERDGSolver solver;
+  validate(!solver.holdsPreviousSolution());
+
+  const int cellDescriptionsIndex =
+      exahype::solvers::ADERDGSolver::Heap::getInstance().createData(0,0);
+  exahype::solvers::ADERDGSolver::addNewCellDescription(
+      cellDescriptionsIndex,0,CellDescription::Type::Cell,CellDescription::None,
+      1,-1,tarch::la::Vector<DIMENSIONS,double>(1.0),tarch::la::Vector<DIMENSIONS,double>(0.0));
+  CellDescription& cellDescription =
+      exahype::solvers::ADERDGSolver::getCellDescription(cellDescriptionsIndex,0);
+
+  // pure ADER-DG solver
+  solver.ensureNecessaryMemoryIsAllocated(cellDescription);
+  validate(DataHeap::getInstance().isValidIndex(cellDescription.getSolution()));
+  validateEquals(cellDescription.getPreviousSolution(),-1);
+  validateEquals(cellDescription.getPreviousSolutionAverages(),-1);
+
+  cellDescription.setType(CellDescription::Type::Erased);
+  solver.ensureNoUnnecessaryMemoryIsAllocated(cellDescription);
+  validateEquals(cellDescription.getSolution(),-1);
+  validateEquals(cellDescription.getPreviousSolution(),-1);
+
+  // solver wrapped by a LimitingADERDGSolver
+  solver.setHoldsPreviousSolution(true);
+  cellDescription.setType(CellDescription::Type::Cell);
+  solver.ensureNecessaryMemoryIsAllocated(cellDescription);
+  validate(DataHeap::getInstance().isValidIndex(cellDescription.getPreviousSolution()));
+  validate(DataHeap::getInstance().isValidIndex(cellDescription.getPreviousSolutionAverages()));
+  validateEquals(
+      static_cast<int>(DataHeap::getInstance().getData(cellDescription.getPreviousSolution()).size()),
+      solver.getDataPerCell());
+
+  cellDescription.setType(CellDescription::Type::Erased);
+  solver.ensureNoUnnecessaryMemoryIsAllocated(cellDescription);
+  validateEquals(cellDescription.getPreviousSolution(),-1);
+
+  exahype::solvers::ADERDGSolver::Heap::getInstance().deleteData(cellDescriptionsIndex);
+}
+
+#ifdef Parallel
+void exahype::tests::solvers::ADERDGSolverTest::testGlobalTimeStepDataReduction() {
+  exahype::tests::solvers::DummyADERDGSolver solver0;
+  solver0.updateMinNextPredictorTimeStepSize(0.2);
+  solver0.updateNextMinCellSize(0.1);
+  solver0.updateNextMaxCellSize(0.1);
+  solver0.updateNextMeshUpdateRequest(false);
+
+  exahype::tests::solvers::DummyADERDGSolver solver1;
+  solver1.updateMinNextPredictorTimeStepSize(0.3);
+  solver1.updateNextMinCellSize(0.05);
+  solver1.updateNextMaxCellSize(0.4);
+  solver1.updateNextMeshUpdateRequest(true);
+
+  exahype::DataHeap::HeapEntries message0 = solver0.compileTimeStepDataForGlobalReduction();
+  const exahype::DataHeap::HeapEntries message1 = solver1.compileTimeStepDataForGlobalReduction();
+  validateEquals(static_cast<int>(message0.size()),4);
+  validateEquals(static_cast<int>(message1.size()),4);
+
+  // MPI_MIN
+  for (int i=0; i<static_cast<int>(message0.size()); i++) {
+    message0[i] = std::min(message0[i],message1[i]);
+  }
+  solver0.mergeWithGloballyReducedTimeStepData(message0);
+
+  validateNumericalEquals(solver0.getMinNextPredictorTimeStepSize(),0.2);
+  validateNumericalEquals(solver0.getNextMinCellSize(),0.05);
+  validateNumericalEquals(solver0.getNextMaxCellSize(),0.4);
+  validate(solver0.getNextMeshUpdateRequest());
+}
+#endif
+
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", on)
+#endif
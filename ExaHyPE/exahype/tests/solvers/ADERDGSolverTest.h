@@ -0,0 +1,72 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_TESTS_SOLVERS_ADERDG_SOLVER_TEST_H_
+#define _EXAHYPE_TESTS_SOLVERS_ADERDG_SOLVER_TEST_H_
+
+#include "tarch/tests/TestCase.h"
+
+namespace exahype {
+namespace tests {
+namespace solvers {
+class ADERDGSolverTest;
+}
+}
+}
+
+/**
+ * Tests the PDE-independent parts of the ADER-DG solver
+ * with a solver whose PDE-specific routines do nothing.
+ */
+class exahype::tests::solvers::ADERDGSolverTest : public tarch::tests::TestCase {
+ private:
+  /**
+   * Runs a speculative batch of time stepping traversals in which
+   * the stability condition is violated after the third one and
+   * checks that the solver advanced exactly three time steps.
+   */
+  void testSpeculativeTimeStepBatching();
+
+  /**
+   * Feeds a history of violations and stable time steps into the
+   * solver and checks that the fused time step size weight shrinks
+   * down to its lower bound and recovers the user's weight.
+   */
+  void testTimeStepSizeWeightAdaption();
+
+  /**
+   * Allocates and frees the memory of a cell of a pure ADER-DG
+   * solver and checks that no previous solution is allocated.
+   * Repeats this for a solver which holds a previous solution, as
+   * the one wrapped by the LimitingADERDGSolver does.
+   */
+  void testPreviousSolutionAllocation();
+
+  #ifdef Parallel
+  /**
+   * Reduces the time step data of two solvers with an elementwise
+   * minimum as the non-blocking all-reduce does and checks that
+   * the merged solver holds the minimum time step size and cell size,
+   * the maximum cell size and the or-ed mesh update request.
+   */
+  void testGlobalTimeStepDataReduction();
+  #endif
+
+ public:
+  ADERDGSolverTest();
+  virtual ~ADERDGSolverTest();
+
+  virtual void run();
+};
+
+#endif
@@ -0,0 +1,128 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_TESTS_SOLVERS_DUMMY_ADERDG_SOLVER_H_
+#define _EXAHYPE_TESTS_SOLVERS_DUMMY_ADERDG_SOLVER_H_
+
+#include "exahype/solvers/ADERDGSolver.h"
+
+namespace exahype {
+namespace tests {
+namespace solvers {
+class DummyADERDGSolver;
+}
+}
+}
+
+/**
+ * An ADER-DG solver whose PDE-specific routines do nothing.
+ * Used by tests of the PDE-independent parts of the solver
+ * and of the mappings.
+ */
+class exahype::tests::solvers::DummyADERDGSolver : public exahype::solvers::ADERDGSolver {
+  public:
+    DummyADERDGSolver() :
+      exahype::solvers::ADERDGSolver(
+          "DummyADERDGSolver",1,0,2,1.0,0,0,
+          exahype::solvers::Solver::TimeStepping::Global) {}
+
+    int constexpr_getNumberOfVariables()  const override { return 1; }
+    int constexpr_getNumberOfParameters() const override { return 0; }
+    double constexpr_getCFLNumber()       const override { return 0.9; }
+    int constexpr_getOrder()              const override { return 1; }
+
+    bool useConservativeFlux()       const override { return false; }
+    bool useNonConservativeProduct() const override { return false; }
+    bool useAlgebraicSource()        const override { return false; }
+    bool usePointSource()            const override { return false; }
+    bool useConstantCoefficients()   const override { return false; }
+
+    void pointSource(const double* const x,const double t,const double dt, double* forceVector, double* x0) override {}
+    void algebraicSource(const double* const Q,double* S) override {}
+    void fusedSource(const double* const Q, const double* const gradQ, double* S) override {}
+    void nonConservativeProduct(const double* const Q,const double* const gradQ,double* BgradQ) override {}
+    void coefficientMatrix(const double* const Q,const int d,double* Bn) override {}
+    void flux(const double* const Q,double** F) override {}
+
+    void solutionUpdate(double* luh, const double* const lduh, const double dt) override {}
+    void volumeIntegral(
+        double* lduh, const double* const lFhi,
+        const tarch::la::Vector<DIMENSIONS, double>& cellSize) override {}
+    void surfaceIntegral(
+        double* lduh, const double* const lFhbnd,
+        const tarch::la::Vector<DIMENSIONS, double>& cellSize) override {}
+    void riemannSolver(
+        double* FL, double* FR, const double* const QL, const double* const QR,
+        double* tempFaceUnknownsArray, double** tempStateSizedVectors,
+        double** tempStateSizedSquareMatrices, const double dt,
+        const int normalNonZero, bool isBoundaryFace) override {}
+    void boundaryConditions(
+        double* fluxOut, double* stateOut,
+        const double* const fluxIn, const double* const stateIn,
+        const tarch::la::Vector<DIMENSIONS, double>& cellCentre,
+        const tarch::la::Vector<DIMENSIONS, double>& cellSize,
+        const double t,const double dt,
+        const int faceIndex, const int normalNonZero) override {}
+    void spaceTimePredictor(
+        double* lQhbnd, double* lFhbnd,
+        double** tempSpaceTimeUnknowns, double** tempSpaceTimeFluxUnknowns,
+        double* tempUnknowns, double* tempFluxUnknowns,
+        double* tempStateSizedVector, const double* const luh,
+        const tarch::la::Vector<DIMENSIONS, double>& cellSize,
+        const double dt, double* pointForceSources) override {}
+    double stableTimeStepSize(
+        const double* const luh, double* tempEigenvalues,
+        const tarch::la::Vector<DIMENSIONS, double>& cellSize) override { return 1.0; }
+    void adjustSolution(
+        double* luh, const tarch::la::Vector<DIMENSIONS, double>& cellCentre,
+        const tarch::la::Vector<DIMENSIONS, double>& dx,
+        const double t, const double dt) override {}
+    AdjustSolutionValue useAdjustSolution(
+        const tarch::la::Vector<DIMENSIONS, double>& cellCentre,
+        const tarch::la::Vector<DIMENSIONS, double>& dx,
+        const double t, const double dt) const override { return AdjustSolutionValue::No; }
+    void adjustPointSolution(const double* const x,const double w,const double t,const double dt,double* Q) override {}
+    void adjustPatchSolution(
+        const tarch::la::Vector<DIMENSIONS, double>& cellCentre,
+        const tarch::la::Vector<DIMENSIONS, double>& dx,
+        const double t, const double dt, double* luh) override {}
+    exahype::solvers::Solver::RefinementControl refinementCriterion(
+        const double* luh, const tarch::la::Vector<DIMENSIONS, double>& cellCentre,
+        const tarch::la::Vector<DIMENSIONS, double>& cellSize,
+        const double time, const int level) override {
+      return exahype::solvers::Solver::RefinementControl::Keep;
+    }
+    void faceUnknownsProlongation(
+        double* lQhbndFine, double* lFhbndFine, const double* lQhbndCoarse,
+        const double* lFhbndCoarse, const int coarseGridLevel, const int fineGridLevel,
+        const tarch::la::Vector<DIMENSIONS - 1, int>& subfaceIndex) override {}
+    void faceUnknownsRestriction(
+        double* lQhbndCoarse, double* lFhbndCoarse, const double* lQhbndFine,
+        const double* lFhbndFine, const int coarseGridLevel, const int fineGridLevel,
+        const tarch::la::Vector<DIMENSIONS - 1, int>& subfaceIndex) override {}
+    void volumeUnknownsProlongation(
+        double* luhFine, const double* luhCoarse, const int coarseGridLevel, const int fineGridLevel,
+        const tarch::la::Vector<DIMENSIONS, int>& subcellIndex) override {}
+    void volumeUnknownsRestriction(
+        double* luhCoarse, const double* luhFine, const int coarseGridLevel, const int fineGridLevel,
+        const tarch::la::Vector<DIMENSIONS, int>& subcellIndex) override {}
+    bool isPhysicallyAdmissible(
+        const double* const solution,
+        const double* const observablesMin,const double* const observablesMax,const int numberOfObservables,
+        const tarch::la::Vector<DIMENSIONS,double>& center, const tarch::la::Vector<DIMENSIONS,double>& dx,
+        const double t, const double dt) const override { return true; }
+    void mapDiscreteMaximumPrincipleObservables(
+        double* observables, const int numberOfObservables, const double* const Q) const override {}
+};
+
+#endif
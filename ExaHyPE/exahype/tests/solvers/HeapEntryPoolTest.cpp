@@ -0,0 +1,146 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/tests/solvers/HeapEntryPoolTest.h"
+
+#include "tarch/compiler/CompilerSpecificSettings.h"
+#include "tarch/tests/TestCaseFactory.h"
+
+#include "exahype/solvers/HeapEntryPool.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+registerTest(exahype::tests::solvers::HeapEntryPoolTest)
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", off)
+#endif
+
+namespace {
+  tarch::multicore::BooleanSemaphore heapSemaphore;
+}
+
+exahype::tests::solvers::HeapEntryPoolTest::HeapEntryPoolTest()
+    : tarch::tests::TestCase("exahype::tests::solvers::HeapEntryPoolTest") {
+}
+
+exahype::tests::solvers::HeapEntryPoolTest::~HeapEntryPoolTest() {}
+
+void exahype::tests::solvers::HeapEntryPoolTest::run() {
+  testMethod(testAcquireReleaseReuse);
+  testMethod(testSpillAndRefill);
+  testMethod(testThreadExit);
+  testMethod(testDestruction);
+}
+
+void exahype::tests::solvers::HeapEntryPoolTest::testAcquireReleaseReuse() {
+  exahype::solvers::HeapEntryPool pool("testAcquireReleaseReuse",heapSemaphore);
+
+  const int heapIndex = pool.acquire(5);
+  validateEquals(static_cast<int>(DataHeap::getInstance().getData(heapIndex).size()),5);
+  for (auto& value : DataHeap::getInstance().getData(heapIndex)) {
+    value = 1.0;
+  }
+  pool.release(heapIndex);
+
+  validateEquals(pool.acquire(5),heapIndex);
+  for (const auto& value : DataHeap::getInstance().getData(heapIndex)) {
+    validateEquals(value,0.0);
+  }
+  validateEquals(pool._numberOfHits.load(),1);
+
+  const int otherHeapIndex = pool.acquire(7);
+  validate(otherHeapIndex!=heapIndex);
+  validateEquals(pool._numberOfHits.load(),1);
+  validateEquals(pool._numberOfAcquisitions.load(),3);
+  validateEquals(pool._liveBytes.load(),static_cast<long>(12*sizeof(double)));
+
+  pool.release(heapIndex);
+  pool.release(otherHeapIndex);
+  validateEquals(pool._liveBytes.load(),0);
+}
+
+void exahype::tests::solvers::HeapEntryPoolTest::testSpillAndRefill() {
+  typedef exahype::solvers::HeapEntryPool HeapEntryPool;
+  HeapEntryPool pool("testSpillAndRefill",heapSemaphore);
+
+  const int numberOfEntries = HeapEntryPool::MaximumNumberOfThreadLocalEntriesPerSize+1;
+  std::vector<int> heapIndices;
+  for (int i=0; i<numberOfEntries; i++) {
+    heapIndices.push_back(pool.acquire(3));
+  }
+  for (const int heapIndex : heapIndices) {
+    pool.release(heapIndex);
+  }
+  validateEquals(static_cast<int>(pool.getThreadLocalFreeLists()[3].size()),HeapEntryPool::MaximumNumberOfThreadLocalEntriesPerSize/2);
+
+  std::vector<int> reusedHeapIndices;
+  for (int i=0; i<numberOfEntries; i++) {
+    reusedHeapIndices.push_back(pool.acquire(3));
+  }
+  validateEquals(pool._numberOfHits.load(),numberOfEntries);
+
+  std::sort(heapIndices.begin(),heapIndices.end());
+  std::sort(reusedHeapIndices.begin(),reusedHeapIndices.end());
+  validate(heapIndices==reusedHeapIndices);
+
+  for (const int heapIndex : reusedHeapIndices) {
+    pool.release(heapIndex);
+  }
+}
+
+void exahype::tests::solvers::HeapEntryPoolTest::testThreadExit() {
+  exahype::solvers::HeapEntryPool pool("testThreadExit",heapSemaphore);
+
+  std::vector<int> heapIndices;
+  std::thread worker([&pool,&heapIndices] () -> void {
+    heapIndices.push_back(pool.acquire(4));
+    heapIndices.push_back(pool.acquire(4));
+    pool.release(heapIndices[0]);
+    pool.release(heapIndices[1]);
+  });
+  worker.join();
+  validateEquals(static_cast<int>(pool._threadLocalFreeLists.size()),0);
+
+  std::vector<int> reusedHeapIndices;
+  reusedHeapIndices.push_back(pool.acquire(4));
+  reusedHeapIndices.push_back(pool.acquire(4));
+  validateEquals(pool._numberOfHits.load(),2);
+
+  std::sort(heapIndices.begin(),heapIndices.end());
+  std::sort(reusedHeapIndices.begin(),reusedHeapIndices.end());
+  validate(heapIndices==reusedHeapIndices);
+
+  pool.release(reusedHeapIndices[0]);
+  pool.release(reusedHeapIndices[1]);
+}
+
+void exahype::tests::solvers::HeapEntryPoolTest::testDestruction() {
+  int releasedHeapIndex = -1;
+  int acquiredHeapIndex = -1;
+  {
+    exahype::solvers::HeapEntryPool pool("testDestruction",heapSemaphore);
+    releasedHeapIndex = pool.acquire(6);
+    acquiredHeapIndex = pool.acquire(6);
+    pool.release(releasedHeapIndex);
+  }
+  validate(!DataHeap::getInstance().isValidIndex(releasedHeapIndex));
+  validate(DataHeap::getInstance().isValidIndex(acquiredHeapIndex));
+
+  DataHeap::getInstance().deleteData(acquiredHeapIndex);
+}
+
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", on)
+#endif
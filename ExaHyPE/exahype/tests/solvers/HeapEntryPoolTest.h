@@ -0,0 +1,63 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_TESTS_SOLVERS_HEAP_ENTRY_POOL_TEST_H_
+#define _EXAHYPE_TESTS_SOLVERS_HEAP_ENTRY_POOL_TEST_H_
+
+#include "tarch/tests/TestCase.h"
+
+namespace exahype {
+namespace tests {
+namespace solvers {
+class HeapEntryPoolTest;
+}
+}
+}
+
+/**
+ * Tests the recycling of DataHeap entries by the HeapEntryPool.
+ */
+class exahype::tests::solvers::HeapEntryPoolTest : public tarch::tests::TestCase {
+ private:
+  /**
+   * A released entry is handed out again for the same size, zeroed,
+   * and counted as a hit. Other sizes get new entries.
+   */
+  void testAcquireReleaseReuse();
+
+  /**
+   * Releases more entries than a thread may cache and checks that
+   * all of them are reused via the shared free lists.
+   */
+  void testSpillAndRefill();
+
+  /**
+   * The entries cached by a terminated thread are reused by
+   * another thread.
+   */
+  void testThreadExit();
+
+  /**
+   * Destroying a pool deletes its pooled entries from the
+   * DataHeap but keeps the acquired ones.
+   */
+  void testDestruction();
+
+ public:
+  HeapEntryPoolTest();
+  virtual ~HeapEntryPoolTest();
+
+  virtual void run();
+};
+
+#endif
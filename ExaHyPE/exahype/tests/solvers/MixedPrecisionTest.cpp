@@ -0,0 +1,114 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/tests/solvers/MixedPrecisionTest.h"
+
+#include "tarch/compiler/CompilerSpecificSettings.h"
+#include "tarch/tests/TestCaseFactory.h"
+
+#include "exahype/solvers/MixedPrecision.h"
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+registerTest(exahype::tests::solvers::MixedPrecisionTest)
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", off)
+#endif
+
+exahype::tests::solvers::MixedPrecisionTest::MixedPrecisionTest()
+    : tarch::tests::TestCase("exahype::tests::solvers::MixedPrecisionTest") {
+}
+
+exahype::tests::solvers::MixedPrecisionTest::~MixedPrecisionTest() {}
+
+void exahype::tests::solvers::MixedPrecisionTest::run() {
+  testMethod(testRoundTrip);
+  testMethod(testErrors);
+}
+
+void exahype::tests::solvers::MixedPrecisionTest::testRoundTrip() {
+  typedef exahype::solvers::StoragePrecision StoragePrecision;
+
+  // odd number of entries such that the last double is not filled
+  const int numberOfEntries = 13;
+  std::vector<double> values(numberOfEntries);
+  for (int i=0; i<numberOfEntries; i++) {
+    values[i] = std::pow(-10.0,i-6) * (1.0 + 0.1*std::sin(0.3*i));
+  }
+
+  const StoragePrecision precisions[3] = {
+      StoragePrecision::Double, StoragePrecision::Single, StoragePrecision::BFloat16 };
+  // half a unit in the last place
+  const double relativeErrorBounds[3] = { 0.0, std::ldexp(1.0,-24), std::ldexp(1.0,-8) };
+
+  for (int p=0; p<3; p++) {
+    const StoragePrecision precision = precisions[p];
+
+    bool valid = false;
+    validate(exahype::solvers::convertToStoragePrecision(exahype::solvers::toString(precision),valid)==precision);
+    validate(valid);
+
+    const int packedSize = exahype::solvers::getPackedSize(numberOfEntries,precision);
+    const int usedBytes  = numberOfEntries*exahype::solvers::getBytesPerEntry(precision);
+    validateEqualsWithParams1(packedSize,(usedBytes+7)/8,p);
+
+    // the padding bytes must be zeroed even if the buffer was not
+    std::vector<double> packed(packedSize,-1.0);
+    exahype::solvers::packIntoDoubles(values.data(),numberOfEntries,precision,packed.data());
+    const char* bytes = reinterpret_cast<const char*>(packed.data());
+    for (int b=usedBytes; b<packedSize*static_cast<int>(sizeof(double)); b++) {
+      validateEqualsWithParams1(static_cast<int>(bytes[b]),0,p);
+    }
+
+    std::vector<double> unpacked(numberOfEntries,0.0);
+    exahype::solvers::unpackFromDoubles(packed.data(),numberOfEntries,precision,unpacked.data());
+    for (int i=0; i<numberOfEntries; i++) {
+      const double relativeError = std::abs(unpacked[i]-values[i])/std::abs(values[i]);
+      validateWithParams1(relativeError<=relativeErrorBounds[p],p);
+    }
+  }
+
+  bool valid = true;
+  exahype::solvers::convertToStoragePrecision("half",valid);
+  validate(!valid);
+}
+
+void exahype::tests::solvers::MixedPrecisionTest::testErrors() {
+  const double original0[3] = { 1.0, -2.0, 0.0 };
+  const double reduced0[3]  = { 1.0, -2.5, 0.25 };
+  const double original1[2] = { 4.0,  8.0 };
+  const double reduced1[2]  = { 4.2,  8.0 };
+
+  exahype::solvers::MixedPrecisionErrors errors0;
+  errors0.record(original0,reduced0,3);
+  validateNumericalEquals(errors0.maxAbsoluteError,0.5);
+  // zero entries do not contribute to the relative error
+  validateNumericalEquals(errors0.maxRelativeError,0.25);
+  validateNumericalEquals(errors0.numberOfValues,3.0);
+
+  exahype::solvers::MixedPrecisionErrors errors1;
+  errors1.record(original1,reduced1,2);
+  validateNumericalEquals(errors1.maxAbsoluteError,0.2);
+  validateNumericalEquals(errors1.maxRelativeError,0.05);
+
+  errors0.merge(errors1);
+  validateNumericalEquals(errors0.maxAbsoluteError,0.5);
+  validateNumericalEquals(errors0.maxRelativeError,0.25);
+  validateNumericalEquals(errors0.numberOfValues,5.0);
+}
+
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", on)
+#endif
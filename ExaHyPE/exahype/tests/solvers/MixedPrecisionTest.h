@@ -0,0 +1,55 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_TESTS_SOLVERS_MIXED_PRECISION_TEST_H_
+#define _EXAHYPE_TESTS_SOLVERS_MIXED_PRECISION_TEST_H_
+
+#include "tarch/tests/TestCase.h"
+
+namespace exahype {
+namespace tests {
+namespace solvers {
+class MixedPrecisionTest;
+}
+}
+}
+
+/**
+ * Tests the reduced precision storage and transfer of heap arrays.
+ */
+class exahype::tests::solvers::MixedPrecisionTest : public tarch::tests::TestCase {
+ private:
+  /**
+   * Packs values of very different magnitude in each precision and
+   * unpacks them again. Checks the packed size, that the padding
+   * bytes are zeroed, that double precision is lossless and that
+   * the relative error of single and bfloat16 precision stays
+   * below half a unit in the last place.
+   */
+  void testRoundTrip();
+
+  /**
+   * Records the errors of two arrays, merges two error records
+   * and checks the maximum absolute and relative error as well as
+   * the number of values.
+   */
+  void testErrors();
+
+ public:
+  MixedPrecisionTest();
+  virtual ~MixedPrecisionTest();
+
+  virtual void run();
+};
+
+#endif
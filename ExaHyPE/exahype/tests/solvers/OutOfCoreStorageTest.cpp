@@ -0,0 +1,176 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/tests/solvers/OutOfCoreStorageTest.h"
+
+#include "tarch/compiler/CompilerSpecificSettings.h"
+#include "tarch/tests/TestCaseFactory.h"
+
+#include "exahype/solvers/OutOfCoreStorage.h"
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+registerTest(exahype::tests::solvers::OutOfCoreStorageTest)
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", off)
+#endif
+
+namespace {
+  /**
+   * Two blocks fill a segment.
+   */
+  constexpr long BlockSize = exahype::solvers::OutOfCoreStorage::SegmentSize/2;
+
+  std::vector<char> createBlock(const int key) {
+    std::vector<char> block(BlockSize);
+    for (long i=0; i<BlockSize; i++) {
+      block[i] = static_cast<char>(31*key + 7*i);
+    }
+    return block;
+  }
+
+  bool equalsBlock(const std::vector<char>& block, const int key) {
+    return block==createBlock(key);
+  }
+
+  /**
+   * \return the value of TMPDIR if it is set, /tmp otherwise.
+   */
+  std::string getTemporaryDirectory() {
+    const char* const directory = std::getenv("TMPDIR");
+    return (directory!=nullptr && *directory!='\0') ? directory : "/tmp";
+  }
+}
+
+exahype::tests::solvers::OutOfCoreStorageTest::OutOfCoreStorageTest()
+    : tarch::tests::TestCase("exahype::tests::solvers::OutOfCoreStorageTest") {
+}
+
+exahype::tests::solvers::OutOfCoreStorageTest::~OutOfCoreStorageTest() {}
+
+void exahype::tests::solvers::OutOfCoreStorageTest::run() {
+  testMethod(testRoundTrip);
+  testMethod(testDiscardAndReuse);
+  testMethod(testRecycleRetiredSegment);
+}
+
+void exahype::tests::solvers::OutOfCoreStorageTest::testRoundTrip() {
+  exahype::solvers::OutOfCoreStorage& storage = exahype::solvers::OutOfCoreStorage::getInstance();
+  validate(!storage.isActive());
+  storage.configure(getTemporaryDirectory(),0);
+  validate(storage.isActive());
+  validateEquals(storage._numberOfResidentSegments,3);
+
+  // Four segments, i.e. one more than the window holds.
+  const int numberOfBlocks = 8;
+  for (int key=0; key<numberOfBlocks; key++) {
+    const std::vector<char> block = createBlock(key);
+    validateWithParams1(storage.store(key,block.data(),BlockSize),key);
+    validateWithParams1(storage.contains(key),key);
+  }
+  validateEquals(static_cast<int>(storage._segments.size()),4);
+  validateEquals(static_cast<int>(storage._residentSegments.size()),3);
+  validate(!storage._segments[0].isResident);
+
+  for (int key=numberOfBlocks-1; key>=0; key--) {
+    std::vector<char> block(BlockSize,0);
+    storage.load(key,block.data(),BlockSize);
+    validateWithParams1(equalsBlock(block,key),key);
+    validateWithParams1(!storage.contains(key),key);
+  }
+  validateEquals(storage._liveBytes,0l);
+  validate(storage._numberOfPrefetches>0);
+
+  std::vector<char> tooLarge(exahype::solvers::OutOfCoreStorage::SegmentSize+1);
+  validate(!storage.store(numberOfBlocks,tooLarge.data(),static_cast<long>(tooLarge.size())));
+  validate(!storage.contains(numberOfBlocks));
+
+  storage.shutdown();
+  validate(!storage.isActive());
+}
+
+void exahype::tests::solvers::OutOfCoreStorageTest::testDiscardAndReuse() {
+  exahype::solvers::OutOfCoreStorage& storage = exahype::solvers::OutOfCoreStorage::getInstance();
+  storage.configure(getTemporaryDirectory(),0);
+  validate(storage.isActive());
+
+  // Blocks 0 and 1 fill segment 0, blocks 2 and 3 segment 1.
+  for (int key=0; key<4; key++) {
+    const std::vector<char> block = createBlock(key);
+    validateWithParams1(storage.store(key,block.data(),BlockSize),key);
+  }
+  validateEquals(static_cast<int>(storage._segments.size()),2);
+
+  storage.discard(0);
+  validate(!storage.contains(0));
+  validate(storage._freeSegments.empty());
+  storage.discard(1);
+  storage.discard(1); // does nothing
+  validateEquals(static_cast<int>(storage._freeSegments.size()),1);
+  validateEquals(storage._freeSegments[0],0);
+
+  // Segment 1 is full. The next block goes into the recycled segment 0.
+  for (int key=4; key<6; key++) {
+    const std::vector<char> block = createBlock(key);
+    validateWithParams1(storage.store(key,block.data(),BlockSize),key);
+  }
+  validateEquals(static_cast<int>(storage._segments.size()),2);
+  validate(storage._freeSegments.empty());
+  validateEquals(storage._currentSegment,0);
+
+  for (int key=5; key>=2; key--) {
+    std::vector<char> block(BlockSize,0);
+    storage.load(key,block.data(),BlockSize);
+    validateWithParams1(equalsBlock(block,key),key);
+  }
+  validateEquals(storage._liveBytes,0l);
+
+  storage.shutdown();
+}
+
+void exahype::tests::solvers::OutOfCoreStorageTest::testRecycleRetiredSegment() {
+  exahype::solvers::OutOfCoreStorage& storage = exahype::solvers::OutOfCoreStorage::getInstance();
+  storage.configure(getTemporaryDirectory(),0);
+  validate(storage.isActive());
+
+  // Blocks 0 and 1 fill segment 0, which stays the current segment.
+  for (int key=0; key<2; key++) {
+    const std::vector<char> block = createBlock(key);
+    validateWithParams1(storage.store(key,block.data(),BlockSize),key);
+  }
+  storage.discard(0);
+  storage.discard(1);
+  validate(storage._freeSegments.empty());
+  validateEquals(storage._currentSegment,0);
+
+  // Segment 0 is retired without live data. It is reused instead of extending the file.
+  const std::vector<char> block = createBlock(2);
+  validate(storage.store(2,block.data(),BlockSize));
+  validateEquals(static_cast<int>(storage._segments.size()),1);
+  validateEquals(storage._currentSegment,0);
+  validateEquals(storage._segments[0].predecessor,-1);
+  validate(storage._freeSegments.empty());
+
+  std::vector<char> restored(BlockSize,0);
+  storage.load(2,restored.data(),BlockSize);
+  validate(equalsBlock(restored,2));
+  validateEquals(storage._liveBytes,0l);
+
+  storage.shutdown();
+}
+
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", on)
+#endif
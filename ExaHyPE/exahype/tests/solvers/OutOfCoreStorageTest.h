@@ -0,0 +1,61 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_TESTS_SOLVERS_OUT_OF_CORE_STORAGE_TEST_H_
+#define _EXAHYPE_TESTS_SOLVERS_OUT_OF_CORE_STORAGE_TEST_H_
+
+#include "tarch/tests/TestCase.h"
+
+namespace exahype {
+namespace tests {
+namespace solvers {
+class OutOfCoreStorageTest;
+}
+}
+}
+
+/**
+ * Tests the out-of-core storage of the compressed unknowns
+ * with a file in the directory given by TMPDIR (or /tmp).
+ */
+class exahype::tests::solvers::OutOfCoreStorageTest : public tarch::tests::TestCase {
+ private:
+  /**
+   * Stores more data than the resident window holds and restores
+   * it in reverse order as the next traversal would. Checks that
+   * evicted segments are reloaded correctly and that data larger
+   * than a segment is rejected.
+   */
+  void testRoundTrip();
+
+  /**
+   * Discards all data of a segment and checks that the next
+   * stores recycle the segment instead of extending the file
+   * without touching the data of the other segment.
+   */
+  void testDiscardAndReuse();
+
+  /**
+   * Discards all data of the current segment and checks that
+   * the segment is recycled as soon as the next store retires it.
+   */
+  void testRecycleRetiredSegment();
+
+ public:
+  OutOfCoreStorageTest();
+  virtual ~OutOfCoreStorageTest();
+
+  virtual void run();
+};
+
+#endif
@@ -0,0 +1,121 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "exahype/tests/solvers/PackedCellMigrationTest.h"
+
+#ifdef Parallel
+
+#include "tarch/compiler/CompilerSpecificSettings.h"
+#include "tarch/tests/TestCaseFactory.h"
+
+#include "exahype/solvers/ADERDGSolver.h"
+#include "exahype/solvers/PackedCellMigration.h"
+
+#include <cmath>
+#include <vector>
+
+registerTest(exahype::tests::solvers::PackedCellMigrationTest)
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", off)
+#endif
+
+namespace {
+  /**
+   * A smooth solution with entries of different magnitude.
+   */
+  std::vector<double> createArray(const int numberOfEntries, const double offset) {
+    std::vector<double> data(numberOfEntries);
+    for (int i=0; i<numberOfEntries; i++) {
+      data[i] = offset + 0.1*std::sin(0.3*i) - 1.0e-3*i;
+    }
+    return data;
+  }
+}
+
+exahype::tests::solvers::PackedCellMigrationTest::PackedCellMigrationTest()
+    : tarch::tests::TestCase("exahype::tests::solvers::PackedCellMigrationTest") {
+}
+
+exahype::tests::solvers::PackedCellMigrationTest::~PackedCellMigrationTest() {}
+
+void exahype::tests::solvers::PackedCellMigrationTest::run() {
+  testMethod(testLosslessRoundTrip);
+  testMethod(testLossyRoundTrip);
+}
+
+void exahype::tests::solvers::PackedCellMigrationTest::testLosslessRoundTrip() {
+  const double compressionAccuracy = exahype::solvers::ADERDGSolver::CompressionAccuracy;
+  exahype::solvers::ADERDGSolver::CompressionAccuracy = 0.0;
+
+  const std::vector<double> first  = createArray(64,1.0);
+  const std::vector<double> second = createArray(27,-20.0);
+
+  std::vector<double> buffer;
+  exahype::solvers::PackedCellMigration::appendArray(buffer,first.data(),first.size());
+  exahype::solvers::PackedCellMigration::appendArray(buffer,second.data(),second.size());
+  validateEquals(buffer.size(),2+first.size()+2+second.size());
+
+  std::vector<double> firstReceived(first.size());
+  std::vector<double> secondReceived(second.size());
+  int position = 0;
+  exahype::solvers::PackedCellMigration::readArray(buffer,position,firstReceived.data(),firstReceived.size());
+  validateEquals(position,static_cast<int>(2+first.size()));
+  exahype::solvers::PackedCellMigration::readArray(buffer,position,secondReceived.data(),secondReceived.size());
+  validateEquals(position,static_cast<int>(buffer.size()));
+
+  for (int i=0; i<static_cast<int>(first.size()); i++) {
+    validateEqualsWithParams1(firstReceived[i],first[i],i);
+  }
+  for (int i=0; i<static_cast<int>(second.size()); i++) {
+    validateEqualsWithParams1(secondReceived[i],second[i],i);
+  }
+
+  exahype::solvers::ADERDGSolver::CompressionAccuracy = compressionAccuracy;
+}
+
+void exahype::tests::solvers::PackedCellMigrationTest::testLossyRoundTrip() {
+  const double compressionAccuracy = exahype::solvers::ADERDGSolver::CompressionAccuracy;
+  const double accuracy = 1.0e-6;
+  exahype::solvers::ADERDGSolver::CompressionAccuracy = accuracy;
+
+  // the first array does not fill a whole number of doubles
+  const std::vector<double> first  = createArray(63,1.0);
+  const std::vector<double> second = createArray(27,-20.0);
+
+  std::vector<double> buffer;
+  exahype::solvers::PackedCellMigration::appendArray(buffer,first.data(),first.size());
+  exahype::solvers::PackedCellMigration::appendArray(buffer,second.data(),second.size());
+  validateWithParams1(buffer.size()<2+first.size()+2+second.size(),buffer.size());
+
+  std::vector<double> firstReceived(first.size());
+  std::vector<double> secondReceived(second.size());
+  int position = 0;
+  exahype::solvers::PackedCellMigration::readArray(buffer,position,firstReceived.data(),firstReceived.size());
+  exahype::solvers::PackedCellMigration::readArray(buffer,position,secondReceived.data(),secondReceived.size());
+  validateEquals(position,static_cast<int>(buffer.size()));
+
+  for (int i=0; i<static_cast<int>(first.size()); i++) {
+    validateNumericalEqualsWithEpsWithParams1(firstReceived[i],first[i],accuracy,i);
+  }
+  for (int i=0; i<static_cast<int>(second.size()); i++) {
+    validateNumericalEqualsWithEpsWithParams1(secondReceived[i],second[i],accuracy,i);
+  }
+
+  exahype::solvers::ADERDGSolver::CompressionAccuracy = compressionAccuracy;
+}
+
+#ifdef UseTestSpecificCompilerSettings
+#pragma optimize("", on)
+#endif
+
+#endif
@@ -0,0 +1,59 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_TESTS_SOLVERS_PACKED_CELL_MIGRATION_TEST_H_
+#define _EXAHYPE_TESTS_SOLVERS_PACKED_CELL_MIGRATION_TEST_H_
+
+#ifdef Parallel
+
+#include "tarch/tests/TestCase.h"
+
+namespace exahype {
+namespace tests {
+namespace solvers {
+class PackedCellMigrationTest;
+}
+}
+}
+
+/**
+ * Tests the packing of the solution arrays into the
+ * single fork or join message of a cell.
+ */
+class exahype::tests::solvers::PackedCellMigrationTest : public tarch::tests::TestCase {
+ private:
+  /**
+   * Appends two arrays without compression and reads them
+   * back. Checks that they are restored bitwise and that the
+   * reads end exactly at the end of the buffer.
+   */
+  void testLosslessRoundTrip();
+
+  /**
+   * Appends two arrays with ADERDGSolver::CompressionAccuracy
+   * set and reads them back. Checks that the buffer is smaller
+   * than without compression and that the restored arrays are
+   * within the accuracy.
+   */
+  void testLossyRoundTrip();
+
+ public:
+  PackedCellMigrationTest();
+  virtual ~PackedCellMigrationTest();
+
+  virtual void run();
+};
+
+#endif
+
+#endif
@@ -0,0 +1,155 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "kernels/DGResampling.h"
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include "tarch/Assertions.h"
+
+#include "kernels/DGBasisFunctions.h"
+#include "kernels/GaussLegendreQuadrature.h"
+
+
+namespace {
+  /**
+   * Applies a 1-d evaluation matrix along one coordinate axis. The input
+   * is viewed as array [outer][numberOfNodes][inner], the output as
+   * array [outer][numberOfPoints][inner].
+   */
+  void applyAlongAxis(
+      const double* in,
+      double*       out,
+      const double* matrix,
+      int           numberOfNodes,
+      int           numberOfPoints,
+      int           outer,
+      int           inner) {
+    for (int o=0; o<outer; o++) {
+      for (int p=0; p<numberOfPoints; p++) {
+        double* outLine = out + (o*numberOfPoints+p)*inner;
+        std::fill_n(outLine,inner,0.0);
+        for (int n=0; n<numberOfNodes; n++) {
+          const double  coefficient = matrix[p*numberOfNodes+n];
+          const double* inLine      = in + (o*numberOfNodes+n)*inner;
+          for (int j=0; j<inner; j++) {
+            outLine[j] += coefficient * inLine[j];
+          }
+        }
+      }
+    }
+  }
+}
+
+
+void kernels::computeEvaluationMatrix1d(
+    int           order,
+    const double* xRef,
+    int           numberOfPoints,
+    double*       matrix) {
+  for (int p=0; p<numberOfPoints; p++) {
+    for (int n=0; n<order+1; n++) {
+      matrix[p*(order+1)+n] = kernels::basisFunctions[order][n](xRef[p]);
+    }
+  }
+}
+
+
+const double* kernels::getEvaluationMatrix1d(
+    int              order,
+    int              numberOfPoints,
+    ResamplingPoints points) {
+  assertion2(points!=ResamplingPoints::EquidistantVertices || numberOfPoints>1,order,numberOfPoints);
+  assertion2(points!=ResamplingPoints::GaussLegendreCellCentres || numberOfPoints==order,order,numberOfPoints);
+
+  static thread_local std::map<std::tuple<int,int,ResamplingPoints>,std::vector<double>> matrices;
+
+  std::vector<double>& matrix = matrices[std::make_tuple(order,numberOfPoints,points)];
+  if (matrix.empty()) {
+    std::vector<double> xRef(numberOfPoints);
+    for (int p=0; p<numberOfPoints; p++) {
+      switch (points) {
+        case ResamplingPoints::EquidistantVertices:
+          xRef[p] = static_cast<double>(p)/(numberOfPoints-1);
+          break;
+        case ResamplingPoints::EquidistantCellCentres:
+          xRef[p] = (p+0.5)/numberOfPoints;
+          break;
+        case ResamplingPoints::GaussLegendreCellCentres:
+          xRef[p] = 0.5*(kernels::gaussLegendreNodes[order][p]+kernels::gaussLegendreNodes[order][p+1]);
+          break;
+      }
+    }
+    matrix.resize(numberOfPoints*(order+1));
+    computeEvaluationMatrix1d(order,xRef.data(),numberOfPoints,matrix.data());
+  }
+  return matrix.data();
+}
+
+
+void kernels::resample(
+    const double*        u,
+    int                  numberOfUnknowns,
+    int                  order,
+    const double* const* evaluationMatrices,
+    const int*           numberOfPoints,
+    double*              result) {
+  const int numberOfNodes = order+1;
+
+  // The sweep along axis d maps [outer][numberOfNodes][inner] onto [outer][numberOfPoints[d]][inner]
+  int outer[DIMENSIONS];
+  int inner[DIMENSIONS];
+  int maxSize = 0;
+  for (int d=0; d<DIMENSIONS; d++) {
+    outer[d] = 1;
+    for (int e=d+1; e<DIMENSIONS; e++) {
+      outer[d] *= numberOfNodes;
+    }
+    inner[d] = numberOfUnknowns;
+    for (int e=0; e<d; e++) {
+      inner[d] *= numberOfPoints[e];
+    }
+    maxSize = std::max(maxSize,outer[d]*numberOfPoints[d]*inner[d]);
+  }
+
+  static thread_local std::vector<double> buffers[2];
+  buffers[0].resize(maxSize);
+  buffers[1].resize(maxSize);
+
+  const double* in = u;
+  for (int d=0; d<DIMENSIONS; d++) {
+    double* out = (d+1==DIMENSIONS) ? result : buffers[d%2].data();
+    applyAlongAxis(in,out,evaluationMatrices[d],numberOfNodes,numberOfPoints[d],outer[d],inner[d]);
+    in = out;
+  }
+}
+
+
+void kernels::resample(
+    const double*    u,
+    int              numberOfUnknowns,
+    int              order,
+    int              numberOfPoints,
+    ResamplingPoints points,
+    double*          result) {
+  const double* evaluationMatrices[DIMENSIONS];
+  int           numberOfPointsPerAxis[DIMENSIONS];
+  for (int d=0; d<DIMENSIONS; d++) {
+    evaluationMatrices[d]    = getEvaluationMatrix1d(order,numberOfPoints,points);
+    numberOfPointsPerAxis[d] = numberOfPoints;
+  }
+  resample(u,numberOfUnknowns,order,evaluationMatrices,numberOfPointsPerAxis,result);
+}
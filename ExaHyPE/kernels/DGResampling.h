@@ -0,0 +1,112 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+/** \file DGResampling.h
+ *  \brief Evaluation of the DG polynomial of a cell on tensor product grids.
+ *
+ *  The plotters evaluate the DG polynomial at many points per cell. Evaluating
+ *  each point and unknown separately (see kernels::interpolate) costs
+ *  \f$(N+1)^d\f$ basis function evaluations per point and unknown. If the
+ *  points form a tensor product grid, we can instead apply one 1-d evaluation
+ *  matrix per coordinate axis to all unknowns at once (sum factorisation).
+ */
+#ifndef EXAHYPE_KERNELS_DGRESAMPLING_H_
+#define EXAHYPE_KERNELS_DGRESAMPLING_H_
+
+#include "peano/utils/Globals.h"
+
+namespace kernels {
+
+/**
+ * Computes the matrix which evaluates the Lagrange basis of order \p order
+ * at \p numberOfPoints reference coordinates \p xRef in (0,1):
+ *
+ *   matrix[p*(order+1)+n] = basisFunctions[order][n](xRef[p])
+ *
+ * \p matrix has to provide space for numberOfPoints*(order+1) entries.
+ */
+void computeEvaluationMatrix1d(
+    int           order,
+    const double* xRef,
+    int           numberOfPoints,
+    double*       matrix);
+
+/**
+ * Point sets along one coordinate axis of the reference cell (0,1) which
+ * are used by the plotters.
+ */
+enum class ResamplingPoints {
+  /**
+   * numberOfPoints equidistant points p/(numberOfPoints-1) including the
+   * boundary, i.e. the vertices of an equidistant grid.
+   */
+  EquidistantVertices,
+  /**
+   * The centres (p+0.5)/numberOfPoints of numberOfPoints equally sized subcells.
+   */
+  EquidistantCellCentres,
+  /**
+   * The order midpoints between two consecutive Gauss-Legendre nodes.
+   */
+  GaussLegendreCellCentres
+};
+
+/**
+ * Returns the evaluation matrix (see computeEvaluationMatrix1d) for
+ * \p numberOfPoints points of the given kind.
+ *
+ * The matrices are computed on first use and kept per thread.
+ */
+const double* getEvaluationMatrix1d(
+    int              order,
+    int              numberOfPoints,
+    ResamplingPoints points);
+
+/**
+ * Evaluates the DG polynomial \p u at all points of a tensor product grid.
+ *
+ * @param u                  Nodal values of the cell; numberOfUnknowns entries
+ *                           per Gauss-Legendre node, first coordinate running fastest.
+ * @param numberOfUnknowns   Number of unknowns per node. All unknowns are resampled.
+ * @param order              Order of the DG polynomial.
+ * @param evaluationMatrices One 1-d evaluation matrix per coordinate axis.
+ * @param numberOfPoints     Number of points per coordinate axis.
+ * @param result             Holds numberOfUnknowns values per point afterwards.
+ *                           The points are enumerated with the first coordinate
+ *                           running fastest, i.e. in the order of dfor.
+ */
+void resample(
+    const double*        u,
+    int                  numberOfUnknowns,
+    int                  order,
+    const double* const* evaluationMatrices,
+    const int*           numberOfPoints,
+    double*              result);
+
+/**
+ * Evaluates the DG polynomial \p u on the tensor product grid with
+ * \p numberOfPoints points of kind \p points along each coordinate axis.
+ *
+ * @param result Has to provide space for numberOfPoints^DIMENSIONS*numberOfUnknowns
+ *               entries. See the other resample variant for the ordering.
+ */
+void resample(
+    const double*    u,
+    int              numberOfUnknowns,
+    int              order,
+    int              numberOfPoints,
+    ResamplingPoints points,
+    double*          result);
+}
+
+#endif
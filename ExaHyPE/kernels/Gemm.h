@@ -0,0 +1,138 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#ifndef _EXAHYPE_KERNELS_GEMM_H_
+#define _EXAHYPE_KERNELS_GEMM_H_
+
+namespace kernels {
+
+/**
+ * Small dense matrix-matrix multiplication
+ *
+ *   C = alpha * A * B + beta * C
+ *
+ * with A of size MxK, B of size KxN, and C of size MxN. All matrices are
+ * stored column-major (Fortran order) as libxsmm expects them. The
+ * leading dimensions LDA, LDB, and LDC, i.e. the distance between two
+ * columns, may be larger than the number of rows. This allows
+ * to multiply sub-blocks of the DG tensors and to use padded columns
+ * (see getPaddedSize() in KernelUtils.h).
+ *
+ * All sizes are template arguments. The compiler thus knows all trip counts,
+ * unrolls the K and N loops and vectorises the M loop, i.e. the loop over
+ * the rows which are contiguous in memory. In the ADER-DG kernels, M
+ * usually is the (padded) number of variables, while N and K are the number
+ * of basis functions per coordinate axis.
+ *
+ * Each column of C is accumulated in registers and written exactly once.
+ * Scaling by alpha and beta is fused into this write. If beta is 0, C is
+ * not read.
+ *
+ * Sketch how the ADER-DG kernels map onto it (per line of DoF along
+ * one coordinate axis):
+ *
+ * - volume integral:   lduh(l,k) += w/dx * lFhi(l,m) * Kxi(k,m),
+ *                      i.e. M=nVar, N=K=basisSize;
+ * - surface integral:  lduh(l,k) += w/dx * [lFbnd_left(l), lFbnd_right(l)] * [FLCoeff(k); -FRCoeff(k)],
+ *                      i.e. M=nVar, N=basisSize, K=2;
+ * - predictor:         rhs(l,k) -= w*dt/dx * lFi(l,n) * Kxi(n,k) for the flux
+ *                      derivatives and lQi(l,k) += 1/w * rhs(l,n) * iK1(k,n) for
+ *                      the time integral, i.e. M=nVar, N=K=basisSize;
+ * - Riemann solver:    Qav(l) = QL(l,n) * w(n) for the averaged face states,
+ *                      i.e. M=nData, N=1, K=number of face DoF.
+ *
+ * \note The arrays must not overlap.
+ */
+template <int M, int N, int K, int LDA = M, int LDB = K, int LDC = M>
+inline void gemm(
+    const double* const __restrict__ A,
+    const double* const __restrict__ B,
+    double* const __restrict__ C,
+    const double alpha = 1.0,
+    const double beta  = 1.0) {
+  static_assert(M>0 && N>0 && K>0, "matrix sizes have to be positive");
+  static_assert(LDA>=M, "leading dimension of A has to be at least M");
+  static_assert(LDB>=K, "leading dimension of B has to be at least K");
+  static_assert(LDC>=M, "leading dimension of C has to be at least M");
+
+  for (int n = 0; n < N; n++) {
+    double column[M];
+    #pragma omp simd
+    for (int m = 0; m < M; m++) {
+      column[m] = 0.0;
+    }
+
+    for (int k = 0; k < K; k++) {
+      const double        b = B[n*LDB+k];
+      const double* const a = A + k*LDA;
+      #pragma omp simd
+      for (int m = 0; m < M; m++) {
+        column[m] += a[m] * b;
+      }
+    }
+
+    double* const c = C + n*LDC;
+    if (beta==0.0) {
+      #pragma omp simd
+      for (int m = 0; m < M; m++) {
+        c[m] = alpha * column[m];
+      }
+    }
+    else {
+      #pragma omp simd
+      for (int m = 0; m < M; m++) {
+        c[m] = alpha * column[m] + beta * c[m];
+      }
+    }
+  }
+}
+
+/**
+ * Copies the \p rows x \p columns lookup table \p matrix (as allocated by
+ * initDGMatrices(), i.e. an array of rows) into the contiguous array
+ * \p result. Read as column-major matrix with leading dimension \p columns,
+ * \p result holds the transposed of \p matrix.
+ *
+ * Use it to prepare B if a kernel multiplies by the transposed of one of
+ * the DG matrices, e.g. lduh(l,k) += lFhi(l,m) * Kxi(k,m).
+ */
+template <int rows, int columns>
+inline void copyTransposed(double* const result, const double* const* const matrix) {
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < columns; j++) {
+      result[i*columns+j] = matrix[i][j];
+    }
+  }
+}
+
+/**
+ * Copies the \p rows x \p columns lookup table \p matrix (as allocated by
+ * initDGMatrices(), i.e. an array of rows) into the contiguous array
+ * \p result. Read as column-major matrix with leading dimension \p rows,
+ * \p result holds \p matrix itself.
+ *
+ * Use it to prepare B if a kernel multiplies by one of the DG matrices,
+ * e.g. rhs(l,k) -= lFi(l,n) * Kxi(n,k).
+ */
+template <int rows, int columns>
+inline void copyColumnMajor(double* const result, const double* const* const matrix) {
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < columns; j++) {
+      result[j*rows+i] = matrix[i][j];
+    }
+  }
+}
+
+}  // namespace kernels
+
+#endif
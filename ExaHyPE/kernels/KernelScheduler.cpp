@@ -0,0 +1,69 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+#include "kernels/KernelScheduler.h"
+
+#include "tarch/Assertions.h"
+
+tarch::logging::Log kernels::KernelScheduler::_log("kernels::KernelScheduler");
+
+constexpr int kernels::KernelScheduler::DefaultMinimalNumberOfCellsPerThread;
+
+
+kernels::KernelScheduler::KernelScheduler():
+  _numberOfThreads(1),
+  _minimalNumberOfCellsPerThread(DefaultMinimalNumberOfCellsPerThread),
+  _numberOfReadyCells(-1),
+  _splitKernels(false) {
+}
+
+kernels::KernelScheduler& kernels::KernelScheduler::getInstance() {
+  static KernelScheduler singleton;
+  return singleton;
+}
+
+void kernels::KernelScheduler::configure(int numberOfThreads, int minimalNumberOfCellsPerThread) {
+  assertion1(numberOfThreads>=1,numberOfThreads);
+  assertion1(minimalNumberOfCellsPerThread>=1,minimalNumberOfCellsPerThread);
+
+  _numberOfThreads               = numberOfThreads;
+  _minimalNumberOfCellsPerThread = minimalNumberOfCellsPerThread;
+  updateDecision();
+}
+
+void kernels::KernelScheduler::setNumberOfReadyCells(int numberOfReadyCells) {
+  _numberOfReadyCells = numberOfReadyCells;
+  updateDecision();
+}
+
+void kernels::KernelScheduler::updateDecision() {
+  const bool splitKernels =
+      _numberOfThreads>1 &&
+      (_numberOfReadyCells<0 ||
+       _numberOfReadyCells<_minimalNumberOfCellsPerThread*_numberOfThreads);
+
+  if (splitKernels!=_splitKernels && _numberOfReadyCells>=0) {
+    logInfo("updateDecision()",
+        (splitKernels ? "split kernel loops among threads" : "run kernels serially and parallelise over cells")
+        << " (" << _numberOfReadyCells << " ready cells, " << _numberOfThreads << " threads)");
+  }
+  _splitKernels = splitKernels;
+}
+
+int kernels::KernelScheduler::getMinimalNumberOfCellsPerThread() const {
+  return _minimalNumberOfCellsPerThread;
+}
+
+bool kernels::KernelScheduler::splitKernels() const {
+  return _splitKernels;
+}
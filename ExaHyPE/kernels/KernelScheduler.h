@@ -0,0 +1,131 @@
+/**
+ * This file is part of the ExaHyPE project.
+ * Copyright (c) 2016  http://exahype.eu
+ * All rights reserved.
+ *
+ * The project has received funding from the European Union's Horizon
+ * 2020 research and innovation programme under grant agreement
+ * No 671698. For copyrights and licensing, please consult the webpage.
+ *
+ * Released under the BSD 3 Open Source License.
+ * For the full license text, see LICENSE.txt
+ **/
+
+/** \file KernelScheduler.h
+ *  \brief Chooses between cell-level and intra-cell shared memory parallelism.
+ *
+ *  The grid traversal processes cells concurrently. Some generic kernels
+ *  additionally split loops of length order+1 among the threads. If there
+ *  are enough cells to keep all threads busy, these nested parallel regions
+ *  only add fork/join overhead and prevent the compiler from vectorising
+ *  the loop bodies. The scheduler thus decides once per traversal if the
+ *  kernels split their loops (few, expensive cells) or run serially (many
+ *  cells).
+ */
+#ifndef EXAHYPE_KERNELS_KERNEL_SCHEDULER_H_
+#define EXAHYPE_KERNELS_KERNEL_SCHEDULER_H_
+
+#include "tarch/logging/Log.h"
+#include "tarch/multicore/Loop.h"
+
+#include "peano/datatraversal/autotuning/MethodTrace.h"
+#include "peano/datatraversal/autotuning/Oracle.h"
+
+namespace kernels {
+  class KernelScheduler;
+
+  /**
+   * Runs body(i) for i in [0,problemSize).
+   *
+   * If the KernelScheduler decided for intra-cell parallelism, the loop is
+   * split among the threads according to the grain size the oracle returns
+   * for \p methodTrace. Otherwise, it is a plain loop and the oracle is not
+   * queried at all.
+   */
+  template <typename LoopBody>
+  void parallelFor(
+      const int problemSize,
+      const peano::datatraversal::autotuning::MethodTrace methodTrace,
+      const LoopBody& body);
+}
+
+/**
+ * Process-wide policy for the shared memory parallelisation of the kernels.
+ *
+ * The Prediction mapping counts the cells which are ready for the space-time
+ * predictor and reports them at the end of each traversal. The kernels
+ * of the next traversal split their loops only if there are less than
+ * getMinimalNumberOfCellsPerThread() cells per thread; this usually only
+ * holds on coarse meshes or on ranks which hold few, expensive high-order
+ * cells. As long as no cell count is known, the kernels split their loops
+ * as before.
+ *
+ * The decision is written outside of the concurrent parts of a traversal
+ * and only read by the kernels.
+ */
+class kernels::KernelScheduler {
+ private:
+  static tarch::logging::Log _log;
+
+  int    _numberOfThreads;
+  int    _minimalNumberOfCellsPerThread;
+  int    _numberOfReadyCells;
+  bool   _splitKernels;
+
+  KernelScheduler();
+
+  void updateDecision();
+
+ public:
+  /**
+   * Default for getMinimalNumberOfCellsPerThread(). Work stealing needs a
+   * few cells per thread to balance cells of different cost.
+   */
+  static constexpr int DefaultMinimalNumberOfCellsPerThread = 4;
+
+  static KernelScheduler& getInstance();
+
+  /**
+   * Is called by the runner after the shared memory environment has been
+   * set up.
+   */
+  void configure(int numberOfThreads, int minimalNumberOfCellsPerThread=DefaultMinimalNumberOfCellsPerThread);
+
+  /**
+   * Sets the number of cells which have been ready for the kernels
+   * during the last traversal and redoes the decision for the next
+   * traversal.
+   */
+  void setNumberOfReadyCells(int numberOfReadyCells);
+
+  int getMinimalNumberOfCellsPerThread() const;
+
+  /**
+   * @return true if the kernels should split their loops among the threads.
+   */
+  bool splitKernels() const;
+};
+
+
+template <typename LoopBody>
+void kernels::parallelFor(
+    const int problemSize,
+    const peano::datatraversal::autotuning::MethodTrace methodTrace,
+    const LoopBody& body) {
+  #if defined(SharedMemoryParallelisation)
+  if (KernelScheduler::getInstance().splitKernels()) {
+    auto grainSize = peano::datatraversal::autotuning::Oracle::getInstance().parallelise(problemSize,methodTrace);
+    pfor(i,0,problemSize,grainSize.getGrainSize())
+      body(i);
+    endpfor
+    grainSize.parallelSectionHasTerminated();
+    return;
+  }
+  #endif
+
+  for (int i=0; i<problemSize; i++) {
+    body(i);
+  }
+}
+
+#endif
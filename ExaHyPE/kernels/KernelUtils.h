@@ -22,6 +22,30 @@
 
 namespace kernels {
 
+/**
+ * Number of doubles per SIMD register of the target architecture.
+ *
+ * We follow the ALIGNMENT the toolkit derives from the architecture
+ * given in the specification file. The kernels thus pad exactly as
+ * the solvers do when they size the arrays (see addPadding() in
+ * exahype/solvers/Solver.h). Without architecture, we do not pad.
+ */
+#if defined(ALIGNMENT)
+constexpr int SimdWidth = ALIGNMENT/8;
+#else
+constexpr int SimdWidth = 1;
+#endif
+
+/**
+ * \return \p n rounded up to the next multiple of SimdWidth.
+ *
+ * Use it as leading dimension if the columns of a matrix shall start
+ * at SIMD register boundaries. Equals addPadding() of the solvers.
+ */
+inline constexpr int getPaddedSize(int n) {
+  return ((n + SimdWidth - 1) / SimdWidth) * SimdWidth;
+}
+
 /**
  * This is a single successor class for the idx2, idx3, idx4, idx5, idx6 classes.
  * It works basically like idx6. If you work with less than 6 dimensions, nothing
@@ -80,9 +80,21 @@ namespace c {
 
 
 /**
- * @param SolverType Has to be of type ADERDG Solver.
+ * @param SolverType    Has to be of type ADERDG Solver.
+ * @param usePaddedData Pad the variable dimension of the space-time
+ *                      unknowns and fluxes, the right-hand side, and the
+ *                      time-averaged unknowns and fluxes (tempUnknowns,
+ *                      tempFluxUnknowns) to a multiple of kernels::SimdWidth
+ *                      (see kernels::getPaddedSize()). Every node's variables
+ *                      then start at a SIMD boundary if the arrays are aligned.
+ *                      The padding entries are kept zero. luh, lQhbnd, and
+ *                      lFhbnd as well as the arrays passed to the user's
+ *                      fusedSource(...) are never padded, i.e. the padding is
+ *                      stripped off before the data leaves the predictor.
+ *                      The arrays have to be sized accordingly
+ *                      (see ADERDGSolver::getTempUnknownsSize() etc.).
  */
-template <bool useSource, bool useFlux, bool useNCP, typename SolverType>
+template <bool useSource, bool useFlux, bool useNCP, typename SolverType, bool usePaddedData=false>
 void spaceTimePredictorNonlinear(
     SolverType& solver,
     double*  lQhbnd, double* lFhbnd,
@@ -95,6 +107,28 @@ void spaceTimePredictorNonlinear(
     const tarch::la::Vector<DIMENSIONS, double>& dx,
     const double dt);
 
+/**
+ * Space-time predictor for linear PDEs whose coefficient matrices are
+ * constant within a cell. Equivalent to spaceTimePredictorLinear without
+ * point sources but evaluates the Cauchy-Kovalewski procedure with
+ * cached coefficient matrices instead of the user's
+ * nonConservativeProduct.
+ *
+ * @param SolverType Has to be of type ADERDG Solver.
+ */
+template <typename SolverType>
+void spaceTimePredictorLinearConstantCoefficients(
+    SolverType& solver,
+    double*  lQhbnd, double* lFhbnd,
+    double** tempSpaceTimeUnknowns,
+    double** tempSpaceTimeFluxUnknowns,
+    double*  tempUnknowns,
+    double*  tempFluxUnknowns,
+    double*  tempStateSizedVector,
+    const double* const luh,
+    const tarch::la::Vector<DIMENSIONS, double>& dx,
+    const double dt);
+
 template <typename SolverType>
 void solutionUpdate(SolverType& solver, double* luh, const double* const lduh, const double dt);
 
@@ -102,7 +136,11 @@ template <bool useSourceOrNCP, bool useFlux, int numberOfVariables, int basisSiz
 void volumeIntegralLinear(double* lduh, const double* const lFhi,
                           const tarch::la::Vector<DIMENSIONS, double>& dx);
 
-template <bool useSourceOrNCP, bool useFlux, int numberOfVariables, int basisSize>
+/**
+ * @param usePaddedData lFhi uses the padded layout written by
+ *                      spaceTimePredictorNonlinear(...). lduh is not padded.
+ */
+template <bool useSourceOrNCP, bool useFlux, int numberOfVariables, int basisSize, bool usePaddedData=false>
 void volumeIntegralNonlinear(double* lduh, const double* const lFhi,
                              const tarch::la::Vector<DIMENSIONS, double>& dx);
 
@@ -252,6 +290,7 @@ void pointSource(
 #include "kernels/aderdg/generic/c/3d/volumeIntegralNonlinear.cpph"
 #include "kernels/aderdg/generic/c/3d/amrRoutines.cpph"
 #endif
+#include "kernels/aderdg/generic/c/spaceTimePredictorLinearConstantCoefficients.cpph"
 
 // Todo: Recasting the code from function templates to class templates
 //       did not yet consider the Fortran kernels and probably never will,
@@ -2,6 +2,9 @@
 
 #include "peano/utils/Loop.h"
 #include "tarch/parallel/Node.h"
+#include "tarch/multicore/Lock.h"
+
+#include <cmath>
 
 const int multiscalelinkedcell::HangingVertexBookkeeper::InvalidAdjacencyIndex         = -1;
 const int multiscalelinkedcell::HangingVertexBookkeeper::RemoteAdjacencyIndex          = -2;
@@ -177,15 +180,56 @@ tarch::la::Vector<THREE_POWER_D,int> multiscalelinkedcell::getIndicesAroundCell(
 }
 
 
+bool multiscalelinkedcell::HangingVertexBookkeeper::HangingVertexKey::operator==(const HangingVertexKey& other) const {
+  bool result = level==other.level;
+  for (int d=0; d<DIMENSIONS; d++) {
+    result &= coordinates[d]==other.coordinates[d];
+  }
+  return result;
+}
+
+
 multiscalelinkedcell::HangingVertexBookkeeper::HangingVertexBookkeeper():
-    _inheritIndicesFromCoarserGrids(true),
-  _vertexMap() {
+  _inheritIndicesFromCoarserGrids(true),
+  _boundingBoxOffset(0.0),
+  _latticeScaling(),
+  _iteration(0) {
+  setBoundingBox(tarch::la::Vector<DIMENSIONS,double>(0.0),tarch::la::Vector<DIMENSIONS,double>(1.0));
+  for (int shard=0; shard<NumberOfShards; shard++) {
+    _shards[shard].numberOfOccupiedSlots = 0;
+  }
 }
 
 void multiscalelinkedcell::HangingVertexBookkeeper::disableInheritingOfCoarseGridIndices() {
   _inheritIndicesFromCoarserGrids = false;
 }
 
+
+void multiscalelinkedcell::HangingVertexBookkeeper::setBoundingBox(
+  const tarch::la::Vector<DIMENSIONS,double>&  offset,
+  const tarch::la::Vector<DIMENSIONS,double>&  size
+) {
+  #ifdef Asserts
+  for (int shard=0; shard<NumberOfShards; shard++) {
+    assertion2(_shards[shard].numberOfOccupiedSlots==0,offset,size);
+  }
+  #endif
+
+  _boundingBoxOffset = offset;
+  _latticeScaling.resize(MaxLevel+1);
+  double cellsPerAxis = 1.0;
+  for (int level=0; level<=MaxLevel; level++) {
+    for (int d=0; d<DIMENSIONS; d++) {
+      assertion2(size(d)>0.0,offset,size);
+      _latticeScaling[level](d) = LatticeRefinement * cellsPerAxis / size(d);
+    }
+    if (level>=1) {
+      cellsPerAxis *= 3.0;
+    }
+  }
+}
+
+
 multiscalelinkedcell::HangingVertexBookkeeper&  multiscalelinkedcell::HangingVertexBookkeeper::getInstance() {
   static multiscalelinkedcell::HangingVertexBookkeeper instance;
   return instance;
@@ -217,25 +261,148 @@ bool multiscalelinkedcell::HangingVertexBookkeeper::allAdjacencyInformationIsAva
 }
 
 
-tarch::la::Vector<DIMENSIONS+1,double > multiscalelinkedcell::HangingVertexBookkeeper::getKey(
+multiscalelinkedcell::HangingVertexBookkeeper::HangingVertexKey multiscalelinkedcell::HangingVertexBookkeeper::getKey(
   const tarch::la::Vector<DIMENSIONS,double>&  x,
   int                                          level
 ) const {
-  tarch::la::Vector<DIMENSIONS+1, double> result;
+  assertion2(level>=0 && level<=MaxLevel,x,level);
+
+  HangingVertexKey result;
+  result.level = level;
   for(int d = 0; d < DIMENSIONS; d++) {
-    result(d) = x(d);
+    result.coordinates[d] = std::llround( (x(d)-_boundingBoxOffset(d)) * _latticeScaling[level](d) );
   }
-  result(DIMENSIONS) = level;
   return result;
 }
 
 
+std::uint64_t multiscalelinkedcell::HangingVertexBookkeeper::getHash(const HangingVertexKey& key) {
+  std::uint64_t result = static_cast<std::uint64_t>(key.level);
+  for(int d = 0; d < DIMENSIONS; d++) {
+    result = result * 0x9e3779b97f4a7c15ull ^ static_cast<std::uint64_t>(key.coordinates[d]);
+  }
+  // splitmix64 finaliser: every input bit affects the high (shard) and low (slot) bits
+  result ^= result >> 30;
+  result *= 0xbf58476d1ce4e5b9ull;
+  result ^= result >> 27;
+  result *= 0x94d049bb133111ebull;
+  result ^= result >> 31;
+  return result;
+}
+
+
+multiscalelinkedcell::HangingVertexBookkeeper::Shard& multiscalelinkedcell::HangingVertexBookkeeper::getShard(std::uint64_t hash) const {
+  return _shards[hash >> (64-ShardBits)];
+}
+
+
+multiscalelinkedcell::HangingVertexBookkeeper::Slot* multiscalelinkedcell::HangingVertexBookkeeper::findSlot(
+  Shard&                   shard,
+  const HangingVertexKey&  key,
+  std::uint64_t            hash
+) {
+  if (shard.slots.empty()) {
+    return nullptr;
+  }
+  const std::uint64_t mask = shard.slots.size()-1;
+  for (std::uint64_t i = hash & mask; ; i = (i+1) & mask) {
+    Slot& slot = shard.slots[i];
+    if (!slot.occupied) {
+      return nullptr;
+    }
+    if (slot.key==key) {
+      return &slot;
+    }
+  }
+}
+
+
+void multiscalelinkedcell::HangingVertexBookkeeper::insertWithoutLookup(Shard& shard, const Slot& slot) {
+  const std::uint64_t mask = shard.slots.size()-1;
+  std::uint64_t i = getHash(slot.key) & mask;
+  while (shard.slots[i].occupied) {
+    i = (i+1) & mask;
+  }
+  shard.slots[i] = slot;
+  shard.numberOfOccupiedSlots++;
+}
+
+
+void multiscalelinkedcell::HangingVertexBookkeeper::grow(Shard& shard) {
+  shard.survivors.clear();
+  for (const Slot& slot : shard.slots) {
+    if (slot.occupied) {
+      shard.survivors.push_back(slot);
+    }
+  }
+
+  Slot emptySlot;
+  emptySlot.occupied = false;
+  shard.slots.assign( shard.slots.empty() ? InitialNumberOfSlotsPerShard : 2*shard.slots.size(), emptySlot );
+  shard.numberOfOccupiedSlots = 0;
+  for (const Slot& slot : shard.survivors) {
+    insertWithoutLookup(shard,slot);
+  }
+}
+
+
+template <typename Predicate>
+int multiscalelinkedcell::HangingVertexBookkeeper::removeSlots(Shard& shard, Predicate predicate) {
+  shard.survivors.clear();
+  for (const Slot& slot : shard.slots) {
+    if (slot.occupied && !predicate(slot.identifier)) {
+      shard.survivors.push_back(slot);
+    }
+  }
+
+  const int removedSlots = shard.numberOfOccupiedSlots - static_cast<int>(shard.survivors.size());
+  if (removedSlots>0) {
+    for (Slot& slot : shard.slots) {
+      slot.occupied = false;
+    }
+    shard.numberOfOccupiedSlots = 0;
+    for (const Slot& slot : shard.survivors) {
+      insertWithoutLookup(shard,slot);
+    }
+  }
+  return removedSlots;
+}
+
+
+multiscalelinkedcell::HangingVertexBookkeeper::Slot& multiscalelinkedcell::HangingVertexBookkeeper::findOrInsertSlot(
+  Shard&                   shard,
+  const HangingVertexKey&  key,
+  std::uint64_t            hash
+) {
+  Slot* result = findSlot(shard,key,hash);
+  if (result==nullptr) {
+    // keep the load factor below 3/4
+    if ( 4*(shard.numberOfOccupiedSlots+1) > 3*static_cast<int>(shard.slots.size()) ) {
+      grow(shard);
+    }
+    Slot newSlot;
+    newSlot.key                                  = key;
+    newSlot.identifier.indicesOfAdjacentCells    = createVertexLinkMapForNewVertex();
+    newSlot.identifier.lastUsedIteration         = _iteration-1;
+    newSlot.occupied                             = true;
+    insertWithoutLookup(shard,newSlot);
+    result = findSlot(shard,key,hash);
+  }
+  assertion(result!=nullptr);
+  return *result;
+}
+
+
 bool multiscalelinkedcell::HangingVertexBookkeeper::holdsVertex(
   const tarch::la::Vector<DIMENSIONS,double>&  x,
   int                                          level
 ) const {
-  const tarch::la::Vector<DIMENSIONS+1,double > key = getKey(x,level);
-  return (_vertexMap.count(key)>0);
+  const HangingVertexKey key  = getKey(x,level);
+  const std::uint64_t    hash = getHash(key);
+  Shard& shard = getShard(hash);
+
+  tarch::multicore::Lock lock(shard.semaphore);
+  return findSlot(shard,key,hash)!=nullptr;
 }
 
 
@@ -245,8 +412,13 @@ bool multiscalelinkedcell::HangingVertexBookkeeper::usedVertexInThisTraversal(
 ) const {
   logTraceInWith2Arguments( "usedVertexInThisTraversal(...)", x, level );
   assertion(holdsVertex(x,level));
-  const tarch::la::Vector<DIMENSIONS+1,double > key = getKey(x,level);
-  const bool result = _vertexMap.at(key).usedInLastTraversal;
+  const HangingVertexKey key  = getKey(x,level);
+  const std::uint64_t    hash = getHash(key);
+  Shard& shard = getShard(hash);
+
+  tarch::multicore::Lock lock(shard.semaphore);
+  const bool result = findSlot(shard,key,hash)->identifier.lastUsedIteration==_iteration;
+  lock.free();
   logTraceOutWith1Argument( "usedVertexInThisTraversal(...)", result );
   return result;
 }
@@ -257,67 +429,71 @@ tarch::la::Vector<TWO_POWER_D,int>&  multiscalelinkedcell::HangingVertexBookkeep
   const tarch::la::Vector<DIMENSIONS,double>&  x,
   int                                          level
 ) {
-  const tarch::la::Vector<DIMENSIONS+1,double > key = getKey(x,level);
-  assertion3(_vertexMap.count(key)==1 || level<=1,x,level,key);
-  _vertexMap[key].usedInLastTraversal = true;
-  return _vertexMap[key].indicesOfAdjacentCells;
+  assertion2(holdsVertex(x,level) || level<=1,x,level);
+  const HangingVertexKey key  = getKey(x,level);
+  const std::uint64_t    hash = getHash(key);
+  Shard& shard = getShard(hash);
+
+  tarch::multicore::Lock lock(shard.semaphore);
+  Slot& slot = findOrInsertSlot(shard,key,hash);
+  slot.identifier.lastUsedIteration = _iteration;
+  return slot.identifier.indicesOfAdjacentCells;
+}
+
+
+void multiscalelinkedcell::HangingVertexBookkeeper::setAdjacencyEntryOfVertex(
+  const tarch::la::Vector<DIMENSIONS,double>&  x,
+  int                                          level,
+  int                                          entry,
+  int                                          cellIndex
+) {
+  assertion2(holdsVertex(x,level) || level<=1,x,level);
+  assertion3(entry>=0 && entry<TWO_POWER_D,x,level,entry);
+  const HangingVertexKey key  = getKey(x,level);
+  const std::uint64_t    hash = getHash(key);
+  Shard& shard = getShard(hash);
+
+  tarch::multicore::Lock lock(shard.semaphore);
+  Slot& slot = findOrInsertSlot(shard,key,hash);
+  slot.identifier.lastUsedIteration             = _iteration;
+  slot.identifier.indicesOfAdjacentCells(entry) = cellIndex;
 }
 
 
 void multiscalelinkedcell::HangingVertexBookkeeper::beginIteration() {
-  for (
-    VertexMap::iterator p = _vertexMap.begin();
-    p != _vertexMap.end();
-    p++
-  ) {
-    p->second.usedInLastTraversal = false;
-  }
+  _iteration++;
 }
 
 
 void multiscalelinkedcell::HangingVertexBookkeeper::endIteration() {
-  for (
-    VertexMap::iterator p = _vertexMap.begin();
-    p != _vertexMap.end();
-  ) {
-    if (p->second.usedInLastTraversal==false) {
-      #ifdef CompilerDoesNotSupportC11ContainerErase
-      VertexMap::iterator pCopy(p);
-      p--;
-      _vertexMap.erase(pCopy);
-      p++;
-      #else
-      p = _vertexMap.erase(p);
-      #endif
-    }
-    else {
-      p++;
-    }
+  int removedVertices = 0;
+  for (int shard=0; shard<NumberOfShards; shard++) {
+    tarch::multicore::Lock lock(_shards[shard].semaphore);
+    removedVertices += removeSlots(
+      _shards[shard],
+      [this](const HangingVertexIdentifier& identifier) -> bool {
+        return identifier.lastUsedIteration!=_iteration;
+      }
+    );
   }
+  logDebug( "endIteration()", "removed " << removedVertices << " hanging vertices that have not been used in this traversal" );
 }
 
 
 void multiscalelinkedcell::HangingVertexBookkeeper::destroyCell(int cellIndex) {
-  for (
-    VertexMap::iterator p = _vertexMap.begin();
-    p != _vertexMap.end();
-  ) {
+  for (int shard=0; shard<NumberOfShards; shard++) {
+    tarch::multicore::Lock lock(_shards[shard].semaphore);
     bool refersToDeletedCell = false;
-    for (int i=0; i<TWO_POWER_D; i++) {
-      refersToDeletedCell |= p->second.indicesOfAdjacentCells(i)==cellIndex;
+    for (const Slot& slot : _shards[shard].slots) {
+      refersToDeletedCell |= slot.occupied && tarch::la::oneEquals(slot.identifier.indicesOfAdjacentCells,cellIndex);
     }
     if (refersToDeletedCell) {
-      #ifdef CompilerDoesNotSupportC11ContainerErase
-      VertexMap::iterator pCopy(p);
-      p--;
-      _vertexMap.erase(pCopy);
-      p++;
-      #else
-      p = _vertexMap.erase(p);
-      #endif
-    }
-    else {
-      p++;
+      removeSlots(
+        _shards[shard],
+        [cellIndex](const HangingVertexIdentifier& identifier) -> bool {
+          return tarch::la::oneEquals(identifier.indicesOfAdjacentCells,cellIndex);
+        }
+      );
     }
   }
 }
@@ -329,17 +505,15 @@ tarch::la::Vector<TWO_POWER_D,int> multiscalelinkedcell::HangingVertexBookkeeper
   const tarch::la::Vector<DIMENSIONS,int>&                     fineGridPositionOfVertex,
   const tarch::la::Vector<TWO_POWER_D_TIMES_TWO_POWER_D,int>&  coarseGridAdjacencyEntries
 ) {
-  const tarch::la::Vector<DIMENSIONS+1, double> key = getKey(x,level);
+  logTraceInWith4Arguments( "createHangingVertex(...)",x,level,fineGridPositionOfVertex,coarseGridAdjacencyEntries);
 
-  logTraceInWith6Arguments( "createHangingVertex(...)",x,level,fineGridPositionOfVertex,coarseGridAdjacencyEntries,key,_vertexMap.count(key));
-
-  if (_vertexMap.count(key)==0) {
-    HangingVertexIdentifier   newHangingVertexIdentifier;
-    newHangingVertexIdentifier.indicesOfAdjacentCells = createVertexLinkMapForNewVertex();
-    newHangingVertexIdentifier.usedInLastTraversal    = false;
-    _vertexMap.insert( std::pair<tarch::la::Vector<DIMENSIONS+1,double >, HangingVertexIdentifier>(key,newHangingVertexIdentifier) );
-  }
+  const HangingVertexKey key  = getKey(x,level);
+  const std::uint64_t    hash = getHash(key);
+  Shard& shard = getShard(hash);
 
+  tarch::multicore::Lock lock(shard.semaphore);
+  tarch::la::Vector<TWO_POWER_D,int>& indicesOfAdjacentCells =
+      findOrInsertSlot(shard,key,hash).identifier.indicesOfAdjacentCells;
 
   tarch::la::Vector<DIMENSIONS,int>   fromCoarseGridVertex;
   tarch::la::Vector<DIMENSIONS,int>   coarseGridVertexAdjacentCellDescriptionIndex;
@@ -365,9 +539,9 @@ tarch::la::Vector<TWO_POWER_D,int> multiscalelinkedcell::HangingVertexBookkeeper
     }
 
     if (
-      (_vertexMap[key].indicesOfAdjacentCells(kScalar)==InvalidAdjacencyIndex)
+      (indicesOfAdjacentCells(kScalar)==InvalidAdjacencyIndex)
       ||
-      (_vertexMap[key].indicesOfAdjacentCells(kScalar)==DomainBoundaryAdjacencyIndex)
+      (indicesOfAdjacentCells(kScalar)==DomainBoundaryAdjacencyIndex)
      ) {
       int index = coarseGridAdjacencyEntries(
           peano::utils::dLinearised(fromCoarseGridVertex,2) * TWO_POWER_D +
@@ -383,13 +557,15 @@ tarch::la::Vector<TWO_POWER_D,int> multiscalelinkedcell::HangingVertexBookkeeper
         index = InvalidAdjacencyIndex;
       }
 
-      _vertexMap[key].indicesOfAdjacentCells(kScalar) = index;
+      indicesOfAdjacentCells(kScalar) = index;
     }
   enddforx
 
-  logTraceOutWith2Arguments( "createHangingVertex(...)",_vertexMap[key].indicesOfAdjacentCells,_vertexMap[key].usedInLastTraversal);
+  const tarch::la::Vector<TWO_POWER_D,int> result = indicesOfAdjacentCells;
+  lock.free();
 
-  return _vertexMap[key].indicesOfAdjacentCells;
+  logTraceOutWith1Argument( "createHangingVertex(...)",result);
+  return result;
 }
 
 
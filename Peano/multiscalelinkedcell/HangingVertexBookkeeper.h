@@ -7,14 +7,13 @@
 #include "tarch/logging/Log.h"
 
 #include "tarch/la/Vector.h"
-#include "tarch/la/VectorCompare.h"
+#include "tarch/multicore/BooleanSemaphore.h"
 
 #include "peano/utils/Globals.h"
 #include "peano/grid/VertexEnumerator.h"
 
-#include <map>
-
-#define CompilerDoesNotSupportC11ContainerErase
+#include <cstdint>
+#include <vector>
 
 namespace multiscalelinkedcell {
   class HangingVertexBookkeeper;
@@ -83,7 +82,17 @@ namespace multiscalelinkedcell {
  * disableInheritingOfCoarseGridIndices()
  * \endcode
  *
-
+ * !!! Data structure
+ *
+ * Hanging vertices are identified by their level and their integer
+ * coordinates on a lattice that is aligned with the bounding box (see
+ * setBoundingBox() and getKey()). The identifiers are held by
+ * NumberOfShards open addressing hash tables with linear probing. Each
+ * shard is protected by its own semaphore, i.e. threads only contend if
+ * they access vertices that are hashed onto the same shard. Entries are
+ * never removed one by one but only by the sweeps in endIteration() and
+ * destroyCell() which compact a shard in place. The memory of the tables
+ * thus is reused from one iteration to the next.
  *
  * @author Kristof Unterweger, Tobias Weinzierl, Dominic Etienne Charrier
  */
@@ -91,24 +100,136 @@ class multiscalelinkedcell::HangingVertexBookkeeper {
   private:
     static tarch::logging::Log  _log;
 
+    /**
+     * Number of independent hash tables. Has to be a power of two.
+     */
+    static constexpr int NumberOfShards = 64;
+
+    /**
+     * Number of bits of the hash which select the shard.
+     */
+    static constexpr int ShardBits = 6;
+
+    /**
+     * Each shard starts with this many slots. Has to be a power of two.
+     */
+    static constexpr int InitialNumberOfSlotsPerShard = 16;
+
+    /**
+     * Each mesh width is subdivided by this factor before we round a
+     * coordinate onto the lattice. Vertex positions of the bounding box's
+     * grid hence map onto multiples of LatticeRefinement, i.e. they are
+     * far away from any rounding boundary.
+     */
+    static constexpr int LatticeRefinement = 1024;
+
+    /**
+     * Finest level whose lattice coordinates fit into 64 bit integers.
+     */
+    static constexpr int MaxLevel = 30;
+
+    struct HangingVertexKey {
+      int           level;
+      std::int64_t  coordinates[DIMENSIONS];
+
+      bool operator==(const HangingVertexKey& other) const;
+    };
+
     struct HangingVertexIdentifier {
       tarch::la::Vector<TWO_POWER_D,int>  indicesOfAdjacentCells;
-      bool                                usedInLastTraversal;
+      /**
+       * Iteration in which the vertex has been used the last time. The
+       * vertex is used in this traversal if this entry equals _iteration.
+       * This way, beginIteration() does not have to touch any entry.
+       */
+      int                                 lastUsedIteration;
+    };
+
+    struct Slot {
+      HangingVertexKey         key;
+      HangingVertexIdentifier  identifier;
+      bool                     occupied;
     };
 
-    typedef std::map< tarch::la::Vector<DIMENSIONS+1,double >, HangingVertexIdentifier, tarch::la::VectorCompare<DIMENSIONS+1> >  VertexMap;
+    struct Shard {
+      /**
+       * Open addressing hash table. Its size is a power of two.
+       */
+      std::vector<Slot>                   slots;
+      int                                 numberOfOccupiedSlots;
+      /**
+       * Scratch buffer for the compaction in removeSlots().
+       */
+      std::vector<Slot>                   survivors;
+      tarch::multicore::BooleanSemaphore  semaphore;
+    };
 
     bool _inheritIndicesFromCoarserGrids;
 
-    VertexMap _vertexMap;
+    tarch::la::Vector<DIMENSIONS,double>               _boundingBoxOffset;
+
+    /**
+     * Scaling from a coordinate relative to the bounding box offset onto
+     * the lattice per level.
+     */
+    std::vector<tarch::la::Vector<DIMENSIONS,double>>  _latticeScaling;
+
+    int _iteration;
+
+    mutable Shard _shards[NumberOfShards];
 
     HangingVertexBookkeeper();
 
-    tarch::la::Vector<DIMENSIONS+1,double > getKey(
+    /**
+     * Maps a vertex position onto the lattice of its level. The lattice of
+     * level l has LatticeRefinement*3^(l-1) points per bounding box width
+     * and coordinate axis. Level 1 is the bounding box itself.
+     */
+    HangingVertexKey getKey(
       const tarch::la::Vector<DIMENSIONS,double>&  x,
       int                                          level
     ) const;
 
+    static std::uint64_t getHash(const HangingVertexKey& key);
+
+    Shard& getShard(std::uint64_t hash) const;
+
+    /**
+     * Returns the slot holding key or nullptr. The caller has to hold the
+     * shard's semaphore.
+     */
+    static Slot* findSlot(Shard& shard, const HangingVertexKey& key, std::uint64_t hash);
+
+    /**
+     * Returns the slot holding key. If there is none yet, we insert an entry
+     * with invalid adjacency information which is not marked as used. The
+     * caller has to hold the shard's semaphore.
+     *
+     * Inserting may rehash the shard and thus invalidates all references to
+     * the shard's slots.
+     */
+    Slot& findOrInsertSlot(Shard& shard, const HangingVertexKey& key, std::uint64_t hash);
+
+    /**
+     * Doubles the number of slots of a shard and reinserts all entries.
+     */
+    static void grow(Shard& shard);
+
+    /**
+     * Removes all entries for which predicate returns true and compacts the
+     * shard. The number of slots remains the same. The caller has to hold the
+     * shard's semaphore.
+     *
+     * @return Number of removed entries
+     */
+    template <typename Predicate>
+    static int removeSlots(Shard& shard, Predicate predicate);
+
+    /**
+     * Inserts an entry which is known not to be contained in the shard yet.
+     */
+    static void insertWithoutLookup(Shard& shard, const Slot& slot);
+
   public:
     /**
      * Every index greater is valid
@@ -143,6 +264,19 @@ class multiscalelinkedcell::HangingVertexBookkeeper {
      */
     void disableInheritingOfCoarseGridIndices();
 
+    /**
+     * Tell the bookkeeper about the bounding box of the grid, i.e. about
+     * the cell on level 1. All vertex positions are mapped onto a lattice
+     * aligned with this box. The default is the unit cube.
+     *
+     * You have to call this operation before the first hanging vertex is
+     * created.
+     */
+    void setBoundingBox(
+      const tarch::la::Vector<DIMENSIONS,double>&  offset,
+      const tarch::la::Vector<DIMENSIONS,double>&  size
+    );
+
     /**
      * @see createBoundaryVertex
      * @see createInnerVertex
@@ -163,6 +297,10 @@ class multiscalelinkedcell::HangingVertexBookkeeper {
      * a marker on the result that it has been used. This hanging vertex hence
      * is not garbage collected.
      *
+     * The reference remains valid until the next hanging vertex is created.
+     * If several threads create or access hanging vertices concurrently, use
+     * setAdjacencyEntryOfVertex() instead.
+     *
      * @see enterCell, e.g.
      */
     tarch::la::Vector<TWO_POWER_D,int>& getAdjacencyEntriesOfVertex(
@@ -170,6 +308,19 @@ class multiscalelinkedcell::HangingVertexBookkeeper {
       int                                          level
     );
 
+    /**
+     * Thread-safe variant of
+     * \code
+     * getAdjacencyEntriesOfVertex(x,level)(entry) = cellIndex;
+     * \endcode
+     */
+    void setAdjacencyEntryOfVertex(
+      const tarch::la::Vector<DIMENSIONS,double>&  x,
+      int                                          level,
+      int                                          entry,
+      int                                          cellIndex
+    );
+
     bool holdsVertex(
       const tarch::la::Vector<DIMENSIONS,double>&  x,
       int                                          level
@@ -25,6 +25,7 @@ multiscalelinkedcell::tests::HangingVertexBookkeeperTest::~HangingVertexBookkeep
 
 void multiscalelinkedcell::tests::HangingVertexBookkeeperTest::run() {
   testMethod( test0 );
+  testMethod( testCreateLookupAndGarbageCollection );
 }
 
 
@@ -84,6 +85,92 @@ void multiscalelinkedcell::tests::HangingVertexBookkeeperTest::test0() {
 }
 
 
+void multiscalelinkedcell::tests::HangingVertexBookkeeperTest::testCreateLookupAndGarbageCollection() {
+  HangingVertexBookkeeper& bookkeeper = HangingVertexBookkeeper::getInstance();
+
+  // remove the vertices of the other tests
+  bookkeeper.beginIteration();
+  bookkeeper.endIteration();
+
+  const int    level         = 6;
+  const int    verticesPerAxis = 3*3*3*3*3+1;
+  const double h             = 1.0/(verticesPerAxis-1);
+  const int    coarseIndex   = 4711;
+
+  tarch::la::Vector<DIMENSIONS,int>                     fineGridPositionOfVertex(0);
+  tarch::la::Vector<TWO_POWER_D_TIMES_TWO_POWER_D,int>  adjacencyEntries(coarseIndex);
+
+  bookkeeper.beginIteration();
+  int numberOfVertices = 0;
+  for (int i=0; i<verticesPerAxis; i+=3) {
+    for (int j=0; j<verticesPerAxis; j+=5) {
+      tarch::la::Vector<DIMENSIONS,double> x(0.0);
+      x(0) = i*h;
+      x(1) = j*h;
+      bookkeeper.createHangingVertex(x,level,fineGridPositionOfVertex,adjacencyEntries);
+      numberOfVertices++;
+    }
+  }
+  validate( numberOfVertices>64*16 );
+
+  int numberOfFoundVertices = 0;
+  for (int i=0; i<verticesPerAxis; i++) {
+    for (int j=0; j<verticesPerAxis; j++) {
+      tarch::la::Vector<DIMENSIONS,double> x(0.0);
+      x(0) = i*h * (1.0+1e-13);
+      x(1) = j*h - 1e-14;
+      const bool expected = (i%3==0) && (j%5==0);
+      validateEqualsWithParams2( bookkeeper.holdsVertex(x,level), expected, i, j );
+      if (expected) {
+        numberOfFoundVertices++;
+        validateEqualsWithParams2( bookkeeper.usedVertexInThisTraversal(x,level), false, i, j );
+        validateEqualsWithParams2( bookkeeper.getAdjacencyEntriesOfVertex(x,level)(0), coarseIndex, i, j );
+        // the first half is used in this traversal, the second one is not
+        if (i<verticesPerAxis/2) {
+          bookkeeper.setAdjacencyEntryOfVertex(x,level,0,i*verticesPerAxis+j);
+        }
+      }
+      validateEqualsWithParams2( bookkeeper.holdsVertex(x,level+1), false, i, j );
+    }
+  }
+  validateEquals( numberOfFoundVertices, numberOfVertices );
+
+  // the vertices have all been accessed through getAdjacencyEntriesOfVertex
+  bookkeeper.endIteration();
+  bookkeeper.beginIteration();
+  for (int i=0; i<verticesPerAxis; i+=3) {
+    tarch::la::Vector<DIMENSIONS,double> x(0.0);
+    x(0) = i*h;
+    x(1) = 0.0;
+    validateWithParams1( bookkeeper.holdsVertex(x,level), i );
+    validateWithParams1( !bookkeeper.usedVertexInThisTraversal(x,level), i );
+    if (i<verticesPerAxis/2) {
+      bookkeeper.setAdjacencyEntryOfVertex(x,level,1,i);
+      validateWithParams1( bookkeeper.usedVertexInThisTraversal(x,level), i );
+    }
+  }
+  bookkeeper.endIteration();
+
+  for (int i=0; i<verticesPerAxis; i+=3) {
+    tarch::la::Vector<DIMENSIONS,double> x(0.0);
+    x(0) = i*h;
+    x(1) = 0.0;
+    validateEqualsWithParams1( bookkeeper.holdsVertex(x,level), i<verticesPerAxis/2, i );
+  }
+
+  tarch::la::Vector<DIMENSIONS,double> x(0.0);
+  validate( bookkeeper.holdsVertex(x,level) );
+  bookkeeper.destroyCell(0);
+  validate( !bookkeeper.holdsVertex(x,level) );
+  x(0) = 3*h;
+  validate( bookkeeper.holdsVertex(x,level) );
+
+  bookkeeper.beginIteration();
+  bookkeeper.endIteration();
+  validate( !bookkeeper.holdsVertex(x,level) );
+}
+
+
 
 #ifdef UseTestSpecificCompilerSettings
 #pragma optimize("",on)
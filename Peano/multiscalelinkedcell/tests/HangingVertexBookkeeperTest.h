@@ -21,6 +21,13 @@ class multiscalelinkedcell::tests::HangingVertexBookkeeperTest: public tarch::te
   private:
     void test0();
 
+    /**
+     * Creates more hanging vertices than fit into the initial hash tables,
+     * looks them up again through slightly perturbed coordinates and checks
+     * the garbage collection in endIteration() as well as destroyCell().
+     */
+    void testCreateLookupAndGarbageCollection();
+
   public: 
     HangingVertexBookkeeperTest();
     virtual ~HangingVertexBookkeeperTest();